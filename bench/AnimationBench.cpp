@@ -0,0 +1,159 @@
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+#include "Vectors.hpp"
+#include "Quaternions.hpp"
+#include "Matrices.hpp"
+#include "Streams.hpp"
+#include "Animation.hpp"
+#include "Bench.hpp"
+
+// A skeleton of 10k joints played at 60 Hz : 600 frames of a 2 s looping clip, sampled with nlerp and with slerp,
+// a second clip sampled and blended with the first, the blended pose converted to matrices, and as the baseline
+// the loop anyone would write by hand, a binary search then quat::slerp and vec3::lerp joint by joint.
+// The tracks have 61 keys (they don't fit in the caches), then 7 (they do)
+namespace
+{
+    using namespace glMath;
+
+    constexpr std::size_t jointCount = 10000;
+    constexpr int frames = 600;
+    constexpr float duration = 2.0f;
+
+    // The keys of one joint, kept to run the hand loop on them
+    struct jointTrack
+    {
+        std::vector<float> times;
+        std::vector<quat<float>> rotations;
+        std::vector<vec3<float>> translations;
+    };
+
+    // A clip whose joints turn around y from a random rotation, some keys flipped to -q to go through the shortest path
+    animationClip<float> makeClip(std::size_t keyCount, unsigned seed, std::vector<jointTrack>* tracks)
+    {
+        std::mt19937 random(seed);
+        std::uniform_real_distribution<float> dist(-1.0f, 1.0f);
+
+        animationClip<float> clip(duration);
+        clip.reserve(jointCount, keyCount);
+
+        std::vector<float> scaleTimes = { 0.0f, duration };
+        std::vector<vec3<float>> scales = { vec3<float>(1.0f), vec3<float>(2.0f) };
+
+        for (std::size_t j = 0; j < jointCount; j++)
+        {
+            jointTrack track;
+            track.times.resize(keyCount);
+            track.rotations.resize(keyCount);
+            track.translations.resize(keyCount);
+
+            quat<float> base = quat<float>(dist(random), dist(random), dist(random), dist(random)).normalize();
+
+            for (std::size_t k = 0; k < keyCount; k++)
+            {
+                track.times[k] = duration * static_cast<float>(k) / static_cast<float>(keyCount - 1);
+                track.rotations[k] = (base * quat<float>::fromAxisAngle(vec3<float>(0.0f, 1.0f, 0.0f), 3.0f * static_cast<float>(k) / static_cast<float>(keyCount))).normalize();
+                if (k % 3 == 0) track.rotations[k] = track.rotations[k] * -1.0f;
+                track.translations[k] = vec3<float>(dist(random), dist(random), dist(random));
+            }
+
+            clip.addJoint(track.times, track.rotations, track.times, track.translations, scaleTimes, scales);
+
+            if (tracks) tracks->push_back(std::move(track));
+        }
+
+        return clip;
+    }
+
+    double msBetween(std::chrono::steady_clock::time_point start, std::chrono::steady_clock::time_point end)
+    {
+        return std::chrono::duration<double, std::milli>(end - start).count();
+    }
+
+    void animationBench(std::size_t keyCount)
+    {
+        std::vector<jointTrack> tracks;
+        animationClip<float> clip = makeClip(keyCount, 3, &tracks);
+        animationClip<float> otherClip = makeClip(keyCount, 4, nullptr);
+
+        animationSampler<float> nlerpSampler(rotationInterpolation::nlerp);
+        animationSampler<float> slerpSampler(rotationInterpolation::slerp);
+        animationSampler<float> otherSampler(rotationInterpolation::nlerp);
+
+        animationPose<float> nlerpPose, slerpPose, otherPose, blended;
+        std::vector<mat4<float>> matrices(jointCount);
+        std::vector<quat<float>> handRotations(jointCount);
+        std::vector<vec3<float>> handTranslations(jointCount);
+
+        double nlerpMs = 0.0, slerpMs = 0.0, blendMs = 0.0, matrixMs = 0.0, handMs = 0.0;
+        double nlerpError = 0.0, slerpError = 0.0;
+
+        for (int f = 0; f < frames; f++)
+        {
+            float time = static_cast<float>(f) / 60.0f;
+
+            auto start = std::chrono::steady_clock::now();
+            nlerpSampler.sample(clip, time, nlerpPose);
+            auto sampled = std::chrono::steady_clock::now();
+            slerpSampler.sample(clip, time, slerpPose);
+            auto slerped = std::chrono::steady_clock::now();
+            otherSampler.sample(otherClip, time * 1.3f, otherPose);
+            animationPose<float>::blend(nlerpPose, otherPose, 0.3f, blended);
+            auto blendEnd = std::chrono::steady_clock::now();
+            blended.toMat4(matrices);
+            auto matrixEnd = std::chrono::steady_clock::now();
+
+            float wrapped = clip.wrapTime(time);
+            for (std::size_t j = 0; j < jointCount; j++)
+            {
+                const jointTrack& track = tracks[j];
+
+                std::size_t k = static_cast<std::size_t>(std::upper_bound(track.times.begin(), track.times.end(), wrapped) - track.times.begin());
+                k = k == 0 ? 0 : std::min(k - 1, keyCount - 2);
+                float t = std::clamp((wrapped - track.times[k]) / (track.times[k + 1] - track.times[k]), 0.0f, 1.0f);
+
+                handRotations[j] = quat<float>::slerp(track.rotations[k], track.rotations[k + 1], t);
+                handTranslations[j] = vec3<float>::lerp(track.translations[k], track.translations[k + 1], t);
+            }
+            auto handEnd = std::chrono::steady_clock::now();
+
+            bench::keep(matrices[0]);
+            bench::keep(handRotations[0]);
+
+            nlerpMs += msBetween(start, sampled);
+            slerpMs += msBetween(sampled, slerped);
+            blendMs += msBetween(slerped, blendEnd);
+            matrixMs += msBetween(blendEnd, matrixEnd);
+            handMs += msBetween(matrixEnd, handEnd);
+
+            // 1 - |cos| of the angle between the sampled rotations and quat::slerp's, and the distance between the translations
+            for (std::size_t j = 0; j < jointCount; j++)
+            {
+                double nlerpDot = std::abs(quat<float>::dotProduct(nlerpPose.rotations.get(j), handRotations[j]));
+                double slerpDot = std::abs(quat<float>::dotProduct(slerpPose.rotations.get(j), handRotations[j]));
+
+                nlerpError = std::max({ nlerpError, 1.0 - nlerpDot, static_cast<double>((nlerpPose.translations.get(j) - handTranslations[j]).length()) });
+                slerpError = std::max(slerpError, 1.0 - slerpDot);
+            }
+        }
+
+        std::printf("  %2zu keys : %.3f %.3f %.3f %.3f %.3f, error nlerp %.2g slerp %.2g\n", keyCount,
+            nlerpMs / frames, slerpMs / frames, blendMs / frames, matrixMs / frames, handMs / frames, nlerpError, slerpError);
+    }
+}
+
+int main()
+{
+    if (!glMath::bench::start("glMath animation benchmark")) return 0;
+
+    std::printf("  ms per frame, %zu joints : nlerp, slerp, 2nd clip + blend, toMat4, hand loop\n", jointCount);
+    animationBench(61);
+    animationBench(7);
+
+    return 0;
+}
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+
+#include "Dispatch.hpp"
+
+// The benchmarks are compiled once for AVX2 and once with GLMATH_FORCE_SCALAR (see bench/CMakeLists.txt) :
+// running both shows what the SIMD kernels gain over the scalar fallbacks, on the same machine
+namespace glMath::bench
+{
+    /// @brief Keeps the compiler from removing the computation of value, nothing using it
+    template<typename T>
+    inline void keep(const T& value)
+    {
+    #if defined(__GNUC__) || defined(__clang__)
+        asm volatile("" : : "g"(&value) : "memory");
+    #else
+        static const void* volatile sink;
+        sink = &value;
+        std::atomic_signal_fence(std::memory_order_seq_cst);
+    #endif
+    }
+
+    /// @brief The best time of repeats runs of run, in milliseconds, after one run to warm up the caches and the clock of the CPU.
+    /// The fastest run is the one the least disturbed by the rest of the system
+    template<typename Fn>
+    inline double bestMs(int repeats, Fn&& run)
+    {
+        double best = 1e300;
+        run();
+
+        for (int i = 0; i < repeats; i++)
+        {
+            auto start = std::chrono::steady_clock::now();
+            run();
+            auto end = std::chrono::steady_clock::now();
+
+            double ms = std::chrono::duration<double, std::milli>(end - start).count();
+            best = ms < best ? ms : best;
+        }
+
+        return best;
+    }
+
+    /// @brief The name of the instruction set the benchmark was compiled for
+    inline const char* buildName()
+    {
+    #if defined(GLMATH_FORCE_SCALAR)
+        return "scalar";
+    #elif defined(__AVX2__)
+        return "avx2";
+    #elif defined(__AVX__)
+        return "avx";
+    #else
+        return "sse2";
+    #endif
+    }
+
+    /// @brief Prints the name of the benchmark and of its build, or returns false (after saying why)
+    /// when the benchmark was built for an instruction set the CPU doesn't have
+    inline bool start(const char* name)
+    {
+    #if defined(__AVX2__) && !defined(GLMATH_FORCE_SCALAR)
+        if (dispatch::detectedLevel() < simdLevel::avx2)
+        {
+            std::printf("%s (%s) : skipped, the CPU doesn't support AVX2\n", name, buildName());
+            return false;
+        }
+    #endif
+
+        std::printf("%s (%s)\n", name, buildName());
+        return true;
+    }
+}
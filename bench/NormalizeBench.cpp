@@ -0,0 +1,111 @@
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+#include "Vectors.hpp"
+#include "Quaternions.hpp"
+#include "Streams.hpp"
+#include "Bench.hpp"
+
+// normalizeFast against the exact normalize : how far from unit length the results are, then the time of both
+// on 1024 vectors and quaternions renormalized again and again, as the bones of a skeleton are every frame
+namespace
+{
+    using namespace glMath;
+
+    constexpr std::size_t count = 1024;
+    constexpr int passes = 8000;
+    constexpr int repeats = 5;
+
+    // The length of a vector or a quaternion of floats, computed in double so its own rounding doesn't hide the error
+    double exactLength(const float* values, std::size_t size)
+    {
+        double lengthSq = 0.0;
+        for (std::size_t i = 0; i < size; i++) lengthSq += static_cast<double>(values[i]) * values[i];
+
+        return std::sqrt(lengthSq);
+    }
+
+    void accuracy()
+    {
+        // rsqrtFast on a geometric sweep from 1e-30 to 1e30, against 1 / sqrt in double
+        double rsqrtError = 0.0;
+        for (double value = 1e-30; value < 1e30; value *= 1.0001)
+        {
+            float x = static_cast<float>(value);
+            double exact = 1.0 / std::sqrt(static_cast<double>(x));
+
+            rsqrtError = std::max(rsqrtError, std::abs(rsqrtFast(x) - exact) / exact);
+        }
+
+        std::mt19937 random(1);
+        std::uniform_real_distribution<float> dist(-10.0f, 10.0f);
+
+        double vecLengthError[2] = {}, quatLengthError[2] = {};
+        for (int i = 0; i < (1 << 20); i++)
+        {
+            vec3<float> vec(dist(random), dist(random), dist(random));
+            vec3<float> exactVec = vec3<float>::normalized(vec);
+            vec3<float> fastVec = vec3<float>::normalizedFast(vec);
+
+            vecLengthError[0] = std::max(vecLengthError[0], std::abs(exactLength(&exactVec.x, 3) - 1.0));
+            vecLengthError[1] = std::max(vecLengthError[1], std::abs(exactLength(&fastVec.x, 3) - 1.0));
+
+            quat<float> rot(dist(random), dist(random), dist(random), dist(random));
+            quat<float> exactRot = rot.getNormalizedQuat();
+            quat<float> fastRot = rot;
+            fastRot.normalizeFast();
+
+            quatLengthError[0] = std::max(quatLengthError[0], std::abs(exactLength(exactRot.data, 4) - 1.0));
+            quatLengthError[1] = std::max(quatLengthError[1], std::abs(exactLength(fastRot.data, 4) - 1.0));
+        }
+
+        std::printf("  rsqrtFast relative error, 1e-30 to 1e30 : %.3g\n", rsqrtError);
+        std::printf("  | |v| - 1 | of 2^20 vec3 : normalize %.3g, normalizeFast %.3g\n", vecLengthError[0], vecLengthError[1]);
+        std::printf("  | |q| - 1 | of 2^20 quat : normalize %.3g, normalizeFast %.3g\n", quatLengthError[0], quatLengthError[1]);
+    }
+
+    void throughput()
+    {
+        std::mt19937 random(2);
+        std::uniform_real_distribution<float> dist(-1.0f, 1.0f);
+
+        std::vector<vec3<float>> vectors(count);
+        std::vector<quat<float>> quats(count);
+        for (std::size_t i = 0; i < count; i++)
+        {
+            vectors[i] = vec3<float>(dist(random), dist(random), dist(random));
+            quats[i] = quat<float>(dist(random), dist(random), dist(random), dist(random));
+        }
+        vec3Stream<float> stream{ std::span<const vec3<float>>(vectors) };
+
+        double vecExact = bench::bestMs(repeats, [&] { for (int p = 0; p < passes; p++) { for (auto& vec : vectors) vec.normalize(); bench::keep(vectors[0]); } });
+        double vecFast = bench::bestMs(repeats, [&] { for (int p = 0; p < passes; p++) { for (auto& vec : vectors) vec.normalizeFast(); bench::keep(vectors[0]); } });
+
+        double streamExact = bench::bestMs(repeats, [&] { for (int p = 0; p < passes; p++) { stream.normalize(); bench::keep(stream.xs()[0]); } });
+        double streamFast = bench::bestMs(repeats, [&] { for (int p = 0; p < passes; p++) { stream.normalizeFast(); bench::keep(stream.xs()[0]); } });
+
+        double quatExact = bench::bestMs(repeats, [&] { for (int p = 0; p < passes; p++) { for (auto& rot : quats) rot.normalize(); bench::keep(quats[0]); } });
+        double quatFast = bench::bestMs(repeats, [&] { for (int p = 0; p < passes; p++) { for (auto& rot : quats) rot.normalizeFast(); bench::keep(quats[0]); } });
+        double quatBatch = bench::bestMs(repeats, [&] { for (int p = 0; p < passes; p++) { quat<float>::normalizeFast(quats); bench::keep(quats[0]); } });
+
+        std::printf("  %zu items x %d passes, best of %d, in ms :\n", count, passes, repeats);
+        std::printf("  vec3 loop     : normalize %7.2f, normalizeFast %7.2f\n", vecExact, vecFast);
+        std::printf("  vec3Stream    : normalize %7.2f, normalizeFast %7.2f\n", streamExact, streamFast);
+        std::printf("  quat loop     : normalize %7.2f, normalizeFast %7.2f\n", quatExact, quatFast);
+        std::printf("  quat batched  : normalizeFast(span) %7.2f\n", quatBatch);
+    }
+}
+
+int main()
+{
+    if (!glMath::bench::start("glMath normalizeFast benchmark")) return 0;
+
+    accuracy();
+    throughput();
+
+    return 0;
+}
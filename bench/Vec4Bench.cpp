@@ -0,0 +1,145 @@
+#include <cstddef>
+#include <cstdio>
+#include <random>
+#include <type_traits>
+#include <vector>
+
+#include "Vectors.hpp"
+#include "Bench.hpp"
+
+// The vec4 dot products, distances and lerp, timed three ways for floats and doubles :
+// - the scalar code Vector4.inl had before the kernels, written again here
+// - vec4 itself, which uses the kernels where hasVec4DotKernel is true (vec4<float> with SSE2, vec4<double> with AVX)
+// - the kernels of SimdInternal.hpp called directly, whether vec4 uses them or not
+// vec4 only uses the kernels of the dot products and distances : the scalar lerp is vectorized as well by the compiler
+namespace
+{
+    using namespace glMath;
+
+    // 512 pairs of vectors fit in the L1 cache, 40000 passes make 20M calls
+    constexpr std::size_t count = 512;
+    constexpr int passes = 40000;
+    constexpr int repeats = 7;
+
+    template<FloatingNumber F>
+    struct scalarCode
+    {
+        static F dotProduct(const vec4<F>& a, const vec4<F>& b) { return (a.x * b.x) + (a.y * b.y) + (a.z * b.z) + (a.w * b.w); }
+        static F dotProduct3(const vec4<F>& a, const vec4<F>& b) { return (a.x * b.x) + (a.y * b.y) + (a.z * b.z); }
+        static F distanceSquared3(const vec4<F>& a, const vec4<F>& b)
+        {
+            return (b.x - a.x) * (b.x - a.x) + (b.y - a.y) * (b.y - a.y) + (b.z - a.z) * (b.z - a.z);
+        }
+        static vec4<F> lerp(const vec4<F>& a, const vec4<F>& b, F t)
+        {
+            return vec4<F>(a.x + (b.x - a.x) * t, a.y + (b.y - a.y) * t, a.z + (b.z - a.z) * t, a.w + (b.w - a.w) * t);
+        }
+    };
+
+    template<FloatingNumber F>
+    struct kernelCode
+    {
+        static F dotProduct(const vec4<F>& a, const vec4<F>& b) { return simd::vec4Dot(a.data, b.data); }
+        static F dotProduct3(const vec4<F>& a, const vec4<F>& b) { return simd::vec4Dot3(a.data, b.data); }
+        static F distanceSquared3(const vec4<F>& a, const vec4<F>& b) { return simd::vec4DistanceSquared3(a.data, b.data); }
+        static vec4<F> lerp(const vec4<F>& a, const vec4<F>& b, F t)
+        {
+            vec4<F> res;
+            auto start = simd::laneLoad<F, 4>(a.data);
+            simd::laneStore(res.data, simd::laneAdd(start, simd::laneMul(simd::laneSub(simd::laneLoad<F, 4>(b.data), start), simd::laneSet<F, 4>(t))));
+            return res;
+        }
+    };
+
+    // The best time of 20M calls of op, in ms. Either each result is stored, the calls being independent,
+    // or the results are summed, each call waiting for the previous addition like in a reduction
+    template<bool summed, typename R, typename F, typename Op>
+    double timeCalls(const std::vector<vec4<F>>& a, const std::vector<vec4<F>>& b, std::vector<R>& results, Op op)
+    {
+        return bench::bestMs(repeats, [&]
+        {
+            R sum{};
+            for (int p = 0; p < passes; p++)
+            {
+                if constexpr (summed)
+                {
+                    for (std::size_t i = 0; i < count; i++) sum += op(a[i], b[i]);
+                }
+                else
+                {
+                    for (std::size_t i = 0; i < count; i++) results[i] = op(a[i], b[i]);
+                    bench::keep(results[0]);
+                }
+            }
+            bench::keep(sum);
+        });
+    }
+
+    template<FloatingNumber F>
+    void vec4Bench(const char* typeName)
+    {
+        std::mt19937 random(1);
+        std::uniform_real_distribution<F> dist(static_cast<F>(-1.0), static_cast<F>(1.0));
+
+        std::vector<vec4<F>> a(count), b(count), vectors(count);
+        std::vector<F> scalars(count);
+        for (std::size_t i = 0; i < count; i++)
+        {
+            a[i] = vec4<F>(dist(random), dist(random), dist(random), dist(random));
+            b[i] = vec4<F>(dist(random), dist(random), dist(random), dist(random));
+        }
+
+        // The kernels only exist for the types with a 4 lanes register in this build, else their column is left empty
+        constexpr bool hasKernel = simd::hasLaneRegister<F, 4>;
+
+        // op(code, u, v) calls the function of scalarCode, vec4 or kernelCode. mode is stored or summed
+        constexpr std::false_type stored;
+        constexpr std::true_type summed;
+
+        auto row = [&](const char* name, auto mode, auto& results, auto op)
+        {
+            constexpr bool isSummed = decltype(mode)::value;
+
+            double scalar = timeCalls<isSummed>(a, b, results, [&](const vec4<F>& u, const vec4<F>& v) { return op(scalarCode<F>{}, u, v); });
+            double library = timeCalls<isSummed>(a, b, results, [&](const vec4<F>& u, const vec4<F>& v) { return op(vec4<F>{}, u, v); });
+
+            if constexpr (hasKernel)
+            {
+                double kernel = timeCalls<isSummed>(a, b, results, [&](const vec4<F>& u, const vec4<F>& v) { return op(kernelCode<F>{}, u, v); });
+                std::printf("  %-8s %-17s %-7s %9.1f %9.1f %9.1f\n", typeName, name, isSummed ? "summed" : "stored", scalar, library, kernel);
+            }
+            else
+            {
+                std::printf("  %-8s %-17s %-7s %9.1f %9.1f %9s\n", typeName, name, isSummed ? "summed" : "stored", scalar, library, "-");
+            }
+        };
+
+        auto dotProduct = [](auto code, const vec4<F>& u, const vec4<F>& v) { return decltype(code)::dotProduct(u, v); };
+        auto dotProduct3 = [](auto code, const vec4<F>& u, const vec4<F>& v) { return decltype(code)::dotProduct3(u, v); };
+        auto distanceSquared3 = [](auto code, const vec4<F>& u, const vec4<F>& v) { return decltype(code)::distanceSquared3(u, v); };
+        auto lerp = [](auto code, const vec4<F>& u, const vec4<F>& v)
+        {
+            if constexpr (std::is_same_v<decltype(code), vec4<F>>) return vec4<F>::lerpUnclamped(u, v, static_cast<F>(0.3));
+            else return decltype(code)::lerp(u, v, static_cast<F>(0.3));
+        };
+
+        row("dotProduct", stored, scalars, dotProduct);
+        row("dotProduct", summed, scalars, dotProduct);
+        row("dotProduct3", stored, scalars, dotProduct3);
+        row("dotProduct3", summed, scalars, dotProduct3);
+        row("distanceSquared3", stored, scalars, distanceSquared3);
+        row("distanceSquared3", summed, scalars, distanceSquared3);
+        row("lerp", stored, vectors, lerp);
+    }
+}
+
+int main()
+{
+    if (!glMath::bench::start("glMath vec4 benchmark")) return 0;
+
+    std::printf("  20M calls, best of %d, in ms          scalar      vec4    kernel\n", repeats);
+    vec4Bench<float>("float");
+    vec4Bench<double>("double");
+
+    return 0;
+}
@@ -0,0 +1,22 @@
+#pragma once
+
+#include "Math\Animation\AnimationClip.hpp"
+#include "Math\Animation\AnimationPose.hpp"
+#include "Math\Animation\AnimationSampler.hpp"
+
+// using namespace glMath;
+
+/// @brief shorthand for writing animationClip<float>
+using animationClipf = glMath::animationClip<float>;
+/// @brief shorthand for writing animationClip<double>
+using animationClipd = glMath::animationClip<double>;
+
+/// @brief shorthand for writing animationPose<float>
+using animationPosef = glMath::animationPose<float>;
+/// @brief shorthand for writing animationPose<double>
+using animationPosed = glMath::animationPose<double>;
+
+/// @brief shorthand for writing animationSampler<float>
+using animationSamplerf = glMath::animationSampler<float>;
+/// @brief shorthand for writing animationSampler<double>
+using animationSamplerd = glMath::animationSampler<double>;
@@ -0,0 +1,5 @@
+#pragma once
+
+#include "Math\Dispatch\Dispatch.hpp"
+
+// using namespace glMath;
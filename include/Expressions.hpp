@@ -0,0 +1,8 @@
+#pragma once
+
+#include "Math\Expressions\LazyExpressions.hpp"
+
+// Nothing here is used by the rest of the library, including this header is what opts in :
+// glMath::expr::lazy(proj) * view * model * point, or vec3f r = glMath::expr::lazy(a) + glMath::expr::lazy(b) * 2.0f - c;
+// A vector times a scalar is a node only if the vector went through lazy() : in lazy(a) + b * 2.0f - c, 
+// b * 2.0f is the eager operator of vec3, evaluated first into a temporary vector
@@ -0,0 +1,6 @@
+#pragma once
+
+#include "Math\FastMath\FastMath.hpp"
+#include "Math\Lanes\Lanes.hpp"
+
+// using namespace glMath;
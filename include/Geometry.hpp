@@ -0,0 +1,10 @@
+#pragma once
+
+#include "Math\Geometry\Frustum.hpp"
+
+// using namespace glMath;
+
+/// @brief shorthand for writing frustum<float>
+using frustumf = glMath::frustum<float>;
+/// @brief shorthand for writing frustum<double>
+using frustumd = glMath::frustum<double>;
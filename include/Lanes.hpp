@@ -0,0 +1,14 @@
+#pragma once
+
+#include "Math\Lanes\Lanes.hpp"
+
+// using namespace glMath;
+
+/// @brief shorthand for writing lanes<float, 4>, 4 floats processed at once (SSE)
+using lanes4f = glMath::float4;
+/// @brief shorthand for writing lanes<float, 8>, 8 floats processed at once (AVX)
+using lanes8f = glMath::float8;
+/// @brief shorthand for writing lanes<double, 2>, 2 doubles processed at once (SSE2)
+using lanes2d = glMath::double2;
+/// @brief shorthand for writing lanes<double, 4>, 4 doubles processed at once (AVX)
+using lanes4d = glMath::double4;
@@ -0,0 +1,85 @@
+#pragma once
+
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "Math\Concepts.hpp"
+#include "Math\Vectors\Vector3.hpp"
+#include "Math\Quaternions\Quaternion.hpp"
+
+namespace glMath
+{
+    /// @brief The keys of one channel (rotation, translation or scale) of every joint of a clip, stored as structure-of-arrays by joint :
+    /// the times and the values in two arrays, the keys of the joint j being at the indices starts[j] to starts[j + 1] - 1 of both,
+    /// in increasing time order. The values stay whole (a quat, a vec3), since a sample reads two neighbouring keys of each joint
+    //
+    // times  : joint 0 : t0 t1 t2 | joint 1 : t0 t1 | ...
+    // keys   : joint 0 : k0 k1 k2 | joint 1 : k0 k1 | ...
+    // starts : 0 3 5 ...
+    //
+    /// @tparam F The type of the times, a float or a double
+    /// @tparam Key quat<F> for the rotations, vec3<F> for the translations and scales
+    template<FloatingNumber F, typename Key>
+    struct animationChannel
+    {
+    public:
+        std::vector<F> times;
+        std::vector<Key> keys;
+        std::vector<std::uint32_t> starts = { 0 };
+
+    public:
+        inline std::size_t jointCount() const { return starts.size() - 1; };
+        inline std::size_t keyCount(std::size_t joint) const { return starts[joint + 1] - starts[joint]; };
+    };
+
+    /// @brief A keyframe animation of a skeleton : for each joint, a track of rotation keys, one of translation keys and one of scale keys,
+    /// each with its own times. The tracks are stored joint after joint (see animationChannel), so sampling every joint
+    /// reads each channel forward, and it is sampled by an animationSampler, which remembers where it was in every track
+    /// @tparam F The type of the times and of the values of the keys, a FloatingNumber, so a float or a double
+    template<FloatingNumber F>
+    struct animationClip
+    {
+    private:
+        animationChannel<F, quat<F>> rotationChannel;
+        animationChannel<F, vec3<F>> translationChannel;
+        animationChannel<F, vec3<F>> scaleChannel;
+
+        F clipDuration;
+        bool loops;
+
+    public:
+        /// @param duration The length of the clip, in the unit of the times of the keys (seconds...)
+        /// @param looping If true, the sampling times wrap around duration, else they are clamped between 0 and duration
+        explicit animationClip(F duration, bool looping = true);
+
+        /// @brief Reserves the memory for jointCount joints and keyCount keys per channel, to avoid reallocations while adding them
+        void reserve(std::size_t jointCount, std::size_t keyCount);
+
+        /// @brief A function to add the tracks of the next joint. Every track needs at least one key,
+        /// a track of one key being constant. The keys are copied
+        /// @param rotationTimes The times of the rotation keys, in increasing order, as big as rotations
+        /// @param rotations The rotation keys, must be normalized
+        /// @param translationTimes The times of the translation keys, in increasing order, as big as translations
+        /// @param scaleTimes The times of the scale keys, in increasing order, as big as scales
+        /// @return The index of the joint
+        std::size_t addJoint(std::span<const F> rotationTimes, std::span<const quat<F>> rotations,
+                             std::span<const F> translationTimes, std::span<const vec3<F>> translations,
+                             std::span<const F> scaleTimes, std::span<const vec3<F>> scales);
+
+        inline std::size_t jointCount() const { return rotationChannel.jointCount(); };
+        inline F duration() const { return clipDuration; };
+        inline bool isLooping() const { return loops; };
+
+        inline const animationChannel<F, quat<F>>& rotations() const { return rotationChannel; };
+        inline const animationChannel<F, vec3<F>>& translations() const { return translationChannel; };
+        inline const animationChannel<F, vec3<F>>& scales() const { return scaleChannel; };
+
+        /// @brief A function to bring a time inside the clip : wrapped around duration() if it loops, else clamped between 0 and duration()
+        F wrapTime(F time) const;
+    };
+}
+
+#include "Math\Animation\AnimationClip.inl"
@@ -0,0 +1,84 @@
+#include <concepts>
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+
+#include "Math\MathInternal.hpp"
+
+namespace glMath
+{
+    #pragma region Constructors
+
+    template<FloatingNumber F>
+    inline animationClip<F>::animationClip(F duration, bool looping)
+        : clipDuration(duration), loops(looping)
+    {
+        assert(duration > static_cast<F>(0.0));
+    }
+
+    #pragma endregion
+
+    #pragma region Tracks
+
+    template<FloatingNumber F>
+    inline void animationClip<F>::reserve(std::size_t jointCount, std::size_t keyCount)
+    {
+        rotationChannel.starts.reserve(jointCount + 1);
+        translationChannel.starts.reserve(jointCount + 1);
+        scaleChannel.starts.reserve(jointCount + 1);
+
+        rotationChannel.times.reserve(jointCount * keyCount);
+        translationChannel.times.reserve(jointCount * keyCount);
+        scaleChannel.times.reserve(jointCount * keyCount);
+
+        rotationChannel.keys.reserve(jointCount * keyCount);
+        translationChannel.keys.reserve(jointCount * keyCount);
+        scaleChannel.keys.reserve(jointCount * keyCount);
+    }
+
+    template<FloatingNumber F>
+    inline std::size_t animationClip<F>::addJoint(std::span<const F> rotationTimes, std::span<const quat<F>> rotations,
+                                                  std::span<const F> translationTimes, std::span<const vec3<F>> translations,
+                                                  std::span<const F> scaleTimes, std::span<const vec3<F>> scales)
+    {
+        assert(!rotations.empty() && rotationTimes.size() == rotations.size());
+        assert(!translations.empty() && translationTimes.size() == translations.size());
+        assert(!scales.empty() && scaleTimes.size() == scales.size());
+
+        // The samplers rely on it to find the keys
+        assert(std::is_sorted(rotationTimes.begin(), rotationTimes.end()));
+        assert(std::is_sorted(translationTimes.begin(), translationTimes.end()));
+        assert(std::is_sorted(scaleTimes.begin(), scaleTimes.end()));
+
+        std::size_t joint = jointCount();
+
+        rotationChannel.times.insert(rotationChannel.times.end(), rotationTimes.begin(), rotationTimes.end());
+        rotationChannel.keys.insert(rotationChannel.keys.end(), rotations.begin(), rotations.end());
+        rotationChannel.starts.push_back(static_cast<std::uint32_t>(rotationChannel.times.size()));
+
+        translationChannel.times.insert(translationChannel.times.end(), translationTimes.begin(), translationTimes.end());
+        translationChannel.keys.insert(translationChannel.keys.end(), translations.begin(), translations.end());
+        translationChannel.starts.push_back(static_cast<std::uint32_t>(translationChannel.times.size()));
+
+        scaleChannel.times.insert(scaleChannel.times.end(), scaleTimes.begin(), scaleTimes.end());
+        scaleChannel.keys.insert(scaleChannel.keys.end(), scales.begin(), scales.end());
+        scaleChannel.starts.push_back(static_cast<std::uint32_t>(scaleChannel.times.size()));
+
+        return joint;
+    }
+
+    #pragma endregion
+
+    #pragma region Time
+
+    template<FloatingNumber F>
+    inline F animationClip<F>::wrapTime(F time) const
+    {
+        if (!loops) return glMath::clamp(time, static_cast<F>(0.0), clipDuration);
+
+        F wrapped = std::fmod(time, clipDuration);
+        return wrapped < static_cast<F>(0.0) ? wrapped + clipDuration : wrapped;
+    }
+
+    #pragma endregion
+}
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <concepts>
+#include <cstddef>
+#include <span>
+
+#include "Math\Concepts.hpp"
+#include "Math\Matrices\Matrix3x4.hpp"
+#include "Math\Matrices\Matrix4x4.hpp"
+#include "Math\Streams\VectorStream.hpp"
+#include "Math\Streams\QuaternionStream.hpp"
+
+namespace glMath
+{
+    /// @brief The local transforms of every joint of a skeleton, as written by an animationSampler, stored as structure-of-arrays by joint.
+    /// Poses are mixed by blend(), and converted to the local matrices of the joints in one batch by toMat4() or toMat3x4()
+    /// @tparam F The type of the values stored in the transforms, a FloatingNumber, so a float or a double
+    template<FloatingNumber F>
+    struct animationPose
+    {
+    public:
+        quatStream<F> rotations;
+        vec3Stream<F> translations;
+        vec3Stream<F> scales;
+
+    public:
+        animationPose() = default;
+        /// @brief A pose of jointCount joints, all at the identity
+        explicit animationPose(std::size_t jointCount);
+
+        /// @brief Resizes the pose, the new joints being at the identity
+        void resize(std::size_t jointCount);
+
+        inline std::size_t size() const { return rotations.size(); };
+
+        /// @brief A function to mix two poses, joint by joint : a weight of 0 gives a, 1 gives b.
+        /// The rotations are interpolated with nlerp, the translations and scales linearly
+        /// @param results Where the pose is written, resized to the size of a. It can be a or b
+        static void blend(const animationPose& a, const animationPose& b, F weight, animationPose& results);
+        /// @brief A function to mix any number of poses (clips playing at the same time, cross-fades...), joint by joint.
+        /// The weights don't need to add up to 1, they are divided by their sum. The rotations are added on the side of
+        /// the first pose's rotation, then normalized (a weighted nlerp), the translations and scales are averaged
+        /// @param poses The poses to mix, all of the same size
+        /// @param weights The weight of each pose, as big as poses, their sum must not be 0
+        /// @param results Where the pose is written, resized to the size of the poses. It can't be one of the poses
+        static void blend(std::span<const animationPose* const> poses, std::span<const F> weights, animationPose& results);
+
+        /// @brief A function to get the local matrix of every joint, translate * rotation * scale, with quatStream::toMat4()
+        /// @param results Where the matrices are written, at least as big as the pose
+        void toMat4(std::span<mat4<F>> results) const;
+        /// @brief Like toMat4(), to 3x4 matrices
+        void toMat3x4(std::span<mat3x4<F>> results) const;
+    };
+}
+
+#include "Math\Animation\AnimationPose.inl"
@@ -0,0 +1,140 @@
+#include <concepts>
+#include <cassert>
+
+#include "Math\MathInternal.hpp"
+
+namespace glMath
+{
+    #pragma region Constructors
+
+    template<FloatingNumber F>
+    inline animationPose<F>::animationPose(std::size_t jointCount)
+    {
+        resize(jointCount);
+    }
+
+    template<FloatingNumber F>
+    inline void animationPose<F>::resize(std::size_t jointCount)
+    {
+        std::size_t oldCount = size();
+
+        rotations.resize(jointCount);
+        translations.resize(jointCount);
+        scales.resize(jointCount);
+
+        for (std::size_t c = 0; c < 3; c++)
+        {
+            std::span<F> comp = scales.component(c);
+            for (std::size_t i = oldCount; i < jointCount; i++) comp[i] = static_cast<F>(1.0);
+        }
+    }
+
+    #pragma endregion
+
+    #pragma region Blending
+
+    template<FloatingNumber F>
+    inline void animationPose<F>::blend(const animationPose<F>& a, const animationPose<F>& b, F weight, animationPose<F>& results)
+    {
+        assert(b.size() >= a.size());
+
+        quatStream<F>::nlerp(a.rotations, b.rotations, weight, results.rotations);
+        vec3Stream<F>::lerpUnclamped(a.translations, b.translations, weight, results.translations);
+        vec3Stream<F>::lerpUnclamped(a.scales, b.scales, weight, results.scales);
+    }
+
+    template<FloatingNumber F>
+    inline void animationPose<F>::blend(std::span<const animationPose<F>* const> poses, std::span<const F> weights, animationPose<F>& results)
+    {
+        assert(!poses.empty() && weights.size() >= poses.size());
+
+        std::size_t count = poses[0]->size();
+
+        F weightSum = static_cast<F>(0.0);
+        for (std::size_t p = 0; p < poses.size(); p++) weightSum += weights[p];
+
+        assert(weightSum != static_cast<F>(0.0));
+
+        results.resize(count);
+
+        // Each component array is accumulated on its own, pose after pose, so every loop reads and writes whole arrays
+        for (std::size_t c = 0; c < 3; c++)
+        {
+            F* outT = results.translations.component(c).data();
+            F* outS = results.scales.component(c).data();
+
+            for (std::size_t p = 0; p < poses.size(); p++)
+            {
+                assert(poses[p] != &results && poses[p]->size() >= count);
+
+                const F* inT = poses[p]->translations.component(c).data();
+                const F* inS = poses[p]->scales.component(c).data();
+                F w = weights[p] / weightSum;
+
+                if (p == 0)
+                {
+                    for (std::size_t i = 0; i < count; i++) { outT[i] = inT[i] * w; outS[i] = inS[i] * w; }
+                }
+                else
+                {
+                    for (std::size_t i = 0; i < count; i++) { outT[i] += inT[i] * w; outS[i] += inS[i] * w; }
+                }
+            }
+        }
+
+        // The rotations are added on the side of the first pose's one, so a quaternion and its opposite (the same rotation)
+        // don't cancel out, then normalized
+        const F* first[4];
+        F* out[4];
+        for (std::size_t c = 0; c < 4; c++)
+        {
+            first[c] = poses[0]->rotations.component(c).data();
+            out[c] = results.rotations.component(c).data();
+        }
+
+        F w0 = weights[0] / weightSum;
+        for (std::size_t c = 0; c < 4; c++)
+        {
+            for (std::size_t i = 0; i < count; i++) out[c][i] = first[c][i] * w0;
+        }
+
+        for (std::size_t p = 1; p < poses.size(); p++)
+        {
+            const F* in[4];
+            for (std::size_t c = 0; c < 4; c++) in[c] = poses[p]->rotations.component(c).data();
+
+            F w = weights[p] / weightSum;
+
+            for (std::size_t i = 0; i < count; i++)
+            {
+                F dot = first[0][i] * in[0][i] + first[1][i] * in[1][i] + first[2][i] * in[2][i] + first[3][i] * in[3][i];
+                F signedW = dot < static_cast<F>(0.0) ? -w : w;
+
+                out[0][i] += in[0][i] * signedW;
+                out[1][i] += in[1][i] * signedW;
+                out[2][i] += in[2][i] * signedW;
+                out[3][i] += in[3][i] * signedW;
+            }
+        }
+
+        results.rotations.normalize();
+    }
+
+    #pragma endregion
+
+    #pragma region Conversions
+
+    template<FloatingNumber F>
+    inline void animationPose<F>::toMat4(std::span<mat4<F>> results) const
+    {
+        rotations.toMat4(translations, scales, results);
+    }
+
+    template<FloatingNumber F>
+    inline void animationPose<F>::toMat3x4(std::span<mat3x4<F>> results) const
+    {
+        rotations.toMat3x4(translations, scales, results);
+    }
+
+    #pragma endregion
+}
@@ -0,0 +1,66 @@
+#pragma once
+
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "Math\Concepts.hpp"
+#include "Math\Streams\VectorStream.hpp"
+#include "Math\Streams\QuaternionStream.hpp"
+#include "Math\Animation\AnimationClip.hpp"
+#include "Math\Animation\AnimationPose.hpp"
+
+namespace glMath
+{
+    /// @brief How the rotations are interpolated between two keys : nlerp (normalized linear interpolation, the cheapest,
+    /// its speed varies a bit between keys far apart) or slerp (constant speed, with the polynomial weights of polynomialMath)
+    enum class rotationInterpolation
+    {
+        nlerp,
+        slerp
+    };
+
+    /// @brief The playback state of one clip on one skeleton : it samples every joint of the clip at a time, into an animationPose.
+    /// It keeps, for each track, the key it was at the last time, so when the time moves forward by a frame the keys are found
+    /// in one or two steps instead of a binary search. The rotations are interpolated in one batch (quatStream::nlerp() or slerp())
+    /// @tparam F The type of the times and of the values of the keys, a FloatingNumber, so a float or a double
+    template<FloatingNumber F>
+    struct animationSampler
+    {
+    private:
+        // The index of the current key of each track, relative to the first key of its joint
+        std::vector<std::uint32_t> rotationCursors;
+        std::vector<std::uint32_t> translationCursors;
+        std::vector<std::uint32_t> scaleCursors;
+
+        // The two keys around the time of every joint, and the interpolation factors, before the batched interpolation
+        quatStream<F> rotationStarts;
+        quatStream<F> rotationEnds;
+        std::vector<F> rotationFactors;
+
+    public:
+        rotationInterpolation interpolation = rotationInterpolation::nlerp;
+
+    public:
+        animationSampler() = default;
+        explicit animationSampler(rotationInterpolation rotationMode);
+
+        /// @brief Puts every cursor back on the first key, the next sample() starts its searches from the beginning of the tracks
+        void reset();
+
+        /// @brief A function to sample every joint of a clip
+        /// @param time The time in the clip, wrapped or clamped by clip.wrapTime()
+        /// @param pose Where the joints are written, resized to clip.jointCount()
+        void sample(const animationClip<F>& clip, F time, animationPose<F>& pose);
+
+    private:
+        // Moves the cursor to the key at or before time in times (count keys) and returns the interpolation factor to the next key
+        static F seek(const F* times, std::size_t count, std::uint32_t& cursor, F time);
+
+        // Interpolates the vec3 keys of a channel into out, with its cursors
+        static void sampleVec3(const animationChannel<F, vec3<F>>& channel, F time, std::vector<std::uint32_t>& cursors, vec3Stream<F>& out);
+    };
+}
+
+#include "Math\Animation\AnimationSampler.inl"
@@ -0,0 +1,144 @@
+#include <concepts>
+#include <algorithm>
+#include <cassert>
+
+#include "Math\MathInternal.hpp"
+
+namespace glMath
+{
+    #pragma region Constructors
+
+    template<FloatingNumber F>
+    inline animationSampler<F>::animationSampler(rotationInterpolation rotationMode)
+        : interpolation(rotationMode)
+    {
+    }
+
+    template<FloatingNumber F>
+    inline void animationSampler<F>::reset()
+    {
+        std::fill(rotationCursors.begin(), rotationCursors.end(), 0u);
+        std::fill(translationCursors.begin(), translationCursors.end(), 0u);
+        std::fill(scaleCursors.begin(), scaleCursors.end(), 0u);
+    }
+
+    #pragma endregion
+
+    #pragma region Sampling
+
+    template<FloatingNumber F>
+    inline void animationSampler<F>::sample(const animationClip<F>& clip, F time, animationPose<F>& pose)
+    {
+        std::size_t jointCount = clip.jointCount();
+
+        time = clip.wrapTime(time);
+
+        // A new clip, or a bigger one : the new cursors start on the first key
+        rotationCursors.resize(jointCount, 0u);
+        translationCursors.resize(jointCount, 0u);
+        scaleCursors.resize(jointCount, 0u);
+
+        pose.resize(jointCount);
+
+        // The rotations : the two keys of every joint are gathered, in the same pass as the search, then interpolated in one batch
+        const animationChannel<F, quat<F>>& rotations = clip.rotations();
+
+        rotationStarts.resize(jointCount);
+        rotationEnds.resize(jointCount);
+        rotationFactors.resize(jointCount);
+
+        F* starts[4] = { rotationStarts.ws().data(), rotationStarts.xs().data(), rotationStarts.ys().data(), rotationStarts.zs().data() };
+        F* ends[4] = { rotationEnds.ws().data(), rotationEnds.xs().data(), rotationEnds.ys().data(), rotationEnds.zs().data() };
+
+        for (std::size_t j = 0; j < jointCount; j++)
+        {
+            std::size_t first = rotations.starts[j];
+            std::size_t count = rotations.starts[j + 1] - first;
+
+            rotationFactors[j] = animationSampler<F>::seek(rotations.times.data() + first, count, rotationCursors[j], time);
+
+            std::size_t key = first + rotationCursors[j];
+            const quat<F>& start = rotations.keys[key];
+            const quat<F>& end = rotations.keys[count < 2 ? key : key + 1];
+
+            starts[0][j] = start.w; starts[1][j] = start.x; starts[2][j] = start.y; starts[3][j] = start.z;
+            ends[0][j] = end.w; ends[1][j] = end.x; ends[2][j] = end.y; ends[3][j] = end.z;
+        }
+
+        if (interpolation == rotationInterpolation::slerp)
+        {
+            quatStream<F>::template slerp<polynomialMath>(rotationStarts, rotationEnds, rotationFactors, pose.rotations);
+        }
+        else
+        {
+            quatStream<F>::nlerp(rotationStarts, rotationEnds, rotationFactors, pose.rotations);
+        }
+
+        animationSampler<F>::sampleVec3(clip.translations(), time, translationCursors, pose.translations);
+        animationSampler<F>::sampleVec3(clip.scales(), time, scaleCursors, pose.scales);
+    }
+
+    #pragma endregion
+
+    #pragma region Internal
+
+    template<FloatingNumber F>
+    inline F animationSampler<F>::seek(const F* times, std::size_t count, std::uint32_t& cursor, F time)
+    {
+        if (count < 2)
+        {
+            cursor = 0;
+            return static_cast<F>(0.0);
+        }
+
+        std::size_t last = count - 2;
+        std::size_t key = std::min<std::size_t>(cursor, last);
+
+        // Forward by a frame, the time is usually still between the same keys, or one or two keys further
+        int steps = 0;
+        while (key < last && time >= times[key + 1] && steps < 2)
+        {
+            key++;
+            steps++;
+        }
+
+        // Backward (the clip looped, or was rewound) or further : binary search
+        if (time < times[key] || (key < last && time >= times[key + 1]))
+        {
+            std::size_t after = static_cast<std::size_t>(std::upper_bound(times, times + count, time) - times);
+            key = std::min(after == 0 ? 0 : after - 1, last);
+        }
+
+        cursor = static_cast<std::uint32_t>(key);
+
+        F span = times[key + 1] - times[key];
+        return span > static_cast<F>(0.0) ? glMath::clamp01((time - times[key]) / span) : static_cast<F>(0.0);
+    }
+
+    template<FloatingNumber F>
+    inline void animationSampler<F>::sampleVec3(const animationChannel<F, vec3<F>>& channel, F time,
+                                                std::vector<std::uint32_t>& cursors, vec3Stream<F>& out)
+    {
+        std::size_t jointCount = channel.jointCount();
+
+        F* results[3] = { out.xs().data(), out.ys().data(), out.zs().data() };
+
+        for (std::size_t j = 0; j < jointCount; j++)
+        {
+            std::size_t first = channel.starts[j];
+            std::size_t count = channel.starts[j + 1] - first;
+
+            F t = animationSampler<F>::seek(channel.times.data() + first, count, cursors[j], time);
+
+            std::size_t key = first + cursors[j];
+            const vec3<F>& start = channel.keys[key];
+            const vec3<F>& end = channel.keys[count < 2 ? key : key + 1];
+
+            results[0][j] = start.x + (end.x - start.x) * t;
+            results[1][j] = start.y + (end.y - start.y) * t;
+            results[2][j] = start.z + (end.z - start.z) * t;
+        }
+    }
+
+    #pragma endregion
+}
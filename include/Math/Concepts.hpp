@@ -1,6 +1,7 @@
 #pragma once
 
 #include <concepts>
+#include <cstddef>
 #include <type_traits>
 
 namespace glMath
@@ -16,12 +17,55 @@ namespace glMath
         std::is_same_v<T, long long>   ||
         std::is_same_v<T, long double> ;
 
+    template<typename T, std::size_t W>
+    struct lanes;
+
+    template<typename T>
+    inline constexpr bool isLanes = false;
+    template<typename T, std::size_t W>
+    inline constexpr bool isLanes<lanes<T, W>> = true;
+
+    // The concept LaneNumber allows the SIMD lane types, W floats or doubles processed at once,
+    // so lanes<float, 4>, lanes<float, 8>, lanes<double, 2> and lanes<double, 4> (see Lanes.hpp)
+    template<typename T>
+    concept LaneNumber = isLanes<T>;
+
     // The concept FloatingNumber allow all the types that are the same as
-    // float, double
+    // float, double, and the lane types, so that vec3<float8> computes 8 vec3<float> at once
     template<typename T>
     concept FloatingNumber = 
         std::is_same_v<T, float>  ||
-        std::is_same_v<T, double> ;
+        std::is_same_v<T, double> ||
+        LaneNumber<T>             ;
+
+    // The float or double behind a FloatingNumber : F itself, or the valueType of a lane type
+    template<typename F>
+    struct scalarType { using type = F; };
+    template<typename T, std::size_t W>
+    struct scalarType<lanes<T, W>> { using type = T; };
+
+    // The precision policies of the functions using trigonometry (see FastMath.hpp) :
+    // exactMath calls the standard library, fastMath the polynomial approximations of glMath::fast,
+    // and polynomialMath is fastMath whose slerps don't compute any angle
+    struct exactMath;
+    struct fastMath;
+    struct polynomialMath;
+
+    // The concept MathPolicy allows the precision policies, exactMath, fastMath and polynomialMath
+    template<typename P>
+    concept MathPolicy = 
+        std::is_same_v<P, exactMath> ||
+        std::is_same_v<P, fastMath>  ||
+        std::is_same_v<P, polynomialMath>;
+
+    // A sine and a cosine of the same angle, defined in MathInternal.hpp
+    template<FloatingNumber F>
+    struct sinCos;
+
+    // Passed to the functions that normalize their quaternion first (quat::rotatePoint...), 
+    // to say it's already a unit one, so they skip the square root and the division
+    struct assumeNormalizedTag {};
+    inline constexpr assumeNormalizedTag assumeNormalized{};
 
     // The concept Comparable allows all the types that define the operators 
     // < , >, <=, >= , == , !=
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <concepts>
+#include <cstddef>
+#include <span>
+
+#include "Math\Concepts.hpp"
+#include "Math\Dispatch\DispatchKernels.hpp"
+#include "Math\Vectors\Vector3.hpp"
+#include "Math\Matrices\Matrix4x4.hpp"
+#include "Math\Quaternions\Quaternion.hpp"
+
+namespace glMath
+{
+    namespace dispatch
+    {
+        /// @brief results[i] = a[i] * b[i]
+        /// @param results At least as big as a and b. It can be the same span as a or b, but must not partially overlap them
+        template<std::floating_point F>
+        void multiply(std::span<const mat4<F>> a, std::span<const mat4<F>> b, std::span<mat4<F>> results);
+
+        /// @brief results[i] = mat * (points[i], 1), without perspective divide, like mat.transformPoints(points, results)
+        /// @param results At least as big as points. It can be the same span as points, but must not partially overlap it
+        template<std::floating_point F>
+        void transformPoints(const mat4<F>& mat, std::span<const vec3<F>> points, std::span<vec3<F>> results);
+
+        /// @brief Normalizes every vector of vectors, the zero vectors being left untouched
+        template<std::floating_point F>
+        void normalize(std::span<vec3<F>> vectors);
+
+        /// @brief results[i] = quat::slerpUnclamped<polynomialMath>(starts[i], ends[i], t), on the shortest path :
+        /// the weights are fast::slerpWeights()', a polynomial vectorized like the other kernels, within a few ulps of the scalar ones
+        /// @param starts Unit quaternions, like ends
+        /// @param results At least as big as starts and ends. It can be the same span as starts or ends
+        template<std::floating_point F>
+        void slerp(std::span<const quat<F>> starts, std::span<const quat<F>> ends, F t, std::span<quat<F>> results);
+    }
+}
+
+#include "Math\Dispatch\Dispatch.inl"
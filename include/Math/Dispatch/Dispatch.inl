@@ -0,0 +1,42 @@
+#include <cassert>
+#include <concepts>
+
+namespace glMath::dispatch
+{
+    #pragma region BatchedFunctions
+
+    template<std::floating_point F>
+    inline void multiply(std::span<const mat4<F>> a, std::span<const mat4<F>> b, std::span<mat4<F>> results)
+    {
+        assert(b.size() >= a.size() && results.size() >= a.size());
+
+        dispatch::kernels<F>().mat4Multiply(reinterpret_cast<const F*>(a.data()), reinterpret_cast<const F*>(b.data()), 
+                                             reinterpret_cast<F*>(results.data()), a.size());
+    }
+
+    template<std::floating_point F>
+    inline void transformPoints(const mat4<F>& mat, std::span<const vec3<F>> points, std::span<vec3<F>> results)
+    {
+        assert(results.size() >= points.size());
+
+        dispatch::kernels<F>().mat4TransformPoints(mat.indices, reinterpret_cast<const F*>(points.data()), reinterpret_cast<F*>(results.data()), points.size(), false);
+    }
+
+    template<std::floating_point F>
+    inline void normalize(std::span<vec3<F>> vectors)
+    {
+        dispatch::kernels<F>().vec3Normalize(reinterpret_cast<F*>(vectors.data()), vectors.size());
+    }
+
+    template<std::floating_point F>
+    inline void slerp(std::span<const quat<F>> starts, std::span<const quat<F>> ends, F t, std::span<quat<F>> results)
+    {
+        assert(ends.size() >= starts.size() && results.size() >= starts.size());
+
+        dispatch::kernels<F>().quatSlerp(reinterpret_cast<const F*>(starts.data()), reinterpret_cast<const F*>(ends.data()), t, 
+                                          reinterpret_cast<F*>(results.data()), starts.size());
+    }
+
+    #pragma endregion
+}
+
@@ -0,0 +1,84 @@
+#pragma once
+
+#include <concepts>
+#include <cstddef>
+
+#include "Math\Concepts.hpp"
+#include "Math\MathInternal.hpp"
+
+// The kernels of every level are compiled in the same build, each with its own instruction set :
+// gcc and clang compile a function for another instruction set than the build's with __attribute__((target)).
+// msvc can't, so with it every level runs the kernels compiled with the build's /arch
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+    #define GLMATH_DISPATCH_TARGETS 1
+    #define GLMATH_TARGET(isa) __attribute__((target(isa)))
+#else
+    #define GLMATH_TARGET(isa)
+#endif
+
+namespace glMath
+{
+    /// @brief The instruction sets the batched kernels of glMath::dispatch are compiled for, from the oldest to the newest.
+    /// sse2 is the baseline of every x86-64 CPU, avx2 includes FMA, and avx512 is AVX-512 F and VL
+    enum class simdLevel : int
+    {
+        sse2 = 0,
+        sse42,
+        avx,
+        avx2,
+        avx512
+    };
+
+    /// @brief Batched kernels chosen at runtime : the CPU is detected once, at the first call, and every function below
+    /// calls the kernel compiled for the best instruction set it supports. That's one indirect call per batch,
+    /// so one binary built for the baseline (without -mavx...) uses the AVX-512 of the CPUs that have it, and doesn't crash on the others.
+    ///
+    /// The environment variable GLMATH_SIMD_LEVEL (sse2, sse4.2, avx, avx2 or avx512), read at the first call,
+    /// or forceLevel(), choose a lower level, to test the other kernels. A level above the CPU's is lowered to the CPU's
+    namespace dispatch
+    {
+        /// @brief The best level the CPU and the OS support (the AVX registers must be saved by the OS), detected once
+        simdLevel detectedLevel() noexcept;
+        /// @brief The level the kernels are bound to : GLMATH_SIMD_LEVEL or detectedLevel(), unless forceLevel() was called
+        simdLevel activeLevel() noexcept;
+        /// @brief Binds the kernels to level, or to detectedLevel() if level is above it. It can be called from any thread,
+        /// the batches already running finish with their kernel
+        void forceLevel(simdLevel level) noexcept;
+        /// @brief Binds the kernels to GLMATH_SIMD_LEVEL or detectedLevel() again
+        void resetLevel() noexcept;
+
+        /// @brief The level of the instruction sets the build is compiled for (-msse4.2, -mavx2...)
+        constexpr simdLevel compiledLevel() noexcept;
+
+        /// @brief "sse2", "sse4.2", "avx", "avx2" or "avx512", the names GLMATH_SIMD_LEVEL accepts
+        const char* levelName(simdLevel level) noexcept;
+
+
+        /// @brief The kernels of one level, on the raw values of the matrices (16 values), vec3 (3 values) and quaternions (4 values, w first),
+        /// or on the components of the streams (soa...)
+        template<std::floating_point F>
+        struct batchKernels
+        {
+            void (*mat4Multiply)(const F* a, const F* b, F* out, std::size_t count);
+            void (*mat4TransformPoints)(const F* mat, const F* in, F* out, std::size_t count, bool perspectiveDivide);
+            void (*vec3Normalize)(F* vectors, std::size_t count);
+            // The streams of 2, 3 and 4 components, soaNormalize[dimensions - 2]
+            void (*soaNormalize[3])(F* const* components, std::size_t count);
+            void (*quatSlerp)(const F* starts, const F* ends, F t, F* out, std::size_t count);
+            void (*soaQuatSlerp)(const F* const* starts, const F* const* ends, const F* t, F* const* out, std::size_t count);
+        };
+
+        /// @brief The kernels bound to activeLevel()
+        template<std::floating_point F>
+        const batchKernels<F>& kernels() noexcept;
+
+        /// @brief The kernels bound to activeLevel() when it isn't compiledLevel(), else nullptr. The batched functions of the library
+        /// (mat4::transformPoints(), vecStream::normalize(), quatStream::slerp<polynomialMath>()) run them instead of their kernels
+        /// compiled for the build then, so a binary built for the baseline uses the AVX of the CPU, and a forced level is tested
+        /// through them as well. Always nullptr with GLMATH_FORCE_SCALAR, or when the levels can't have their own instruction set (msvc)
+        template<std::floating_point F>
+        const batchKernels<F>* runtimeKernels() noexcept;
+    }
+}
+
+#include "Math\Dispatch\DispatchKernels.inl"
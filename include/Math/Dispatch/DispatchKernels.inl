@@ -0,0 +1,205 @@
+#include <atomic>
+#include <concepts>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+
+#include "Math\MathInternal.hpp"
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+    #include <intrin.h>
+#endif
+
+// The helpers of the kernels are inlined in the kernels of their level, so that they're compiled with the level's instruction set
+#if defined(GLMATH_DISPATCH_TARGETS)
+    #define GLMATH_DISPATCH_INLINE inline __attribute__((always_inline))
+#else
+    #define GLMATH_DISPATCH_INLINE inline
+#endif
+
+namespace glMath::dispatch
+{
+    #pragma region Detection
+
+    inline simdLevel detectLevel() noexcept
+    {
+        #if defined(GLMATH_DISPATCH_TARGETS)
+
+        // The builtins also check that the OS saves the AVX and AVX-512 registers
+        __builtin_cpu_init();
+
+        if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512vl")) return simdLevel::avx512;
+        if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma"))         return simdLevel::avx2;
+        if (__builtin_cpu_supports("avx"))                                           return simdLevel::avx;
+        if (__builtin_cpu_supports("sse4.2"))                                        return simdLevel::sse42;
+
+        return simdLevel::sse2;
+
+        #elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+
+        int info[4];
+        __cpuid(info, 1);
+
+        bool hasSse42 = (info[2] & (1 << 20)) != 0;
+        bool hasFma = (info[2] & (1 << 12)) != 0;
+        bool hasAvx = (info[2] & (1 << 28)) != 0;
+        bool hasOsSave = (info[2] & (1 << 27)) != 0;
+
+        // The XMM and YMM registers, then the opmask and ZMM ones, must be saved by the OS
+        unsigned long long osRegisters = hasOsSave ? _xgetbv(0) : 0;
+        bool osSavesAvx = (osRegisters & 0x06) == 0x06;
+        bool osSavesAvx512 = (osRegisters & 0xE6) == 0xE6;
+
+        __cpuidex(info, 7, 0);
+
+        bool hasAvx2 = (info[1] & (1 << 5)) != 0;
+        bool hasAvx512 = (info[1] & (1 << 16)) != 0 && (info[1] & (1 << 31)) != 0;
+
+        if (hasAvx && osSavesAvx512 && hasAvx512)      return simdLevel::avx512;
+        if (hasAvx && osSavesAvx && hasAvx2 && hasFma) return simdLevel::avx2;
+        if (hasAvx && osSavesAvx)                      return simdLevel::avx;
+        if (hasSse42)                                  return simdLevel::sse42;
+
+        return simdLevel::sse2;
+
+        #else
+
+        return simdLevel::sse2;
+
+        #endif
+    }
+
+    // GLMATH_SIMD_LEVEL, or -1 if it isn't set or isn't a level name
+    inline int environmentLevel() noexcept
+    {
+        const char* value = std::getenv("GLMATH_SIMD_LEVEL");
+        if (value == nullptr) return -1;
+
+        for (int level = static_cast<int>(simdLevel::sse2); level <= static_cast<int>(simdLevel::avx512); level++)
+        {
+            if (std::strcmp(value, dispatch::levelName(static_cast<simdLevel>(level))) == 0) return level;
+        }
+
+        return -1;
+    }
+
+    inline const char* levelName(simdLevel level) noexcept
+    {
+        switch (level)
+        {
+            case simdLevel::sse2:   return "sse2";
+            case simdLevel::sse42:  return "sse4.2";
+            case simdLevel::avx:    return "avx";
+            case simdLevel::avx2:   return "avx2";
+            case simdLevel::avx512: return "avx512";
+        }
+
+        return "sse2";
+    }
+
+    inline constexpr simdLevel compiledLevel() noexcept
+    {
+        #if defined(__AVX512F__) && defined(__AVX512VL__)
+        return simdLevel::avx512;
+        #elif defined(__AVX2__) && defined(__FMA__)
+        return simdLevel::avx2;
+        #elif defined(__AVX__)
+        return simdLevel::avx;
+        #elif defined(__SSE4_2__)
+        return simdLevel::sse42;
+        #else
+        return simdLevel::sse2;
+        #endif
+    }
+
+    inline simdLevel detectedLevel() noexcept
+    {
+        static const simdLevel detected = dispatch::detectLevel();
+        return detected;
+    }
+
+    // The level of kernels(), -1 until the first call binds it
+    inline std::atomic<int> boundLevel { -1 };
+
+    inline void forceLevel(simdLevel level) noexcept
+    {
+        int clamped = glMath::min(static_cast<int>(level), static_cast<int>(dispatch::detectedLevel()));
+        boundLevel.store(glMath::max(clamped, 0), std::memory_order_relaxed);
+    }
+
+    inline void resetLevel() noexcept
+    {
+        int fromEnvironment = dispatch::environmentLevel();
+
+        if (fromEnvironment >= 0) dispatch::forceLevel(static_cast<simdLevel>(fromEnvironment));
+        else                      dispatch::forceLevel(dispatch::detectedLevel());
+    }
+
+    inline simdLevel activeLevel() noexcept
+    {
+        int level = boundLevel.load(std::memory_order_relaxed);
+
+        // Two threads can both see -1, they bind the same level
+        if (level < 0)
+        {
+            dispatch::resetLevel();
+            level = boundLevel.load(std::memory_order_relaxed);
+        }
+
+        return static_cast<simdLevel>(level);
+    }
+
+    #pragma endregion
+
+    #pragma region Levels
+
+    // The vectors, quaternions and factors go through blocks of structure-of-arrays, x[16], y[16]..., so that the loops
+    // on a whole block have a known size, and are vectorized with every register width (even at -O2)
+    constexpr std::size_t blockSize = 16;
+
+    // Every level starts from arch=x86-64, so that the levels below the build's (sse2 in a -mavx2 build) aren't compiled
+    // with the build's instruction sets, then adds its own
+    #define GLMATH_LEVEL_NAME sse2
+    #define GLMATH_LEVEL_TARGET GLMATH_TARGET("arch=x86-64")
+    #include "Math\Dispatch\LevelKernels.inl"
+
+    #define GLMATH_LEVEL_NAME sse42
+    #define GLMATH_LEVEL_TARGET GLMATH_TARGET("arch=x86-64,sse3,ssse3,sse4.1,sse4.2,popcnt")
+    #include "Math\Dispatch\LevelKernels.inl"
+
+    #define GLMATH_LEVEL_NAME avx
+    #define GLMATH_LEVEL_TARGET GLMATH_TARGET("arch=x86-64,sse3,ssse3,sse4.1,sse4.2,popcnt,avx")
+    #include "Math\Dispatch\LevelKernels.inl"
+
+    #define GLMATH_LEVEL_NAME avx2
+    #define GLMATH_LEVEL_TARGET GLMATH_TARGET("arch=x86-64,sse3,ssse3,sse4.1,sse4.2,popcnt,avx,avx2,fma")
+    #include "Math\Dispatch\LevelKernels.inl"
+
+    #define GLMATH_LEVEL_NAME avx512
+    #define GLMATH_LEVEL_TARGET GLMATH_TARGET("arch=x86-64,sse3,ssse3,sse4.1,sse4.2,popcnt,avx,avx2,fma,avx512f,avx512vl")
+    #include "Math\Dispatch\LevelKernels.inl"
+
+    template<std::floating_point F>
+    inline const batchKernels<F>& kernels() noexcept
+    {
+        static constexpr const batchKernels<F>* levels[] = { &sse2::kernels<F>, &sse42::kernels<F>, &avx::kernels<F>, &avx2::kernels<F>, &avx512::kernels<F> };
+
+        return *levels[static_cast<int>(dispatch::activeLevel())];
+    }
+
+    template<std::floating_point F>
+    inline const batchKernels<F>* runtimeKernels() noexcept
+    {
+        #if defined(GLMATH_DISPATCH_TARGETS) && !defined(GLMATH_FORCE_SCALAR)
+        if (dispatch::activeLevel() != dispatch::compiledLevel()) return &dispatch::kernels<F>();
+        #endif
+
+        return nullptr;
+    }
+
+    #pragma endregion
+}
+
+#undef GLMATH_DISPATCH_INLINE
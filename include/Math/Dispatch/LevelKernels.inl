@@ -0,0 +1,292 @@
+// The kernels of one level, included by DispatchKernels.inl once per level, in glMath::dispatch : GLMATH_LEVEL_NAME is the namespace
+// of the level, GLMATH_LEVEL_TARGET its GLMATH_TARGET(...). gcc and clang only inline a function into one compiled for the same
+// instruction sets or more, so the helpers of the kernels are defined here with the level's target too,
+// and the kernels call nothing else (the constants of glMath::fast aside)
+
+namespace GLMATH_LEVEL_NAME
+{
+    // 1 / sqrt(value) for a normal value > 0, from the bits of value and Newton-Raphson steps (3 for floats, 4 for doubles),
+    // so within 2 ulps of the exact one. Unlike std::sqrt, which may set errno, gcc vectorizes it
+    template<std::floating_point F>
+    GLMATH_LEVEL_TARGET GLMATH_DISPATCH_INLINE F rsqrtNewton(F value)
+    {
+        F y;
+        if constexpr (std::is_same_v<F, float>) y = __builtin_bit_cast(float, 0x5F375A86u - (__builtin_bit_cast(std::uint32_t, value) >> 1));
+        else                                    y = __builtin_bit_cast(double, 0x5FE6EB50C7B537A9ull - (__builtin_bit_cast(std::uint64_t, value) >> 1));
+
+        F halfValue = static_cast<F>(0.5) * value;
+        constexpr int steps = std::is_same_v<F, float> ? 3 : 4;
+
+        for (int i = 0; i < steps; i++) y = y * (static_cast<F>(1.5) - halfValue * y * y);
+
+        return y;
+    }
+
+    // 1 / length from the squared length, clamped to the smallest normal value for rsqrtNewton() : the zero vectors stay zero,
+    // and the ones shorter than 1e-19 (1e-154 for doubles) aren't scaled to a length of 1. The squared lengths being positive,
+    // the clamp is an integer max on their bits, gcc turning a max of floats into a branch here
+    template<std::floating_point F>
+    GLMATH_LEVEL_TARGET GLMATH_DISPATCH_INLINE F inverseLength(F lengthSq)
+    {
+        using U = std::conditional_t<std::is_same_v<F, float>, std::uint32_t, std::uint64_t>;
+
+        constexpr U minBits = __builtin_bit_cast(U, std::numeric_limits<F>::min());
+        U bits = __builtin_bit_cast(U, lengthSq);
+
+        return dispatch::GLMATH_LEVEL_NAME::rsqrtNewton(__builtin_bit_cast(F, bits > minBits ? bits : minBits));
+    }
+
+    // Normalizes the count first vectors of the Dimensions components. The components already are a structure of arrays,
+    // so unlike the other kernels this one doesn't go through blocks
+    template<std::floating_point F, std::size_t Dimensions>
+    GLMATH_LEVEL_TARGET GLMATH_DISPATCH_INLINE void normalizeComponents(F* const* components, std::size_t count)
+    {
+        F* comps[Dimensions];
+        for (std::size_t c = 0; c < Dimensions; c++) comps[c] = components[c];
+
+        for (std::size_t i = 0; i < count; i++)
+        {
+            F lengthSq = static_cast<F>(0.0);
+            for (std::size_t c = 0; c < Dimensions; c++) lengthSq += comps[c][i] * comps[c][i];
+
+            F inverse = dispatch::GLMATH_LEVEL_NAME::inverseLength(lengthSq);
+            for (std::size_t c = 0; c < Dimensions; c++) comps[c][i] *= inverse;
+        }
+    }
+
+    // The slerp of quat::slerpUnclamped<polynomialMath>() on the quaternions offset to offset + blockSize - 1, on the shortest path.
+    // The weights are fast::slerpWeights()', cos(h) and 1 / cos(h) coming from rsqrtNewton(), so within a few ulps of them.
+    // out can be starts or ends
+    template<std::floating_point F>
+    GLMATH_LEVEL_TARGET GLMATH_DISPATCH_INLINE void slerpBlock(const F* const* starts, const F* const* ends, const F* t, F* const* out, std::size_t offset)
+    {
+        using series = fast::slerpSeries<F>;
+
+        F f1 = static_cast<F>(1.0);
+        F f2 = static_cast<F>(2.0);
+
+        F weightStart[blockSize], weightEnd[blockSize];
+        for (std::size_t i = 0; i < blockSize; i++)
+        {
+            F dot = static_cast<F>(0.0);
+            for (int c = 0; c < 4; c++) dot += starts[c][offset + i] * ends[c][offset + i];
+
+            F sign = dot < static_cast<F>(0.0) ? -f1 : f1;
+
+            // cos(h)^2 = (1 + cos(a)) / 2 is at least 0.5 on the shortest path
+            F cosHalfSq = (f1 + dot * sign) * static_cast<F>(0.5);
+            F invCosHalf = dispatch::GLMATH_LEVEL_NAME::rsqrtNewton(cosHalfSq);
+            F cosHalfM1 = cosHalfSq * invCosHalf - f1;
+
+            F factor = t[offset + i];
+            F tStart = f2 - factor * f2;
+            F tEnd = factor * f2;
+            F tStartSq = tStart * tStart;
+            F tEndSq = tEnd * tEnd;
+
+            F sumStart = f1;
+            F sumEnd = f1;
+
+            for (int j = 7; j >= 0; j--)
+            {
+                sumStart = f1 + (series::u[j] * tStartSq - series::v[j]) * cosHalfM1 * sumStart;
+                sumEnd = f1 + (series::u[j] * tEndSq - series::v[j]) * cosHalfM1 * sumEnd;
+            }
+
+            weightStart[i] = (f1 - factor) * sumStart * invCosHalf;
+            weightEnd[i] = factor * sumEnd * invCosHalf * sign;
+        }
+
+        for (int c = 0; c < 4; c++)
+        {
+            for (std::size_t i = 0; i < blockSize; i++)
+            {
+                out[c][offset + i] = starts[c][offset + i] * weightStart[i] + ends[c][offset + i] * weightEnd[i];
+            }
+        }
+    }
+
+
+    template<std::floating_point F>
+    GLMATH_LEVEL_TARGET void mat4Multiply(const F* a, const F* b, F* out, std::size_t count)
+    {
+        for (std::size_t i = 0; i < count; i++)
+        {
+            const F* matA = a + i * 16;
+            const F* matB = b + i * 16;
+
+            // Written at the end, out can be a or b
+            F res[16];
+
+            for (int col = 0; col < 4; col++)
+            {
+                for (int row = 0; row < 4; row++)
+                {
+                    res[col * 4 + row] = matA[row] * matB[col * 4] + matA[4 + row] * matB[col * 4 + 1]
+                                       + matA[8 + row] * matB[col * 4 + 2] + matA[12 + row] * matB[col * 4 + 3];
+                }
+            }
+
+            for (int j = 0; j < 16; j++) out[i * 16 + j] = res[j];
+        }
+    }
+
+    template<std::floating_point F>
+    GLMATH_LEVEL_TARGET void mat4TransformPoints(const F* mat, const F* in, F* out, std::size_t count, bool perspectiveDivide)
+    {
+        for (std::size_t start = 0; start < count; start += blockSize)
+        {
+            std::size_t blockCount = count - start < blockSize ? count - start : blockSize;
+
+            F x[blockSize] = {}, y[blockSize] = {}, z[blockSize] = {};
+            for (std::size_t i = 0; i < blockCount; i++)
+            {
+                x[i] = in[(start + i) * 3];
+                y[i] = in[(start + i) * 3 + 1];
+                z[i] = in[(start + i) * 3 + 2];
+            }
+
+            F res[3][blockSize];
+            for (std::size_t i = 0; i < blockSize; i++)
+            {
+                res[0][i] = mat[0] * x[i] + mat[4] * y[i] + mat[8] * z[i] + mat[12];
+                res[1][i] = mat[1] * x[i] + mat[5] * y[i] + mat[9] * z[i] + mat[13];
+                res[2][i] = mat[2] * x[i] + mat[6] * y[i] + mat[10] * z[i] + mat[14];
+            }
+
+            if (perspectiveDivide)
+            {
+                for (std::size_t i = 0; i < blockSize; i++)
+                {
+                    F inverseW = static_cast<F>(1.0) / (mat[3] * x[i] + mat[7] * y[i] + mat[11] * z[i] + mat[15]);
+                    for (int r = 0; r < 3; r++) res[r][i] *= inverseW;
+                }
+            }
+
+            for (std::size_t i = 0; i < blockCount; i++)
+            {
+                out[(start + i) * 3]     = res[0][i];
+                out[(start + i) * 3 + 1] = res[1][i];
+                out[(start + i) * 3 + 2] = res[2][i];
+            }
+        }
+    }
+
+    template<std::floating_point F>
+    GLMATH_LEVEL_TARGET void vec3Normalize(F* vectors, std::size_t count)
+    {
+        for (std::size_t start = 0; start < count; start += blockSize)
+        {
+            std::size_t blockCount = count - start < blockSize ? count - start : blockSize;
+
+            F x[blockSize] = {}, y[blockSize] = {}, z[blockSize] = {};
+            for (std::size_t i = 0; i < blockCount; i++)
+            {
+                x[i] = vectors[(start + i) * 3];
+                y[i] = vectors[(start + i) * 3 + 1];
+                z[i] = vectors[(start + i) * 3 + 2];
+            }
+
+            F* components[3] = { x, y, z };
+            dispatch::GLMATH_LEVEL_NAME::normalizeComponents<F, 3>(components, blockSize);
+
+            for (std::size_t i = 0; i < blockCount; i++)
+            {
+                vectors[(start + i) * 3]     = x[i];
+                vectors[(start + i) * 3 + 1] = y[i];
+                vectors[(start + i) * 3 + 2] = z[i];
+            }
+        }
+    }
+
+    template<std::floating_point F, std::size_t Dimensions>
+    GLMATH_LEVEL_TARGET void soaNormalize(F* const* components, std::size_t count)
+    {
+        dispatch::GLMATH_LEVEL_NAME::normalizeComponents<F, Dimensions>(components, count);
+    }
+
+    template<std::floating_point F>
+    GLMATH_LEVEL_TARGET void quatSlerp(const F* starts, const F* ends, F t, F* out, std::size_t count)
+    {
+        F factors[blockSize];
+        for (std::size_t i = 0; i < blockSize; i++) factors[i] = t;
+
+        for (std::size_t start = 0; start < count; start += blockSize)
+        {
+            std::size_t blockCount = count - start < blockSize ? count - start : blockSize;
+
+            // The lanes after blockCount slerp identity to identity
+            F s[4][blockSize] = {}, e[4][blockSize] = {};
+            for (std::size_t i = 0; i < blockSize; i++)
+            {
+                s[0][i] = static_cast<F>(1.0);
+                e[0][i] = static_cast<F>(1.0);
+            }
+
+            for (std::size_t i = 0; i < blockCount; i++)
+            {
+                for (int c = 0; c < 4; c++)
+                {
+                    s[c][i] = starts[(start + i) * 4 + c];
+                    e[c][i] = ends[(start + i) * 4 + c];
+                }
+            }
+
+            const F* startComponents[4] = { s[0], s[1], s[2], s[3] };
+            const F* endComponents[4] = { e[0], e[1], e[2], e[3] };
+            F* outComponents[4] = { s[0], s[1], s[2], s[3] };
+            dispatch::GLMATH_LEVEL_NAME::slerpBlock(startComponents, endComponents, factors, outComponents, 0);
+
+            for (std::size_t i = 0; i < blockCount; i++)
+            {
+                for (int c = 0; c < 4; c++) out[(start + i) * 4 + c] = s[c][i];
+            }
+        }
+    }
+
+    template<std::floating_point F>
+    GLMATH_LEVEL_TARGET void soaQuatSlerp(const F* const* starts, const F* const* ends, const F* t, F* const* out, std::size_t count)
+    {
+        std::size_t start = 0;
+        for (; start + blockSize <= count; start += blockSize) dispatch::GLMATH_LEVEL_NAME::slerpBlock(starts, ends, t, out, start);
+
+        // The last quaternions through a block padded with identities, slerped with t = 0
+        if (start < count)
+        {
+            F s[4][blockSize] = {}, e[4][blockSize] = {}, factors[blockSize] = {};
+            for (std::size_t i = 0; i < blockSize; i++)
+            {
+                s[0][i] = static_cast<F>(1.0);
+                e[0][i] = static_cast<F>(1.0);
+            }
+
+            for (std::size_t i = start; i < count; i++)
+            {
+                for (int c = 0; c < 4; c++)
+                {
+                    s[c][i - start] = starts[c][i];
+                    e[c][i - start] = ends[c][i];
+                }
+                factors[i - start] = t[i];
+            }
+
+            const F* startComponents[4] = { s[0], s[1], s[2], s[3] };
+            const F* endComponents[4] = { e[0], e[1], e[2], e[3] };
+            F* outComponents[4] = { s[0], s[1], s[2], s[3] };
+            dispatch::GLMATH_LEVEL_NAME::slerpBlock(startComponents, endComponents, factors, outComponents, 0);
+
+            for (std::size_t i = start; i < count; i++)
+            {
+                for (int c = 0; c < 4; c++) out[c][i] = s[c][i - start];
+            }
+        }
+    }
+
+    template<std::floating_point F>
+    inline constexpr batchKernels<F> kernels = { &mat4Multiply<F>, &mat4TransformPoints<F>, &vec3Normalize<F>,
+                                                 { &soaNormalize<F, 2>, &soaNormalize<F, 3>, &soaNormalize<F, 4> },
+                                                 &quatSlerp<F>, &soaQuatSlerp<F> };
+}
+
+#undef GLMATH_LEVEL_NAME
+#undef GLMATH_LEVEL_TARGET
@@ -0,0 +1,218 @@
+#pragma once
+
+#include <concepts>
+#include <cstddef>
+#include <type_traits>
+
+#include "Math\Concepts.hpp"
+#include "Math\Vectors\Vector3.hpp"
+#include "Math\Vectors\Vector4.hpp"
+#include "Math\Matrices\Matrix4x4.hpp"
+
+// An opt-in layer of expression templates : the operators below only apply once one of the operands
+// went through glMath::expr::lazy(), the eager operators of the library stay untouched.
+//
+// - vector expressions (+, -, * and / on vec3 and vec4) build a tree that is evaluated component by component
+//   when converted to a vector, so the whole expression runs in a single pass without any temporary vector.
+//   Only the operators with a lazy operand are deferred : a vector scaled by a scalar needs lazy() too,
+//   lazy(a) + lazy(b) * 2.0f is fused where lazy(a) + b * 2.0f first computes b * 2.0f eagerly
+// - matrix chains (lazy(proj) * view * model) only keep pointers to their matrices, and once multiplied
+//   by a vector they apply the matrices to it from right to left : N mat-vec products instead of N - 1 mat-mat ones
+//
+// Both only hold references to their operands : they are meant to be consumed in the expression that built them,
+// storing one in an auto variable and using it after a temporary operand died is undefined behavior.
+// lazy() itself doesn't take temporaries.
+
+namespace glMath::expr
+{
+    #pragma region VectorExpressions
+
+    /// @brief The leaf of a vector expression, a reference to a vec3 or a vec4
+    template<typename V>
+    struct vecLeaf;
+
+    template<FloatingNumber F>
+    struct vecLeaf<vec3<F>>
+    {
+        using valueType = F;
+        using resultType = vec3<F>;
+        static constexpr int size = 3;
+
+        const vec3<F>& vec;
+
+        inline constexpr F at(int i) const noexcept;
+    };
+
+    template<FloatingNumber F>
+    struct vecLeaf<vec4<F>>
+    {
+        using valueType = F;
+        using resultType = vec4<F>;
+        static constexpr int size = 4;
+
+        const vec4<F>& vec;
+
+        inline constexpr F at(int i) const noexcept;
+    };
+
+    /// @brief A scalar broadcast to every component of a vector expression
+    template<FloatingNumber F, typename V>
+    struct scalarLeaf
+    {
+        using valueType = F;
+        using resultType = V;
+        static constexpr int size = vecLeaf<V>::size;
+
+        F value;
+
+        inline constexpr F at(int) const noexcept { return value; }
+    };
+
+    /// @brief A component-wise operation between two nodes
+    template<typename L, typename R, typename Op>
+    struct vecBinary
+    {
+        using valueType = typename L::valueType;
+        using resultType = typename L::resultType;
+        static constexpr int size = L::size;
+
+        L left;
+        R right;
+
+        inline constexpr valueType at(int i) const noexcept { return Op{}(left.at(i), right.at(i)); }
+    };
+
+    /// @brief The negation of a node
+    template<typename E>
+    struct vecNegate
+    {
+        using valueType = typename E::valueType;
+        using resultType = typename E::resultType;
+        static constexpr int size = E::size;
+
+        E expr;
+
+        inline constexpr valueType at(int i) const noexcept { return -expr.at(i); }
+    };
+
+    /// @brief A deferred vector expression, evaluated when converted to its vector type (or with eval())
+    /// @tparam Node The root of the expression tree
+    template<typename Node>
+    struct vecExpr
+    {
+        using valueType = typename Node::valueType;
+        using resultType = typename Node::resultType;
+        static constexpr int size = Node::size;
+
+        Node node;
+
+        inline constexpr valueType at(int i) const noexcept { return node.at(i); }
+
+        /// @brief A function to evaluate the expression, every component going through the whole tree once
+        /// @return Returns the resulting vec3 or vec4
+        inline constexpr resultType eval() const noexcept;
+
+        inline constexpr operator resultType() const noexcept { return this->eval(); }
+    };
+
+    // True for the vectors that can be leaves of an expression
+    template<typename T>
+    concept LazyVector = requires { typename vecLeaf<std::remove_cvref_t<T>>::resultType; };
+
+    // True for the vecExpr types
+    template<typename T>
+    inline constexpr bool isVecExpr = false;
+    template<typename Node>
+    inline constexpr bool isVecExpr<vecExpr<Node>> = true;
+
+    // True for anything that can be an operand of a vector expression
+    template<typename T>
+    concept VecOperand = isVecExpr<std::remove_cvref_t<T>> || LazyVector<T>;
+
+    #pragma endregion
+
+    #pragma region MatrixChains
+
+    /// @brief A deferred product of N matrices, applied from right to left once multiplied by a vector,
+    /// or multiplied from left to right when converted to a mat4 (with eval())
+    template<FloatingNumber F, std::size_t N>
+    struct matChain
+    {
+        const mat4<F>* mats[N];
+
+        /// @brief A function to evaluate the chain as a matrix, from left to right, the same way as the eager operators
+        /// @return Returns the product of all the matrices
+        inline constexpr mat4<F> eval() const noexcept;
+
+        inline constexpr operator mat4<F>() const noexcept { return this->eval(); }
+
+        /// @brief A function to transform a point (w of 1) by the chain, without any perspective divide.
+        /// The matrices are applied to the point one after the other, from right to left
+        /// @param point The point to transform
+        /// @return Returns the xyz of the transformed point
+        inline constexpr vec3<F> transformPoint(const vec3<F>& point) const noexcept;
+        /// @brief A function to transform a direction (w of 0) by the chain, from right to left
+        /// @param direction The direction to transform
+        /// @return Returns the xyz of the transformed direction
+        inline constexpr vec3<F> transformDirection(const vec3<F>& direction) const noexcept;
+    };
+
+    #pragma endregion
+
+    /// @brief The entry point of the expressions, wraps a vec3 or a vec4 so that the operators it's used with are deferred
+    template<FloatingNumber F>
+    inline constexpr vecExpr<vecLeaf<vec3<F>>> lazy(const vec3<F>& vec) noexcept;
+    /// @brief The entry point of the expressions, wraps a vec3 or a vec4 so that the operators it's used with are deferred
+    template<FloatingNumber F>
+    inline constexpr vecExpr<vecLeaf<vec4<F>>> lazy(const vec4<F>& vec) noexcept;
+    /// @brief The entry point of the matrix chains, the products following it are deferred
+    template<FloatingNumber F>
+    inline constexpr matChain<F, 1> lazy(const mat4<F>& mat) noexcept;
+
+    // The expressions only hold references, so a temporary would die before the expression is evaluated
+    template<FloatingNumber F>
+    void lazy(vec3<F>&& vec) = delete;
+    template<FloatingNumber F>
+    void lazy(vec4<F>&& vec) = delete;
+    template<FloatingNumber F>
+    void lazy(mat4<F>&& mat) = delete;
+
+
+    template<VecOperand A, VecOperand B>
+        requires (isVecExpr<std::remove_cvref_t<A>> || isVecExpr<std::remove_cvref_t<B>>)
+    inline constexpr auto operator+(const A& a, const B& b) noexcept;
+
+    template<VecOperand A, VecOperand B>
+        requires (isVecExpr<std::remove_cvref_t<A>> || isVecExpr<std::remove_cvref_t<B>>)
+    inline constexpr auto operator-(const A& a, const B& b) noexcept;
+
+    template<VecOperand A, VecOperand B>
+        requires (isVecExpr<std::remove_cvref_t<A>> || isVecExpr<std::remove_cvref_t<B>>)
+    inline constexpr auto operator*(const A& a, const B& b) noexcept;
+
+    template<typename Node>
+    inline constexpr auto operator*(const vecExpr<Node>& a, typename Node::valueType scalar) noexcept;
+    template<typename Node>
+    inline constexpr auto operator*(typename Node::valueType scalar, const vecExpr<Node>& a) noexcept;
+    template<typename Node>
+    inline constexpr auto operator/(const vecExpr<Node>& a, typename Node::valueType scalar) noexcept;
+
+    template<typename Node>
+    inline constexpr auto operator-(const vecExpr<Node>& a) noexcept;
+
+
+    template<FloatingNumber F, std::size_t N>
+    inline constexpr matChain<F, N + 1> operator*(const matChain<F, N>& chain, const mat4<F>& mat) noexcept;
+    template<FloatingNumber F, std::size_t N>
+    inline constexpr matChain<F, N + 1> operator*(const mat4<F>& mat, const matChain<F, N>& chain) noexcept;
+    template<FloatingNumber F, std::size_t N, std::size_t M>
+    inline constexpr matChain<F, N + M> operator*(const matChain<F, N>& a, const matChain<F, M>& b) noexcept;
+
+    template<FloatingNumber F, std::size_t N>
+    inline constexpr vec4<F> operator*(const matChain<F, N>& chain, const vec4<F>& vec) noexcept;
+    template<FloatingNumber F, std::size_t N, typename Node>
+        requires std::is_same_v<typename Node::resultType, vec4<F>>
+    inline constexpr vec4<F> operator*(const matChain<F, N>& chain, const vecExpr<Node>& vec) noexcept;
+}
+
+#include "Math\Expressions\LazyExpressions.inl"
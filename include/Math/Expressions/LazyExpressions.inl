@@ -0,0 +1,232 @@
+#include <concepts>
+#include <functional>
+#include <utility>
+
+namespace glMath::expr
+{
+    #pragma region Leaves
+
+    // The components are read by name, data[] not being the active member of the union in constant evaluation
+
+    template<FloatingNumber F>
+    inline constexpr F vecLeaf<vec3<F>>::at(int i) const noexcept
+    {
+        return i == 0 ? vec.x : (i == 1 ? vec.y : vec.z);
+    }
+
+    template<FloatingNumber F>
+    inline constexpr F vecLeaf<vec4<F>>::at(int i) const noexcept
+    {
+        return i == 0 ? vec.x : (i == 1 ? vec.y : (i == 2 ? vec.z : vec.w));
+    }
+
+    // Returns the node of an operand, wrapping the vectors in a leaf
+    template<typename T>
+    inline constexpr auto nodeOf(const T& operand) noexcept
+    {
+        if constexpr (isVecExpr<T>)
+        {
+            return operand.node;
+        }
+        else
+        {
+            return vecLeaf<T>{ operand };
+        }
+    }
+
+    template<typename L, typename R, typename Op>
+    inline constexpr auto makeBinary(const L& left, const R& right) noexcept
+    {
+        static_assert(L::size == R::size, "glMath::expr : the two operands must have the same size");
+        static_assert(std::is_same_v<typename L::valueType, typename R::valueType>, "glMath::expr : the two operands must have the same type");
+
+        return vecExpr<vecBinary<L, R, Op>>{ { left, right } };
+    }
+
+    #pragma endregion
+
+    #pragma region VectorExpressions
+
+    template<typename Node>
+    inline constexpr typename vecExpr<Node>::resultType vecExpr<Node>::eval() const noexcept
+    {
+        return [this]<int... I>(std::integer_sequence<int, I...>)
+        {
+            return resultType(node.at(I)...);
+        }(std::make_integer_sequence<int, size>{});
+    }
+
+    template<FloatingNumber F>
+    inline constexpr vecExpr<vecLeaf<vec3<F>>> lazy(const vec3<F>& vec) noexcept
+    {
+        return { { vec } };
+    }
+
+    template<FloatingNumber F>
+    inline constexpr vecExpr<vecLeaf<vec4<F>>> lazy(const vec4<F>& vec) noexcept
+    {
+        return { { vec } };
+    }
+
+
+    template<VecOperand A, VecOperand B>
+        requires (isVecExpr<std::remove_cvref_t<A>> || isVecExpr<std::remove_cvref_t<B>>)
+    inline constexpr auto operator+(const A& a, const B& b) noexcept
+    {
+        return makeBinary<decltype(nodeOf(a)), decltype(nodeOf(b)), std::plus<>>(nodeOf(a), nodeOf(b));
+    }
+
+    template<VecOperand A, VecOperand B>
+        requires (isVecExpr<std::remove_cvref_t<A>> || isVecExpr<std::remove_cvref_t<B>>)
+    inline constexpr auto operator-(const A& a, const B& b) noexcept
+    {
+        return makeBinary<decltype(nodeOf(a)), decltype(nodeOf(b)), std::minus<>>(nodeOf(a), nodeOf(b));
+    }
+
+    template<VecOperand A, VecOperand B>
+        requires (isVecExpr<std::remove_cvref_t<A>> || isVecExpr<std::remove_cvref_t<B>>)
+    inline constexpr auto operator*(const A& a, const B& b) noexcept
+    {
+        return makeBinary<decltype(nodeOf(a)), decltype(nodeOf(b)), std::multiplies<>>(nodeOf(a), nodeOf(b));
+    }
+
+    template<typename Node>
+    inline constexpr auto operator*(const vecExpr<Node>& a, typename Node::valueType scalar) noexcept
+    {
+        using scalarNode = scalarLeaf<typename Node::valueType, typename Node::resultType>;
+
+        return makeBinary<Node, scalarNode, std::multiplies<>>(a.node, scalarNode{ scalar });
+    }
+
+    template<typename Node>
+    inline constexpr auto operator*(typename Node::valueType scalar, const vecExpr<Node>& a) noexcept
+    {
+        return a * scalar;
+    }
+
+    template<typename Node>
+    inline constexpr auto operator/(const vecExpr<Node>& a, typename Node::valueType scalar) noexcept
+    {
+        using F = typename Node::valueType;
+
+        // Same as the eager operator/ : a division by zero leaves the vector unchanged,
+        // else it is multiplied by the inverse of the scalar
+        F invScalar = scalar == static_cast<F>(0.0) ? static_cast<F>(1.0) : static_cast<F>(1.0) / scalar;
+
+        return a * invScalar;
+    }
+
+    template<typename Node>
+    inline constexpr auto operator-(const vecExpr<Node>& a) noexcept
+    {
+        return vecExpr<vecNegate<Node>>{ { a.node } };
+    }
+
+    #pragma endregion
+
+    #pragma region MatrixChains
+
+    template<FloatingNumber F>
+    inline constexpr matChain<F, 1> lazy(const mat4<F>& mat) noexcept
+    {
+        return { { &mat } };
+    }
+
+    template<FloatingNumber F, std::size_t N>
+    inline constexpr mat4<F> matChain<F, N>::eval() const noexcept
+    {
+        mat4<F> res = *mats[0];
+
+        for (std::size_t i = 1; i < N; i++)
+        {
+            res = res * *mats[i];
+        }
+
+        return res;
+    }
+
+    template<FloatingNumber F, std::size_t N>
+    inline constexpr vec3<F> matChain<F, N>::transformPoint(const vec3<F>& point) const noexcept
+    {
+        vec4<F> res = *this * vec4<F>(point, static_cast<F>(1.0));
+
+        return vec3<F>(res.x, res.y, res.z);
+    }
+
+    template<FloatingNumber F, std::size_t N>
+    inline constexpr vec3<F> matChain<F, N>::transformDirection(const vec3<F>& direction) const noexcept
+    {
+        vec4<F> res = *this * vec4<F>(direction, static_cast<F>(0.0));
+
+        return vec3<F>(res.x, res.y, res.z);
+    }
+
+
+    template<FloatingNumber F, std::size_t N>
+    inline constexpr matChain<F, N + 1> operator*(const matChain<F, N>& chain, const mat4<F>& mat) noexcept
+    {
+        matChain<F, N + 1> res;
+
+        for (std::size_t i = 0; i < N; i++)
+        {
+            res.mats[i] = chain.mats[i];
+        }
+        res.mats[N] = &mat;
+
+        return res;
+    }
+
+    template<FloatingNumber F, std::size_t N>
+    inline constexpr matChain<F, N + 1> operator*(const mat4<F>& mat, const matChain<F, N>& chain) noexcept
+    {
+        matChain<F, N + 1> res;
+
+        res.mats[0] = &mat;
+        for (std::size_t i = 0; i < N; i++)
+        {
+            res.mats[i + 1] = chain.mats[i];
+        }
+
+        return res;
+    }
+
+    template<FloatingNumber F, std::size_t N, std::size_t M>
+    inline constexpr matChain<F, N + M> operator*(const matChain<F, N>& a, const matChain<F, M>& b) noexcept
+    {
+        matChain<F, N + M> res;
+
+        for (std::size_t i = 0; i < N; i++)
+        {
+            res.mats[i] = a.mats[i];
+        }
+        for (std::size_t i = 0; i < M; i++)
+        {
+            res.mats[N + i] = b.mats[i];
+        }
+
+        return res;
+    }
+
+    template<FloatingNumber F, std::size_t N>
+    inline constexpr vec4<F> operator*(const matChain<F, N>& chain, const vec4<F>& vec) noexcept
+    {
+        // (A * B * C) * v == A * (B * (C * v)), 16 multiply-adds per matrix instead of 64 per product
+        vec4<F> res = vec;
+
+        for (std::size_t i = N; i > 0; i--)
+        {
+            res = *chain.mats[i - 1] * res;
+        }
+
+        return res;
+    }
+
+    template<FloatingNumber F, std::size_t N, typename Node>
+        requires std::is_same_v<typename Node::resultType, vec4<F>>
+    inline constexpr vec4<F> operator*(const matChain<F, N>& chain, const vecExpr<Node>& vec) noexcept
+    {
+        return chain * vec.eval();
+    }
+
+    #pragma endregion
+}
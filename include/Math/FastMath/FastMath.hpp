@@ -0,0 +1,155 @@
+#pragma once
+
+#include <concepts>
+#include <cstddef>
+#include <span>
+
+#include "Math\Concepts.hpp"
+#include "Math\MathInternal.hpp"
+
+namespace glMath
+{
+    /// @brief Polynomial approximations of the transcendental functions, for the code that doesn't need the full precision of the standard library.
+    /// They have no branch, so the same code works with float, double and the lane types, for which every lane is computed at once in SIMD registers
+    /// (fast::sin(float8) is 8 sines for the price of about one), and loops calling them can be vectorized by the compiler.
+    /// One value at a time, asin, acos and atan are about twice as fast as the standard library, but sin, cos, exp and log are not faster
+    /// than the ones of a good libm (glibc's sinf is already a polynomial) : their speed comes from the lane types and the batched versions.
+    /// The polynomials are the Cephes minimax ones, made for floats : doubles get the same polynomials, so errors around 1e-8, and not 1e-16.
+    /// The errors given are the float ones, measured against the double precision std:: functions, over the whole domain given for each function
+    namespace fast
+    {
+        /// @brief sin(x), x being in radians. Absolute error under 1e-7 for |x| <= 8192 with floats (the range reduction then loses precision, like with std::sinf),
+        /// and for |x| <= 1e9 with doubles
+        template<FloatingNumber F>
+        inline F sin(F x) noexcept;
+        /// @brief cos(x), x being in radians, with the same error as sin(x)
+        template<FloatingNumber F>
+        inline F cos(F x) noexcept;
+        /// @brief sin(x) and cos(x) with the same error, for about the price of one of them (the range reduction is shared)
+        template<FloatingNumber F>
+        inline sinCos<F> sincos(F x) noexcept;
+
+        /// @brief asin(x), for x in [-1, 1], absolute error under 2e-7
+        template<FloatingNumber F>
+        inline F asin(F x) noexcept;
+        /// @brief acos(x), for x in [-1, 1], absolute error under 3e-7
+        template<FloatingNumber F>
+        inline F acos(F x) noexcept;
+
+        /// @brief atan(x), absolute error under 2e-7
+        template<FloatingNumber F>
+        inline F atan(F x) noexcept;
+        /// @brief atan2(y, x), the angle of (x, y) in [-pi, pi], absolute error under 3e-7.
+        /// Unlike std::atan2, the sign of a zero y is ignored, and atan2(0, 0) is 0
+        template<FloatingNumber F>
+        inline F atan2(F y, F x) noexcept;
+
+        /// @brief e^x, relative error under 2e-7. It overflows to infinity and underflows to 0 (through the denormals) like std::exp
+        template<FloatingNumber F>
+        inline F exp(F x) noexcept;
+        /// @brief ln(x), absolute error under 1e-7 for x in [0.5, 2] and relative error under 1e-7 elsewhere.
+        /// log(0) is -infinity, and log(x < 0) is NaN, like std::log
+        template<FloatingNumber F>
+        inline F log(F x) noexcept;
+
+        /// @brief The weights of a slerp between two unit vectors or quaternions whose dot product is cosAngle,
+        /// sin((1 - t) * angle) / sin(angle) and sin(t * angle) / sin(angle), without acos nor sines : Eberly's polynomial 
+        /// in t and in the cosine of the angle ("A Fast and Accurate Algorithm for Computing SLERP"), 8 terms, evaluated on half the angle.
+        /// Up to an angle of 90 degrees (every quaternion slerp, on the shortest path) the interpolated direction is within 2e-8 radians
+        /// of the exact one in double, the rounding of the floats (5e-7 radians) dominating in float. Above, the error grows to 4e-5 radians
+        /// at 150 degrees and a few 1e-3 close to 180, where the weights are infinite
+        template<FloatingNumber F>
+        inline lerpWeights<F> slerpWeights(F cosAngle, F t) noexcept;
+
+
+        /// @brief The batched versions, computing results[i] = f(values[i]) with the widest lane type of the build (8 floats or 4 doubles with AVX,
+        /// 4 floats or 2 doubles with SSE2), the tail being computed one value at a time. They need the lane types, so Lanes.hpp or FastMath.hpp
+        /// @param results Where the results are written, at least as big as values. It can be the same span as values
+        template<std::floating_point F>
+        void sin(std::span<const F> values, std::span<F> results);
+        template<std::floating_point F>
+        void cos(std::span<const F> values, std::span<F> results);
+        template<std::floating_point F>
+        void sincos(std::span<const F> values, std::span<F> sines, std::span<F> cosines);
+        template<std::floating_point F>
+        void asin(std::span<const F> values, std::span<F> results);
+        template<std::floating_point F>
+        void acos(std::span<const F> values, std::span<F> results);
+        template<std::floating_point F>
+        void atan(std::span<const F> values, std::span<F> results);
+        template<std::floating_point F>
+        void atan2(std::span<const F> ys, std::span<const F> xs, std::span<F> results);
+        template<std::floating_point F>
+        void exp(std::span<const F> values, std::span<F> results);
+        template<std::floating_point F>
+        void log(std::span<const F> values, std::span<F> results);
+
+
+        // The building blocks of the approximations, working on the bits of the values :
+        // 2^n for an integral n in the normal range ([-126, 127] for float, [-1022, 1023] for double),
+        // the unbiased exponent of a positive normal value, so floor(log2(value)),
+        // and its mantissa, so value / 2^exponent, in [1, 2)
+        template<std::floating_point F>
+        inline F pow2(F n) noexcept;
+        template<std::floating_point F>
+        inline F exponent(F value) noexcept;
+        template<std::floating_point F>
+        inline F mantissa(F value) noexcept;
+
+        // The same for the lane types, defined in Lanes.hpp
+        template<typename T, std::size_t W>
+        inline lanes<T, W> pow2(const lanes<T, W>& n) noexcept;
+        template<typename T, std::size_t W>
+        inline lanes<T, W> exponent(const lanes<T, W>& value) noexcept;
+        template<typename T, std::size_t W>
+        inline lanes<T, W> mantissa(const lanes<T, W>& value) noexcept;
+    }
+
+
+    /// @brief The precision policy of the standard library, the default one : the functions taking a MathPolicy
+    /// (vec3::slerp<P>, quat::fromEuler<P>, mat4::rotateX<P>...) call std::sin, std::cos...
+    struct exactMath
+    {
+        template<FloatingNumber F> static F sin(F x)        { return glMath::sin(x); };
+        template<FloatingNumber F> static F cos(F x)        { return glMath::cos(x); };
+        template<FloatingNumber F> static sinCos<F> sincos(F x) { return glMath::sincos(x); };
+        template<FloatingNumber F> static F acos(F x)       { return glMath::acos(x); };
+        template<FloatingNumber F> static F atan2(F y, F x) { return glMath::atan2(y, x); };
+
+        // One value at a time, for the batched functions taking a MathPolicy (quat::fromEuler(span)...)
+        template<std::floating_point F>
+        static void sincos(std::span<const F> values, std::span<F> sines, std::span<F> cosines)
+        {
+            for (std::size_t i = 0; i < values.size(); i++)
+            {
+                sinCos<F> res = glMath::sincos(values[i]);
+                sines[i] = res.sin;
+                cosines[i] = res.cos;
+            }
+        };
+    };
+
+    /// @brief The precision policy of glMath::fast : vec3::slerp<fastMath>, quat::fromEuler<fastMath>, mat4::rotateX<fastMath>...
+    /// use the polynomial approximations, so their results are within a few 1e-7 of the exact ones
+    struct fastMath
+    {
+        template<FloatingNumber F> static F sin(F x)        { return fast::sin(x); };
+        template<FloatingNumber F> static F cos(F x)        { return fast::cos(x); };
+        template<FloatingNumber F> static sinCos<F> sincos(F x) { return fast::sincos(x); };
+        template<FloatingNumber F> static F acos(F x)       { return fast::acos(x); };
+        template<FloatingNumber F> static F atan2(F y, F x) { return fast::atan2(y, x); };
+
+        template<std::floating_point F>
+        static void sincos(std::span<const F> values, std::span<F> sines, std::span<F> cosines) { fast::sincos(values, sines, cosines); };
+    };
+
+    /// @brief fastMath, except for the slerps (quat::slerp<polynomialMath>, vec3::slerp<polynomialMath>, dualQuat::sclerp<polynomialMath>...) :
+    /// their weights come from fast::slerpWeights(), a polynomial of t and of the dot product, instead of an acos and three sines.
+    /// They skip the normalization of the ends as well, so the vectors and quaternions given to them must be normalized
+    struct polynomialMath : fastMath
+    {
+        template<FloatingNumber F> static lerpWeights<F> slerpWeights(F cosAngle, F t) { return fast::slerpWeights(cosAngle, t); };
+    };
+}
+
+#include "Math\FastMath\FastMath.inl"
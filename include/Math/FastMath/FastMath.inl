@@ -0,0 +1,498 @@
+#include <concepts>
+#include <bit>
+#include <cstdint>
+#include <cassert>
+#include <limits>
+#include <type_traits>
+
+#include "Math\MathInternal.hpp"
+#include "Math\SimdInternal.hpp"
+
+namespace glMath::fast
+{
+    #pragma region BuildingBlocks
+
+    template<std::floating_point F>
+    inline F pow2(F n) noexcept
+    {
+        if constexpr (std::is_same_v<F, float>)
+        {
+            return std::bit_cast<float>(static_cast<std::uint32_t>(static_cast<std::int32_t>(n) + 127) << 23);
+        }
+        else
+        {
+            return std::bit_cast<double>(static_cast<std::uint64_t>(static_cast<std::int64_t>(n) + 1023) << 52);
+        }
+    }
+
+    template<std::floating_point F>
+    inline F exponent(F value) noexcept
+    {
+        if constexpr (std::is_same_v<F, float>)
+        {
+            return static_cast<float>(static_cast<std::int32_t>(std::bit_cast<std::uint32_t>(value) >> 23) - 127);
+        }
+        else
+        {
+            return static_cast<double>(static_cast<std::int64_t>(std::bit_cast<std::uint64_t>(value) >> 52) - 1023);
+        }
+    }
+
+    template<std::floating_point F>
+    inline F mantissa(F value) noexcept
+    {
+        if constexpr (std::is_same_v<F, float>)
+        {
+            return std::bit_cast<float>((std::bit_cast<std::uint32_t>(value) & 0x007FFFFFu) | 0x3F800000u);
+        }
+        else
+        {
+            return std::bit_cast<double>((std::bit_cast<std::uint64_t>(value) & 0x000FFFFFFFFFFFFFull) | 0x3FF0000000000000ull);
+        }
+    }
+
+
+    // The nearest integer, ties to even, for the reductions below. One value at a time it adds and subtracts 1.5 * 2^(mantissa bits),
+    // which rounds in the default mode for |value| < 2^22 (float) or 2^51 (double) : std::rint is a library call without SSE4.1
+    template<FloatingNumber F>
+    inline F roundReduction(F value) noexcept
+    {
+        if constexpr (std::is_same_v<F, float>)       return (value + 12582912.0f) - 12582912.0f;
+        else if constexpr (std::is_same_v<F, double>) return (value + 6755399441055744.0) - 6755399441055744.0;
+        else                                          return glMath::round(value);
+    }
+
+
+    // The sine and cosine polynomials of r, once x is reduced to r in [-pi/4, pi/4], with x = r + quadrant * pi/2.
+    // The quadrant (mod 4) is returned as 0, 1, 2 or 3, for sin and cos to pick their polynomial and sign
+    template<FloatingNumber F>
+    inline void sinCosReduced(F x, F& sinR, F& cosR, F& quadrant) noexcept
+    {
+        F j = fast::roundReduction(x * static_cast<F>(0.636619772367581343));
+
+        // pi/2 in 3 parts, the first ones having few bits so that j * part is exact
+        F r = x - j * static_cast<F>(1.5703125);
+        r = r - j * static_cast<F>(4.837512969970703125e-4);
+        r = r - j * static_cast<F>(7.54978995489188216e-8);
+
+        F r2 = r * r;
+
+        sinR = r + r * r2 * (static_cast<F>(-1.6666654611e-1) + r2 * (static_cast<F>(8.3321608736e-3) + r2 * static_cast<F>(-1.9515295891e-4)));
+        cosR = static_cast<F>(1.0) - static_cast<F>(0.5) * r2
+             + r2 * r2 * (static_cast<F>(4.166664568298827e-2) + r2 * (static_cast<F>(-1.388731625493765e-3) + r2 * static_cast<F>(2.443315711809948e-5)));
+
+        // j mod 4, with j - 4 * floor(j / 4)
+        F quarter = j * static_cast<F>(0.25);
+        F floorQuarter = fast::roundReduction(quarter);
+        floorQuarter = glMath::select(floorQuarter > quarter, floorQuarter - static_cast<F>(1.0), floorQuarter);
+
+        quadrant = j - static_cast<F>(4.0) * floorQuarter;
+    }
+
+    // asin(a) for a in [0, 1], and whether the polynomial was computed for sqrt((1 - a) / 2) instead of a
+    template<FloatingNumber F>
+    inline F asinPositive(F a, F& p, auto& isBig) noexcept
+    {
+        isBig = a > static_cast<F>(0.5);
+
+        F z = glMath::select(isBig, static_cast<F>(0.5) * (static_cast<F>(1.0) - a), a * a);
+        F s = glMath::select(isBig, glMath::sqrt(z), a);
+
+        F poly = static_cast<F>(4.2163199048e-2);
+        poly = poly * z + static_cast<F>(2.4181311049e-2);
+        poly = poly * z + static_cast<F>(4.5470025998e-2);
+        poly = poly * z + static_cast<F>(7.4953002686e-2);
+        poly = poly * z + static_cast<F>(1.6666752422e-1);
+
+        // asin(s)
+        p = s + s * z * poly;
+
+        return glMath::select(isBig, static_cast<F>(glMath::halfPi<typename scalarType<F>::type>()) - static_cast<F>(2.0) * p, p);
+    }
+
+    // atan(t) for t >= 0 (infinity included), reduced around 0, tan(pi/8) and tan(3pi/8)
+    template<FloatingNumber F>
+    inline F atanPositive(F t) noexcept
+    {
+        using T = typename scalarType<F>::type;
+
+        auto isBig = t > static_cast<F>(2.414213562373095);
+        auto isMid = t > static_cast<F>(0.4142135623730950);
+
+        F num = glMath::select(isBig, static_cast<F>(-1.0), glMath::select(isMid, t - static_cast<F>(1.0), t));
+        F den = glMath::select(isBig, t, glMath::select(isMid, t + static_cast<F>(1.0), static_cast<F>(1.0)));
+        F y0 = glMath::select(isBig, static_cast<F>(glMath::halfPi<T>()), glMath::select(isMid, static_cast<F>(glMath::pi<T>() * static_cast<T>(0.25)), static_cast<F>(0.0)));
+
+        F u = num / den;
+        F z = u * u;
+
+        F poly = static_cast<F>(8.05374449538e-2);
+        poly = poly * z - static_cast<F>(1.38776856032e-1);
+        poly = poly * z + static_cast<F>(1.99777106478e-1);
+        poly = poly * z - static_cast<F>(3.33329491539e-1);
+
+        return y0 + u + u * z * poly;
+    }
+
+    // Like glMath::abs, and copying the sign of the scalar, for the generic code below
+    template<FloatingNumber F>
+    inline F withSignOf(F magnitude, F sign) noexcept
+    {
+        return glMath::select(sign < static_cast<F>(0.0), -magnitude, magnitude);
+    }
+
+    #pragma endregion
+
+    #pragma region Functions
+
+    template<FloatingNumber F>
+    inline F sin(F x) noexcept
+    {
+        F sinR, cosR, quadrant;
+        fast::sinCosReduced(x, sinR, cosR, quadrant);
+
+        // sin(r + pi/2) = cos(r), sin(r + pi) = -sin(r), sin(r + 3pi/2) = -cos(r), the odd quadrants being the ones 1 away from 2
+        F res = glMath::select(glMath::abs(quadrant - static_cast<F>(2.0)) == static_cast<F>(1.0), cosR, sinR);
+
+        return glMath::select(quadrant >= static_cast<F>(2.0), -res, res);
+    }
+
+    template<FloatingNumber F>
+    inline F cos(F x) noexcept
+    {
+        F sinR, cosR, quadrant;
+        fast::sinCosReduced(x, sinR, cosR, quadrant);
+
+        // cos(r + pi/2) = -sin(r), cos(r + pi) = -cos(r), cos(r + 3pi/2) = sin(r), the negative quadrants being 1 and 2
+        F res = glMath::select(glMath::abs(quadrant - static_cast<F>(2.0)) == static_cast<F>(1.0), sinR, cosR);
+
+        return glMath::select(glMath::abs(quadrant - static_cast<F>(1.5)) < static_cast<F>(1.0), -res, res);
+    }
+
+    template<FloatingNumber F>
+    inline sinCos<F> sincos(F x) noexcept
+    {
+        F sinR, cosR, quadrant;
+        fast::sinCosReduced(x, sinR, cosR, quadrant);
+
+        // The same quadrant rules as sin() and cos() above
+        auto isOdd = glMath::abs(quadrant - static_cast<F>(2.0)) == static_cast<F>(1.0);
+
+        F sinRes = glMath::select(isOdd, cosR, sinR);
+        F cosRes = glMath::select(isOdd, sinR, cosR);
+
+        return {
+            glMath::select(quadrant >= static_cast<F>(2.0), -sinRes, sinRes),
+            glMath::select(glMath::abs(quadrant - static_cast<F>(1.5)) < static_cast<F>(1.0), -cosRes, cosRes)
+        };
+    }
+
+    template<FloatingNumber F>
+    inline F asin(F x) noexcept
+    {
+        F p;
+        decltype(x > x) isBig;
+
+        return fast::withSignOf(fast::asinPositive(glMath::abs(x), p, isBig), x);
+    }
+
+    template<FloatingNumber F>
+    inline F acos(F x) noexcept
+    {
+        using T = typename scalarType<F>::type;
+
+        F p;
+        decltype(x > x) isBig;
+        fast::asinPositive(glMath::abs(x), p, isBig);
+
+        // acos(a) = 2 * asin(sqrt((1 - a) / 2)) above 0.5, pi/2 - asin(a) below, and acos(-a) = pi - acos(a)
+        F res = glMath::select(isBig, static_cast<F>(2.0) * p, static_cast<F>(glMath::halfPi<T>()) - p);
+
+        return glMath::select(x < static_cast<F>(0.0), static_cast<F>(glMath::pi<T>()) - res, res);
+    }
+
+    template<FloatingNumber F>
+    inline F atan(F x) noexcept
+    {
+        return fast::withSignOf(fast::atanPositive(glMath::abs(x)), x);
+    }
+
+    template<FloatingNumber F>
+    inline F atan2(F y, F x) noexcept
+    {
+        using T = typename scalarType<F>::type;
+
+        F absX = glMath::abs(x);
+        F absY = glMath::abs(y);
+
+        // The angle of (|x|, |y|), in [0, pi/2], from the ratio of the smallest by the biggest so that it stays in [0, 1]
+        F big = glMath::max(absX, absY);
+        F ratio = glMath::min(absX, absY) / big;
+        ratio = glMath::select(big == static_cast<F>(0.0), static_cast<F>(0.0), ratio);
+
+        F res = fast::atanPositive(ratio);
+        res = glMath::select(absY > absX, static_cast<F>(glMath::halfPi<T>()) - res, res);
+
+        res = glMath::select(x < static_cast<F>(0.0), static_cast<F>(glMath::pi<T>()) - res, res);
+
+        return fast::withSignOf(res, y);
+    }
+
+    template<FloatingNumber F>
+    inline F exp(F x) noexcept
+    {
+        using T = typename scalarType<F>::type;
+
+        // Beyond, the result is 0 or infinity anyway, and 2^n stays in the range of pow2() once split in two
+        if constexpr (std::is_same_v<T, float>) x = glMath::clamp(x, static_cast<F>(-104.0), static_cast<F>(89.0));
+        else                                    x = glMath::clamp(x, static_cast<F>(-746.0), static_cast<F>(710.0));
+
+        // x = n * ln(2) + r, r in [-ln(2) / 2, ln(2) / 2], ln(2) being in 2 parts
+        F n = fast::roundReduction(x * static_cast<F>(1.44269504088896341));
+
+        F r = x - n * static_cast<F>(0.693359375);
+        r = r + n * static_cast<F>(2.12194440e-4);
+
+        F poly = static_cast<F>(1.9875691500e-4);
+        poly = poly * r + static_cast<F>(1.3981999507e-3);
+        poly = poly * r + static_cast<F>(8.3334519073e-3);
+        poly = poly * r + static_cast<F>(4.1665795894e-2);
+        poly = poly * r + static_cast<F>(1.6666665459e-1);
+        poly = poly * r + static_cast<F>(5.0000001201e-1);
+
+        F expR = static_cast<F>(1.0) + r + r * r * poly;
+
+        // 2^n as 2^n1 * 2^n2, so that the results near the overflow and in the denormals are right
+        F n1 = fast::roundReduction(n * static_cast<F>(0.5));
+        F n2 = n - n1;
+
+        return expR * fast::pow2(n1) * fast::pow2(n2);
+    }
+
+    template<FloatingNumber F>
+    inline F log(F x) noexcept
+    {
+        using T = typename scalarType<F>::type;
+
+        // The denormals are scaled to normal values first, 2^(mantissa bits + 1) being taken back from the exponent
+        constexpr T denormalScale = std::is_same_v<T, float> ? static_cast<T>(16777216.0) : static_cast<T>(18014398509481984.0);
+        constexpr T denormalExponent = std::is_same_v<T, float> ? static_cast<T>(24.0) : static_cast<T>(54.0);
+
+        auto isDenormal = x < static_cast<F>(std::numeric_limits<T>::min());
+        F normal = glMath::select(isDenormal, x * static_cast<F>(denormalScale), x);
+
+        // x = m * 2^e, m in [sqrt(2) / 2, sqrt(2))
+        F e = fast::exponent(normal) - glMath::select(isDenormal, static_cast<F>(denormalExponent), static_cast<F>(0.0));
+        F m = fast::mantissa(normal);
+
+        auto isAboveSqrt2 = m > static_cast<F>(1.41421356237309505);
+        m = glMath::select(isAboveSqrt2, m * static_cast<F>(0.5), m);
+        e = glMath::select(isAboveSqrt2, e + static_cast<F>(1.0), e);
+
+        F f = m - static_cast<F>(1.0);
+        F z = f * f;
+
+        F poly = static_cast<F>(7.0376836292e-2);
+        poly = poly * f - static_cast<F>(1.1514610310e-1);
+        poly = poly * f + static_cast<F>(1.1676998740e-1);
+        poly = poly * f - static_cast<F>(1.2420140846e-1);
+        poly = poly * f + static_cast<F>(1.4249322787e-1);
+        poly = poly * f - static_cast<F>(1.6668057665e-1);
+        poly = poly * f + static_cast<F>(2.0000714765e-1);
+        poly = poly * f - static_cast<F>(2.4999993993e-1);
+        poly = poly * f + static_cast<F>(3.3333331174e-1);
+
+        // ln(x) = ln(m) + e * ln(2), ln(2) being in 2 parts
+        F y = f * z * poly;
+        y = y - e * static_cast<F>(2.12194440e-4);
+        y = y - static_cast<F>(0.5) * z;
+
+        F res = f + y + e * static_cast<F>(0.693359375);
+
+        // The special values, like std::log
+        constexpr T inf = std::numeric_limits<T>::infinity();
+        constexpr T nan = std::numeric_limits<T>::quiet_NaN();
+
+        res = glMath::select(x == static_cast<F>(inf), static_cast<F>(inf), res);
+        res = glMath::select(x == static_cast<F>(0.0), static_cast<F>(-inf), res);
+        res = glMath::select(x < static_cast<F>(0.0), static_cast<F>(nan), res);
+
+        return glMath::select(x != x, x, res);
+    }
+
+    // sin(t * a) / sin(a) = t * (1 + b1 * (1 + b2 * (1 + ...))), with bi = (u[i] * t^2 - v[i]) * (cos(a) - 1), 
+    // u[i] = 1 / (i * (2i + 1)) and v[i] = i / (2i + 1). The 8 first terms are kept, the last one being scaled by Eberly's 1 + mu
+    // to make up for the others. The kernels of glMath::dispatch use them as well
+    template<std::floating_point T>
+    struct slerpSeries
+    {
+        static constexpr T onePlusMu = static_cast<T>(1.90110745351730037);
+        static constexpr T u[8] = { static_cast<T>(1.0 / 3.0),  static_cast<T>(1.0 / 10.0), static_cast<T>(1.0 / 21.0), static_cast<T>(1.0 / 36.0),
+                                    static_cast<T>(1.0 / 55.0), static_cast<T>(1.0 / 78.0), static_cast<T>(1.0 / 105.0), onePlusMu / static_cast<T>(136.0) };
+        static constexpr T v[8] = { static_cast<T>(1.0 / 3.0),  static_cast<T>(2.0 / 5.0),  static_cast<T>(3.0 / 7.0),  static_cast<T>(4.0 / 9.0),
+                                    static_cast<T>(5.0 / 11.0), static_cast<T>(6.0 / 13.0), static_cast<T>(7.0 / 15.0), onePlusMu * static_cast<T>(8.0 / 17.0) };
+    };
+
+    template<FloatingNumber F>
+    inline lerpWeights<F> slerpWeights(F cosAngle, F t) noexcept
+    {
+        using T = typename scalarType<F>::type;
+
+        constexpr const T* u = slerpSeries<T>::u;
+        constexpr const T* v = slerpSeries<T>::v;
+
+        // The series is the most precise near cos(a) = 1, so it runs on half the angle, h = a / 2 :
+        // sin(t * a) / sin(a) = (sin(2t * h) / sin(h)) / (2 * cos(h)), with cos(h) = sqrt((1 + cos(a)) / 2)
+        F cosHalf = glMath::sqrt(glMath::max((static_cast<F>(1.0) + cosAngle) * static_cast<F>(0.5), static_cast<F>(0.0)));
+        F cosHalfM1 = cosHalf - static_cast<F>(1.0);
+
+        F tStart = static_cast<F>(2.0) - t * static_cast<F>(2.0);
+        F tEnd = t * static_cast<F>(2.0);
+        F tStartSq = tStart * tStart;
+        F tEndSq = tEnd * tEnd;
+
+        F sumStart = static_cast<F>(1.0);
+        F sumEnd = static_cast<F>(1.0);
+
+        for (int i = 7; i >= 0; i--)
+        {
+            sumStart = static_cast<F>(1.0) + (static_cast<F>(u[i]) * tStartSq - static_cast<F>(v[i])) * cosHalfM1 * sumStart;
+            sumEnd = static_cast<F>(1.0) + (static_cast<F>(u[i]) * tEndSq - static_cast<F>(v[i])) * cosHalfM1 * sumEnd;
+        }
+
+        F invCosHalf = static_cast<F>(1.0) / cosHalf;
+
+        return { (static_cast<F>(1.0) - t) * sumStart * invCosHalf, t * sumEnd * invCosHalf };
+    }
+
+    #pragma endregion
+
+    #pragma region BatchedFunctions
+
+    // results[i] = function(values[i]), with the widest lane type, then one value at a time for the tail.
+    // Without SIMD the lanes are plain arrays, slower than the scalar functions, so everything is done one value at a time
+    template<std::floating_point F, typename Function>
+    inline void applyBatched(std::span<const F> values, std::span<F> results, Function function)
+    {
+        using L = lanes<F, simd::widestLaneWidth<F>>;
+
+        assert(results.size() >= values.size());
+
+        const F* in = values.data();
+        F* out = results.data();
+
+        std::size_t count = values.size();
+        std::size_t laneCount = simd::hasLaneRegister<F, L::width> ? count - count % L::width : 0;
+        std::size_t i = 0;
+
+        for (; i < laneCount; i += L::width)
+        {
+            function(L::load(in + i)).store(out + i);
+        }
+
+        for (; i < count; i++)
+        {
+            out[i] = function(in[i]);
+        }
+    }
+
+    template<std::floating_point F>
+    inline void sin(std::span<const F> values, std::span<F> results)
+    {
+        fast::applyBatched(values, results, [](auto x) { return fast::sin(x); });
+    }
+
+    template<std::floating_point F>
+    inline void cos(std::span<const F> values, std::span<F> results)
+    {
+        fast::applyBatched(values, results, [](auto x) { return fast::cos(x); });
+    }
+
+    template<std::floating_point F>
+    inline void sincos(std::span<const F> values, std::span<F> sines, std::span<F> cosines)
+    {
+        using L = lanes<F, simd::widestLaneWidth<F>>;
+
+        assert(sines.size() >= values.size() && cosines.size() >= values.size());
+
+        const F* in = values.data();
+        F* outSin = sines.data();
+        F* outCos = cosines.data();
+
+        std::size_t count = values.size();
+        std::size_t laneCount = simd::hasLaneRegister<F, L::width> ? count - count % L::width : 0;
+        std::size_t i = 0;
+
+        for (; i < laneCount; i += L::width)
+        {
+            sinCos<L> res = fast::sincos(L::load(in + i));
+            res.sin.store(outSin + i);
+            res.cos.store(outCos + i);
+        }
+
+        for (; i < count; i++)
+        {
+            sinCos<F> res = fast::sincos(in[i]);
+            outSin[i] = res.sin;
+            outCos[i] = res.cos;
+        }
+    }
+
+    template<std::floating_point F>
+    inline void asin(std::span<const F> values, std::span<F> results)
+    {
+        fast::applyBatched(values, results, [](auto x) { return fast::asin(x); });
+    }
+
+    template<std::floating_point F>
+    inline void acos(std::span<const F> values, std::span<F> results)
+    {
+        fast::applyBatched(values, results, [](auto x) { return fast::acos(x); });
+    }
+
+    template<std::floating_point F>
+    inline void atan(std::span<const F> values, std::span<F> results)
+    {
+        fast::applyBatched(values, results, [](auto x) { return fast::atan(x); });
+    }
+
+    template<std::floating_point F>
+    inline void atan2(std::span<const F> ys, std::span<const F> xs, std::span<F> results)
+    {
+        using L = lanes<F, simd::widestLaneWidth<F>>;
+
+        assert(xs.size() >= ys.size() && results.size() >= ys.size());
+
+        const F* inY = ys.data();
+        const F* inX = xs.data();
+        F* out = results.data();
+
+        std::size_t count = ys.size();
+        std::size_t laneCount = simd::hasLaneRegister<F, L::width> ? count - count % L::width : 0;
+        std::size_t i = 0;
+
+        for (; i < laneCount; i += L::width)
+        {
+            fast::atan2(L::load(inY + i), L::load(inX + i)).store(out + i);
+        }
+
+        for (; i < count; i++)
+        {
+            out[i] = fast::atan2(inY[i], inX[i]);
+        }
+    }
+
+    template<std::floating_point F>
+    inline void exp(std::span<const F> values, std::span<F> results)
+    {
+        fast::applyBatched(values, results, [](auto x) { return fast::exp(x); });
+    }
+
+    template<std::floating_point F>
+    inline void log(std::span<const F> values, std::span<F> results)
+    {
+        fast::applyBatched(values, results, [](auto x) { return fast::log(x); });
+    }
+
+    #pragma endregion
+}
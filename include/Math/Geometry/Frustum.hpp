@@ -0,0 +1,71 @@
+#pragma once
+
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+#include "Math\Concepts.hpp"
+#include "Math\Vectors\Vector3.hpp"
+#include "Math\Vectors\Vector4.hpp"
+#include "Math\Matrices\Matrix4x4.hpp"
+
+namespace glMath
+{
+    /// @brief A struct used to represent a view frustum, as 6 planes pointing inwards, used to cull spheres and boxes
+    /// @tparam F The type of the values stored in the planes, a FloatingNumber, so a float or a double
+    template<FloatingNumber F>
+    struct frustum
+    {
+    public:
+        /// @brief The planes, in the order left, right, bottom, top, near, far. 
+        /// Each one is (a, b, c, d) with a normalized (a, b, c), and a point p is on its inner side if a*p.x + b*p.y + c*p.z + d >= 0
+        vec4<F> planes[6];
+
+    public:
+        frustum();
+        /// @brief Extracts the planes of a matrix (Gribb-Hartmann), in the space the matrix transforms from. 
+        /// With a projection * view matrix, the planes are in world space, and with projection * view * model, in model space
+        /// @param mat Any matrix giving OpenGL clip coordinates, so -w <= x, y, z <= w
+        frustum(const mat4<F>& mat);
+
+        static frustum fromMat(const mat4<F>& mat);
+
+        bool containsPoint(const vec3<F>& point) const;
+        /// @brief Returns false only if the sphere is fully outside one of the planes, 
+        /// so a few spheres near the corners are kept even if they are outside. A sphere with a NaN is kept
+        /// @param radius Must be positive or zero
+        bool intersectsSphere(const vec3<F>& center, F radius) const;
+        /// @brief Returns false only if the box is fully outside one of the planes, 
+        /// so a few boxes near the corners are kept even if they are outside. A box with a NaN is kept
+        /// @param center The center of the axis-aligned box
+        /// @param extents The half size of the box on each axis, positive or zero
+        bool intersectsAABB(const vec3<F>& center, const vec3<F>& extents) const;
+
+        /// @brief A function to test many spheres at once, stored as structure-of-arrays. 
+        /// With SIMD, 4 or 8 spheres are tested per step, with the same result as intersectsSphere() for each
+        /// @param visibleMask One bit per sphere, set if it is visible. It needs at least (x.size() + 63) / 64 words, which are overwritten
+        void testSpheres(std::span<const F> x, std::span<const F> y, std::span<const F> z, std::span<const F> radius, 
+                         std::span<std::uint64_t> visibleMask) const;
+        /// @brief A function to test many spheres at once, stored as structure-of-arrays, and write the indices of the visible ones
+        /// @param visibleIndices Where the indices of the visible spheres are written, in increasing order, as big as x at most
+        /// @return How many spheres are visible, so how many indices were written
+        std::size_t cullSpheres(std::span<const F> x, std::span<const F> y, std::span<const F> z, std::span<const F> radius, 
+                                std::span<std::uint32_t> visibleIndices) const;
+
+        /// @brief A function to test many axis-aligned boxes at once, given by their centers and half extents, stored as structure-of-arrays. 
+        /// With SIMD, 4 or 8 boxes are tested per step, with the same result as intersectsAABB() for each
+        /// @param visibleMask One bit per box, set if it is visible. It needs at least (centerX.size() + 63) / 64 words, which are overwritten
+        void testAABBs(std::span<const F> centerX, std::span<const F> centerY, std::span<const F> centerZ, 
+                       std::span<const F> extentX, std::span<const F> extentY, std::span<const F> extentZ, 
+                       std::span<std::uint64_t> visibleMask) const;
+        /// @brief A function to test many axis-aligned boxes at once, stored as structure-of-arrays, and write the indices of the visible ones
+        /// @param visibleIndices Where the indices of the visible boxes are written, in increasing order, as big as centerX at most
+        /// @return How many boxes are visible, so how many indices were written
+        std::size_t cullAABBs(std::span<const F> centerX, std::span<const F> centerY, std::span<const F> centerZ, 
+                              std::span<const F> extentX, std::span<const F> extentY, std::span<const F> extentZ, 
+                              std::span<std::uint32_t> visibleIndices) const;
+    };
+}
+
+#include "Math\Geometry\Frustum.inl"
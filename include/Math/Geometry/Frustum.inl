@@ -0,0 +1,232 @@
+#include <concepts>
+#include <cmath>
+#include <algorithm>
+#include <bit>
+#include <cassert>
+
+#include "Math\MathInternal.hpp"
+#include "Math\SimdInternal.hpp"
+
+namespace glMath
+{
+
+    #pragma region Constructors
+
+    template<FloatingNumber F>
+    inline frustum<F>::frustum()
+    {
+        F f0 = static_cast<F>(0.0);
+
+        for (int i = 0; i < 6; i++)
+        {
+            planes[i] = vec4<F>(f0, f0, f0, f0);
+        }
+    }
+
+    template<FloatingNumber F>
+    inline frustum<F>::frustum(const mat4<F>& mat)
+    {
+        // The rows of the matrix, the matrix being column-major
+        vec4<F> rows[4];
+        for (int r = 0; r < 4; r++)
+        {
+            rows[r] = vec4<F>(mat.columns[0][r], mat.columns[1][r], mat.columns[2][r], mat.columns[3][r]);
+        }
+
+        // -w <= x <= w, -w <= y <= w and -w <= z <= w, so each plane is w + or - one of the other rows
+        for (int i = 0; i < 3; i++)
+        {
+            planes[i * 2 + 0] = vec4<F>(rows[3].x + rows[i].x, rows[3].y + rows[i].y, rows[3].z + rows[i].z, rows[3].w + rows[i].w);
+            planes[i * 2 + 1] = vec4<F>(rows[3].x - rows[i].x, rows[3].y - rows[i].y, rows[3].z - rows[i].z, rows[3].w - rows[i].w);
+        }
+
+        for (int i = 0; i < 6; i++)
+        {
+            vec4<F>& plane = planes[i];
+
+            F len = std::sqrt(plane.x * plane.x + plane.y * plane.y + plane.z * plane.z);
+
+            if (len > glMath::epsilon<F>())
+            {
+                F invLen = static_cast<F>(1.0) / len;
+
+                plane = vec4<F>(plane.x * invLen, plane.y * invLen, plane.z * invLen, plane.w * invLen);
+            }
+        }
+    }
+
+    template<FloatingNumber F>
+    inline frustum<F> frustum<F>::fromMat(const mat4<F>& mat)
+    {
+        return frustum<F>(mat);
+    }
+
+    #pragma endregion
+
+    #pragma region Single tests
+
+    template<FloatingNumber F>
+    inline bool frustum<F>::containsPoint(const vec3<F>& point) const
+    {
+        return intersectsSphere(point, static_cast<F>(0.0));
+    }
+
+    template<FloatingNumber F>
+    inline bool frustum<F>::intersectsSphere(const vec3<F>& center, F radius) const
+    {
+        assert(!(radius < static_cast<F>(0.0)));
+
+        for (int i = 0; i < 6; i++)
+        {
+            const vec4<F>& plane = planes[i];
+
+            if (plane.x * center.x + plane.y * center.y + plane.z * center.z + plane.w < -radius) return false;
+        }
+
+        return true;
+    }
+
+    template<FloatingNumber F>
+    inline bool frustum<F>::intersectsAABB(const vec3<F>& center, const vec3<F>& extents) const
+    {
+        assert(!(extents.x < static_cast<F>(0.0) || extents.y < static_cast<F>(0.0) || extents.z < static_cast<F>(0.0)));
+
+        for (int i = 0; i < 6; i++)
+        {
+            const vec4<F>& plane = planes[i];
+
+            // The box projected on the normal of the plane
+            F radius = std::abs(plane.x) * extents.x + std::abs(plane.y) * extents.y + std::abs(plane.z) * extents.z;
+
+            if (plane.x * center.x + plane.y * center.y + plane.z * center.z + plane.w < -radius) return false;
+        }
+
+        return true;
+    }
+
+    #pragma endregion
+
+    #pragma region Batch tests
+
+    template<FloatingNumber F>
+    inline void frustum<F>::testSpheres(std::span<const F> x, std::span<const F> y, std::span<const F> z, std::span<const F> radius, 
+                                        std::span<std::uint64_t> visibleMask) const
+    {
+        std::size_t count = x.size();
+
+        assert(y.size() >= count && z.size() >= count && radius.size() >= count);
+        assert(std::none_of(radius.begin(), radius.begin() + count, [](F r) { return r < static_cast<F>(0.0); }));
+        assert(visibleMask.size() >= (count + 63) / 64);
+
+        std::fill_n(visibleMask.data(), (count + 63) / 64, static_cast<std::uint64_t>(0));
+
+        std::size_t i = 0;
+
+        if constexpr (simd::hasFrustumKernel<F>)
+        {
+            i = simd::frustumTestSpheres(reinterpret_cast<const F*>(planes), x.data(), y.data(), z.data(), radius.data(), count, visibleMask.data());
+        }
+
+        // The tail (or everything, without SIMD)
+        for (; i < count; i++)
+        {
+            if (intersectsSphere(vec3<F>(x[i], y[i], z[i]), radius[i]))
+            {
+                visibleMask[i >> 6] |= static_cast<std::uint64_t>(1) << (i & 63);
+            }
+        }
+    }
+
+    template<FloatingNumber F>
+    inline std::size_t frustum<F>::cullSpheres(std::span<const F> x, std::span<const F> y, std::span<const F> z, std::span<const F> radius, 
+                                               std::span<std::uint32_t> visibleIndices) const
+    {
+        std::size_t count = x.size();
+        std::size_t visibleCount = 0;
+
+        // 64 spheres at a time, so the mask stays one word
+        for (std::size_t start = 0; start < count; start += 64)
+        {
+            std::size_t n = std::min<std::size_t>(64, count - start);
+
+            std::uint64_t mask;
+            testSpheres(x.subspan(start, n), y.subspan(start, n), z.subspan(start, n), radius.subspan(start, n), std::span<std::uint64_t>(&mask, 1));
+
+            while (mask != 0)
+            {
+                assert(visibleCount < visibleIndices.size());
+
+                visibleIndices[visibleCount++] = static_cast<std::uint32_t>(start + std::countr_zero(mask));
+                mask &= mask - 1;
+            }
+        }
+
+        return visibleCount;
+    }
+
+    template<FloatingNumber F>
+    inline void frustum<F>::testAABBs(std::span<const F> centerX, std::span<const F> centerY, std::span<const F> centerZ, 
+                                      std::span<const F> extentX, std::span<const F> extentY, std::span<const F> extentZ, 
+                                      std::span<std::uint64_t> visibleMask) const
+    {
+        std::size_t count = centerX.size();
+
+        assert(centerY.size() >= count && centerZ.size() >= count);
+        assert(extentX.size() >= count && extentY.size() >= count && extentZ.size() >= count);
+        assert(std::none_of(extentX.begin(), extentX.begin() + count, [](F e) { return e < static_cast<F>(0.0); }) && 
+               std::none_of(extentY.begin(), extentY.begin() + count, [](F e) { return e < static_cast<F>(0.0); }) && 
+               std::none_of(extentZ.begin(), extentZ.begin() + count, [](F e) { return e < static_cast<F>(0.0); }));
+        assert(visibleMask.size() >= (count + 63) / 64);
+
+        std::fill_n(visibleMask.data(), (count + 63) / 64, static_cast<std::uint64_t>(0));
+
+        std::size_t i = 0;
+
+        if constexpr (simd::hasFrustumKernel<F>)
+        {
+            i = simd::frustumTestAABBs(reinterpret_cast<const F*>(planes), centerX.data(), centerY.data(), centerZ.data(), 
+                                       extentX.data(), extentY.data(), extentZ.data(), count, visibleMask.data());
+        }
+
+        // The tail (or everything, without SIMD)
+        for (; i < count; i++)
+        {
+            if (intersectsAABB(vec3<F>(centerX[i], centerY[i], centerZ[i]), vec3<F>(extentX[i], extentY[i], extentZ[i])))
+            {
+                visibleMask[i >> 6] |= static_cast<std::uint64_t>(1) << (i & 63);
+            }
+        }
+    }
+
+    template<FloatingNumber F>
+    inline std::size_t frustum<F>::cullAABBs(std::span<const F> centerX, std::span<const F> centerY, std::span<const F> centerZ, 
+                                             std::span<const F> extentX, std::span<const F> extentY, std::span<const F> extentZ, 
+                                             std::span<std::uint32_t> visibleIndices) const
+    {
+        std::size_t count = centerX.size();
+        std::size_t visibleCount = 0;
+
+        // 64 boxes at a time, so the mask stays one word
+        for (std::size_t start = 0; start < count; start += 64)
+        {
+            std::size_t n = std::min<std::size_t>(64, count - start);
+
+            std::uint64_t mask;
+            testAABBs(centerX.subspan(start, n), centerY.subspan(start, n), centerZ.subspan(start, n), 
+                      extentX.subspan(start, n), extentY.subspan(start, n), extentZ.subspan(start, n), std::span<std::uint64_t>(&mask, 1));
+
+            while (mask != 0)
+            {
+                assert(visibleCount < visibleIndices.size());
+
+                visibleIndices[visibleCount++] = static_cast<std::uint32_t>(start + std::countr_zero(mask));
+                mask &= mask - 1;
+            }
+        }
+
+        return visibleCount;
+    }
+
+    #pragma endregion
+
+}
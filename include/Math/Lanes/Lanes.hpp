@@ -0,0 +1,165 @@
+#pragma once
+
+#include <concepts>
+#include <cstddef>
+#include <span>
+#include <type_traits>
+
+#include "Math\Concepts.hpp"
+#include "Math\SimdInternal.hpp"
+#include "Math\Vectors\Vector3.hpp"
+#include "Math\Vectors\Vector4.hpp"
+#include "Math\Quaternions\Quaternion.hpp"
+
+namespace glMath
+{
+    template<typename T, std::size_t W>
+    struct laneMask;
+
+    /// @brief W floats or doubles processed at once, backed by one SSE or AVX register when the build has it, else by a plain array.
+    /// It's a FloatingNumber, so vec3<float8>, vec4<double4> or quat<float8> hold W vectors or quaternions (one per lane),
+    /// and their functions compute all of them at once (AoSoA). The comparisons return a laneMask instead of a bool,
+    /// so only the functions without branches, or with a lane path, can be used with them
+    /// (the arithmetic, dotProduct, crossProduct, length, normalize, lerp, slerp, quat::rotatePoint...)
+    /// @tparam T float or double
+    /// @tparam W The number of lanes, 4 or 8 for float, 2 or 4 for double
+    template<typename T, std::size_t W>
+    struct alignas(sizeof(T) * W) lanes
+    {
+        static_assert(std::is_same_v<T, float> || std::is_same_v<T, double>, "glMath::lanes : the lanes must be floats or doubles");
+
+    public:
+        using valueType = T;
+        using registerType = typename simd::laneRegister<T, W>::type;
+
+        static constexpr std::size_t width = W;
+
+        union
+        {
+            registerType reg; // Only used if simd::hasLaneRegister<T, W>
+            T values[W];
+        };
+
+    public:
+        // Left uninitialized, like a float
+        lanes() noexcept = default;
+        // Every lane is value, and it's implicit so that static_cast<F>(1.0) and the scalar constants work
+        inline lanes(T value) noexcept;
+
+        /// @brief A function to read W values, that don't need to be aligned
+        inline static lanes load(const T* ptr) noexcept;
+        /// @brief A function to write the W values, that don't need to be aligned
+        inline void store(T* ptr) const noexcept;
+
+        inline T operator[](std::size_t lane) const noexcept { return values[lane]; };
+        inline T& operator[](std::size_t lane) noexcept { return values[lane]; };
+
+        inline lanes& operator+=(const lanes& other) noexcept;
+        inline lanes& operator-=(const lanes& other) noexcept;
+        inline lanes& operator*=(const lanes& other) noexcept;
+        inline lanes& operator/=(const lanes& other) noexcept;
+
+        inline lanes operator-() const noexcept;
+    };
+
+    /// @brief The result of a comparison of two lanes : all the bits of a lane are set where the comparison is true
+    template<typename T, std::size_t W>
+    struct laneMask
+    {
+    public:
+        using registerType = typename simd::laneRegister<T, W>::type;
+
+        union
+        {
+            registerType reg; // Only used if simd::hasLaneRegister<T, W>
+            bool values[W];
+        };
+
+    public:
+        laneMask() noexcept = default;
+
+        inline bool operator[](std::size_t lane) const noexcept;
+    };
+
+    using float4  = lanes<float, 4>;
+    using float8  = lanes<float, 8>;
+    using double2 = lanes<double, 2>;
+    using double4 = lanes<double, 4>;
+
+
+    template<typename T, std::size_t W>
+    inline lanes<T, W> operator+(const lanes<T, W>& a, const lanes<T, W>& b) noexcept;
+    template<typename T, std::size_t W>
+    inline lanes<T, W> operator-(const lanes<T, W>& a, const lanes<T, W>& b) noexcept;
+    template<typename T, std::size_t W>
+    inline lanes<T, W> operator*(const lanes<T, W>& a, const lanes<T, W>& b) noexcept;
+    template<typename T, std::size_t W>
+    inline lanes<T, W> operator/(const lanes<T, W>& a, const lanes<T, W>& b) noexcept;
+
+    // With a scalar on one side, which is broadcast to every lane (so 2 * lanes works, like 2 * float)
+    template<typename T, std::size_t W>
+    inline lanes<T, W> operator+(const lanes<T, W>& a, std::type_identity_t<T> b) noexcept { return a + lanes<T, W>(b); };
+    template<typename T, std::size_t W>
+    inline lanes<T, W> operator+(std::type_identity_t<T> a, const lanes<T, W>& b) noexcept { return lanes<T, W>(a) + b; };
+    template<typename T, std::size_t W>
+    inline lanes<T, W> operator-(const lanes<T, W>& a, std::type_identity_t<T> b) noexcept { return a - lanes<T, W>(b); };
+    template<typename T, std::size_t W>
+    inline lanes<T, W> operator-(std::type_identity_t<T> a, const lanes<T, W>& b) noexcept { return lanes<T, W>(a) - b; };
+    template<typename T, std::size_t W>
+    inline lanes<T, W> operator*(const lanes<T, W>& a, std::type_identity_t<T> b) noexcept { return a * lanes<T, W>(b); };
+    template<typename T, std::size_t W>
+    inline lanes<T, W> operator*(std::type_identity_t<T> a, const lanes<T, W>& b) noexcept { return lanes<T, W>(a) * b; };
+    template<typename T, std::size_t W>
+    inline lanes<T, W> operator/(const lanes<T, W>& a, std::type_identity_t<T> b) noexcept { return a / lanes<T, W>(b); };
+    template<typename T, std::size_t W>
+    inline lanes<T, W> operator/(std::type_identity_t<T> a, const lanes<T, W>& b) noexcept { return lanes<T, W>(a) / b; };
+
+    template<typename T, std::size_t W>
+    inline laneMask<T, W> operator<(const lanes<T, W>& a, const lanes<T, W>& b) noexcept;
+    template<typename T, std::size_t W>
+    inline laneMask<T, W> operator<=(const lanes<T, W>& a, const lanes<T, W>& b) noexcept;
+    template<typename T, std::size_t W>
+    inline laneMask<T, W> operator>(const lanes<T, W>& a, const lanes<T, W>& b) noexcept;
+    template<typename T, std::size_t W>
+    inline laneMask<T, W> operator>=(const lanes<T, W>& a, const lanes<T, W>& b) noexcept;
+    template<typename T, std::size_t W>
+    inline laneMask<T, W> operator==(const lanes<T, W>& a, const lanes<T, W>& b) noexcept;
+    template<typename T, std::size_t W>
+    inline laneMask<T, W> operator!=(const lanes<T, W>& a, const lanes<T, W>& b) noexcept;
+
+    template<typename T, std::size_t W>
+    inline laneMask<T, W> operator&&(const laneMask<T, W>& a, const laneMask<T, W>& b) noexcept;
+    template<typename T, std::size_t W>
+    inline laneMask<T, W> operator||(const laneMask<T, W>& a, const laneMask<T, W>& b) noexcept;
+    template<typename T, std::size_t W>
+    inline laneMask<T, W> operator!(const laneMask<T, W>& a) noexcept;
+
+    /// @brief True if the mask is true in at least one lane
+    template<typename T, std::size_t W>
+    inline bool any(const laneMask<T, W>& mask) noexcept;
+    /// @brief True if the mask is true in every lane
+    template<typename T, std::size_t W>
+    inline bool all(const laneMask<T, W>& mask) noexcept;
+
+
+    /// @brief A function to pack W vectors into one vector of lanes, the lane i holding vectors[i].
+    /// If there are fewer than W vectors, the missing lanes are 0
+    /// @tparam L The lane type, float8...
+    template<LaneNumber L>
+    inline vec3<L> gather(std::span<const vec3<typename L::valueType>> vectors) noexcept;
+    template<LaneNumber L>
+    inline vec4<L> gather(std::span<const vec4<typename L::valueType>> vectors) noexcept;
+    template<LaneNumber L>
+    inline quat<L> gather(std::span<const quat<typename L::valueType>> quats) noexcept;
+
+    /// @brief A function to unpack a vector of lanes into W vectors, the lane i going to vectors[i].
+    /// If vectors is smaller than W, only its size is written
+    template<LaneNumber L>
+    inline void scatter(const vec3<L>& packet, std::span<vec3<typename L::valueType>> vectors) noexcept;
+    template<LaneNumber L>
+    inline void scatter(const vec4<L>& packet, std::span<vec4<typename L::valueType>> vectors) noexcept;
+    template<LaneNumber L>
+    inline void scatter(const quat<L>& packet, std::span<quat<typename L::valueType>> quats) noexcept;
+}
+
+#include "Math\Lanes\Lanes.inl"
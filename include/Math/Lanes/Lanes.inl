@@ -0,0 +1,556 @@
+#include <concepts>
+#include <cmath>
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+
+#include "Math\MathInternal.hpp"
+
+namespace glMath
+{
+    #pragma region Lanes
+
+    template<typename T, std::size_t W>
+    inline lanes<T, W>::lanes(T value) noexcept
+    {
+        if constexpr (simd::hasLaneRegister<T, W>)
+        {
+            reg = simd::laneSet<T, W>(value);
+        }
+        else
+        {
+            for (std::size_t i = 0; i < W; i++) values[i] = value;
+        }
+    }
+
+    template<typename T, std::size_t W>
+    inline lanes<T, W> lanes<T, W>::load(const T* ptr) noexcept
+    {
+        lanes<T, W> res;
+
+        if constexpr (simd::hasLaneRegister<T, W>)
+        {
+            res.reg = simd::laneLoad<T, W>(ptr);
+        }
+        else
+        {
+            for (std::size_t i = 0; i < W; i++) res.values[i] = ptr[i];
+        }
+
+        return res;
+    }
+
+    template<typename T, std::size_t W>
+    inline void lanes<T, W>::store(T* ptr) const noexcept
+    {
+        if constexpr (simd::hasLaneRegister<T, W>)
+        {
+            simd::laneStore(ptr, reg);
+        }
+        else
+        {
+            for (std::size_t i = 0; i < W; i++) ptr[i] = values[i];
+        }
+    }
+
+    template<typename T, std::size_t W>
+    inline lanes<T, W>& lanes<T, W>::operator+=(const lanes<T, W>& other) noexcept
+    {
+        *this = *this + other;
+        return *this;
+    }
+
+    template<typename T, std::size_t W>
+    inline lanes<T, W>& lanes<T, W>::operator-=(const lanes<T, W>& other) noexcept
+    {
+        *this = *this - other;
+        return *this;
+    }
+
+    template<typename T, std::size_t W>
+    inline lanes<T, W>& lanes<T, W>::operator*=(const lanes<T, W>& other) noexcept
+    {
+        *this = *this * other;
+        return *this;
+    }
+
+    template<typename T, std::size_t W>
+    inline lanes<T, W>& lanes<T, W>::operator/=(const lanes<T, W>& other) noexcept
+    {
+        *this = *this / other;
+        return *this;
+    }
+
+    template<typename T, std::size_t W>
+    inline lanes<T, W> lanes<T, W>::operator-() const noexcept
+    {
+        if constexpr (simd::hasLaneRegister<T, W>)
+        {
+            // Flips the sign bit, so -0 and 0 stay distinct like with a scalar
+            lanes<T, W> res;
+            res.reg = simd::laneXor(reg, simd::laneSet<T, W>(static_cast<T>(-0.0)));
+            return res;
+        }
+        else
+        {
+            lanes<T, W> res;
+            for (std::size_t i = 0; i < W; i++) res.values[i] = -values[i];
+            return res;
+        }
+    }
+
+    template<typename T, std::size_t W>
+    inline bool laneMask<T, W>::operator[](std::size_t lane) const noexcept
+    {
+        if constexpr (simd::hasLaneRegister<T, W>)
+        {
+            return (simd::laneMoveMask(reg) >> lane) & 1;
+        }
+        else
+        {
+            return values[lane];
+        }
+    }
+
+    #pragma endregion
+
+    #pragma region Operators
+
+    template<typename T, std::size_t W>
+    inline lanes<T, W> operator+(const lanes<T, W>& a, const lanes<T, W>& b) noexcept
+    {
+        lanes<T, W> res;
+
+        if constexpr (simd::hasLaneRegister<T, W>) res.reg = simd::laneAdd(a.reg, b.reg);
+        else for (std::size_t i = 0; i < W; i++) res.values[i] = a.values[i] + b.values[i];
+
+        return res;
+    }
+
+    template<typename T, std::size_t W>
+    inline lanes<T, W> operator-(const lanes<T, W>& a, const lanes<T, W>& b) noexcept
+    {
+        lanes<T, W> res;
+
+        if constexpr (simd::hasLaneRegister<T, W>) res.reg = simd::laneSub(a.reg, b.reg);
+        else for (std::size_t i = 0; i < W; i++) res.values[i] = a.values[i] - b.values[i];
+
+        return res;
+    }
+
+    template<typename T, std::size_t W>
+    inline lanes<T, W> operator*(const lanes<T, W>& a, const lanes<T, W>& b) noexcept
+    {
+        lanes<T, W> res;
+
+        if constexpr (simd::hasLaneRegister<T, W>) res.reg = simd::laneMul(a.reg, b.reg);
+        else for (std::size_t i = 0; i < W; i++) res.values[i] = a.values[i] * b.values[i];
+
+        return res;
+    }
+
+    template<typename T, std::size_t W>
+    inline lanes<T, W> operator/(const lanes<T, W>& a, const lanes<T, W>& b) noexcept
+    {
+        lanes<T, W> res;
+
+        if constexpr (simd::hasLaneRegister<T, W>) res.reg = simd::laneDiv(a.reg, b.reg);
+        else for (std::size_t i = 0; i < W; i++) res.values[i] = a.values[i] / b.values[i];
+
+        return res;
+    }
+
+
+    template<typename T, std::size_t W>
+    inline laneMask<T, W> operator<(const lanes<T, W>& a, const lanes<T, W>& b) noexcept
+    {
+        laneMask<T, W> res;
+
+        if constexpr (simd::hasLaneRegister<T, W>) res.reg = simd::laneCmpLt(a.reg, b.reg);
+        else for (std::size_t i = 0; i < W; i++) res.values[i] = a.values[i] < b.values[i];
+
+        return res;
+    }
+
+    template<typename T, std::size_t W>
+    inline laneMask<T, W> operator<=(const lanes<T, W>& a, const lanes<T, W>& b) noexcept
+    {
+        laneMask<T, W> res;
+
+        if constexpr (simd::hasLaneRegister<T, W>) res.reg = simd::laneCmpLe(a.reg, b.reg);
+        else for (std::size_t i = 0; i < W; i++) res.values[i] = a.values[i] <= b.values[i];
+
+        return res;
+    }
+
+    template<typename T, std::size_t W>
+    inline laneMask<T, W> operator>(const lanes<T, W>& a, const lanes<T, W>& b) noexcept
+    {
+        return b < a;
+    }
+
+    template<typename T, std::size_t W>
+    inline laneMask<T, W> operator>=(const lanes<T, W>& a, const lanes<T, W>& b) noexcept
+    {
+        return b <= a;
+    }
+
+    template<typename T, std::size_t W>
+    inline laneMask<T, W> operator==(const lanes<T, W>& a, const lanes<T, W>& b) noexcept
+    {
+        laneMask<T, W> res;
+
+        if constexpr (simd::hasLaneRegister<T, W>) res.reg = simd::laneCmpEq(a.reg, b.reg);
+        else for (std::size_t i = 0; i < W; i++) res.values[i] = a.values[i] == b.values[i];
+
+        return res;
+    }
+
+    template<typename T, std::size_t W>
+    inline laneMask<T, W> operator!=(const lanes<T, W>& a, const lanes<T, W>& b) noexcept
+    {
+        laneMask<T, W> res;
+
+        if constexpr (simd::hasLaneRegister<T, W>) res.reg = simd::laneCmpNeq(a.reg, b.reg);
+        else for (std::size_t i = 0; i < W; i++) res.values[i] = a.values[i] != b.values[i];
+
+        return res;
+    }
+
+
+    template<typename T, std::size_t W>
+    inline laneMask<T, W> operator&&(const laneMask<T, W>& a, const laneMask<T, W>& b) noexcept
+    {
+        laneMask<T, W> res;
+
+        if constexpr (simd::hasLaneRegister<T, W>) res.reg = simd::laneAnd(a.reg, b.reg);
+        else for (std::size_t i = 0; i < W; i++) res.values[i] = a.values[i] && b.values[i];
+
+        return res;
+    }
+
+    template<typename T, std::size_t W>
+    inline laneMask<T, W> operator||(const laneMask<T, W>& a, const laneMask<T, W>& b) noexcept
+    {
+        laneMask<T, W> res;
+
+        if constexpr (simd::hasLaneRegister<T, W>) res.reg = simd::laneOr(a.reg, b.reg);
+        else for (std::size_t i = 0; i < W; i++) res.values[i] = a.values[i] || b.values[i];
+
+        return res;
+    }
+
+    template<typename T, std::size_t W>
+    inline laneMask<T, W> operator!(const laneMask<T, W>& a) noexcept
+    {
+        laneMask<T, W> res;
+
+        if constexpr (simd::hasLaneRegister<T, W>)
+        {
+            // Comparing a register with itself for equality gives all bits set (for every value but NaN, and 0 is not one)
+            auto zero = simd::laneSet<T, W>(static_cast<T>(0.0));
+            res.reg = simd::laneAndNot(a.reg, simd::laneCmpEq(zero, zero));
+        }
+        else
+        {
+            for (std::size_t i = 0; i < W; i++) res.values[i] = !a.values[i];
+        }
+
+        return res;
+    }
+
+    template<typename T, std::size_t W>
+    inline bool any(const laneMask<T, W>& mask) noexcept
+    {
+        if constexpr (simd::hasLaneRegister<T, W>)
+        {
+            return simd::laneMoveMask(mask.reg) != 0;
+        }
+        else
+        {
+            return std::any_of(mask.values, mask.values + W, [](bool lane) { return lane; });
+        }
+    }
+
+    template<typename T, std::size_t W>
+    inline bool all(const laneMask<T, W>& mask) noexcept
+    {
+        if constexpr (simd::hasLaneRegister<T, W>)
+        {
+            return simd::laneMoveMask(mask.reg) == (1 << W) - 1;
+        }
+        else
+        {
+            return std::all_of(mask.values, mask.values + W, [](bool lane) { return lane; });
+        }
+    }
+
+    template<typename T, std::size_t W>
+    inline lanes<T, W> select(const laneMask<T, W>& mask, const lanes<T, W>& a, const lanes<T, W>& b) noexcept
+    {
+        lanes<T, W> res;
+
+        if constexpr (simd::hasLaneRegister<T, W>) res.reg = simd::laneSelect(mask.reg, a.reg, b.reg);
+        else for (std::size_t i = 0; i < W; i++) res.values[i] = mask.values[i] ? a.values[i] : b.values[i];
+
+        return res;
+    }
+
+    #pragma endregion
+
+    #pragma region MathFunctions
+
+    template<typename T, std::size_t W>
+    inline lanes<T, W> sqrt(const lanes<T, W>& value) noexcept
+    {
+        lanes<T, W> res;
+
+        if constexpr (simd::hasLaneRegister<T, W>) res.reg = simd::laneSqrt(value.reg);
+        else for (std::size_t i = 0; i < W; i++) res.values[i] = std::sqrt(value.values[i]);
+
+        return res;
+    }
+
+    template<typename T, std::size_t W>
+    inline lanes<T, W> rsqrtFast(const lanes<T, W>& value) noexcept
+    {
+        if constexpr (std::is_same_v<T, float> && simd::hasLaneRegister<T, W>)
+        {
+            lanes<T, W> res;
+            res.reg = simd::laneRsqrtFast(value.reg);
+
+            return res;
+        }
+        else
+        {
+            return lanes<T, W>(static_cast<T>(1.0)) / glMath::sqrt(value);
+        }
+    }
+
+    template<typename T, std::size_t W>
+    inline lanes<T, W> abs(const lanes<T, W>& value) noexcept
+    {
+        lanes<T, W> res;
+
+        // Clears the sign bit
+        if constexpr (simd::hasLaneRegister<T, W>) res.reg = simd::laneAndNot(simd::laneSet<T, W>(static_cast<T>(-0.0)), value.reg);
+        else for (std::size_t i = 0; i < W; i++) res.values[i] = std::abs(value.values[i]);
+
+        return res;
+    }
+
+    template<typename T, std::size_t W>
+    inline lanes<T, W> min(const lanes<T, W>& a, const lanes<T, W>& b) noexcept
+    {
+        lanes<T, W> res;
+
+        if constexpr (simd::hasLaneRegister<T, W>) res.reg = simd::laneMin(a.reg, b.reg);
+        else for (std::size_t i = 0; i < W; i++) res.values[i] = glMath::min(a.values[i], b.values[i]);
+
+        return res;
+    }
+
+    template<typename T, std::size_t W>
+    inline lanes<T, W> max(const lanes<T, W>& a, const lanes<T, W>& b) noexcept
+    {
+        lanes<T, W> res;
+
+        if constexpr (simd::hasLaneRegister<T, W>) res.reg = simd::laneMax(a.reg, b.reg);
+        else for (std::size_t i = 0; i < W; i++) res.values[i] = glMath::max(a.values[i], b.values[i]);
+
+        return res;
+    }
+
+    template<typename T, std::size_t W>
+    inline lanes<T, W> clamp(const lanes<T, W>& value, const lanes<T, W>& minInclusive, const lanes<T, W>& maxInclusive) noexcept
+    {
+        return glMath::min(glMath::max(value, minInclusive), maxInclusive);
+    }
+
+    template<typename T, std::size_t W>
+    inline lanes<T, W> clamp01(const lanes<T, W>& value) noexcept
+    {
+        return glMath::clamp(value, lanes<T, W>(static_cast<T>(0.0)), lanes<T, W>(static_cast<T>(1.0)));
+    }
+
+    template<typename T, std::size_t W>
+    inline lanes<T, W> sin(const lanes<T, W>& value)
+    {
+        lanes<T, W> res;
+        for (std::size_t i = 0; i < W; i++) res.values[i] = std::sin(value.values[i]);
+
+        return res;
+    }
+
+    template<typename T, std::size_t W>
+    inline lanes<T, W> cos(const lanes<T, W>& value)
+    {
+        lanes<T, W> res;
+        for (std::size_t i = 0; i < W; i++) res.values[i] = std::cos(value.values[i]);
+
+        return res;
+    }
+
+    template<typename T, std::size_t W>
+    inline lanes<T, W> acos(const lanes<T, W>& value)
+    {
+        lanes<T, W> res;
+        for (std::size_t i = 0; i < W; i++) res.values[i] = std::acos(value.values[i]);
+
+        return res;
+    }
+
+    template<typename T, std::size_t W>
+    inline sinCos<lanes<T, W>> sincos(const lanes<T, W>& value)
+    {
+        sinCos<lanes<T, W>> res;
+        for (std::size_t i = 0; i < W; i++)
+        {
+            res.sin.values[i] = std::sin(value.values[i]);
+            res.cos.values[i] = std::cos(value.values[i]);
+        }
+
+        return res;
+    }
+
+    template<typename T, std::size_t W>
+    inline lanes<T, W> round(const lanes<T, W>& value) noexcept
+    {
+        lanes<T, W> res;
+
+        if constexpr (simd::hasLaneRegister<T, W>) res.reg = simd::laneRound(value.reg);
+        else for (std::size_t i = 0; i < W; i++) res.values[i] = std::rint(value.values[i]);
+
+        return res;
+    }
+
+    // The building blocks of glMath::fast, on the bits of every lane
+    template<typename T, std::size_t W>
+    inline lanes<T, W> fast::pow2(const lanes<T, W>& n) noexcept
+    {
+        lanes<T, W> res;
+
+        if constexpr (simd::hasLaneRegister<T, W>) res.reg = simd::lanePow2(n.reg);
+        else for (std::size_t i = 0; i < W; i++) res.values[i] = fast::pow2(n.values[i]);
+
+        return res;
+    }
+
+    template<typename T, std::size_t W>
+    inline lanes<T, W> fast::exponent(const lanes<T, W>& value) noexcept
+    {
+        lanes<T, W> res;
+
+        if constexpr (simd::hasLaneRegister<T, W>) res.reg = simd::laneExponent(value.reg);
+        else for (std::size_t i = 0; i < W; i++) res.values[i] = fast::exponent(value.values[i]);
+
+        return res;
+    }
+
+    template<typename T, std::size_t W>
+    inline lanes<T, W> fast::mantissa(const lanes<T, W>& value) noexcept
+    {
+        lanes<T, W> res;
+
+        if constexpr (simd::hasLaneRegister<T, W>)
+        {
+            // The mantissa bits, with the exponent of 1.0
+            using U = std::conditional_t<std::is_same_v<T, float>, std::uint32_t, std::uint64_t>;
+            constexpr U mantissaMask = std::is_same_v<T, float> ? U(0x007FFFFFu) : U(0x000FFFFFFFFFFFFFull);
+
+            res.reg = simd::laneOr(simd::laneAnd(value.reg, simd::laneSet<T, W>(std::bit_cast<T>(mantissaMask))), simd::laneSet<T, W>(static_cast<T>(1.0)));
+        }
+        else for (std::size_t i = 0; i < W; i++) res.values[i] = fast::mantissa(value.values[i]);
+
+        return res;
+    }
+
+    #pragma endregion
+
+    #pragma region GatherScatter
+
+    template<LaneNumber L>
+    inline vec3<L> gather(std::span<const vec3<typename L::valueType>> vectors) noexcept
+    {
+        vec3<L> res(static_cast<typename L::valueType>(0.0));
+
+        for (std::size_t i = 0; i < std::min(vectors.size(), L::width); i++)
+        {
+            res.x.values[i] = vectors[i].x;
+            res.y.values[i] = vectors[i].y;
+            res.z.values[i] = vectors[i].z;
+        }
+
+        return res;
+    }
+
+    template<LaneNumber L>
+    inline vec4<L> gather(std::span<const vec4<typename L::valueType>> vectors) noexcept
+    {
+        vec4<L> res(static_cast<typename L::valueType>(0.0));
+
+        for (std::size_t i = 0; i < std::min(vectors.size(), L::width); i++)
+        {
+            res.x.values[i] = vectors[i].x;
+            res.y.values[i] = vectors[i].y;
+            res.z.values[i] = vectors[i].z;
+            res.w.values[i] = vectors[i].w;
+        }
+
+        return res;
+    }
+
+    template<LaneNumber L>
+    inline quat<L> gather(std::span<const quat<typename L::valueType>> quats) noexcept
+    {
+        L zero(static_cast<typename L::valueType>(0.0));
+        quat<L> res(zero, zero, zero, zero);
+
+        for (std::size_t i = 0; i < std::min(quats.size(), L::width); i++)
+        {
+            res.w.values[i] = quats[i].w;
+            res.x.values[i] = quats[i].x;
+            res.y.values[i] = quats[i].y;
+            res.z.values[i] = quats[i].z;
+        }
+
+        return res;
+    }
+
+    template<LaneNumber L>
+    inline void scatter(const vec3<L>& packet, std::span<vec3<typename L::valueType>> vectors) noexcept
+    {
+        for (std::size_t i = 0; i < std::min(vectors.size(), L::width); i++)
+        {
+            vectors[i].x = packet.x.values[i];
+            vectors[i].y = packet.y.values[i];
+            vectors[i].z = packet.z.values[i];
+        }
+    }
+
+    template<LaneNumber L>
+    inline void scatter(const vec4<L>& packet, std::span<vec4<typename L::valueType>> vectors) noexcept
+    {
+        for (std::size_t i = 0; i < std::min(vectors.size(), L::width); i++)
+        {
+            vectors[i].x = packet.x.values[i];
+            vectors[i].y = packet.y.values[i];
+            vectors[i].z = packet.z.values[i];
+            vectors[i].w = packet.w.values[i];
+        }
+    }
+
+    template<LaneNumber L>
+    inline void scatter(const quat<L>& packet, std::span<quat<typename L::valueType>> quats) noexcept
+    {
+        for (std::size_t i = 0; i < std::min(quats.size(), L::width); i++)
+        {
+            quats[i].w = packet.w.values[i];
+            quats[i].x = packet.x.values[i];
+            quats[i].y = packet.y.values[i];
+            quats[i].z = packet.z.values[i];
+        }
+    }
+
+    #pragma endregion
+}
@@ -2,34 +2,38 @@
 #include <cmath>
 
 #include <stdint.h>
+#include <cstddef>
 #include <algorithm>
+#include <numbers>
+#include <type_traits>
 
 #include "Math\Concepts.hpp"
+#include "Math\SimdInternal.hpp"
 
 namespace glMath
 {
    
     // Min and Max methods, taking two or an infinite number of arguments 
     template<Comparable T>
-    T max(T a, T b) 
+    constexpr T max(T a, T b) 
     {
         return a > b ? a : b;
     }
     template<Comparable T>
-    T min(T a, T b) 
+    constexpr T min(T a, T b) 
     {
         return a < b ? a : b;
     }
 
     template<Comparable T, Comparable... Args>
-    T max(T first, Args... args) 
+    constexpr T max(T first, Args... args) 
     {
         T result = first;
         ((result = max(result, args)), ...); 
         return result;
     }
     template<Comparable T, Comparable... Args>
-    T min(T first, Args... args) 
+    constexpr T min(T first, Args... args) 
     {
         T result = first;
         ((result = min(result, args)), ...); 
@@ -40,12 +44,12 @@ namespace glMath
     // Methods to clamp a float or an Angle between two numbers
 
     template<Number N>
-    inline N clamp(N value, N minInclusive, N maxInclusive)
+    inline constexpr N clamp(N value, N minInclusive, N maxInclusive)
     {
         return std::clamp(value, minInclusive, maxInclusive);
     }
     template<Number N>
-    inline N clamp01(N value)
+    inline constexpr N clamp01(N value)
     {
         return std::clamp(value, static_cast<N>(0.0), static_cast<N>(1.0));
     }
@@ -53,10 +57,28 @@ namespace glMath
 
     // Simple Absolute Value and Square Root methods, with floats and Angles
 
+    // std::abs is only constexpr since C++23, so constant evaluation does it by hand
     template<Number N>
-    inline N abs(N value) { return std::abs(value); }
+    inline constexpr N abs(N value) 
+    { 
+        if (std::is_constant_evaluated()) return value < static_cast<N>(0) ? -value : value;
+
+        return std::abs(value); 
+    }
     template<std::floating_point F>
     inline F sqrt(F value) { return static_cast<F>(std::sqrt(value)); }
+    // The nearest integer, ties to even (the default rounding mode)
+    template<std::floating_point F>
+    inline F round(F value) { return static_cast<F>(std::rint(value)); }
+
+    // 1 / sqrt(value), from the hardware estimate and one Newton-Raphson step when there is one (floats with SSE), 
+    // with a relative error under 5e-7. Else (doubles, or no SIMD) it's the exact 1 / sqrt(value)
+    template<std::floating_point F>
+    inline F rsqrtFast(F value)
+    {
+        if constexpr (simd::hasRsqrtKernel<F>) return simd::rsqrtFast(value);
+        else return static_cast<F>(1.0) / static_cast<F>(std::sqrt(value));
+    }
     
     // All the trigonometry stuff with floats, and Angles, returning floats and Angles
 
@@ -75,10 +97,33 @@ namespace glMath
     template<std::floating_point F>
     inline F atan2(F y, F x) { return static_cast<F>(std::atan2(y, x)); }
 
+    /// @brief The sine and the cosine of one angle, as sincos() returns them, 
+    /// and as the rotation factories taking precomputed angles (mat4::rotateX(sinCos), quat::fromEuler(sinCos...)...) read them
+    template<FloatingNumber F>
+    struct sinCos
+    {
+        F sin;
+        F cos;
+    };
+
+    /// @brief The weights of the two ends of an interpolation, the result being start * weights.start + end * weights.end,
+    /// as fast::slerpWeights() returns them
+    template<FloatingNumber F>
+    struct lerpWeights
+    {
+        F start;
+        F end;
+    };
+
+    // Both at once : gcc and clang merge the two calls into one sincos() of the libm, 
+    // and fast::sincos / fastMath::sincos share the range reduction
+    template<std::floating_point F>
+    inline sinCos<F> sincos(F value) { return { glMath::sin(value), glMath::cos(value) }; }
+
     // Just a Lerp method, which will be defined in each struct Vec, Angle... seperatly
 
     template<Number N>
-    inline N lerp(N start, N end, N t)
+    inline constexpr N lerp(N start, N end, N t)
     {
         return start + (end - start) * clamp01(t);
     }
@@ -96,13 +141,13 @@ namespace glMath
     }
 
     template<Number N>
-    inline N toRadians(N degAngle)
+    inline constexpr N toRadians(N degAngle)
     {
         return degAngle * static_cast<N>(0.0174532925);
     }
 
     template<Number N>
-    inline N toDegrees(N radAngle)
+    inline constexpr N toDegrees(N radAngle)
     {
         return radAngle * static_cast<N>(57.295779513);
     }
@@ -110,55 +155,103 @@ namespace glMath
 
 
     template<Number N>
-    inline N pi()
+    inline constexpr N pi()
     {
         return static_cast<N>(std::numbers::pi);
     }
     template<Number N>
-    inline N halfPi()
+    inline constexpr N halfPi()
     {
         return static_cast<N>(std::numbers::pi * 0.5);
     }
     template<Number N>
-    inline N twoPi()
+    inline constexpr N twoPi()
     {
         return static_cast<N>(std::numbers::pi * 2.0);
     }
     template<Number N>
-    inline N e()
+    inline constexpr N e()
     {
         return static_cast<N>(std::numbers::e);
     }
     template<Number N>
-    inline N degToRad()
+    inline constexpr N degToRad()
     {
         return static_cast<N>(0.0174532925);
     }
     template<Number N>
-    inline N radToDeg()
+    inline constexpr N radToDeg()
     {
         return static_cast<N>(57.295779513);
     }
     template<Number N>
-    inline N sqrtOf2()
+    inline constexpr N sqrtOf2()
     {
         return static_cast<N>(std::numbers::sqrt2);
     }
     template<Number N>
-    inline N sqrtOf3()
+    inline constexpr N sqrtOf3()
     {
         return static_cast<N>(std::numbers::sqrt3);
     }
     template<Number N>
-    inline N epsilon()
+    inline constexpr N epsilon()
     {
         return static_cast<N>(0.1e-05);
     }
 
     template<std::floating_point F>
-    inline bool nearlyEqual(F a, F b)
+    inline constexpr bool nearlyEqual(F a, F b)
+    {
+        return glMath::abs(b - a) < static_cast<F>(1e-06);
+    }
+
+
+    // The branch-free ternary, which the lane types need since their comparisons give one answer per lane
+    template<std::floating_point F>
+    inline constexpr F select(bool condition, F a, F b)
     {
-        return std::abs(b - a) < static_cast<F>(1e-06);
+        return condition ? a : b;
     }
+
+
+    // The same functions for the lane types, defined in Lanes.hpp. 
+    // They are declared here so that the glMath:: calls of the vector and quaternion templates find them
+    template<typename T, std::size_t W>
+    struct lanes;
+    template<typename T, std::size_t W>
+    struct laneMask;
+
+    template<typename T, std::size_t W>
+    inline lanes<T, W> select(const laneMask<T, W>& mask, const lanes<T, W>& a, const lanes<T, W>& b) noexcept;
+
+    template<typename T, std::size_t W>
+    inline lanes<T, W> sqrt(const lanes<T, W>& value) noexcept;
+    template<typename T, std::size_t W>
+    inline lanes<T, W> rsqrtFast(const lanes<T, W>& value) noexcept;
+    template<typename T, std::size_t W>
+    inline lanes<T, W> round(const lanes<T, W>& value) noexcept;
+    template<typename T, std::size_t W>
+    inline lanes<T, W> abs(const lanes<T, W>& value) noexcept;
+    template<typename T, std::size_t W>
+    inline lanes<T, W> min(const lanes<T, W>& a, const lanes<T, W>& b) noexcept;
+    template<typename T, std::size_t W>
+    inline lanes<T, W> max(const lanes<T, W>& a, const lanes<T, W>& b) noexcept;
+    template<typename T, std::size_t W>
+    inline lanes<T, W> clamp(const lanes<T, W>& value, const lanes<T, W>& minInclusive, const lanes<T, W>& maxInclusive) noexcept;
+    template<typename T, std::size_t W>
+    inline lanes<T, W> clamp01(const lanes<T, W>& value) noexcept;
+
+    // The trigonometry calls the scalar functions lane by lane, so it's correct but not faster than W scalar calls (glMath::fast has SIMD versions)
+    template<typename T, std::size_t W>
+    inline lanes<T, W> sin(const lanes<T, W>& value);
+    template<typename T, std::size_t W>
+    inline lanes<T, W> cos(const lanes<T, W>& value);
+    template<typename T, std::size_t W>
+    inline lanes<T, W> acos(const lanes<T, W>& value);
+    template<typename T, std::size_t W>
+    inline sinCos<lanes<T, W>> sincos(const lanes<T, W>& value);
     
-}
\ No newline at end of file
+}
+
+#include "Math\FastMath\FastMath.hpp"
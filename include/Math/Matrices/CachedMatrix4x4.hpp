@@ -0,0 +1,90 @@
+#pragma once
+
+#include <concepts>
+#include <cstdint>
+#include <optional>
+
+#include "Math\Concepts.hpp"
+#include "Math\Matrices\Matrix3x3.hpp"
+#include "Math\Matrices\Matrix4x4.hpp"
+
+namespace glMath
+{
+    /// @brief A mat4 that remembers what was derived from it : the inverse, the normal matrix and the determinant
+    /// are computed the first time they are asked for, then returned as they are until the matrix changes.
+    /// Every way of changing the matrix (set, operator=, operator*=, transpose) invalidates them
+    /// @tparam F The type of the values stored in the matrix, a FloatingNumber, so a float or a double
+    template<FloatingNumber F>
+    struct cachedMat4
+    {
+    private:
+        enum : std::uint8_t
+        {
+            determinantCached = 1 << 0,
+            inverseCached     = 1 << 1,
+            normalMatCached   = 1 << 2,
+        };
+
+        mat4<F> mat;
+
+        mutable std::optional<mat4<F>> inverse;
+        mutable mat3<F> normalMat;
+        mutable F det = static_cast<F>(0.0);
+        mutable std::uint8_t cached = 0;
+
+        // Incremented on every change of the matrix
+        std::uint32_t version = 0;
+
+        inline void invalidate() { cached = 0; version++; };
+
+    public:
+        cachedMat4() : mat(mat4<F>::identity()) {};
+        cachedMat4(const mat4<F>& matrix) : mat(matrix) {};
+
+        /// @brief The wrapped matrix, read only : the changes have to go through the functions below
+        inline const mat4<F>& get() const { return mat; };
+        inline operator const mat4<F>&() const { return mat; };
+
+        /// @brief A counter incremented every time the matrix changes, so that other caches can tell if they're stale
+        inline std::uint32_t getVersion() const { return version; };
+
+        /// @brief Replaces the matrix, invalidating everything derived from it
+        void set(const mat4<F>& matrix);
+        cachedMat4& operator=(const mat4<F>& matrix);
+
+        /// @brief A function to change the value at a certain position, invalidating everything derived from the matrix. 
+        /// There is no writable at() : the cache can only be invalidated when the value is written, not when a reference is handed out
+        /// @param row The row (0-3) of the value
+        /// @param col The column (0-3) of the value
+        /// @param value The new value
+        void set(int row, int col, F value);
+        /// @brief A function to read the value at a certain position (ReadOnly), the cache is kept
+        F at(int row, int col) const;
+
+        /// @brief A function to transpose the matrix, invalidating everything derived from it
+        /// @return Returns a reference to the cached matrix
+        cachedMat4& transpose();
+
+        cachedMat4& operator*=(const mat4<F>& other);
+        cachedMat4& operator*=(const cachedMat4& other);
+
+
+        /// @brief The determinant of the matrix, computed once per change
+        F determinant() const;
+        /// @brief The inverse of the matrix, computed once per change
+        /// @return Returns the inverse, or std::nullopt if the determinant is or is practically zero
+        const std::optional<mat4<F>>& getInversedMat() const;
+        /// @brief The normal matrix, the top-left 3x3 matrix inversed and then transposed, computed once per change
+        const mat3<F>& getNormalMat() const;
+
+        /// @brief A function to know if the matrix mirrors what it transforms (negative determinant),
+        /// in which case the winding order of the triangles is flipped
+        /// @return Returns true if the determinant is negative
+        bool flipsHandedness() const;
+
+        /// @brief A function to know if the inverse, the normal matrix and the determinant are all already computed
+        inline bool isFullyCached() const { return cached == (determinantCached | inverseCached | normalMatCached); };
+    };
+}
+
+#include "Math\Matrices\CachedMatrix4x4.inl"
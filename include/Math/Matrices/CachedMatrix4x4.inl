@@ -0,0 +1,103 @@
+#include <concepts>
+
+namespace glMath
+{
+    #pragma region Changes
+
+    template<FloatingNumber F>
+    inline void cachedMat4<F>::set(const mat4<F>& matrix)
+    {
+        mat = matrix;
+        invalidate();
+    }
+
+    template<FloatingNumber F>
+    inline cachedMat4<F>& cachedMat4<F>::operator=(const mat4<F>& matrix)
+    {
+        set(matrix);
+        return *this;
+    }
+
+    template<FloatingNumber F>
+    inline void cachedMat4<F>::set(int row, int col, F value)
+    {
+        mat.at(row, col) = value;
+        invalidate();
+    }
+
+    template<FloatingNumber F>
+    inline F cachedMat4<F>::at(int row, int col) const
+    {
+        return mat.at(row, col);
+    }
+
+    template<FloatingNumber F>
+    inline cachedMat4<F>& cachedMat4<F>::transpose()
+    {
+        mat.transpose();
+        invalidate();
+        return *this;
+    }
+
+    template<FloatingNumber F>
+    inline cachedMat4<F>& cachedMat4<F>::operator*=(const mat4<F>& other)
+    {
+        mat *= other;
+        invalidate();
+        return *this;
+    }
+
+    template<FloatingNumber F>
+    inline cachedMat4<F>& cachedMat4<F>::operator*=(const cachedMat4<F>& other)
+    {
+        return *this *= other.mat;
+    }
+
+    #pragma endregion
+
+    #pragma region DerivedValues
+
+    template<FloatingNumber F>
+    inline F cachedMat4<F>::determinant() const
+    {
+        if (!(cached & determinantCached))
+        {
+            det = mat.determinant();
+            cached |= determinantCached;
+        }
+
+        return det;
+    }
+
+    template<FloatingNumber F>
+    inline const std::optional<mat4<F>>& cachedMat4<F>::getInversedMat() const
+    {
+        if (!(cached & inverseCached))
+        {
+            inverse = mat.getInversedMat();
+            cached |= inverseCached;
+        }
+
+        return inverse;
+    }
+
+    template<FloatingNumber F>
+    inline const mat3<F>& cachedMat4<F>::getNormalMat() const
+    {
+        if (!(cached & normalMatCached))
+        {
+            normalMat = mat.getNormalMat();
+            cached |= normalMatCached;
+        }
+
+        return normalMat;
+    }
+
+    template<FloatingNumber F>
+    inline bool cachedMat4<F>::flipsHandedness() const
+    {
+        return this->determinant() < static_cast<F>(0.0);
+    }
+
+    #pragma endregion
+}
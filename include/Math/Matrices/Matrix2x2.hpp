@@ -1,6 +1,7 @@
 #pragma once
 
 #include <concepts>
+#include <optional>
 
 #include "Math\Concepts.hpp"
 
@@ -20,80 +21,86 @@ namespace glMath
         
     public: 
         // stored in column-major
-        mat2(F m00, F m01, 
-             F m10, F m11);
+        inline constexpr mat2(F m00, F m01, 
+                              F m10, F m11) noexcept;
 
-        mat2(F scalar);
+        inline constexpr mat2(F scalar) noexcept;
 
-        mat2();
+        inline constexpr mat2() noexcept;
 
         template<FloatingNumber f>
         mat2<f> as() const;
 
         static mat2 rotateZ(F zAngDeg);
 
-        vec2<F> rotatePoint(const vec2<F>& point) const;
-        static vec2<F> rotatePoint(const mat2& mat, const vec2<F>& vec);
+        inline constexpr vec2<F> rotatePoint(const vec2<F>& point) const noexcept;
+        inline static constexpr vec2<F> rotatePoint(const mat2& mat, const vec2<F>& vec) noexcept;
 
-        F determinant() const;
-        static F determinant(const mat2<F>& mat);
+        inline constexpr F determinant() const noexcept;
+        inline static constexpr F determinant(const mat2<F>& mat) noexcept;
 
-        mat2& inverse();
-        mat2& transpose();
+        /// @brief A function to inverse the matrix, in place
+        /// @return Returns true if the matrix was inversed. If its determinant is or is practically zero,
+        /// returns false and the matrix is left untouched
+        inline constexpr bool inverse() noexcept;
+        inline constexpr mat2& transpose() noexcept;
 
-        mat2 getInvertedMat() const;
+        /// @brief A function to get the inverse of the matrix
+        /// @return Returns a new 2x2 matrix of the same type, but inversed, 
+        /// or std::nullopt if its determinant is or is practically zero
+        inline constexpr std::optional<mat2> getInvertedMat() const noexcept;
 
-        mat2 getTransposedMat() const;
+        inline constexpr mat2 getTransposedMat() const noexcept;
 
-        static mat2 inverted(const mat2& mat);
-        static mat2 transposed(const mat2& mat);
+        inline static constexpr std::optional<mat2> inverted(const mat2& mat) noexcept;
+        inline static constexpr mat2 transposed(const mat2& mat) noexcept;
 
 
-        static mat2<F> diagonal(F diagonal);
+        inline static constexpr mat2<F> diagonal(F diagonal) noexcept;
 
 
-        inline static mat2 identity() { return mat2(1.0, 0.0,
+        inline static constexpr mat2 identity() noexcept { return mat2(1.0, 0.0,
                                                     0.0, 1.0); };        
 
-        F& at(int row, int col);
-        F at(int row, int col) const; 
+        inline constexpr F& at(int row, int col) noexcept;
+        inline constexpr F at(int row, int col) const noexcept;
         
         
-        mat2& operator+=(const mat2& other);
-        mat2& operator+=(F scalar);
+        inline constexpr mat2& operator+=(const mat2& other) noexcept;
+        inline constexpr mat2& operator+=(F scalar) noexcept;
 
-        mat2& operator-=(const mat2& other);
-        mat2& operator-=(F scalar);
+        inline constexpr mat2& operator-=(const mat2& other) noexcept;
+        inline constexpr mat2& operator-=(F scalar) noexcept;
 
-        mat2& operator*=(const mat2& other);
-        mat2& operator*=(F scalar);
+        inline constexpr mat2& operator*=(const mat2& other) noexcept;
+        inline constexpr mat2& operator*=(F scalar) noexcept;
 
-        mat2& operator/=(F scalar);
+        inline constexpr mat2& operator/=(F scalar) noexcept;
     };
 
     template<FloatingNumber F>
-    inline mat2<F> operator+(const mat2<F>& a, const mat2<F>& b);
+    inline constexpr mat2<F> operator+(const mat2<F>& a, const mat2<F>& b) noexcept;
 
     template<FloatingNumber F>
-    inline mat2<F> operator-(const mat2<F>& a, const mat2<F>& b);
+    inline constexpr mat2<F> operator-(const mat2<F>& a, const mat2<F>& b) noexcept;
 
     template<FloatingNumber F>
-    inline mat2<F> operator*(const mat2<F>& a, const mat2<F>& b);
+    inline constexpr mat2<F> operator*(const mat2<F>& a, const mat2<F>& b) noexcept;
     template<FloatingNumber F>
-    inline mat2<F> operator*(const mat2<F>& a, F scalar);
+    inline constexpr mat2<F> operator*(const mat2<F>& a, F scalar) noexcept;
     template<FloatingNumber F>
-    inline mat2<F> operator*(F scalar, const mat2<F>& a);
+    inline constexpr mat2<F> operator*(F scalar, const mat2<F>& a) noexcept;
     template<FloatingNumber F>
-    inline vec2<F> operator*(const mat2<F>& a, const vec2<F>& vec);
+    inline constexpr vec2<F> operator*(const mat2<F>& a, const vec2<F>& vec) noexcept;
 
     template<FloatingNumber F>
-    inline mat2<F> operator/(const mat2<F>& a, F scalar);
+    inline constexpr mat2<F> operator/(const mat2<F>& a, F scalar) noexcept;
 
 
     template<FloatingNumber F>
-    inline bool operator==(const mat2<F>& a, const mat2<F>& b);
+    inline constexpr bool operator==(const mat2<F>& a, const mat2<F>& b) noexcept;
     template<FloatingNumber F>
-    inline bool operator!=(const mat2<F>& a, const mat2<F>& b);
+    inline constexpr bool operator!=(const mat2<F>& a, const mat2<F>& b) noexcept;
 }
 
 #include "Math\Matrices\Matrix2x2.inl"
\ No newline at end of file
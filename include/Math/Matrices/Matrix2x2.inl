@@ -9,32 +9,24 @@ namespace glMath
     #pragma region Constructors
 
     template<FloatingNumber F>
-    inline mat2<F>::mat2(F m00, F m01, 
-                         F m10, F m11)
-    {
-        columns[0][0] = m00; columns[0][1] = m10; 
-        columns[1][0] = m01; columns[1][1] = m11;
-        
-    }
+    inline constexpr mat2<F>::mat2(F m00, F m01, 
+                                   F m10, F m11) noexcept
+        : columns{ { m00, m10 }, 
+                   { m01, m11 } }
+    {}
 
     template<FloatingNumber F>
-    inline mat2<F>::mat2(F scalar)
-    {
-        columns[0][0] = scalar; columns[0][1] = scalar; 
-        columns[1][0] = scalar; columns[1][1] = scalar;
-        
-    }
+    inline constexpr mat2<F>::mat2(F scalar) noexcept
+        : columns{ { scalar, scalar }, 
+                   { scalar, scalar } }
+    {}
 
+    // The constructors (and everything constexpr) only go through columns, 
+    // it's the only member of the union that constant evaluation can read afterwards
     template<FloatingNumber F>
-    inline mat2<F>::mat2()
-    {
-        F f0 = static_cast<F>(0.0);
-
-        indices[0] = f0;
-        indices[1] = f0;
-        indices[2] = f0;
-        indices[3] = f0;
-    }
+    inline constexpr mat2<F>::mat2() noexcept
+        : columns{}
+    {}
 
     #pragma endregion Constructors
     
@@ -42,7 +34,7 @@ namespace glMath
     
     
     template<FloatingNumber F>
-    inline mat2<F> mat2<F>::diagonal(F diagonal)
+    inline constexpr mat2<F> mat2<F>::diagonal(F diagonal) noexcept
     {
         mat2<F> baseMat;
 
@@ -81,36 +73,35 @@ namespace glMath
     #pragma region MemberMethods
     
     template<FloatingNumber F>
-    inline F mat2<F>::determinant() const
+    inline constexpr F mat2<F>::determinant() const noexcept
     {
         return columns[0][0] * columns[1][1] - columns[0][1] * columns[1][0];
     }
 
     template<FloatingNumber F>
-    inline mat2<F>& mat2<F>::inverse()
+    inline constexpr bool mat2<F>::inverse() noexcept
     {
         F det = this->determinant();
 
-        if (std::abs(det) > glMath::epsilon<F>()) 
-        {
-            F invDet = static_cast<F>(1.0) / det;
+        if (glMath::abs(det) <= glMath::epsilon<F>()) return false;
 
-            F m00 = columns[0][0];
-            F m01 = columns[1][0];
-            F m10 = columns[0][1];
-            F m11 = columns[1][1];
+        F invDet = static_cast<F>(1.0) / det;
 
-            columns[0][0] =  m11 * invDet;
-            columns[0][1] = -m01 * invDet; 
-            columns[1][0] = -m10 * invDet;
-            columns[1][1] =  m00 * invDet;
-        }
+        F m00 = columns[0][0];
+        F m01 = columns[1][0];
+        F m10 = columns[0][1];
+        F m11 = columns[1][1];
 
-        return *this;
+        columns[0][0] =  m11 * invDet;
+        columns[0][1] = -m10 * invDet; 
+        columns[1][0] = -m01 * invDet;
+        columns[1][1] =  m00 * invDet;
+
+        return true;
     }
 
     template<FloatingNumber F>
-    inline mat2<F>& mat2<F>::transpose()
+    inline constexpr mat2<F>& mat2<F>::transpose() noexcept
     {
         F m01 = columns[1][0];
         F m10 = columns[0][1];
@@ -122,15 +113,17 @@ namespace glMath
     }
 
     template<FloatingNumber F>
-    inline mat2<F> mat2<F>::getInvertedMat() const
+    inline constexpr std::optional<mat2<F>> mat2<F>::getInvertedMat() const noexcept
     {
         mat2<F> res = *this;
 
-        return res.inverse();
+        if (!res.inverse()) return std::nullopt;
+
+        return res;
     }
 
     template<FloatingNumber F>
-    inline mat2<F> mat2<F>::getTransposedMat() const
+    inline constexpr mat2<F> mat2<F>::getTransposedMat() const noexcept
     {
         mat2<F> res = *this;
 
@@ -138,20 +131,20 @@ namespace glMath
     }
 
     template<FloatingNumber F>
-    inline F& mat2<F>::at(int row, int col)
+    inline constexpr F& mat2<F>::at(int row, int col) noexcept
     {
         return columns[col][row];
     }
 
     template<FloatingNumber F>
-    inline F mat2<F>::at(int row, int col) const
+    inline constexpr F mat2<F>::at(int row, int col) const noexcept
     {
         return columns[col][row];
     }
 
 
     template<FloatingNumber F>
-    inline vec2<F> mat2<F>::rotatePoint(const mat2<F>& mat, const vec2<F>& point) 
+    inline constexpr vec2<F> mat2<F>::rotatePoint(const mat2<F>& mat, const vec2<F>& point) noexcept 
     {
         return mat * point;
     }
@@ -161,24 +154,24 @@ namespace glMath
     #pragma region StaticMethods
 
     template<FloatingNumber F>
-    inline vec2<F> mat2<F>::rotatePoint(const vec2<F>& point) const
+    inline constexpr vec2<F> mat2<F>::rotatePoint(const vec2<F>& point) const noexcept
     {
         return *this * point;
     }
 
     template<FloatingNumber F>
-    inline F mat2<F>::determinant(const mat2<F>& mat)
+    inline constexpr F mat2<F>::determinant(const mat2<F>& mat) noexcept
     {
         return mat.determinant();
     }
 
     template<FloatingNumber F>
-    inline mat2<F> mat2<F>::inverted(const mat2<F>& mat)
+    inline constexpr std::optional<mat2<F>> mat2<F>::inverted(const mat2<F>& mat) noexcept
     {
         return mat.getInvertedMat();
     }
     template<FloatingNumber F>
-    inline mat2<F> mat2<F>::transposed(const mat2<F>& mat)
+    inline constexpr mat2<F> mat2<F>::transposed(const mat2<F>& mat) noexcept
     {
         return mat.getTransposedMat();
     }
@@ -200,46 +193,50 @@ namespace glMath
     #pragma region ReferenceOperators
 
     template<FloatingNumber F>
-    inline mat2<F>& mat2<F>::operator+=(const mat2<F>& other)
+    inline constexpr mat2<F>& mat2<F>::operator+=(const mat2<F>& other) noexcept
     {
         *this = *this + other;
         return *this;
     }
     template<FloatingNumber F>
-    inline mat2<F>& mat2<F>::operator+=(F scalar)
+    inline constexpr mat2<F>& mat2<F>::operator+=(F scalar) noexcept
     {
-        *this = *this + scalar;
+        columns[0][0] += scalar; columns[0][1] += scalar;
+        columns[1][0] += scalar; columns[1][1] += scalar;
+
         return *this;
     }
 
     template<FloatingNumber F>
-    inline mat2<F>& mat2<F>::operator-=(const mat2<F>& other)
+    inline constexpr mat2<F>& mat2<F>::operator-=(const mat2<F>& other) noexcept
     {
         *this = *this - other;
         return *this;
     }
     template<FloatingNumber F>
-    inline mat2<F>& mat2<F>::operator-=(F scalar)
+    inline constexpr mat2<F>& mat2<F>::operator-=(F scalar) noexcept
     {
-        *this = *this - scalar;
+        columns[0][0] -= scalar; columns[0][1] -= scalar;
+        columns[1][0] -= scalar; columns[1][1] -= scalar;
+
         return *this;
     }
 
     template<FloatingNumber F>
-    inline mat2<F>& mat2<F>::operator*=(const mat2<F>& other)
+    inline constexpr mat2<F>& mat2<F>::operator*=(const mat2<F>& other) noexcept
     {
         *this = *this * other;
         return *this;
     }
     template<FloatingNumber F>
-    inline mat2<F>& mat2<F>::operator*=(F scalar)
+    inline constexpr mat2<F>& mat2<F>::operator*=(F scalar) noexcept
     {
         *this = *this * scalar;
         return *this;
     }
 
     template<FloatingNumber F>
-    inline mat2<F>& mat2<F>::operator/=(F scalar)
+    inline constexpr mat2<F>& mat2<F>::operator/=(F scalar) noexcept
     {
         *this = *this / scalar;
         return *this;
@@ -251,33 +248,33 @@ namespace glMath
     #pragma region ArithmeticOperators
 
     template<FloatingNumber F>
-    inline mat2<F> operator+(const mat2<F>& a, const mat2<F>& b) 
+    inline constexpr mat2<F> operator+(const mat2<F>& a, const mat2<F>& b) noexcept 
     {
         mat2<F> res;
 
-        res.indices[0] = a.indices[0] + b.indices[0];
-        res.indices[1] = a.indices[1] + b.indices[1];
-        res.indices[2] = a.indices[2] + b.indices[2];
-        res.indices[3] = a.indices[3] + b.indices[3];
+        res.columns[0][0] = a.columns[0][0] + b.columns[0][0];
+        res.columns[0][1] = a.columns[0][1] + b.columns[0][1];
+        res.columns[1][0] = a.columns[1][0] + b.columns[1][0];
+        res.columns[1][1] = a.columns[1][1] + b.columns[1][1];
 
         return res;
     }
 
     template<FloatingNumber F>
-    inline mat2<F> operator-(const mat2<F>& a, const mat2<F>& b) 
+    inline constexpr mat2<F> operator-(const mat2<F>& a, const mat2<F>& b) noexcept 
     {
         mat2<F> res;
 
-        res.indices[0] = a.indices[0] - b.indices[0];
-        res.indices[1] = a.indices[1] - b.indices[1];
-        res.indices[2] = a.indices[2] - b.indices[2];
-        res.indices[3] = a.indices[3] - b.indices[3];
+        res.columns[0][0] = a.columns[0][0] - b.columns[0][0];
+        res.columns[0][1] = a.columns[0][1] - b.columns[0][1];
+        res.columns[1][0] = a.columns[1][0] - b.columns[1][0];
+        res.columns[1][1] = a.columns[1][1] - b.columns[1][1];
 
         return res;
     }
 
     template<FloatingNumber F>
-    inline mat2<F> operator*(const mat2<F>& a, const mat2<F>& b) 
+    inline constexpr mat2<F> operator*(const mat2<F>& a, const mat2<F>& b) noexcept 
     {
         mat2<F> res;
 
@@ -291,33 +288,33 @@ namespace glMath
     }
 
     template<FloatingNumber F>
-    inline mat2<F> operator*(const mat2<F>& mat, F scalar) 
+    inline constexpr mat2<F> operator*(const mat2<F>& mat, F scalar) noexcept 
     {
         mat2<F> res;
 
-        res.indices[0] = mat.indices[0] * scalar;
-        res.indices[1] = mat.indices[1] * scalar;
-        res.indices[2] = mat.indices[2] * scalar;
-        res.indices[3] = mat.indices[3] * scalar;
+        res.columns[0][0] = mat.columns[0][0] * scalar;
+        res.columns[0][1] = mat.columns[0][1] * scalar;
+        res.columns[1][0] = mat.columns[1][0] * scalar;
+        res.columns[1][1] = mat.columns[1][1] * scalar;
 
         return res;
     }
 
     template<FloatingNumber F>
-    inline mat2<F> operator*(F scalar, const mat2<F>& mat) 
+    inline constexpr mat2<F> operator*(F scalar, const mat2<F>& mat) noexcept 
     {
         mat2<F> res;
 
-        res.indices[0] = mat.indices[0] * scalar;
-        res.indices[1] = mat.indices[1] * scalar;
-        res.indices[2] = mat.indices[2] * scalar;
-        res.indices[3] = mat.indices[3] * scalar;
+        res.columns[0][0] = mat.columns[0][0] * scalar;
+        res.columns[0][1] = mat.columns[0][1] * scalar;
+        res.columns[1][0] = mat.columns[1][0] * scalar;
+        res.columns[1][1] = mat.columns[1][1] * scalar;
 
         return res;
     }
 
     template<FloatingNumber F>
-    inline vec2<F> operator*(const mat2<F>& mat, const vec2<F>& vec) 
+    inline constexpr vec2<F> operator*(const mat2<F>& mat, const vec2<F>& vec) noexcept 
     {
         vec2<F> res;
 
@@ -328,7 +325,7 @@ namespace glMath
     }
 
     template<FloatingNumber F>
-    inline mat2<F> operator/(const mat2<F>& mat, F scalar) 
+    inline constexpr mat2<F> operator/(const mat2<F>& mat, F scalar) noexcept 
     {
         if (scalar == static_cast<F>(0.0)) return mat;
 
@@ -336,31 +333,34 @@ namespace glMath
 
         F invScalar = static_cast<F>(1.0) / scalar;
 
-        res.indices[0] = mat.indices[0] * invScalar;
-        res.indices[1] = mat.indices[1] * invScalar;
-        res.indices[2] = mat.indices[2] * invScalar;
-        res.indices[3] = mat.indices[3] * invScalar;
+        res.columns[0][0] = mat.columns[0][0] * invScalar;
+        res.columns[0][1] = mat.columns[0][1] * invScalar;
+        res.columns[1][0] = mat.columns[1][0] * invScalar;
+        res.columns[1][1] = mat.columns[1][1] * invScalar;
 
         return res;
     }
 
 
     template<FloatingNumber F>
-    inline bool operator==(const mat2<F>& a, const mat2<F>& b) 
+    inline constexpr bool operator==(const mat2<F>& a, const mat2<F>& b) noexcept 
     {
-        for (int i = 0; i < 4; i++)
+        for (int col = 0; col < 2; col++)
         {
-            if (std::abs(b.indices[i] - a.indices[i]) > glMath::epsilon<F>())
+            for (int row = 0; row < 2; row++)
             {
-                return false;
-            } 
+                if (glMath::abs(b.columns[col][row] - a.columns[col][row]) > glMath::epsilon<F>())
+                {
+                    return false;
+                } 
+            }
         }
 
         return true;
     }
 
     template<FloatingNumber F>
-    inline bool operator!=(const mat2<F>& a, const mat2<F>& b)
+    inline constexpr bool operator!=(const mat2<F>& a, const mat2<F>& b) noexcept
     {
         return !(a == b);
     }
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <concepts>
+#include <optional>
 
 #include "Math\Concepts.hpp"
 
@@ -31,52 +32,67 @@ namespace glMath
         
     public: 
         // stored in column-major
-        mat3(F m00, F m01, F m02,
-             F m10, F m11, F m12,
-             F m20, F m21, F m22);
+        inline constexpr mat3(F m00, F m01, F m02,
+                              F m10, F m11, F m12,
+                              F m20, F m21, F m22) noexcept;
 
-        mat3();
+        inline constexpr mat3() noexcept;
 
-        mat3(F scalar);
+        inline constexpr mat3(F scalar) noexcept;
 
         template<FloatingNumber f>
         mat3<f> as() const;
 
+        // P being exactMath or fastMath, for the precision of the sine and cosine
+        template<MathPolicy P = exactMath>
         static mat3 rotateX(F xAngDeg);
+        template<MathPolicy P = exactMath>
         static mat3 rotateY(F yAngDeg);
+        template<MathPolicy P = exactMath>
         static mat3 rotateZ(F zAngDeg);
+        // The same rotations from a precomputed sine and cosine (glMath::sincos), the angle being in radians
+        inline static constexpr mat3 rotateX(const sinCos<F>& angle) noexcept;
+        inline static constexpr mat3 rotateY(const sinCos<F>& angle) noexcept;
+        inline static constexpr mat3 rotateZ(const sinCos<F>& angle) noexcept;
 
         /// @brief A method to generate a mat3 from a quaternion
         /// @param rotationQuat The quaternion that contains the wanted rotation
         /// @return A mat3 coming from the rotationQuat quaternion
-        static mat3 fromQuat(const quat<F>& rotationQuat);
+        inline static constexpr mat3 fromQuat(const quat<F>& rotationQuat) noexcept;
 
-        vec3<F> rotatePoint(const vec3<F>& point) const;
-        static vec3<F> rotatePoint(const mat3& mat, const vec3<F>& vec);
+        inline constexpr vec3<F> rotatePoint(const vec3<F>& point) const noexcept;
+        inline static constexpr vec3<F> rotatePoint(const mat3& mat, const vec3<F>& vec) noexcept;
         
-        F determinant() const;
-        static F determinant(const mat3<F>& mat);
+        inline constexpr F determinant() const noexcept;
+        inline static constexpr F determinant(const mat3<F>& mat) noexcept;
+        inline static constexpr std::optional<mat3> inverted(const mat3& mat) noexcept;
 
-        mat3& inverted();
-        mat3& transposed();
+        /// @brief A function to inverse the matrix, in place
+        /// @return Returns true if the matrix was inversed. If its determinant is or is practically zero,
+        /// returns false and the matrix is left untouched
+        inline constexpr bool inverse() noexcept;
+        inline constexpr mat3& transposed() noexcept;
 
-        mat3 getInvertedMat() const;
+        /// @brief A function to get the inverse of the matrix
+        /// @return Returns a new 3x3 matrix of the same type, but inversed, 
+        /// or std::nullopt if its determinant is or is practically zero
+        inline constexpr std::optional<mat3> getInvertedMat() const noexcept;
 
-        mat3 getTransposedMat() const;
+        inline constexpr mat3 getTransposedMat() const noexcept;
 
-        mat3 getComatrix() const;
+        inline constexpr mat3 getComatrix() const noexcept;
 
-        mat3 getAdjugateMat() const;
+        inline constexpr mat3 getAdjugateMat() const noexcept;
 
-        static mat3<F> diagonal(F diagonal);
+        inline static constexpr mat3<F> diagonal(F diagonal) noexcept;
 
-        inline static mat3 identity() { return mat3(1.0, 0.0, 0.0,
-                                                    0.0, 1.0, 0.0,
-                                                    0.0, 0.0, 1.0); };
+        inline static constexpr mat3 identity() noexcept { return mat3(1.0, 0.0, 0.0,
+                                                                      0.0, 1.0, 0.0,
+                                                                      0.0, 0.0, 1.0); };
         
 
-        F& at(int row, int col);
-        F at(int row, int col) const;  
+        inline constexpr F& at(int row, int col) noexcept;
+        inline constexpr F at(int row, int col) const noexcept;
         
 
         template<Number N = F>
@@ -85,45 +101,45 @@ namespace glMath
         template<Number N = F>
         N getCofactor(int row, int col) const;
 
-        mat2<F> getSubmatrix(int row, int col) const;
+        inline constexpr mat2<F> getSubmatrix(int row, int col) const noexcept;
 
 
-        mat3& operator+=(const mat3& other);
-        mat3& operator+=(F scalar);
+        inline constexpr mat3& operator+=(const mat3& other) noexcept;
+        inline constexpr mat3& operator+=(F scalar) noexcept;
 
-        mat3& operator-=(const mat3& other);
-        mat3& operator-=(F scalar);
+        inline constexpr mat3& operator-=(const mat3& other) noexcept;
+        inline constexpr mat3& operator-=(F scalar) noexcept;
 
-        mat3& operator*=(const mat3& other);
-        mat3& operator*=(F scalar);
+        inline constexpr mat3& operator*=(const mat3& other) noexcept;
+        inline constexpr mat3& operator*=(F scalar) noexcept;
         
-        mat3& operator/=(F scalar);
+        inline constexpr mat3& operator/=(F scalar) noexcept;
     };
 
     template<FloatingNumber F>
-    inline mat3<F> operator+(const mat3<F>& a, const mat3<F>& b);
+    inline constexpr mat3<F> operator+(const mat3<F>& a, const mat3<F>& b) noexcept;
 
     template<FloatingNumber F>
-    inline mat3<F> operator-(const mat3<F>& a, const mat3<F>& b);
+    inline constexpr mat3<F> operator-(const mat3<F>& a, const mat3<F>& b) noexcept;
 
     template<FloatingNumber F>
-    inline mat3<F> operator*(const mat3<F>& a, const mat3<F>& b);
+    inline constexpr mat3<F> operator*(const mat3<F>& a, const mat3<F>& b) noexcept;
     template<FloatingNumber F>
-    inline mat3<F> operator*(const mat3<F>& a, F scalar);
+    inline constexpr mat3<F> operator*(const mat3<F>& a, F scalar) noexcept;
     template<FloatingNumber F>
-    inline mat3<F> operator*(F scalar, const mat3<F>& a);
+    inline constexpr mat3<F> operator*(F scalar, const mat3<F>& a) noexcept;
     template<FloatingNumber F>
-    inline vec3<F> operator*(const mat3<F>& a, const vec3<F>& vec);
+    inline constexpr vec3<F> operator*(const mat3<F>& a, const vec3<F>& vec) noexcept;
 
     template<FloatingNumber F>
-    inline mat3<F> operator/(const mat3<F>& a, F scalar);
+    inline constexpr mat3<F> operator/(const mat3<F>& a, F scalar) noexcept;
 
 
 
     template<FloatingNumber F>
-    inline bool operator==(const mat3<F>& a, const mat3<F>& b);
+    inline constexpr bool operator==(const mat3<F>& a, const mat3<F>& b) noexcept;
     template<FloatingNumber F>
-    inline bool operator!=(const mat3<F>& a, const mat3<F>& b);
+    inline constexpr bool operator!=(const mat3<F>& a, const mat3<F>& b) noexcept;
 }
 
 #include "Math\Matrices\Matrix3x3.inl"
\ No newline at end of file
@@ -11,44 +11,26 @@ namespace glMath
     #pragma region Constructors
 
     template<FloatingNumber F>
-    inline mat3<F>::mat3(F m00, F m01, F m02, 
-                         F m10, F m11, F m12,
-                         F m20, F m21, F m22)
-    {
-        columns[0][0] = m00; columns[0][1] = m10; columns[0][2] = m20;
-        columns[1][0] = m01; columns[1][1] = m11; columns[1][2] = m21;
-        columns[2][0] = m02; columns[2][1] = m12; columns[2][2] = m22;
-    }
+    inline constexpr mat3<F>::mat3(F m00, F m01, F m02, 
+                                   F m10, F m11, F m12,
+                                   F m20, F m21, F m22) noexcept
+        : columns{ { m00, m10, m20 }, 
+                   { m01, m11, m21 }, 
+                   { m02, m12, m22 } }
+    {}
 
+    // Same as mat2, only columns is written so constant evaluation can read it back
     template<FloatingNumber F>
-    inline mat3<F>::mat3()
-    {
-        F f0 = static_cast<F>(0.0);
-
-        indices[0] = f0;
-        indices[1] = f0;
-        indices[2] = f0;
-        indices[3] = f0;
-        indices[4] = f0;
-        indices[5] = f0;
-        indices[6] = f0;
-        indices[7] = f0;
-        indices[8] = f0;
-    }
+    inline constexpr mat3<F>::mat3() noexcept
+        : columns{}
+    {}
 
     template<FloatingNumber F>
-    inline mat3<F>::mat3(F scalar)
-    {
-        indices[0] = scalar;
-        indices[1] = scalar;
-        indices[2] = scalar;
-        indices[3] = scalar;
-        indices[4] = scalar;
-        indices[5] = scalar;
-        indices[6] = scalar;
-        indices[7] = scalar;
-        indices[8] = scalar;
-    }
+    inline constexpr mat3<F>::mat3(F scalar) noexcept
+        : columns{ { scalar, scalar, scalar }, 
+                   { scalar, scalar, scalar }, 
+                   { scalar, scalar, scalar } }
+    {}
 
     #pragma endregion Constructors
     
@@ -56,7 +38,7 @@ namespace glMath
     
     
     template<FloatingNumber F>
-    inline mat3<F> mat3<F>::diagonal(F diagonal)
+    inline constexpr mat3<F> mat3<F>::diagonal(F diagonal) noexcept
     {
         mat3<F> baseMat;
 
@@ -83,22 +65,20 @@ namespace glMath
 
         mat3<f> res;
 
-        res.indices[0] = std::clamp(static_cast<f>(indices[0]), minLimit, maxLimit);
-        res.indices[1] = std::clamp(static_cast<f>(indices[1]), minLimit, maxLimit);
-        res.indices[2] = std::clamp(static_cast<f>(indices[2]), minLimit, maxLimit);
-        res.indices[3] = std::clamp(static_cast<f>(indices[3]), minLimit, maxLimit);
-        res.indices[4] = std::clamp(static_cast<f>(indices[4]), minLimit, maxLimit);
-        res.indices[5] = std::clamp(static_cast<f>(indices[5]), minLimit, maxLimit);
-        res.indices[6] = std::clamp(static_cast<f>(indices[6]), minLimit, maxLimit);
-        res.indices[7] = std::clamp(static_cast<f>(indices[7]), minLimit, maxLimit);
-        res.indices[8] = std::clamp(static_cast<f>(indices[8]), minLimit, maxLimit);
+        for (int c = 0; c < 3; c++)
+        {
+            for (int r = 0; r < 3; r++)
+            {
+                res.columns[c][r] = std::clamp(static_cast<f>(columns[c][r]), minLimit, maxLimit);
+            }
+        }
 
         return res;
     }
 
 
     template<FloatingNumber F>
-    inline vec3<F> mat3<F>::rotatePoint(const mat3<F>& mat, const vec3<F>& point) 
+    inline constexpr vec3<F> mat3<F>::rotatePoint(const mat3<F>& mat, const vec3<F>& point) noexcept 
     {
         return mat * point;
     }
@@ -108,14 +88,14 @@ namespace glMath
     #pragma region MemberMethods
 
     template<FloatingNumber F>
-    inline vec3<F> mat3<F>::rotatePoint(const vec3<F>& point) const
+    inline constexpr vec3<F> mat3<F>::rotatePoint(const vec3<F>& point) const noexcept
     {
         return *this * point;
     }
 
     
     template<FloatingNumber F>
-    inline F mat3<F>::determinant() const
+    inline constexpr F mat3<F>::determinant() const noexcept
     {
         return columns[0][0] * (columns[1][1] * columns[2][2] - columns[2][1] * columns[1][2]) - 
                columns[1][0] * (columns[0][1] * columns[2][2] - columns[0][2] * columns[2][1]) + 
@@ -123,20 +103,19 @@ namespace glMath
     }
 
     template<FloatingNumber F>
-    inline mat3<F>& mat3<F>::inverted()
+    inline constexpr bool mat3<F>::inverse() noexcept
     {
         F det = this->determinant();
     
-        if (std::abs(det) > glMath::epsilon<F>()) 
-        { 
-            *this = this->getAdjugateMat() * (static_cast<F>(1.0) / det);  
-        }
+        if (glMath::abs(det) <= glMath::epsilon<F>()) return false;
 
-        return *this;
+        *this = this->getAdjugateMat() * (static_cast<F>(1.0) / det);  
+
+        return true;
     }
 
     template<FloatingNumber F>
-    inline mat3<F>& mat3<F>::transposed()
+    inline constexpr mat3<F>& mat3<F>::transposed() noexcept
     {
         F m01 = columns[1][0];
         F m02 = columns[2][0];
@@ -156,15 +135,17 @@ namespace glMath
     }
 
     template<FloatingNumber F>
-    inline mat3<F> mat3<F>::getInvertedMat() const
+    inline constexpr std::optional<mat3<F>> mat3<F>::getInvertedMat() const noexcept
     {
         mat3<F> res = *this;
 
-        return res.inverted();
+        if (!res.inverse()) return std::nullopt;
+
+        return res;
     }
 
     template<FloatingNumber F>
-    inline mat3<F> mat3<F>::getTransposedMat() const
+    inline constexpr mat3<F> mat3<F>::getTransposedMat() const noexcept
     {
         mat3<F> res = *this;
 
@@ -172,7 +153,7 @@ namespace glMath
     }
 
     template<FloatingNumber F>
-    inline mat3<F> mat3<F>::getComatrix() const
+    inline constexpr mat3<F> mat3<F>::getComatrix() const noexcept
     {
         mat3<F> res;
 
@@ -192,7 +173,7 @@ namespace glMath
     }
 
     template<FloatingNumber F>
-    inline mat3<F> mat3<F>::getAdjugateMat() const 
+    inline constexpr mat3<F> mat3<F>::getAdjugateMat() const noexcept 
     {
         mat3<F> res;
 
@@ -212,13 +193,13 @@ namespace glMath
     }
 
     template<FloatingNumber F>
-    inline F& mat3<F>::at(int row, int col)
+    inline constexpr F& mat3<F>::at(int row, int col) noexcept
     {
         return columns[col][row];
     }
 
     template<FloatingNumber F>
-    inline F mat3<F>::at(int row, int col) const
+    inline constexpr F mat3<F>::at(int row, int col) const noexcept
     {
         return columns[col][row];
     }
@@ -227,7 +208,7 @@ namespace glMath
     // ↓↓↓↓↓↓↓↓↓↓↓↓↓
 
     template<FloatingNumber F>
-    inline mat2<F> mat3<F>::getSubmatrix(int row, int col) const
+    inline constexpr mat2<F> mat3<F>::getSubmatrix(int row, int col) const noexcept
     {
         mat2<F> res;
 
@@ -294,62 +275,76 @@ namespace glMath
     #pragma region StaticMethods
 
     template<FloatingNumber F>
-    inline F mat3<F>::determinant(const mat3<F>& mat)
+    inline constexpr F mat3<F>::determinant(const mat3<F>& mat) noexcept
     {
         return mat.determinant();
     }
 
+    template<FloatingNumber F>
+    inline constexpr std::optional<mat3<F>> mat3<F>::inverted(const mat3<F>& mat) noexcept
+    {
+        return mat.getInvertedMat();
+    }
+
 
     template<FloatingNumber F>
+    template<MathPolicy P>
     inline mat3<F> mat3<F>::rotateX(F zAngDeg)
     {
-        F ang = zAngDeg * glMath::degToRad<F>();
-        F cosAng = static_cast<F>(std::cos(ang));
-        F sinAng = static_cast<F>(std::sin(ang));
+        return mat3<F>::rotateX(P::sincos(zAngDeg * glMath::degToRad<F>()));
+    }
 
+    template<FloatingNumber F>
+    inline constexpr mat3<F> mat3<F>::rotateX(const sinCos<F>& angle) noexcept
+    {
         mat3<F> res = mat3<F>::identity();
 
+                                  res.columns[1][1] = angle.cos; res.columns[2][1] = -angle.sin;
+                                  res.columns[1][2] = angle.sin; res.columns[2][2] = angle.cos;
 
-                                  res.columns[1][1] = cosAng; res.columns[2][1] = -sinAng;
-                                  res.columns[1][2] = sinAng; res.columns[2][2] = cosAng;
-    
         return res;
     }
 
     template<FloatingNumber F>
+    template<MathPolicy P>
     inline mat3<F> mat3<F>::rotateY(F zAngDeg)
     {
-        F ang = zAngDeg * glMath::degToRad<F>();
-        F cosAng = static_cast<F>(std::cos(ang));
-        F sinAng = static_cast<F>(std::sin(ang));
+        return mat3<F>::rotateY(P::sincos(zAngDeg * glMath::degToRad<F>()));
+    }
 
+    template<FloatingNumber F>
+    inline constexpr mat3<F> mat3<F>::rotateY(const sinCos<F>& angle) noexcept
+    {
         mat3<F> res = mat3<F>::identity();
 
-        res.columns[0][0] = cosAng;                            res.columns[2][0] = sinAng;
+        res.columns[0][0] = angle.cos;                            res.columns[2][0] = angle.sin;
 
-        res.columns[0][2] = -sinAng;                           res.columns[2][2] = cosAng;
+        res.columns[0][2] = -angle.sin;                           res.columns[2][2] = angle.cos;
 
         return res;
     }
 
     template<FloatingNumber F>
+    template<MathPolicy P>
     inline mat3<F> mat3<F>::rotateZ(F zAngDeg)
     {
-        F ang = zAngDeg * glMath::degToRad<F>();
-        F cosAng = static_cast<F>(std::cos(ang));
-        F sinAng = static_cast<F>(std::sin(ang));
+        return mat3<F>::rotateZ(P::sincos(zAngDeg * glMath::degToRad<F>()));
+    }
 
+    template<FloatingNumber F>
+    inline constexpr mat3<F> mat3<F>::rotateZ(const sinCos<F>& angle) noexcept
+    {
         mat3<F> res = mat3<F>::identity();
 
-        res.columns[0][0] = cosAng; res.columns[1][0] = -sinAng;
-        res.columns[0][1] = sinAng; res.columns[1][1] = cosAng;
+        res.columns[0][0] = angle.cos; res.columns[1][0] = -angle.sin;
+        res.columns[0][1] = angle.sin; res.columns[1][1] = angle.cos;
 
         return res;
     }
 
     
     template<FloatingNumber F>
-    inline mat3<F> mat3<F>::fromQuat(const quat<F>& rotationQuat)
+    inline constexpr mat3<F> mat3<F>::fromQuat(const quat<F>& rotationQuat) noexcept
     {
         F xx = rotationQuat.x * rotationQuat.x;
         F yy = rotationQuat.y * rotationQuat.y;
@@ -375,46 +370,58 @@ namespace glMath
     #pragma region ReferenceOperators
 
     template<FloatingNumber F>
-    inline mat3<F>& mat3<F>::operator+=(const mat3<F>& other)
+    inline constexpr mat3<F>& mat3<F>::operator+=(const mat3<F>& other) noexcept
     {
         *this = *this + other;
         return *this;
     }
     template<FloatingNumber F>
-    inline mat3<F>& mat3<F>::operator+=(F scalar)
+    inline constexpr mat3<F>& mat3<F>::operator+=(F scalar) noexcept
     {
-        *this = *this + scalar;
+        for (int c = 0; c < 3; c++)
+        {
+            for (int r = 0; r < 3; r++)
+            {
+                columns[c][r] += scalar;
+            }
+        }
         return *this;
     }
 
     template<FloatingNumber F>
-    inline mat3<F>& mat3<F>::operator-=(const mat3<F>& other)
+    inline constexpr mat3<F>& mat3<F>::operator-=(const mat3<F>& other) noexcept
     {
         *this = *this - other;
         return *this;
     }
     template<FloatingNumber F>
-    inline mat3<F>& mat3<F>::operator-=(F scalar)
+    inline constexpr mat3<F>& mat3<F>::operator-=(F scalar) noexcept
     {
-        *this = *this - scalar;
+        for (int c = 0; c < 3; c++)
+        {
+            for (int r = 0; r < 3; r++)
+            {
+                columns[c][r] -= scalar;
+            }
+        }
         return *this;
     }
 
     template<FloatingNumber F>
-    inline mat3<F>& mat3<F>::operator*=(const mat3<F>& other)
+    inline constexpr mat3<F>& mat3<F>::operator*=(const mat3<F>& other) noexcept
     {
         *this = *this * other;
         return *this;
     }
     template<FloatingNumber F>
-    inline mat3<F>& mat3<F>::operator*=(F scalar)
+    inline constexpr mat3<F>& mat3<F>::operator*=(F scalar) noexcept
     {
         *this = *this * scalar;
         return *this;
     }
 
     template<FloatingNumber F>
-    inline mat3<F>& mat3<F>::operator/=(F scalar)
+    inline constexpr mat3<F>& mat3<F>::operator/=(F scalar) noexcept
     {
         *this = *this / scalar;
         return *this;
@@ -426,43 +433,39 @@ namespace glMath
     #pragma region ArithmeticOperators
 
     template<FloatingNumber F>
-    inline mat3<F> operator+(const mat3<F>& a, const mat3<F>& b) 
+    inline constexpr mat3<F> operator+(const mat3<F>& a, const mat3<F>& b) noexcept 
     {
         mat3<F> res;
 
-        res.indices[0] = a.indices[0] + b.indices[0];
-        res.indices[1] = a.indices[1] + b.indices[1];
-        res.indices[2] = a.indices[2] + b.indices[2];
-        res.indices[3] = a.indices[3] + b.indices[3];
-        res.indices[4] = a.indices[4] + b.indices[4];
-        res.indices[5] = a.indices[5] + b.indices[5];
-        res.indices[6] = a.indices[6] + b.indices[6];
-        res.indices[7] = a.indices[7] + b.indices[7];
-        res.indices[8] = a.indices[8] + b.indices[8];
+        for (int c = 0; c < 3; c++)
+        {
+            for (int r = 0; r < 3; r++)
+            {
+                res.columns[c][r] = a.columns[c][r] + b.columns[c][r];
+            }
+        }
 
         return res;
     }
 
     template<FloatingNumber F>
-    inline mat3<F> operator-(const mat3<F>& a, const mat3<F>& b) 
+    inline constexpr mat3<F> operator-(const mat3<F>& a, const mat3<F>& b) noexcept 
     {
         mat3<F> res;
 
-        res.indices[0] = a.indices[0] - b.indices[0];
-        res.indices[1] = a.indices[1] - b.indices[1];
-        res.indices[2] = a.indices[2] - b.indices[2];
-        res.indices[3] = a.indices[3] - b.indices[3];
-        res.indices[4] = a.indices[4] - b.indices[4];
-        res.indices[5] = a.indices[5] - b.indices[5];
-        res.indices[6] = a.indices[6] - b.indices[6];
-        res.indices[7] = a.indices[7] - b.indices[7];
-        res.indices[8] = a.indices[8] - b.indices[8];
+        for (int c = 0; c < 3; c++)
+        {
+            for (int r = 0; r < 3; r++)
+            {
+                res.columns[c][r] = a.columns[c][r] - b.columns[c][r];
+            }
+        }
 
         return res;
     }
 
     template<FloatingNumber F>
-    inline mat3<F> operator*(const mat3<F>& a, const mat3<F>& b) 
+    inline constexpr mat3<F> operator*(const mat3<F>& a, const mat3<F>& b) noexcept 
     {
         mat3<F> res;
 
@@ -482,43 +485,39 @@ namespace glMath
     }
 
     template<FloatingNumber F>
-    inline mat3<F> operator*(const mat3<F>& mat, F scalar) 
+    inline constexpr mat3<F> operator*(const mat3<F>& mat, F scalar) noexcept 
     {
         mat3<F> res;
 
-        res.indices[0] = mat.indices[0] * scalar;
-        res.indices[1] = mat.indices[1] * scalar;
-        res.indices[2] = mat.indices[2] * scalar;
-        res.indices[3] = mat.indices[3] * scalar;
-        res.indices[4] = mat.indices[4] * scalar;
-        res.indices[5] = mat.indices[5] * scalar;
-        res.indices[6] = mat.indices[6] * scalar;
-        res.indices[7] = mat.indices[7] * scalar;
-        res.indices[8] = mat.indices[8] * scalar;
+        for (int c = 0; c < 3; c++)
+        {
+            for (int r = 0; r < 3; r++)
+            {
+                res.columns[c][r] = mat.columns[c][r] * scalar;
+            }
+        }
 
         return res;
     }
 
     template<FloatingNumber F>
-    inline mat3<F> operator*(F scalar, const mat3<F>& mat) 
+    inline constexpr mat3<F> operator*(F scalar, const mat3<F>& mat) noexcept 
     {
         mat3<F> res;
 
-        res.indices[0] = mat.indices[0] * scalar;
-        res.indices[1] = mat.indices[1] * scalar;
-        res.indices[2] = mat.indices[2] * scalar;
-        res.indices[3] = mat.indices[3] * scalar;
-        res.indices[4] = mat.indices[4] * scalar;
-        res.indices[5] = mat.indices[5] * scalar;
-        res.indices[6] = mat.indices[6] * scalar;
-        res.indices[7] = mat.indices[7] * scalar;
-        res.indices[8] = mat.indices[8] * scalar;
+        for (int c = 0; c < 3; c++)
+        {
+            for (int r = 0; r < 3; r++)
+            {
+                res.columns[c][r] = mat.columns[c][r] * scalar;
+            }
+        }
 
         return res;
     }
 
     template<FloatingNumber F>
-    inline vec3<F> operator*(const mat3<F>& mat, const vec3<F>& vec) 
+    inline constexpr vec3<F> operator*(const mat3<F>& mat, const vec3<F>& vec) noexcept 
     {
         return vec3<F>(
             mat.columns[0][0] * vec.x + mat.columns[1][0] * vec.y + mat.columns[2][0] * vec.z,
@@ -528,7 +527,7 @@ namespace glMath
     }
 
     template<FloatingNumber F>
-    inline mat3<F> operator/(const mat3<F>& mat, F scalar) 
+    inline constexpr mat3<F> operator/(const mat3<F>& mat, F scalar) noexcept 
     {
         if (scalar == static_cast<F>(0.0)) return mat;
 
@@ -536,15 +535,13 @@ namespace glMath
 
         F invScalar = static_cast<F>(1.0) / scalar;
 
-        res.indices[0] = mat.indices[0] * invScalar;
-        res.indices[1] = mat.indices[1] * invScalar;
-        res.indices[2] = mat.indices[2] * invScalar;
-        res.indices[3] = mat.indices[3] * invScalar;
-        res.indices[4] = mat.indices[4] * invScalar;
-        res.indices[5] = mat.indices[5] * invScalar;
-        res.indices[6] = mat.indices[6] * invScalar;
-        res.indices[7] = mat.indices[7] * invScalar;
-        res.indices[8] = mat.indices[8] * invScalar;
+        for (int c = 0; c < 3; c++)
+        {
+            for (int r = 0; r < 3; r++)
+            {
+                res.columns[c][r] = mat.columns[c][r] * invScalar;
+            }
+        }
 
         return res;
     }
@@ -552,21 +549,24 @@ namespace glMath
 
 
     template<FloatingNumber F>
-    inline bool operator==(const mat3<F>& a, const mat3<F>& b) 
+    inline constexpr bool operator==(const mat3<F>& a, const mat3<F>& b) noexcept 
     {
-        for (int i = 0; i < 9; i++)
+        for (int c = 0; c < 3; c++)
         {
-            if (std::abs(b.indices[i] - a.indices[i]) > glMath::epsilon<F>())
+            for (int r = 0; r < 3; r++)
             {
-                return false;
-            } 
+                if (glMath::abs(b.columns[c][r] - a.columns[c][r]) > glMath::epsilon<F>())
+                {
+                    return false;
+                } 
+            }
         }
 
         return true;
     }
 
     template<FloatingNumber F>
-    inline bool operator!=(const mat3<F>& a, const mat3<F>& b)
+    inline constexpr bool operator!=(const mat3<F>& a, const mat3<F>& b) noexcept
     {
         return !(a == b);
     }
@@ -0,0 +1,115 @@
+#pragma once
+
+#include <concepts>
+#include <optional>
+#include <span>
+
+#include "Math\Concepts.hpp"
+
+namespace glMath
+{
+    template<FloatingNumber F>
+    struct vec3;
+
+    template<FloatingNumber F>
+    struct mat3;
+
+    template<FloatingNumber F>
+    struct mat4;
+
+    /// @brief A 3x3 matrix padded to the layout of the three first columns of a mat4 : each column is 4 values wide and aligned,
+    /// the 4th value of every column being kept at 0. Unlike mat3, every column is one full-width SIMD load,
+    /// so it's the type to use for normal matrices and batches of rotations
+    //
+    // ( [0][0] [1][0] [2][0] )
+    // ( [0][1] [1][1] [2][1] )
+    // ( [0][2] [1][2] [2][2] )
+    // ( [0][3] [1][3] [2][3] ) <- padding, always 0
+    //
+    /// @tparam F The type of the values stored in the matrix, a FloatingNumber, so a float or a double
+    template<FloatingNumber F>
+    struct alignas(sizeof(F) * 4) mat3a
+    {
+    public:
+        F columns[3][4]; // [col][row] access
+
+    public:
+        // The values are written in the same order as for mat3, row by row
+        inline constexpr mat3a(F m00, F m01, F m02,
+                               F m10, F m11, F m12,
+                               F m20, F m21, F m22) noexcept;
+        inline constexpr mat3a() noexcept;
+
+
+        inline static constexpr mat3a identity() noexcept { return mat3a(1.0, 0.0, 0.0,
+                                                                          0.0, 1.0, 0.0,
+                                                                          0.0, 0.0, 1.0); };
+
+        /// @brief A function to convert a mat3 to the padded layout, losslessly
+        inline static constexpr mat3a fromMat3(const mat3<F>& mat) noexcept;
+        /// @brief A function to get the top-left 3x3 part of a mat4, like mat4::toMat3(), but padded
+        inline static constexpr mat3a fromMat4(const mat4<F>& mat) noexcept;
+        /// @brief A function to convert the matrix back to a mat3, losslessly
+        inline constexpr mat3<F> toMat3() const noexcept;
+
+        /// @brief A function to compute the normal matrices of many matrices at once,
+        /// like mat4::getNormalMat() but padded, and with SSE for float
+        /// @param mats The matrices whose top-left 3x3 part is used
+        /// @param results Where the normal matrices are written, at least as big as mats
+        static void normalMats(std::span<const mat4<F>> mats, std::span<mat3a> results);
+
+
+        /// @brief The scalar product of two matrices, used by operator* when no SIMD kernel is available
+        inline static constexpr mat3a multiplyScalar(const mat3a& a, const mat3a& b) noexcept;
+
+
+        /// @brief A function to transpose the matrix, in place
+        /// @return Returns a reference to the matrix, but transposed
+        inline constexpr mat3a& transpose() noexcept;
+        /// @brief A function to get the transpose of the matrix
+        inline constexpr mat3a getTransposedMat() const noexcept;
+
+        inline constexpr F determinant() const noexcept;
+
+        /// @brief A function to inverse the matrix, in place
+        /// @return Returns true if the matrix was inversed. If its determinant is or is practically zero,
+        /// returns false and the matrix is left untouched
+        inline constexpr bool inverse() noexcept;
+        /// @brief A function to get the inverse of the matrix
+        /// @return Returns a new matrix of the same type, but inversed, or std::nullopt if its determinant is or is practically zero
+        inline constexpr std::optional<mat3a> getInversedMat() const noexcept;
+
+        /// @brief A function to get the normal matrix, the matrix inversed and then transposed.
+        /// Like mat4::getNormalMat(), a matrix that can't be inversed is only transposed
+        inline constexpr mat3a getNormalMat() const noexcept;
+
+
+        /// @brief A function to transform many vectors at once (with SSE for float, 4 vectors per step)
+        /// @param vectors The vectors to transform
+        /// @param results Where the transformed vectors are written, at least as big as vectors.
+        /// It can be the same span as vectors, but must not partially overlap it
+        void transformVectors(std::span<const vec3<F>> vectors, std::span<vec3<F>> results) const;
+
+
+        inline constexpr F& at(int row, int col) noexcept;
+        inline constexpr F at(int row, int col) const noexcept;
+
+
+        inline constexpr mat3a& operator*=(const mat3a& other) noexcept;
+    };
+
+    template<FloatingNumber F>
+    inline constexpr mat3a<F> operator*(const mat3a<F>& a, const mat3a<F>& b) noexcept;
+
+    template<FloatingNumber F>
+    inline constexpr vec3<F> operator*(const mat3a<F>& mat, const vec3<F>& vec) noexcept;
+
+
+    template<FloatingNumber F>
+    inline constexpr bool operator==(const mat3a<F>& a, const mat3a<F>& b) noexcept;
+
+    template<FloatingNumber F>
+    inline constexpr bool operator!=(const mat3a<F>& a, const mat3a<F>& b) noexcept;
+}
+
+#include "Math\Matrices\Matrix3x3a.inl"
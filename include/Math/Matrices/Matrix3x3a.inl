@@ -0,0 +1,294 @@
+#include <concepts>
+#include <cassert>
+#include <type_traits>
+
+#include "Math\MathInternal.hpp"
+#include "Math\SimdInternal.hpp"
+
+namespace glMath
+{
+    #pragma region Constructors
+
+    template<FloatingNumber F>
+    inline constexpr mat3a<F>::mat3a(F m00, F m01, F m02,
+                                     F m10, F m11, F m12,
+                                     F m20, F m21, F m22) noexcept
+        : columns{ { m00, m10, m20, static_cast<F>(0.0) },
+                   { m01, m11, m21, static_cast<F>(0.0) },
+                   { m02, m12, m22, static_cast<F>(0.0) } }
+    {}
+
+    template<FloatingNumber F>
+    inline constexpr mat3a<F>::mat3a() noexcept
+        : columns{}
+    {}
+
+    #pragma endregion
+
+    #pragma region StaticMethods
+
+    template<FloatingNumber F>
+    inline constexpr mat3a<F> mat3a<F>::fromMat3(const mat3<F>& mat) noexcept
+    {
+        return mat3a<F>(mat.columns[0][0], mat.columns[1][0], mat.columns[2][0],
+                        mat.columns[0][1], mat.columns[1][1], mat.columns[2][1],
+                        mat.columns[0][2], mat.columns[1][2], mat.columns[2][2]);
+    }
+
+    template<FloatingNumber F>
+    inline constexpr mat3a<F> mat3a<F>::fromMat4(const mat4<F>& mat) noexcept
+    {
+        return mat3a<F>(mat.columns[0][0], mat.columns[1][0], mat.columns[2][0],
+                        mat.columns[0][1], mat.columns[1][1], mat.columns[2][1],
+                        mat.columns[0][2], mat.columns[1][2], mat.columns[2][2]);
+    }
+
+    template<FloatingNumber F>
+    inline void mat3a<F>::normalMats(std::span<const mat4<F>> mats, std::span<mat3a<F>> results)
+    {
+        assert(results.size() >= mats.size());
+
+        if constexpr (simd::hasMat3aInverseKernel<F>)
+        {
+            simd::mat3aNormalMats(reinterpret_cast<const F*>(mats.data()), reinterpret_cast<F*>(results.data()),
+                                  mats.size(), glMath::epsilon<F>());
+        }
+        else
+        {
+            for (std::size_t i = 0; i < mats.size(); i++)
+            {
+                results[i] = mat3a<F>::fromMat4(mats[i]).getNormalMat();
+            }
+        }
+    }
+
+    template<FloatingNumber F>
+    inline constexpr mat3a<F> mat3a<F>::multiplyScalar(const mat3a<F>& a, const mat3a<F>& b) noexcept
+    {
+        mat3a<F> res;
+
+        for (int col = 0; col < 3; col++)
+        {
+            res.columns[col][0] = a.columns[0][0] * b.columns[col][0] + a.columns[1][0] * b.columns[col][1] + a.columns[2][0] * b.columns[col][2];
+            res.columns[col][1] = a.columns[0][1] * b.columns[col][0] + a.columns[1][1] * b.columns[col][1] + a.columns[2][1] * b.columns[col][2];
+            res.columns[col][2] = a.columns[0][2] * b.columns[col][0] + a.columns[1][2] * b.columns[col][1] + a.columns[2][2] * b.columns[col][2];
+        }
+
+        return res;
+    }
+
+    #pragma endregion
+
+    #pragma region MemberMethods
+
+    template<FloatingNumber F>
+    inline constexpr mat3<F> mat3a<F>::toMat3() const noexcept
+    {
+        return mat3<F>(columns[0][0], columns[1][0], columns[2][0],
+                       columns[0][1], columns[1][1], columns[2][1],
+                       columns[0][2], columns[1][2], columns[2][2]);
+    }
+
+    template<FloatingNumber F>
+    inline constexpr mat3a<F>& mat3a<F>::transpose() noexcept
+    {
+        if constexpr (simd::hasMat3aInverseKernel<F>)
+        {
+            if (!std::is_constant_evaluated())
+            {
+                simd::mat3aTranspose(&columns[0][0], &columns[0][0]);
+                return *this;
+            }
+        }
+
+        F m01 = columns[1][0];
+        F m02 = columns[2][0];
+        F m12 = columns[2][1];
+
+        columns[1][0] = columns[0][1];
+        columns[2][0] = columns[0][2];
+        columns[2][1] = columns[1][2];
+
+        columns[0][1] = m01;
+        columns[0][2] = m02;
+        columns[1][2] = m12;
+
+        return *this;
+    }
+
+    template<FloatingNumber F>
+    inline constexpr mat3a<F> mat3a<F>::getTransposedMat() const noexcept
+    {
+        mat3a<F> copy = *this;
+
+        return copy.transpose();
+    }
+
+    template<FloatingNumber F>
+    inline constexpr F mat3a<F>::determinant() const noexcept
+    {
+        return columns[0][0] * (columns[1][1] * columns[2][2] - columns[2][1] * columns[1][2]) -
+               columns[1][0] * (columns[0][1] * columns[2][2] - columns[0][2] * columns[2][1]) +
+               columns[2][0] * (columns[0][1] * columns[1][2] - columns[1][1] * columns[0][2]);
+    }
+
+    template<FloatingNumber F>
+    inline constexpr bool mat3a<F>::inverse() noexcept
+    {
+        if constexpr (simd::hasMat3aInverseKernel<F>)
+        {
+            if (!std::is_constant_evaluated())
+            {
+                return simd::mat3aInverse(&columns[0][0], &columns[0][0], glMath::epsilon<F>());
+            }
+        }
+
+        // The rows of the inverse are the cross products of the columns, divided by the determinant
+        vec3<F> c0(columns[0][0], columns[0][1], columns[0][2]);
+        vec3<F> c1(columns[1][0], columns[1][1], columns[1][2]);
+        vec3<F> c2(columns[2][0], columns[2][1], columns[2][2]);
+
+        vec3<F> r0 = vec3<F>::crossProduct(c1, c2);
+        vec3<F> r1 = vec3<F>::crossProduct(c2, c0);
+        vec3<F> r2 = vec3<F>::crossProduct(c0, c1);
+
+        F det = vec3<F>::dotProduct(c0, r0);
+
+        if (glMath::abs(det) <= glMath::epsilon<F>()) return false;
+
+        F invDet = static_cast<F>(1.0) / det;
+
+        *this = mat3a<F>(r0.x * invDet, r0.y * invDet, r0.z * invDet,
+                         r1.x * invDet, r1.y * invDet, r1.z * invDet,
+                         r2.x * invDet, r2.y * invDet, r2.z * invDet);
+
+        return true;
+    }
+
+    template<FloatingNumber F>
+    inline constexpr std::optional<mat3a<F>> mat3a<F>::getInversedMat() const noexcept
+    {
+        mat3a<F> copy = *this;
+
+        if (!copy.inverse()) return std::nullopt;
+
+        return copy;
+    }
+
+    template<FloatingNumber F>
+    inline constexpr mat3a<F> mat3a<F>::getNormalMat() const noexcept
+    {
+        mat3a<F> res = *this;
+        res.inverse();
+
+        return res.transpose();
+    }
+
+    template<FloatingNumber F>
+    inline void mat3a<F>::transformVectors(std::span<const vec3<F>> vectors, std::span<vec3<F>> results) const
+    {
+        assert(results.size() >= vectors.size());
+
+        std::size_t i = 0;
+
+        // The padded columns are laid out like the three first columns of a mat4,
+        // which is all the mat4 kernel reads when the vectors aren't points
+        if constexpr (simd::hasVec3TransformKernel<F>)
+        {
+            i = simd::mat4TransformVec3(&columns[0][0], reinterpret_cast<const F*>(vectors.data()), reinterpret_cast<F*>(results.data()),
+                                        vectors.size(), false, false);
+        }
+
+        for (; i < vectors.size(); i++)
+        {
+            results[i] = *this * vectors[i];
+        }
+    }
+
+    template<FloatingNumber F>
+    inline constexpr F& mat3a<F>::at(int row, int col) noexcept
+    {
+        return columns[col][row];
+    }
+
+    template<FloatingNumber F>
+    inline constexpr F mat3a<F>::at(int row, int col) const noexcept
+    {
+        return columns[col][row];
+    }
+
+    #pragma endregion
+
+    #pragma region ReferenceOperators
+
+    template<FloatingNumber F>
+    inline constexpr mat3a<F>& mat3a<F>::operator*=(const mat3a<F>& other) noexcept
+    {
+        // The kernels load both matrices before writing, so the product can be written directly into *this
+        if constexpr (simd::hasMat3aKernel<F>)
+        {
+            if (!std::is_constant_evaluated())
+            {
+                simd::mat3aMultiply(&columns[0][0], &other.columns[0][0], &columns[0][0]);
+                return *this;
+            }
+        }
+
+        *this = mat3a<F>::multiplyScalar(*this, other);
+
+        return *this;
+    }
+
+    #pragma endregion
+
+    #pragma region Operators
+
+    template<FloatingNumber F>
+    inline constexpr mat3a<F> operator*(const mat3a<F>& a, const mat3a<F>& b) noexcept
+    {
+        if constexpr (simd::hasMat3aKernel<F>)
+        {
+            if (!std::is_constant_evaluated())
+            {
+                mat3a<F> res;
+                simd::mat3aMultiply(&a.columns[0][0], &b.columns[0][0], &res.columns[0][0]);
+                return res;
+            }
+        }
+
+        return mat3a<F>::multiplyScalar(a, b);
+    }
+
+    template<FloatingNumber F>
+    inline constexpr vec3<F> operator*(const mat3a<F>& mat, const vec3<F>& vec) noexcept
+    {
+        return vec3<F>(
+            mat.columns[0][0] * vec.x + mat.columns[1][0] * vec.y + mat.columns[2][0] * vec.z,
+            mat.columns[0][1] * vec.x + mat.columns[1][1] * vec.y + mat.columns[2][1] * vec.z,
+            mat.columns[0][2] * vec.x + mat.columns[1][2] * vec.y + mat.columns[2][2] * vec.z
+        );
+    }
+
+
+    template<FloatingNumber F>
+    inline constexpr bool operator==(const mat3a<F>& a, const mat3a<F>& b) noexcept
+    {
+        for (int c = 0; c < 3; c++)
+        {
+            for (int r = 0; r < 3; r++)
+            {
+                if (glMath::abs(b.columns[c][r] - a.columns[c][r]) > glMath::epsilon<F>()) return false;
+            }
+        }
+
+        return true;
+    }
+
+    template<FloatingNumber F>
+    inline constexpr bool operator!=(const mat3a<F>& a, const mat3a<F>& b) noexcept
+    {
+        return !(a == b);
+    }
+
+    #pragma endregion
+}
@@ -0,0 +1,146 @@
+#pragma once
+
+#include <concepts>
+#include <optional>
+#include <span>
+
+#include "Math\Concepts.hpp"
+
+namespace glMath
+{
+    template<FloatingNumber F>
+    struct vec3;
+
+    template<FloatingNumber F>
+    struct vec4;
+
+    template<FloatingNumber F>
+    struct quat;
+
+    template<FloatingNumber F>
+    struct dualQuat;
+
+    template<FloatingNumber F>
+    struct mat4;
+
+    /// @brief A struct used to represent an affine transform without the constant [0 0 0 1] bottom row of a mat4,
+    /// stored as three rows of four values (48 bytes for float instead of 64), so that it can be uploaded as is
+    /// to a shader (a mat4x3 in GLSL, or three vec4) for bone palettes and per-instance transforms :
+    //
+    // ( [0][0] [0][1] [0][2] [0][3] )
+    // ( [1][0] [1][1] [1][2] [1][3] )
+    // ( [2][0] [2][1] [2][2] [2][3] )
+    //
+    /// @tparam F The type of the values stored in the matrix, a FloatingNumber, so a float or a double
+    template<FloatingNumber F>
+    struct alignas(sizeof(F) * 4) mat3x4
+    {
+    public:
+        union
+        {
+            F rows[3][4];   // [row][col] access
+            F indices[12];  // [index] access
+        };
+
+    public:
+        // The values are written in the same order as they are read, row by row
+        inline constexpr mat3x4(F m00, F m01, F m02, F m03,
+                                F m10, F m11, F m12, F m13,
+                                F m20, F m21, F m22, F m23) noexcept;
+        inline constexpr mat3x4() noexcept;
+
+
+        inline static constexpr mat3x4 identity() noexcept { return mat3x4(1.0, 0.0, 0.0, 0.0,
+                                                                            0.0, 1.0, 0.0, 0.0,
+                                                                            0.0, 0.0, 1.0, 0.0); };
+
+        /// @brief A function to pack an affine 4x4 matrix, its bottom row is dropped
+        /// @param mat The 4x4 matrix, its bottom row is expected to be [0 0 0 1]
+        /// @return Returns a new 3x4 matrix of the same type
+        inline static constexpr mat3x4 fromMat4(const mat4<F>& mat) noexcept;
+        /// @brief A function to generate a 3x4 matrix from a rotation and a translation
+        /// @param rotationQuat The quaternion that contains the wanted rotation, expected to be normalized
+        /// @param translation The translation, stored in the last column
+        /// @return Returns a new 3x4 matrix of the same type
+        inline static constexpr mat3x4 fromQuat(const quat<F>& rotationQuat, const vec3<F>& translation) noexcept;
+        /// @brief A function to generate a 3x4 matrix from a dual quaternion
+        /// @param dQuat The dual quaternion, expected to be normalized
+        /// @return Returns a new 3x4 matrix of the same type
+        inline static constexpr mat3x4 fromDualQuat(const dualQuat<F>& dQuat) noexcept;
+
+        /// @brief A function to unpack the matrix, with a [0 0 0 1] bottom row added
+        /// @return Returns a new 4x4 matrix of the same type
+        inline constexpr mat4<F> toMat4() const noexcept;
+
+        /// @brief A function to pack many affine 4x4 matrices at once (with SSE for float, AVX for double)
+        /// @param mats The 4x4 matrices, their bottom row is expected to be [0 0 0 1]
+        /// @param results Where the 3x4 matrices are written, at least as big as mats
+        static void pack(std::span<const mat4<F>> mats, std::span<mat3x4> results);
+        /// @brief A function to unpack many 3x4 matrices at once (with SSE for float, AVX for double)
+        /// @param mats The 3x4 matrices
+        /// @param results Where the 4x4 matrices are written, at least as big as mats
+        static void unpack(std::span<const mat3x4> mats, std::span<mat4<F>> results);
+
+
+        /// @brief A function to transform a point, with an implicit w of 1
+        /// @param point The point to transform
+        /// @return Returns the transformed point
+        inline constexpr vec3<F> transformPoint(const vec3<F>& point) const noexcept;
+        /// @brief A function to transform a direction, with an implicit w of 0, so the translation is ignored
+        /// @param direction The direction to transform
+        /// @return Returns the transformed direction
+        inline constexpr vec3<F> transformDirection(const vec3<F>& direction) const noexcept;
+
+
+        /// @brief The scalar product of two 3x4 matrices, used by operator* when no SIMD kernel is available
+        /// @param a The left matrix
+        /// @param b The right matrix
+        /// @return Returns a new 3x4 matrix of the same type, a * b, as if both had a [0 0 0 1] bottom row
+        inline static constexpr mat3x4 multiplyScalar(const mat3x4& a, const mat3x4& b) noexcept;
+
+
+        /// @brief A function to get the determinant of the 3x3 part, the determinant of the whole affine transform
+        /// @return Returns the determinant, as the type of the matrix
+        inline constexpr F determinant() const noexcept;
+
+        /// @brief A function to inverse the matrix, in place : the 3x3 part is inversed,
+        /// and the translation is rotated back with it
+        /// @return Returns true if the matrix was inversed. If its determinant is or is practically zero,
+        /// returns false and the matrix is left untouched
+        inline constexpr bool inverse() noexcept;
+        /// @brief A function to get the inverse of the matrix
+        /// @return Returns a new 3x4 matrix of the same type, but inversed,
+        /// or std::nullopt if its determinant is or is practically zero
+        inline constexpr std::optional<mat3x4> getInversedMat() const noexcept;
+
+
+        /// @brief A function to access the value at a certain position
+        /// @param row The row (0-2) of the value
+        /// @param col The column (0-3) of the value
+        /// @return Returns a reference to the value at the specified position, allowing it to be changed
+        inline constexpr F& at(int row, int col) noexcept;
+        /// @brief A function to read the value at a certain position (ReadOnly)
+        /// @param row The row (0-2) of the value
+        /// @param col The column (0-3) of the value
+        /// @return Returns a copy of the value at the specified position
+        inline constexpr F at(int row, int col) const noexcept;
+
+
+        inline constexpr mat3x4& operator*=(const mat3x4& other) noexcept;
+    };
+
+    template<FloatingNumber F>
+    inline constexpr mat3x4<F> operator*(const mat3x4<F>& a, const mat3x4<F>& b) noexcept;
+
+    template<FloatingNumber F>
+    inline constexpr vec4<F> operator*(const mat3x4<F>& mat, const vec4<F>& vec) noexcept;
+
+
+    template<FloatingNumber F>
+    inline constexpr bool operator==(const mat3x4<F>& a, const mat3x4<F>& b) noexcept;
+
+    template<FloatingNumber F>
+    inline constexpr bool operator!=(const mat3x4<F>& a, const mat3x4<F>& b) noexcept;
+}
+
+#include "Math\Matrices\Matrix3x4.inl"
@@ -0,0 +1,293 @@
+#include <cmath>
+#include <concepts>
+#include <cassert>
+#include <type_traits>
+
+#include "Math\MathInternal.hpp"
+#include "Math\SimdInternal.hpp"
+
+namespace glMath
+{
+    #pragma region Constructors
+
+    template<FloatingNumber F>
+    inline constexpr mat3x4<F>::mat3x4(F m00, F m01, F m02, F m03,
+                                       F m10, F m11, F m12, F m13,
+                                       F m20, F m21, F m22, F m23) noexcept
+        : rows{ { m00, m01, m02, m03 },
+                { m10, m11, m12, m13 },
+                { m20, m21, m22, m23 } }
+    {}
+
+    // Like the other matrices, only rows is written, so that constant evaluation can read it back
+    template<FloatingNumber F>
+    inline constexpr mat3x4<F>::mat3x4() noexcept
+        : rows{}
+    {}
+
+    #pragma endregion
+
+    #pragma region StaticMethods
+
+    template<FloatingNumber F>
+    inline constexpr mat3x4<F> mat3x4<F>::fromMat4(const mat4<F>& mat) noexcept
+    {
+        return mat3x4<F>(mat.columns[0][0], mat.columns[1][0], mat.columns[2][0], mat.columns[3][0],
+                         mat.columns[0][1], mat.columns[1][1], mat.columns[2][1], mat.columns[3][1],
+                         mat.columns[0][2], mat.columns[1][2], mat.columns[2][2], mat.columns[3][2]);
+    }
+
+    template<FloatingNumber F>
+    inline constexpr mat3x4<F> mat3x4<F>::fromQuat(const quat<F>& rotationQuat, const vec3<F>& translation) noexcept
+    {
+        F xx = rotationQuat.x * rotationQuat.x;
+        F yy = rotationQuat.y * rotationQuat.y;
+        F zz = rotationQuat.z * rotationQuat.z;
+        F xy = rotationQuat.x * rotationQuat.y;
+        F wz = rotationQuat.w * rotationQuat.z;
+        F wy = rotationQuat.w * rotationQuat.y;
+        F wx = rotationQuat.w * rotationQuat.x;
+        F xz = rotationQuat.x * rotationQuat.z;
+        F yz = rotationQuat.y * rotationQuat.z;
+
+        return mat3x4<F>(1 - 2 * (yy + zz), 2 * (xy - wz)    , 2 * (xz + wy)    , translation.x,
+                         2 * (xy + wz)    , 1 - 2 * (xx + zz), 2 * (yz - wx)    , translation.y,
+                         2 * (xz - wy)    , 2 * (yz + wx)    , 1 - 2 * (xx + yy), translation.z);
+    }
+
+    template<FloatingNumber F>
+    inline constexpr mat3x4<F> mat3x4<F>::fromDualQuat(const dualQuat<F>& dQuat) noexcept
+    {
+        return mat3x4<F>::fromQuat(dQuat.real, dQuat.getTranslation());
+    }
+
+    template<FloatingNumber F>
+    inline void mat3x4<F>::pack(std::span<const mat4<F>> mats, std::span<mat3x4<F>> results)
+    {
+        assert(results.size() >= mats.size());
+
+        if constexpr (simd::hasMat3x4Kernel<F>)
+        {
+            simd::mat4ToMat3x4(reinterpret_cast<const F*>(mats.data()), reinterpret_cast<F*>(results.data()), mats.size());
+        }
+        else
+        {
+            for (std::size_t i = 0; i < mats.size(); i++)
+            {
+                results[i] = mat3x4<F>::fromMat4(mats[i]);
+            }
+        }
+    }
+
+    template<FloatingNumber F>
+    inline void mat3x4<F>::unpack(std::span<const mat3x4<F>> mats, std::span<mat4<F>> results)
+    {
+        assert(results.size() >= mats.size());
+
+        if constexpr (simd::hasMat3x4Kernel<F>)
+        {
+            simd::mat3x4ToMat4(reinterpret_cast<const F*>(mats.data()), reinterpret_cast<F*>(results.data()), mats.size());
+        }
+        else
+        {
+            for (std::size_t i = 0; i < mats.size(); i++)
+            {
+                results[i] = mats[i].toMat4();
+            }
+        }
+    }
+
+    template<FloatingNumber F>
+    inline constexpr mat3x4<F> mat3x4<F>::multiplyScalar(const mat3x4<F>& a, const mat3x4<F>& b) noexcept
+    {
+        mat3x4<F> res;
+
+        for (int row = 0; row < 3; row++)
+        {
+            res.rows[row][0] = a.rows[row][0] * b.rows[0][0] + a.rows[row][1] * b.rows[1][0] + a.rows[row][2] * b.rows[2][0];
+            res.rows[row][1] = a.rows[row][0] * b.rows[0][1] + a.rows[row][1] * b.rows[1][1] + a.rows[row][2] * b.rows[2][1];
+            res.rows[row][2] = a.rows[row][0] * b.rows[0][2] + a.rows[row][1] * b.rows[1][2] + a.rows[row][2] * b.rows[2][2];
+            res.rows[row][3] = a.rows[row][0] * b.rows[0][3] + a.rows[row][1] * b.rows[1][3] + a.rows[row][2] * b.rows[2][3] + a.rows[row][3];
+        }
+
+        return res;
+    }
+
+    #pragma endregion
+
+    #pragma region MemberMethods
+
+    template<FloatingNumber F>
+    inline constexpr mat4<F> mat3x4<F>::toMat4() const noexcept
+    {
+        F f0 = static_cast<F>(0.0);
+
+        return mat4<F>(rows[0][0], rows[0][1], rows[0][2], rows[0][3],
+                       rows[1][0], rows[1][1], rows[1][2], rows[1][3],
+                       rows[2][0], rows[2][1], rows[2][2], rows[2][3],
+                       f0        , f0        , f0        , static_cast<F>(1.0));
+    }
+
+    template<FloatingNumber F>
+    inline constexpr vec3<F> mat3x4<F>::transformPoint(const vec3<F>& point) const noexcept
+    {
+        return vec3<F>(
+            rows[0][0] * point.x + rows[0][1] * point.y + rows[0][2] * point.z + rows[0][3],
+            rows[1][0] * point.x + rows[1][1] * point.y + rows[1][2] * point.z + rows[1][3],
+            rows[2][0] * point.x + rows[2][1] * point.y + rows[2][2] * point.z + rows[2][3]
+        );
+    }
+
+    template<FloatingNumber F>
+    inline constexpr vec3<F> mat3x4<F>::transformDirection(const vec3<F>& direction) const noexcept
+    {
+        return vec3<F>(
+            rows[0][0] * direction.x + rows[0][1] * direction.y + rows[0][2] * direction.z,
+            rows[1][0] * direction.x + rows[1][1] * direction.y + rows[1][2] * direction.z,
+            rows[2][0] * direction.x + rows[2][1] * direction.y + rows[2][2] * direction.z
+        );
+    }
+
+    template<FloatingNumber F>
+    inline constexpr F mat3x4<F>::determinant() const noexcept
+    {
+        return rows[0][0] * (rows[1][1] * rows[2][2] - rows[1][2] * rows[2][1]) -
+               rows[0][1] * (rows[1][0] * rows[2][2] - rows[1][2] * rows[2][0]) +
+               rows[0][2] * (rows[1][0] * rows[2][1] - rows[1][1] * rows[2][0]);
+    }
+
+    template<FloatingNumber F>
+    inline constexpr bool mat3x4<F>::inverse() noexcept
+    {
+        // The columns of the inverse of the 3x3 part are the cross products of its rows,
+        // divided by its determinant
+        vec3<F> r0(rows[0][0], rows[0][1], rows[0][2]);
+        vec3<F> r1(rows[1][0], rows[1][1], rows[1][2]);
+        vec3<F> r2(rows[2][0], rows[2][1], rows[2][2]);
+        vec3<F> t (rows[0][3], rows[1][3], rows[2][3]);
+
+        vec3<F> c0 = vec3<F>::crossProduct(r1, r2);
+        vec3<F> c1 = vec3<F>::crossProduct(r2, r0);
+        vec3<F> c2 = vec3<F>::crossProduct(r0, r1);
+
+        F det = vec3<F>::dotProduct(r0, c0);
+
+        if (glMath::abs(det) <= glMath::epsilon<F>()) return false;
+
+        F invDet = static_cast<F>(1.0) / det;
+
+        c0 *= invDet;
+        c1 *= invDet;
+        c2 *= invDet;
+
+        // The rows of the inverse, whose dot products with t give the translation rotated back
+        vec3<F> i0(c0.x, c1.x, c2.x);
+        vec3<F> i1(c0.y, c1.y, c2.y);
+        vec3<F> i2(c0.z, c1.z, c2.z);
+
+        rows[0][0] = i0.x; rows[0][1] = i0.y; rows[0][2] = i0.z; rows[0][3] = -vec3<F>::dotProduct(i0, t);
+        rows[1][0] = i1.x; rows[1][1] = i1.y; rows[1][2] = i1.z; rows[1][3] = -vec3<F>::dotProduct(i1, t);
+        rows[2][0] = i2.x; rows[2][1] = i2.y; rows[2][2] = i2.z; rows[2][3] = -vec3<F>::dotProduct(i2, t);
+
+        return true;
+    }
+
+    template<FloatingNumber F>
+    inline constexpr std::optional<mat3x4<F>> mat3x4<F>::getInversedMat() const noexcept
+    {
+        mat3x4<F> copy = *this;
+
+        if (!copy.inverse()) return std::nullopt;
+
+        return copy;
+    }
+
+    template<FloatingNumber F>
+    inline constexpr F& mat3x4<F>::at(int row, int col) noexcept
+    {
+        return rows[row][col];
+    }
+
+    template<FloatingNumber F>
+    inline constexpr F mat3x4<F>::at(int row, int col) const noexcept
+    {
+        return rows[row][col];
+    }
+
+    #pragma endregion
+
+    #pragma region ReferenceOperators
+
+    template<FloatingNumber F>
+    inline constexpr mat3x4<F>& mat3x4<F>::operator*=(const mat3x4<F>& other) noexcept
+    {
+        // The kernels load all the rows of both matrices before writing,
+        // so the product can be written directly into *this
+        if constexpr (simd::hasMat3x4Kernel<F>)
+        {
+            if (!std::is_constant_evaluated())
+            {
+                simd::mat3x4Multiply(indices, other.indices, indices);
+                return *this;
+            }
+        }
+
+        *this = mat3x4<F>::multiplyScalar(*this, other);
+
+        return *this;
+    }
+
+    #pragma endregion
+
+    #pragma region Operators
+
+    template<FloatingNumber F>
+    inline constexpr mat3x4<F> operator*(const mat3x4<F>& a, const mat3x4<F>& b) noexcept
+    {
+        if constexpr (simd::hasMat3x4Kernel<F>)
+        {
+            if (!std::is_constant_evaluated())
+            {
+                mat3x4<F> res;
+                simd::mat3x4Multiply(a.indices, b.indices, res.indices);
+                return res;
+            }
+        }
+
+        return mat3x4<F>::multiplyScalar(a, b);
+    }
+
+    template<FloatingNumber F>
+    inline constexpr vec4<F> operator*(const mat3x4<F>& mat, const vec4<F>& vec) noexcept
+    {
+        return vec4<F>(
+            mat.rows[0][0] * vec.x + mat.rows[0][1] * vec.y + mat.rows[0][2] * vec.z + mat.rows[0][3] * vec.w,
+            mat.rows[1][0] * vec.x + mat.rows[1][1] * vec.y + mat.rows[1][2] * vec.z + mat.rows[1][3] * vec.w,
+            mat.rows[2][0] * vec.x + mat.rows[2][1] * vec.y + mat.rows[2][2] * vec.z + mat.rows[2][3] * vec.w,
+            vec.w
+        );
+    }
+
+
+    template<FloatingNumber F>
+    inline constexpr bool operator==(const mat3x4<F>& a, const mat3x4<F>& b) noexcept
+    {
+        for (int r = 0; r < 3; r++)
+        {
+            for (int c = 0; c < 4; c++)
+            {
+                if (glMath::abs(b.rows[r][c] - a.rows[r][c]) > glMath::epsilon<F>()) return false;
+            }
+        }
+
+        return true;
+    }
+
+    template<FloatingNumber F>
+    inline constexpr bool operator!=(const mat3x4<F>& a, const mat3x4<F>& b) noexcept
+    {
+        return !(a == b);
+    }
+
+    #pragma endregion
+}
@@ -1,6 +1,8 @@
 #pragma once
 
 #include <concepts>
+#include <optional>
+#include <span>
 
 #include "Math\Concepts.hpp"
 
@@ -12,6 +14,9 @@ namespace glMath
     template<FloatingNumber F>
     struct vec4;
 
+    template<FloatingNumber F>
+    struct vec3a;
+
     template<FloatingNumber F>
     struct quat;
 
@@ -34,12 +39,12 @@ namespace glMath
         };
         
     public: 
-        mat4(F m00, F m01, F m02, F m03,
-             F m10, F m11, F m12, F m13,
-             F m20, F m21, F m22, F m23,
-             F m30, F m31, F m32, F m33);
-        mat4();
-        mat4(F scalar);
+        inline constexpr mat4(F m00, F m01, F m02, F m03,
+                              F m10, F m11, F m12, F m13,
+                              F m20, F m21, F m22, F m23,
+                              F m30, F m31, F m32, F m33) noexcept;
+        inline constexpr mat4() noexcept;
+        inline constexpr mat4(F scalar) noexcept;
 
 
         template<FloatingNumber f>
@@ -47,181 +52,324 @@ namespace glMath
 
         /// @brief A function to convert the 4x4 matrix to a 3x3 matrix.
         /// @return A 3x3 matrix extracted from the top-left corner of the 4x4 matrix.
-        mat3<F> toMat3() const;
+        inline constexpr mat3<F> toMat3() const noexcept;
 
 
-        static mat4 diagonal(F diagonal);
+        inline static constexpr mat4 diagonal(F diagonal) noexcept;
 
 
-        inline static mat4 identity() { return mat4(1.0, 0.0, 0.0, 0.0,
-                                                    0.0, 1.0, 0.0, 0.0,
-                                                    0.0, 0.0, 1.0, 0.0,
-                                                    0.0, 0.0, 0.0, 1.0); };
+        inline static constexpr mat4 identity() noexcept { return mat4(1.0, 0.0, 0.0, 0.0,
+                                                                      0.0, 1.0, 0.0, 0.0,
+                                                                      0.0, 0.0, 1.0, 0.0,
+                                                                      0.0, 0.0, 0.0, 1.0); };
 
-        static mat4 translate(const vec3<F>& translation);
-        static mat4 translate(F tx, F ty, F tz);
+        inline static constexpr mat4 translate(const vec3<F>& translation) noexcept;
+        inline static constexpr mat4 translate(F tx, F ty, F tz) noexcept;
 
-        static mat4 scale(const vec3<F>& scale);
-        static mat4 scale(F sx, F sy, F sz);
+        inline static constexpr mat4 scale(const vec3<F>& scale) noexcept;
+        inline static constexpr mat4 scale(F sx, F sy, F sz) noexcept;
 
+        // P being exactMath or fastMath, for the precision of the sine and cosine
+        template<MathPolicy P = exactMath>
         static mat4 rotateX(F xAngDegrees);
+        template<MathPolicy P = exactMath>
         static mat4 rotateY(F yAngDegrees);
+        template<MathPolicy P = exactMath>
         static mat4 rotateZ(F zAngDegrees);
+        // The same rotations from a precomputed sine and cosine (glMath::sincos), the angle being in radians
+        inline static constexpr mat4 rotateX(const sinCos<F>& angle) noexcept;
+        inline static constexpr mat4 rotateY(const sinCos<F>& angle) noexcept;
+        inline static constexpr mat4 rotateZ(const sinCos<F>& angle) noexcept;
 
-        static mat4 fromQuat(const quat<F>& rotationQuat);
-        static mat4 fromDualQuat(const dualQuat<F>& dQuat);
+        inline static constexpr mat4 fromQuat(const quat<F>& rotationQuat) noexcept;
+        inline static constexpr mat4 fromDualQuat(const dualQuat<F>& dQuat) noexcept;
 
-        static mat4 fromMat3(const mat3<F>& mat);
+        inline static constexpr mat4 fromMat3(const mat3<F>& mat) noexcept;
 
-        /// @brief A function to generates a lookAt matrix
+        /// @brief A function to generate a lookAt (view) matrix, right-handed : the camera looks down its -z axis
         /// @param eye The position of the element looking
         /// @param target The position of the element to look at
         /// @param worldUp The world up vector
         /// @return Returns a new 4X4 matrix of the same type 
         static mat4 lookAt(const vec3<F>& eye, const vec3<F>& target, const vec3<F>& worldUp);
+        /// @brief A function to generate the inverse of lookAt(), the world matrix of the camera, 
+        /// without inversing anything : its columns are the axes of the camera, and eye
+        /// @return Returns a new 4X4 matrix of the same type 
+        static mat4 lookAtInverse(const vec3<F>& eye, const vec3<F>& target, const vec3<F>& worldUp);
 
-        /// @brief A function to generate a perspective matrix
-        /// @param fovInRad The Field Of View of the camera, IN RADIANS
+        /// @brief A function to generate a perspective matrix, right-handed, with a [-1, 1] depth range
+        /// @param fovInRad The vertical Field Of View of the camera, IN RADIANS
         /// @param aspectRatio The aspect ratio of the window
         /// @param near The near clipping plane
         /// @param far The far clipping plane
         /// @return Return a new 4X4 matrix of the same type
         static mat4 perspective(F fovInRad, F aspectRatio, F near, F far);
+        /// @brief A function to generate the inverse of perspective(), in closed form, to unproject from clip space to view space
+        static mat4 perspectiveInverse(F fovInRad, F aspectRatio, F near, F far);
 
-        /// @brief A function to generate an orthographic matrix
-        /// @param left The left clipping plpane
+        /// @brief A function to generate a reversed-Z perspective matrix, right-handed, with a [0, 1] depth range 
+        /// (glClipControl(..., GL_ZERO_TO_ONE)) : near is mapped to 1 and far to 0, which spreads the precision 
+        /// of a floating point depth buffer evenly
+        /// @param fovInRad The vertical Field Of View of the camera, IN RADIANS
+        /// @param aspectRatio The aspect ratio of the window
+        /// @param near The near clipping plane
+        /// @param far The far clipping plane
+        /// @return Return a new 4X4 matrix of the same type
+        static mat4 perspectiveReversedZ(F fovInRad, F aspectRatio, F near, F far);
+        /// @brief A function to generate the inverse of perspectiveReversedZ(), in closed form
+        static mat4 perspectiveReversedZInverse(F fovInRad, F aspectRatio, F near, F far);
+
+        /// @brief A function to generate a perspective matrix without far plane, right-handed, with a [-1, 1] depth range
+        /// @param fovInRad The vertical Field Of View of the camera, IN RADIANS
+        /// @param aspectRatio The aspect ratio of the window
+        /// @param near The near clipping plane
+        /// @return Return a new 4X4 matrix of the same type
+        static mat4 perspectiveInfinite(F fovInRad, F aspectRatio, F near);
+        /// @brief A function to generate the inverse of perspectiveInfinite(), in closed form
+        static mat4 perspectiveInfiniteInverse(F fovInRad, F aspectRatio, F near);
+
+        /// @brief A function to generate a reversed-Z perspective matrix without far plane, right-handed, with a [0, 1] depth range : 
+        /// near is mapped to 1, and the infinity to 0
+        /// @param fovInRad The vertical Field Of View of the camera, IN RADIANS
+        /// @param aspectRatio The aspect ratio of the window
+        /// @param near The near clipping plane
+        /// @return Return a new 4X4 matrix of the same type
+        static mat4 perspectiveInfiniteReversedZ(F fovInRad, F aspectRatio, F near);
+        /// @brief A function to generate the inverse of perspectiveInfiniteReversedZ(), in closed form
+        static mat4 perspectiveInfiniteReversedZInverse(F fovInRad, F aspectRatio, F near);
+
+        /// @brief A function to generate an orthographic matrix, right-handed, with a [-1, 1] depth range
+        /// @param left The left clipping plane
         /// @param right The right clipping plane
-        /// @param bottom The top clipping plane
-        /// @param top The bottom clipping plane
+        /// @param bottom The bottom clipping plane
+        /// @param top The top clipping plane
         /// @param near The near clipping plane
         /// @param far The far clipping plane
         /// @return Return a new 4X4 matrix of the same type
-        static mat4 orthographic(F left, F right, F bottom, F top, F near, F far);
+        inline static constexpr mat4 orthographic(F left, F right, F bottom, F top, F near, F far) noexcept;
+        /// @brief A function to generate the inverse of orthographic(), in closed form
+        inline static constexpr mat4 orthographicInverse(F left, F right, F bottom, F top, F near, F far) noexcept;
 
         
-        vec4<F> transformPoint(const vec4<F>& point) const;
-        static vec4<F> transformPoint(const mat4& mat, const vec4<F>& point);
+        inline constexpr vec4<F> transformPoint(const vec4<F>& point) const noexcept;
+        inline static constexpr vec4<F> transformPoint(const mat4& mat, const vec4<F>& point) noexcept;
+
+        /// @brief A function to transform many points at once, with an implicit w of 1. 
+        /// With SSE, mat4<float> works on 4 points per step, and when the CPU's level isn't the build's, the kernel of dispatch::runtimeKernels() is used
+        /// @param points The points to transform
+        /// @param results Where the transformed points are written, at least as big as points. 
+        /// It can be the same span as points, but must not partially overlap it
+        /// @param perspectiveDivide If true, the results are divided by their transformed w
+        void transformPoints(std::span<const vec3<F>> points, std::span<vec3<F>> results, bool perspectiveDivide = false) const;
+        /// @brief A function to transform many directions at once, with an implicit w of 0, so the translation is ignored. 
+        /// With SSE, mat4<float> works on 4 directions per step
+        /// @param directions The directions to transform
+        /// @param results Where the transformed directions are written, at least as big as directions. 
+        /// It can be the same span as directions, but must not partially overlap it
+        void transformDirections(std::span<const vec3<F>> directions, std::span<vec3<F>> results) const;
+        /// @brief A function to transform many points at once, with the w of each point
+        /// @param points The points to transform
+        /// @param results Where the transformed points are written, at least as big as points. 
+        /// It can be the same span as points, but must not partially overlap it
+        void transformPoints(std::span<const vec4<F>> points, std::span<vec4<F>> results) const;
+        /// @brief A function to transform many directions at once, their w being taken as 0, so the translation is ignored
+        /// @param directions The directions to transform
+        /// @param results Where the transformed directions are written, at least as big as directions. 
+        /// It can be the same span as directions, but must not partially overlap it
+        void transformDirections(std::span<const vec4<F>> directions, std::span<vec4<F>> results) const;
+        /// @brief A function to transform many points at once, with an implicit w of 1. 
+        /// With SSE for float and AVX for double, each vec3a is transformed in one register, without repacking
+        /// @param points The points to transform
+        /// @param results Where the transformed points are written, at least as big as points. 
+        /// It can be the same span as points, but must not partially overlap it
+        /// @param perspectiveDivide If true, the results are divided by their transformed w
+        void transformPoints(std::span<const vec3a<F>> points, std::span<vec3a<F>> results, bool perspectiveDivide = false) const;
+        /// @brief A function to transform many directions at once, with an implicit w of 0, so the translation is ignored
+        /// @param directions The directions to transform
+        /// @param results Where the transformed directions are written, at least as big as directions. 
+        /// It can be the same span as directions, but must not partially overlap it
+        void transformDirections(std::span<const vec3a<F>> directions, std::span<vec3a<F>> results) const;
+
+
+        /// @brief The scalar product of two matrices, used by operator* when no SIMD kernel is available.
+        /// The SIMD kernels agree with it within 4 ULP of the sum of the absolute products of each element
+        /// (they can use FMA, which rounds once instead of twice)
+        /// @param a The left matrix
+        /// @param b The right matrix
+        /// @return Returns a new 4x4 matrix of the same type, a * b
+        inline static constexpr mat4 multiplyScalar(const mat4& a, const mat4& b) noexcept;
 
 
         /// @brief A function to transpose a matrix, inversing its rows and its columns
         /// @return Returns a reference to the matrix, but transposed
-        mat4& transpose();
+        inline constexpr mat4& transpose() noexcept;
         /// @brief A function to transpose a matrix, inversing its rows and columns
         /// @return Returns a new 4x4 matrix of the same type, but transposed
-        mat4 getTransposedMat() const;
-        static mat4 transpose(const mat4& mat);
-
-        /// @brief A function to inverse a matrix
-        /// @return Returns a reference to the matrix, but inversed. 
-        /// If its determinant is or is practically zero, returns a new matrix, identic as the original 
-        mat4& inverse();
-        /// @brief A function to transpose a matrix, inversing its rows and columns
-        /// @return Returns a new 4x4 matrix of the same type, but transposed
-        mat4 getInversedMat() const;
-        static mat4 inverse(const mat4& mat);
+        inline constexpr mat4 getTransposedMat() const noexcept;
+        inline static constexpr mat4 transpose(const mat4& mat) noexcept;
+
+        /// @brief A function to inverse a matrix, in place. The 2x2 sub-determinants are computed once 
+        /// and shared by the determinant and the adjugate (and with SSE for mat4<float>)
+        /// @return Returns true if the matrix was inversed. If its determinant is or is practically zero, 
+        /// returns false and the matrix is left untouched
+        inline constexpr bool inverse() noexcept;
+        /// @brief A function to get the inverse of a matrix
+        /// @return Returns a new 4x4 matrix of the same type, but inversed, 
+        /// or std::nullopt if its determinant is or is practically zero
+        inline constexpr std::optional<mat4> getInversedMat() const noexcept;
+        inline static constexpr std::optional<mat4> inverse(const mat4& mat) noexcept;
+
+        /// @brief A function to inverse an affine matrix (bottom row being [0 0 0 1]), in place : 
+        /// the 3x3 part is inversed, and the translation is rotated back with it. 
+        /// Way cheaper than inverse(), for matrices made by translate, scale, rotateX/Y/Z, fromQuat, fromDualQuat...
+        /// @attention In debug builds, asserts that the matrix is affine
+        /// @return Returns true if the matrix was inversed. If its 3x3 determinant is or is practically zero,
+        /// returns false and the matrix is left untouched
+        inline constexpr bool inverseAffine() noexcept;
+        /// @brief A function to get the inverse of an affine matrix (bottom row being [0 0 0 1])
+        /// @attention In debug builds, asserts that the matrix is affine
+        /// @return Returns a new 4x4 matrix of the same type, but inversed, 
+        /// or std::nullopt if its 3x3 determinant is or is practically zero
+        inline constexpr std::optional<mat4> getInversedAffineMat() const noexcept;
+        /// @brief A function to inverse many affine matrices (bottom row being [0 0 0 1]) 
+        /// @param mats The matrices to inverse
+        /// @param results Where the inverses are written, at least as big as mats. It can be the same span as mats
+        /// @return Returns true if all the matrices were inversed. The ones whose 3x3 determinant is or is 
+        /// practically zero are copied unchanged in results
+        static bool inverseAffine(std::span<const mat4> mats, std::span<mat4> results);
+
+        /// @brief A function to inverse a rigid matrix (a rotation and a translation only), in place : 
+        /// the 3x3 part is transposed, and the translation is rotated back with it. 
+        /// Even cheaper than inverseAffine(), for matrices made by translate, rotateX/Y/Z, fromQuat, fromDualQuat, lookAt...
+        /// @attention In debug builds, asserts that the matrix is rigid
+        /// @return Returns a reference to the matrix, but inversed
+        inline constexpr mat4& inverseRigid() noexcept;
+        /// @brief A function to get the inverse of a rigid matrix (a rotation and a translation only)
+        /// @attention In debug builds, asserts that the matrix is rigid
+        /// @return Returns a new 4x4 matrix of the same type, but inversed
+        inline constexpr mat4 getInversedRigidMat() const noexcept;
+        /// @brief A function to inverse many rigid matrices (a rotation and a translation only)
+        /// @param mats The matrices to inverse
+        /// @param results Where the inverses are written, at least as big as mats. It can be the same span as mats
+        static void inverseRigid(std::span<const mat4> mats, std::span<mat4> results);
+
+        /// @brief A function to know if the bottom row of the matrix is [0 0 0 1]
+        /// @return Returns true if the matrix is affine
+        inline constexpr bool isAffine() const noexcept;
+        /// @brief A function to know if the matrix is only made of a rotation and a translation : 
+        /// affine, with orthonormal 3x3 columns and a positive determinant 
+        /// @param tolerance The tolerance used on the dot products and lengths of the columns
+        /// @return Returns true if the matrix is rigid
+        inline constexpr bool isRigid(F tolerance = static_cast<F>(1e-3)) const noexcept;
 
 
         /// @brief A function to get the matrix of cofactors
         /// @return Returns a new matrix of the same type, but made of its cofactors 
-        mat4 getComatrix() const;
+        inline constexpr mat4 getComatrix() const noexcept;
         /// @brief A function to get the matrix of cofactors
         /// @param mat The matrix which will be used to calculate all the cofactors
         /// @return Returns a new 4x4 matrix of the same type, but made of the cofactors of the specified matrix
-        static mat4 getComatrix(const mat4<F>& mat);
+        inline static constexpr mat4 getComatrix(const mat4<F>& mat) noexcept;
 
         /// @brief A function to get the adjugate of a matrix, the cofactor matrix transposed 
         /// @return Returns a new 4x4 matrix, of the same type but that is the adjugate of itself
-        mat4 getAdjugate() const;
+        inline constexpr mat4 getAdjugate() const noexcept;
         /// @brief A function to get the adjufate of a matrix, the cofactor matrix transposed
         /// @param mat The matrix which will be used to calculate the adjugate
         /// @return Returns a new 4x4 matrix of the same type, but that is the adjugate of the specified matrix
-        static mat4 getAdjugate(const mat4<F>& mat);
+        inline static constexpr mat4 getAdjugate(const mat4<F>& mat) noexcept;
 
-        /// @brief A function to get the normal of a matrix, the top-left 3x3 matrix inversed and then transposed
+        /// @brief A function to get the normal of a matrix, the top-left 3x3 matrix inversed and then transposed.
+        /// A top-left 3x3 matrix that can't be inversed (its determinant is or is practically zero) is only transposed
         /// @return Returns a new 3x3 matrix of the same type, but that is the normal of itself
-        mat3<F> getNormalMat() const;
+        inline constexpr mat3<F> getNormalMat() const noexcept;
         /// @brief A function to get the normal of a matrix, the top-left 3x3 matrix inversed and then transposed
         /// @param mat The matrix which will be used to calculate the normal
         /// @return Returns a new 3x3 matrix of the same type, but that is the normal of the specified matrix 
-        static mat3<F> getNormalMat(const mat4<F>& mat);
+        inline static constexpr mat3<F> getNormalMat(const mat4<F>& mat) noexcept;
 
 
         /// @brief A function to get a smaller matrix from a bigger one
         /// @param row The row (0-3) to remove
         /// @param col The column (0-3) to remove
         /// @return Return a new 3x3 matrix of the same type
-        mat3<F> getSubmatrix(int row, int col) const;
+        inline constexpr mat3<F> getSubmatrix(int row, int col) const noexcept;
 
         /// @brief A function to get the minor of a smaller matrix from a bigger one
         /// @param row The row (0-3) to remove
         /// @param col The column (0-3) to remove
         /// @return Return the determinant of the 3x3 matrix, as the type of the original matrix 
-        F getMinor(int row, int col) const;
+        inline constexpr F getMinor(int row, int col) const noexcept;
         /// @brief A function to get the cofactor of a smaller matrix from a bigger one
         /// @param row The row (0-3) to remove
         /// @param col The column (0-3) to remove
         /// @return Return the cofactor of the 3x3 matrix, as the type of the original matrix
-        F getCofactor(int row, int col) const;
+        inline constexpr F getCofactor(int row, int col) const noexcept;
 
         /// @brief A function to get the determinant of a matrix
         /// @return Return the determinant of the matrix that called the object, as the type of the matrix
-        F determinant() const;
+        inline constexpr F determinant() const noexcept;
         /// @brief A function to get the determinant of a matrix
         /// @param mat The matrix which will be used to calculate the determinant
         /// @return Return the determinant of the specified matrix, as the type of the matrix
-        static F determinant(const mat4<F>& mat);
+        inline static constexpr F determinant(const mat4<F>& mat) noexcept;
         
         /// @brief A function to access the value at a certain position
         /// @param row The row (0-3) of the value. If the value is less than 0, or greater than 3, it doesn't cause an error
         /// @param col The column (0-3) of the value. If the value is less than 0, or greater than 3, it doesn't cause an error
         /// @return Returns a reference to the value at the specified position, allowing it to be changed 
-        F& at(int row, int col);
+        inline constexpr F& at(int row, int col) noexcept;
         /// @brief A function to read the value at a certain position (ReadOnly)
         /// @param row The row (0-3) of the value. If the value is less than 0, or greater than 3, it doesn't cause an error
         /// @param col The column (0-3) of the value. If the value is less than 0, or greater than 3, it doesn't cause an error
         /// @return Returns a const copy to the value at the specified position, allowing it to be read but not changed 
-        const F at(int row, int col) const;   
+        inline constexpr const F at(int row, int col) const noexcept;
         
         
-        mat4& operator+=(const mat4& other);
-        mat4& operator+=(F scalar);
+        inline constexpr mat4& operator+=(const mat4& other) noexcept;
+        inline constexpr mat4& operator+=(F scalar) noexcept;
 
-        mat4& operator-=(const mat4& other);
-        mat4& operator-=(F scalar);
+        inline constexpr mat4& operator-=(const mat4& other) noexcept;
+        inline constexpr mat4& operator-=(F scalar) noexcept;
         
-        mat4& operator*=(const mat4& other);
-        mat4& operator*=(F scalar);
+        inline constexpr mat4& operator*=(const mat4& other) noexcept;
+        inline constexpr mat4& operator*=(F scalar) noexcept;
     
-        mat4& operator/=(F scalar);
+        inline constexpr mat4& operator/=(F scalar) noexcept;
+
+    private:
+        // The right, up and backward axes of a camera at eye looking at target, shared by lookAt() and lookAtInverse()
+        static void lookAtAxes(const vec3<F>& eye, const vec3<F>& target, const vec3<F>& worldUp, 
+                               vec3<F>& right, vec3<F>& up, vec3<F>& backward);
     };
 
     template<FloatingNumber F>
-    inline mat4<F> operator*(const mat4<F>& a, const mat4<F>& b);
+    inline constexpr mat4<F> operator*(const mat4<F>& a, const mat4<F>& b) noexcept;
 
     template<FloatingNumber F>
-    inline vec4<F> operator*(const mat4<F>& mat, const vec4<F>& vec);
+    inline constexpr vec4<F> operator*(const mat4<F>& mat, const vec4<F>& vec) noexcept;
 
     template<FloatingNumber F>
-    inline mat4<F> operator+(const mat4<F>& a, const mat4<F>& b);
+    inline constexpr mat4<F> operator+(const mat4<F>& a, const mat4<F>& b) noexcept;
 
     template<FloatingNumber F>
-    inline mat4<F> operator-(const mat4<F>& a, const mat4<F>& b);
+    inline constexpr mat4<F> operator-(const mat4<F>& a, const mat4<F>& b) noexcept;
 
     template<FloatingNumber F>
-    inline mat4<F> operator*(const mat4<F>& mat, F scalar);
+    inline constexpr mat4<F> operator*(const mat4<F>& mat, F scalar) noexcept;
 
     template<FloatingNumber F>
-    inline mat4<F> operator*(F scalar, const mat4<F>& mat);
+    inline constexpr mat4<F> operator*(F scalar, const mat4<F>& mat) noexcept;
 
     template<FloatingNumber F>
-    inline mat4<F> operator/(const mat4<F>& mat, F scalar);
+    inline constexpr mat4<F> operator/(const mat4<F>& mat, F scalar) noexcept;
 
 
     template<FloatingNumber F>
-    inline bool operator==(const mat4<F>& a, const mat4<F>& b);
+    inline constexpr bool operator==(const mat4<F>& a, const mat4<F>& b) noexcept;
 
     template<FloatingNumber F>
-    inline bool operator!=(const mat4<F>& a, const mat4<F>& b);
+    inline constexpr bool operator!=(const mat4<F>& a, const mat4<F>& b) noexcept;
 }
 
 #include "Math\Matrices\Matrix4x4.inl"
\ No newline at end of file
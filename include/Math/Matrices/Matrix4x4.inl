@@ -1,43 +1,41 @@
 #include <cmath>
 #include <concepts>
+#include <cassert>
+#include <type_traits>
 
 #include "Math\MathInternal.hpp"
+#include "Math\SimdInternal.hpp"
+#include "Math\Dispatch\DispatchKernels.hpp"
 
 namespace glMath
 {
     #pragma region Constructors
 
     template<FloatingNumber F>
-    inline mat4<F>::mat4(F m00, F m01, F m02, F m03,
-                         F m10, F m11, F m12, F m13,
-                         F m20, F m21, F m22, F m23,
-                         F m30, F m31, F m32, F m33)
-    {
-        columns[0][0] = m00; columns[0][1] = m10; columns[0][2] = m20; columns[0][3] = m30;
-        columns[1][0] = m01; columns[1][1] = m11; columns[1][2] = m21; columns[1][3] = m31;
-        columns[2][0] = m02; columns[2][1] = m12; columns[2][2] = m22; columns[2][3] = m32;
-        columns[3][0] = m03; columns[3][1] = m13; columns[3][2] = m23; columns[3][3] = m33;
-    }
-
+    inline constexpr mat4<F>::mat4(F m00, F m01, F m02, F m03,
+                                   F m10, F m11, F m12, F m13,
+                                   F m20, F m21, F m22, F m23,
+                                   F m30, F m31, F m32, F m33) noexcept
+        : columns{ { m00, m10, m20, m30 }, 
+                   { m01, m11, m21, m31 }, 
+                   { m02, m12, m22, m32 }, 
+                   { m03, m13, m23, m33 } }
+    {}
+
+    // Only columns is written, so that constant evaluation can read it back : 
+    // indices is still fine at runtime (the SIMD kernels use it)
     template<FloatingNumber F>
-    inline mat4<F>::mat4()
-    {
-        F f0 = static_cast<F>(0.0);
-
-        for (int i = 0; i < 16; i++)
-        {
-            indices[i] = f0;
-        }
-    }
+    inline constexpr mat4<F>::mat4() noexcept
+        : columns{}
+    {}
 
     template<FloatingNumber F>
-    inline mat4<F>::mat4(F scalar)
-    {
-        for (int i = 0; i < 16; i++)
-        {
-            indices[i] = scalar;
-        }
-    }
+    inline constexpr mat4<F>::mat4(F scalar) noexcept
+        : columns{ { scalar, scalar, scalar, scalar }, 
+                   { scalar, scalar, scalar, scalar }, 
+                   { scalar, scalar, scalar, scalar }, 
+                   { scalar, scalar, scalar, scalar } }
+    {}
 
     #pragma endregion
 
@@ -67,39 +65,72 @@ namespace glMath
     #pragma region StaticMethods
 
     template<FloatingNumber F>
-    inline mat4<F> mat4<F>::transpose(const mat4<F>& mat)
+    inline constexpr mat4<F> mat4<F>::transpose(const mat4<F>& mat) noexcept
     {
         return mat.getTransposedMat();
     }
     template<FloatingNumber F>
-    inline mat4<F> mat4<F>::inverse(const mat4<F>& mat)
+    inline constexpr std::optional<mat4<F>> mat4<F>::inverse(const mat4<F>& mat) noexcept
     {
         return mat.getInversedMat();
     }
 
 
     template<FloatingNumber F>
-    inline mat4<F> mat4<F>::getComatrix(const mat4<F>& mat) 
+    inline bool mat4<F>::inverseAffine(std::span<const mat4<F>> mats, std::span<mat4<F>> results)
+    {
+        assert(results.size() >= mats.size());
+
+        bool allInversed = true;
+
+        for (std::size_t i = 0; i < mats.size(); i++)
+        {
+            mat4<F> mat = mats[i];
+
+            allInversed &= mat.inverseAffine();
+
+            results[i] = mat;
+        }
+
+        return allInversed;
+    }
+
+    template<FloatingNumber F>
+    inline void mat4<F>::inverseRigid(std::span<const mat4<F>> mats, std::span<mat4<F>> results)
+    {
+        assert(results.size() >= mats.size());
+
+        for (std::size_t i = 0; i < mats.size(); i++)
+        {
+            mat4<F> mat = mats[i];
+
+            results[i] = mat.inverseRigid();
+        }
+    }
+
+
+    template<FloatingNumber F>
+    inline constexpr mat4<F> mat4<F>::getComatrix(const mat4<F>& mat) noexcept 
     {
         return mat.getComatrix();
     }
 
     template<FloatingNumber F>
-    inline mat4<F> mat4<F>::getAdjugate(const mat4<F>& mat) 
+    inline constexpr mat4<F> mat4<F>::getAdjugate(const mat4<F>& mat) noexcept 
     {
         return mat.getAdjugate();
     }
 
 
     template<FloatingNumber F>
-    inline mat3<F> mat4<F>::getNormalMat(const mat4<F>& mat) 
+    inline constexpr mat3<F> mat4<F>::getNormalMat(const mat4<F>& mat) noexcept 
     {
         return mat.getNormalMat();
     }
 
     
     template<FloatingNumber F>
-    inline mat4<F> mat4<F>::diagonal(F diagonal)
+    inline constexpr mat4<F> mat4<F>::diagonal(F diagonal) noexcept
     {
         mat4<F> baseMat;
 
@@ -113,13 +144,13 @@ namespace glMath
 
 
     template<FloatingNumber F>
-    inline mat4<F> mat4<F>::translate(const vec3<F>& translation)
+    inline constexpr mat4<F> mat4<F>::translate(const vec3<F>& translation) noexcept
     {
         return mat4<F>::translate(translation.x, translation.y, translation.z);
     }
 
     template<FloatingNumber F>
-    inline mat4<F> mat4<F>::translate(F tx, F ty, F tz)
+    inline constexpr mat4<F> mat4<F>::translate(F tx, F ty, F tz) noexcept
     {
         mat4<F> res = mat4<F>::identity();
 
@@ -132,13 +163,13 @@ namespace glMath
 
 
     template<FloatingNumber F>
-    inline mat4<F> mat4<F>::scale(const vec3<F>& scale)
+    inline constexpr mat4<F> mat4<F>::scale(const vec3<F>& scale) noexcept
     {
         return mat4<F>::scale(scale.x, scale.y, scale.z);
     }
 
     template<FloatingNumber F>
-    inline mat4<F> mat4<F>::scale(F sx, F sy, F sz)
+    inline constexpr mat4<F> mat4<F>::scale(F sx, F sy, F sz) noexcept
     {
         mat4<F> res = mat4<F>::identity();
 
@@ -151,58 +182,67 @@ namespace glMath
 
 
     template<FloatingNumber F>
+    template<MathPolicy P>
     inline mat4<F> mat4<F>::rotateX(F xAngDeg) 
     {
-        F ang = xAngDeg * glMath::degToRad<F>();
-        F cx = static_cast<F>(std::cos(ang));
-        F sx = static_cast<F>(std::sin(ang));
+        return mat4<F>::rotateX(P::sincos(xAngDeg * glMath::degToRad<F>()));
+    }
 
+    template<FloatingNumber F>
+    inline constexpr mat4<F> mat4<F>::rotateX(const sinCos<F>& angle) noexcept
+    {
         mat4<F> res = mat4<F>::identity();
 
-        res.columns[1][1] = cx;
-        res.columns[2][1] = -sx;
-        res.columns[1][2] = sx;
-        res.columns[2][2] = cx;
+        res.columns[1][1] = angle.cos;
+        res.columns[2][1] = -angle.sin;
+        res.columns[1][2] = angle.sin;
+        res.columns[2][2] = angle.cos;
 
         return res;
     }
 
     template<FloatingNumber F>
+    template<MathPolicy P>
     inline mat4<F> mat4<F>::rotateY(F xAngDeg) 
     {
-        F ang = xAngDeg * glMath::degToRad<F>();
-        F cx = static_cast<F>(std::cos(ang));
-        F sx = static_cast<F>(std::sin(ang));
+        return mat4<F>::rotateY(P::sincos(xAngDeg * glMath::degToRad<F>()));
+    }
 
+    template<FloatingNumber F>
+    inline constexpr mat4<F> mat4<F>::rotateY(const sinCos<F>& angle) noexcept
+    {
         mat4<F> res = mat4<F>::identity();
 
-        res.columns[0][0] = cx;
-        res.columns[2][0] = sx;
-        res.columns[0][2] = -sx;
-        res.columns[2][2] = cx;
+        res.columns[0][0] = angle.cos;
+        res.columns[2][0] = angle.sin;
+        res.columns[0][2] = -angle.sin;
+        res.columns[2][2] = angle.cos;
 
         return res;
     }
 
     template<FloatingNumber F>
+    template<MathPolicy P>
     inline mat4<F> mat4<F>::rotateZ(F xAngDeg) 
     {
-        F ang = xAngDeg * glMath::degToRad<F>();
-        F cx = static_cast<F>(std::cos(ang));
-        F sx = static_cast<F>(std::sin(ang));
+        return mat4<F>::rotateZ(P::sincos(xAngDeg * glMath::degToRad<F>()));
+    }
 
+    template<FloatingNumber F>
+    inline constexpr mat4<F> mat4<F>::rotateZ(const sinCos<F>& angle) noexcept
+    {
         mat4<F> res = mat4<F>::identity();
 
-        res.columns[0][0] = cx;
-        res.columns[1][0] = -sx;
-        res.columns[0][1] = sx;
-        res.columns[1][1] = cx;
+        res.columns[0][0] = angle.cos;
+        res.columns[1][0] = -angle.sin;
+        res.columns[0][1] = angle.sin;
+        res.columns[1][1] = angle.cos;
 
         return res;
     }
 
     template<FloatingNumber F>
-    inline mat4<F> mat4<F>::fromQuat(const quat<F>& rotationQuat)
+    inline constexpr mat4<F> mat4<F>::fromQuat(const quat<F>& rotationQuat) noexcept
     {
         F xx = rotationQuat.x * rotationQuat.x;
         F yy = rotationQuat.y * rotationQuat.y;
@@ -223,7 +263,7 @@ namespace glMath
     }
 
     template<FloatingNumber F>
-    inline mat4<F> mat4<F>::fromDualQuat(const dualQuat<F>& dQuat)
+    inline constexpr mat4<F> mat4<F>::fromDualQuat(const dualQuat<F>& dQuat) noexcept
     {
         quat<F> real = dQuat.real;
 
@@ -249,7 +289,7 @@ namespace glMath
 
 
     template<FloatingNumber F>
-    inline mat4<F> mat4<F>::fromMat3(const mat3<F>& mat)
+    inline constexpr mat4<F> mat4<F>::fromMat3(const mat3<F>& mat) noexcept
     {
         mat4<F> res = mat4<F>::identity();
 
@@ -267,54 +307,75 @@ namespace glMath
     }
 
 
+    // If worldUp is practically parallel to the view direction, another up vector is used
     template<FloatingNumber F>
-    inline mat4<F> mat4<F>::lookAt(const vec3<F>& eye, const vec3<F>& target, const vec3<F>& worldUp)
+    inline void mat4<F>::lookAtAxes(const vec3<F>& eye, const vec3<F>& target, const vec3<F>& worldUp, 
+                                    vec3<F>& right, vec3<F>& up, vec3<F>& backward)
     {
         F f0 = static_cast<F>(0.0);
         F f1 = static_cast<F>(1.0);
-        F f2 = static_cast<F>(2.0);
-        F f025 = static_cast<F>(0.25);
-        
-        vec3<F> forward = (target - eye).getUnitVector();
-        vec3<F> right;
 
-        F dotUp = vec3<F>::dotProduct(worldUp, forward);
-        if (std::abs(dotUp) > static_cast<F>(0.9999)) 
+        vec3<F> forward = vec3<F>::normalized(target - eye);
+
+        F dotUp = vec3<F>::dotProduct(vec3<F>::normalized(worldUp), forward);
+        if (glMath::abs(dotUp) > static_cast<F>(0.9999)) 
         { 
-            vec3<F> temporaryUp = std::abs(forward.z) < static_cast<F>(0.999) ? vec3<F>(f0, f0, f1) : vec3<F>(f1, f0, f0); 
-            right = vec3<F>::crossProduct(temporaryUp, forward).getUnitVector(); 
+            vec3<F> temporaryUp = glMath::abs(forward.z) < static_cast<F>(0.999) ? vec3<F>(f0, f0, f1) : vec3<F>(f1, f0, f0); 
+            right = vec3<F>::normalized(vec3<F>::crossProduct(forward, temporaryUp)); 
         } 
         else 
         { 
-            right = vec3<F>::crossProduct(worldUp, forward).getUnitVector(); 
+            right = vec3<F>::normalized(vec3<F>::crossProduct(forward, worldUp)); 
         }
             
-        vec3<F> actualUp = vec3<F>::crossProduct(forward, right);  
-        
-        F m00 = right.x;     F m01 = right.y;     F m02 = right.z;
-        F m10 = actualUp.x;  F m11 = actualUp.y;  F m12 = actualUp.z;
-        F m20 = forward.x;   F m21 = forward.y;   F m22 = forward.z;
-            
-        mat4<F> res = mat4<F>::identity();
+        up = vec3<F>::crossProduct(right, forward);
+        backward = -forward;
+    }
 
-        res.columns[0][0] = right.x;    res.columns[1][0] = right.x;    res.columns[2][0] = right.x;    res.columns[3][0] = -vec3<F>::dotProduct(right, eye);
-        res.columns[0][1] = actualUp.x; res.columns[1][0] = actualUp.x; res.columns[2][0] = actualUp.x; res.columns[3][0] = -vec3<F>::dotProduct(actualUp, eye);
-        res.columns[0][2] = forward.x;  res.columns[1][0] = forward.x;  res.columns[2][0] = forward.x;  res.columns[3][0] = -vec3<F>::dotProduct(forward, eye);
-    
-        return res;
+    template<FloatingNumber F>
+    inline mat4<F> mat4<F>::lookAt(const vec3<F>& eye, const vec3<F>& target, const vec3<F>& worldUp)
+    {
+        vec3<F> right, up, backward;
+        mat4<F>::lookAtAxes(eye, target, worldUp, right, up, backward);
+
+        // The axes are the rows of the rotation, as it is their transpose (and so their inverse)
+        return mat4<F>(right.x,    right.y,    right.z,    -vec3<F>::dotProduct(right, eye),
+                       up.x,       up.y,       up.z,       -vec3<F>::dotProduct(up, eye),
+                       backward.x, backward.y, backward.z, -vec3<F>::dotProduct(backward, eye),
+                       0.0,        0.0,        0.0,        1.0);
+    }
+
+    template<FloatingNumber F>
+    inline mat4<F> mat4<F>::lookAtInverse(const vec3<F>& eye, const vec3<F>& target, const vec3<F>& worldUp)
+    {
+        vec3<F> right, up, backward;
+        mat4<F>::lookAtAxes(eye, target, worldUp, right, up, backward);
+
+        // The world matrix of the camera : the axes are its columns, and eye its translation
+        return mat4<F>(right.x, up.x, backward.x, eye.x,
+                       right.y, up.y, backward.y, eye.y,
+                       right.z, up.z, backward.z, eye.z,
+                       0.0,     0.0,  0.0,        1.0);
     }
 
 
+    // Every perspective below has the same shape :
+    //
+    // ( x 0  0 0 )                        ( 1/x  0    0    0  )
+    // ( 0 y  0 0 )  whose inverse is      (  0  1/y   0    0  )
+    // ( 0 0  a b )                        (  0   0    0   -1  )
+    // ( 0 0 -1 0 )                        (  0   0   1/b  a/b )
+    //
+    // so their inverses are written directly, with 3 divisions
+
     template<FloatingNumber F>
     inline mat4<F> mat4<F>::perspective(F fovInRad, F aspectRatio, F near, F far)
     {
-        F f2 = static_cast<F>(2.0);
         F f1 = static_cast<F>(1.0);
-        F f05 = static_cast<F>(0.5);
 
         F tanHalfFOV = std::tan(fovInRad * static_cast<F>(0.5));
 
-        mat4<F> res = mat4<F>::identity();
+        mat4<F> res;
 
         res.columns[0][0] = f1 / (aspectRatio * tanHalfFOV);
         res.columns[1][1] = f1 / tanHalfFOV;
@@ -326,7 +387,134 @@ namespace glMath
     }
 
     template<FloatingNumber F>
-    inline mat4<F> mat4<F>::orthographic(F left, F right, F bottom, F top, F near, F far)
+    inline mat4<F> mat4<F>::perspectiveInverse(F fovInRad, F aspectRatio, F near, F far)
+    {
+        F f1 = static_cast<F>(1.0);
+
+        F tanHalfFOV = std::tan(fovInRad * static_cast<F>(0.5));
+        F b = -((static_cast<F>(2.0) * far * near) / (far - near));
+
+        mat4<F> res;
+
+        res.columns[0][0] = aspectRatio * tanHalfFOV;
+        res.columns[1][1] = tanHalfFOV;
+        res.columns[3][2] = -f1;
+        res.columns[2][3] = f1 / b;
+        res.columns[3][3] = -((far + near) / (far - near)) / b;
+
+        return res;
+    }
+
+    template<FloatingNumber F>
+    inline mat4<F> mat4<F>::perspectiveReversedZ(F fovInRad, F aspectRatio, F near, F far)
+    {
+        F f1 = static_cast<F>(1.0);
+
+        F tanHalfFOV = std::tan(fovInRad * static_cast<F>(0.5));
+
+        mat4<F> res;
+
+        res.columns[0][0] = f1 / (aspectRatio * tanHalfFOV);
+        res.columns[1][1] = f1 / tanHalfFOV;
+        res.columns[2][2] = near / (far - near);
+        res.columns[3][2] = (far * near) / (far - near);
+        res.columns[2][3] = -f1;
+
+        return res;
+    }
+
+    template<FloatingNumber F>
+    inline mat4<F> mat4<F>::perspectiveReversedZInverse(F fovInRad, F aspectRatio, F near, F far)
+    {
+        F f1 = static_cast<F>(1.0);
+
+        F tanHalfFOV = std::tan(fovInRad * static_cast<F>(0.5));
+
+        mat4<F> res;
+
+        res.columns[0][0] = aspectRatio * tanHalfFOV;
+        res.columns[1][1] = tanHalfFOV;
+        res.columns[3][2] = -f1;
+        res.columns[2][3] = (far - near) / (far * near);
+        res.columns[3][3] = f1 / far;
+
+        return res;
+    }
+
+    template<FloatingNumber F>
+    inline mat4<F> mat4<F>::perspectiveInfinite(F fovInRad, F aspectRatio, F near)
+    {
+        F f1 = static_cast<F>(1.0);
+
+        F tanHalfFOV = std::tan(fovInRad * static_cast<F>(0.5));
+
+        mat4<F> res;
+
+        res.columns[0][0] = f1 / (aspectRatio * tanHalfFOV);
+        res.columns[1][1] = f1 / tanHalfFOV;
+        res.columns[2][2] = -f1;
+        res.columns[3][2] = -static_cast<F>(2.0) * near;
+        res.columns[2][3] = -f1;
+
+        return res;
+    }
+
+    template<FloatingNumber F>
+    inline mat4<F> mat4<F>::perspectiveInfiniteInverse(F fovInRad, F aspectRatio, F near)
+    {
+        F f1 = static_cast<F>(1.0);
+
+        F tanHalfFOV = std::tan(fovInRad * static_cast<F>(0.5));
+        F invB = -f1 / (static_cast<F>(2.0) * near);
+
+        mat4<F> res;
+
+        res.columns[0][0] = aspectRatio * tanHalfFOV;
+        res.columns[1][1] = tanHalfFOV;
+        res.columns[3][2] = -f1;
+        res.columns[2][3] = invB;
+        res.columns[3][3] = -invB;
+
+        return res;
+    }
+
+    template<FloatingNumber F>
+    inline mat4<F> mat4<F>::perspectiveInfiniteReversedZ(F fovInRad, F aspectRatio, F near)
+    {
+        F f1 = static_cast<F>(1.0);
+
+        F tanHalfFOV = std::tan(fovInRad * static_cast<F>(0.5));
+
+        mat4<F> res;
+
+        res.columns[0][0] = f1 / (aspectRatio * tanHalfFOV);
+        res.columns[1][1] = f1 / tanHalfFOV;
+        res.columns[3][2] = near;
+        res.columns[2][3] = -f1;
+
+        return res;
+    }
+
+    template<FloatingNumber F>
+    inline mat4<F> mat4<F>::perspectiveInfiniteReversedZInverse(F fovInRad, F aspectRatio, F near)
+    {
+        F f1 = static_cast<F>(1.0);
+
+        F tanHalfFOV = std::tan(fovInRad * static_cast<F>(0.5));
+
+        mat4<F> res;
+
+        res.columns[0][0] = aspectRatio * tanHalfFOV;
+        res.columns[1][1] = tanHalfFOV;
+        res.columns[3][2] = -f1;
+        res.columns[2][3] = f1 / near;
+
+        return res;
+    }
+
+
+    template<FloatingNumber F>
+    inline constexpr mat4<F> mat4<F>::orthographic(F left, F right, F bottom, F top, F near, F far) noexcept
     {
         F f2 = static_cast<F>(2.0);
 
@@ -334,42 +522,228 @@ namespace glMath
 
         res.columns[0][0] = f2 / (right - left);
         res.columns[1][1] = f2 / (top - bottom);
-        res.columns[1][1] = f2 / (far - near);
+        res.columns[2][2] = -f2 / (far - near);
 
         res.columns[3][0] = -((right + left) / (right - left));
-        res.columns[3][0] = -((top + bottom) / (top - bottom));
-        res.columns[3][0] = -((far + near) / (far - near));
+        res.columns[3][1] = -((top + bottom) / (top - bottom));
+        res.columns[3][2] = -((far + near) / (far - near));
+
+        return res;
+    }
+
+    template<FloatingNumber F>
+    inline constexpr mat4<F> mat4<F>::orthographicInverse(F left, F right, F bottom, F top, F near, F far) noexcept
+    {
+        F f05 = static_cast<F>(0.5);
+
+        mat4<F> res = mat4<F>::identity();
+
+        res.columns[0][0] = (right - left) * f05;
+        res.columns[1][1] = (top - bottom) * f05;
+        res.columns[2][2] = -(far - near) * f05;
+
+        res.columns[3][0] = (right + left) * f05;
+        res.columns[3][1] = (top + bottom) * f05;
+        res.columns[3][2] = -(far + near) * f05;
 
         return res;
     }
 
 
     template<FloatingNumber F>
-    inline F mat4<F>::determinant(const mat4<F>& mat)
+    inline constexpr F mat4<F>::determinant(const mat4<F>& mat) noexcept
     {
         return mat.determinant();
     }
 
 
     template<FloatingNumber F>
-    inline vec4<F> mat4<F>::transformPoint(const mat4<F>& mat, const vec4<F>& point)
+    inline constexpr vec4<F> mat4<F>::transformPoint(const mat4<F>& mat, const vec4<F>& point) noexcept
     {
         return mat * point;
     }
 
+
+    template<FloatingNumber F>
+    inline constexpr mat4<F> mat4<F>::multiplyScalar(const mat4<F>& a, const mat4<F>& b) noexcept
+    {
+        mat4<F> res;
+
+        for (int col = 0; col < 4; col++) 
+        {
+            res.columns[col][0] = a.columns[0][0] * b.columns[col][0] + a.columns[1][0] * b.columns[col][1] + a.columns[2][0] * b.columns[col][2] + a.columns[3][0] * b.columns[col][3];
+            res.columns[col][1] = a.columns[0][1] * b.columns[col][0] + a.columns[1][1] * b.columns[col][1] + a.columns[2][1] * b.columns[col][2] + a.columns[3][1] * b.columns[col][3];
+            res.columns[col][2] = a.columns[0][2] * b.columns[col][0] + a.columns[1][2] * b.columns[col][1] + a.columns[2][2] * b.columns[col][2] + a.columns[3][2] * b.columns[col][3];
+            res.columns[col][3] = a.columns[0][3] * b.columns[col][0] + a.columns[1][3] * b.columns[col][1] + a.columns[2][3] * b.columns[col][2] + a.columns[3][3] * b.columns[col][3];
+        }
+
+        return res;
+    }
+
     #pragma endregion
 
     #pragma region MemberMethods
 
     template<FloatingNumber F>
-    inline vec4<F> mat4<F>::transformPoint(const vec4<F>& point) const
+    inline constexpr vec4<F> mat4<F>::transformPoint(const vec4<F>& point) const noexcept
     {
         return *this * point;
     }
 
 
+    template<FloatingNumber F>
+    inline void mat4<F>::transformPoints(std::span<const vec3<F>> points, std::span<vec3<F>> results, bool perspectiveDivide) const
+    {
+        assert(results.size() >= points.size());
+
+        // The kernels of the CPU's level (or of a forced one), when it isn't the build's
+        if (const dispatch::batchKernels<F>* runtime = dispatch::runtimeKernels<F>())
+        {
+            runtime->mat4TransformPoints(indices, reinterpret_cast<const F*>(points.data()), reinterpret_cast<F*>(results.data()), 
+                                         points.size(), perspectiveDivide);
+            return;
+        }
+
+        std::size_t i = 0;
+
+        if constexpr (simd::hasVec3TransformKernel<F>)
+        {
+            i = simd::mat4TransformVec3(indices, reinterpret_cast<const F*>(points.data()), reinterpret_cast<F*>(results.data()), 
+                                        points.size(), true, perspectiveDivide);
+        }
+
+        // The tail (or everything, without SIMD)
+        for (; i < points.size(); i++)
+        {
+            vec3<F> p = points[i];
+
+            vec3<F> res(
+                columns[0][0] * p.x + columns[1][0] * p.y + columns[2][0] * p.z + columns[3][0],
+                columns[0][1] * p.x + columns[1][1] * p.y + columns[2][1] * p.z + columns[3][1],
+                columns[0][2] * p.x + columns[1][2] * p.y + columns[2][2] * p.z + columns[3][2]
+            );
+
+            if (perspectiveDivide)
+            {
+                res *= static_cast<F>(1.0) / (columns[0][3] * p.x + columns[1][3] * p.y + columns[2][3] * p.z + columns[3][3]);
+            }
+
+            results[i] = res;
+        }
+    }
+
+    template<FloatingNumber F>
+    inline void mat4<F>::transformDirections(std::span<const vec3<F>> directions, std::span<vec3<F>> results) const
+    {
+        assert(results.size() >= directions.size());
+
+        std::size_t i = 0;
+
+        if constexpr (simd::hasVec3TransformKernel<F>)
+        {
+            i = simd::mat4TransformVec3(indices, reinterpret_cast<const F*>(directions.data()), reinterpret_cast<F*>(results.data()), 
+                                        directions.size(), false, false);
+        }
+
+        // The tail (or everything, without SIMD)
+        for (; i < directions.size(); i++)
+        {
+            vec3<F> d = directions[i];
+
+            results[i] = vec3<F>(
+                columns[0][0] * d.x + columns[1][0] * d.y + columns[2][0] * d.z,
+                columns[0][1] * d.x + columns[1][1] * d.y + columns[2][1] * d.z,
+                columns[0][2] * d.x + columns[1][2] * d.y + columns[2][2] * d.z
+            );
+        }
+    }
+
+    template<FloatingNumber F>
+    inline void mat4<F>::transformPoints(std::span<const vec4<F>> points, std::span<vec4<F>> results) const
+    {
+        assert(results.size() >= points.size());
+
+        if constexpr (simd::hasVec4TransformKernel<F>)
+        {
+            simd::mat4TransformVec4(indices, reinterpret_cast<const F*>(points.data()), reinterpret_cast<F*>(results.data()), points.size(), true);
+        }
+        else
+        {
+            for (std::size_t i = 0; i < points.size(); i++)
+            {
+                results[i] = *this * points[i];
+            }
+        }
+    }
+
+    template<FloatingNumber F>
+    inline void mat4<F>::transformDirections(std::span<const vec4<F>> directions, std::span<vec4<F>> results) const
+    {
+        assert(results.size() >= directions.size());
+
+        if constexpr (simd::hasVec4TransformKernel<F>)
+        {
+            simd::mat4TransformVec4(indices, reinterpret_cast<const F*>(directions.data()), reinterpret_cast<F*>(results.data()), directions.size(), false);
+        }
+        else
+        {
+            for (std::size_t i = 0; i < directions.size(); i++)
+            {
+                vec4<F> d = directions[i];
+                d.w = static_cast<F>(0.0);
+
+                results[i] = *this * d;
+            }
+        }
+    }
+
+
+    template<FloatingNumber F>
+    inline void mat4<F>::transformPoints(std::span<const vec3a<F>> points, std::span<vec3a<F>> results, bool perspectiveDivide) const
+    {
+        assert(results.size() >= points.size());
+
+        if constexpr (simd::hasVec3aKernel<F>)
+        {
+            simd::mat4TransformVec3a(indices, points.data()->data, results.data()->data, points.size(), true, perspectiveDivide);
+        }
+        else
+        {
+            for (std::size_t i = 0; i < points.size(); i++)
+            {
+                vec4<F> res = *this * vec4<F>(points[i].x, points[i].y, points[i].z, static_cast<F>(1.0));
+
+                if (perspectiveDivide)
+                {
+                    res *= static_cast<F>(1.0) / res.w;
+                }
+
+                results[i] = vec3a<F>(res);
+            }
+        }
+    }
+
+    template<FloatingNumber F>
+    inline void mat4<F>::transformDirections(std::span<const vec3a<F>> directions, std::span<vec3a<F>> results) const
+    {
+        assert(results.size() >= directions.size());
+
+        if constexpr (simd::hasVec3aKernel<F>)
+        {
+            simd::mat4TransformVec3a(indices, directions.data()->data, results.data()->data, directions.size(), false, false);
+        }
+        else
+        {
+            for (std::size_t i = 0; i < directions.size(); i++)
+            {
+                results[i] = vec3a<F>(*this * vec4<F>(directions[i]));
+            }
+        }
+    }
+
+
     template <FloatingNumber F>
-    inline mat4<F>& mat4<F>::transpose()
+    inline constexpr mat4<F>& mat4<F>::transpose() noexcept
     {
         mat4<F> copy = *this;
 
@@ -390,7 +764,7 @@ namespace glMath
     }
 
     template <FloatingNumber F>
-    inline mat4<F> mat4<F>::getTransposedMat() const
+    inline constexpr mat4<F> mat4<F>::getTransposedMat() const noexcept
     {
         mat4<F> copy = *this;
 
@@ -399,30 +773,199 @@ namespace glMath
 
 
     template <FloatingNumber F>
-    inline mat4<F>& mat4<F>::inverse()
+    inline constexpr bool mat4<F>::inverse() noexcept
     {
-        F det = this->determinant();
+        // The kernels can't run in constant evaluation, which falls through to the scalar path
+        if constexpr (simd::hasMat4InverseKernel<F>)
+        {
+            if (!std::is_constant_evaluated())
+            {
+                return simd::mat4Inverse(indices, indices, glMath::epsilon<F>());
+            }
+        }
+
+        // Same names as in getAdjugate(), row-major with indices going from 1-4
+
+        F m11 = columns[0][0]; F m12 = columns[1][0]; F m13 = columns[2][0]; F m14 = columns[3][0];
+        F m21 = columns[0][1]; F m22 = columns[1][1]; F m23 = columns[2][1]; F m24 = columns[3][1];
+        F m31 = columns[0][2]; F m32 = columns[1][2]; F m33 = columns[2][2]; F m34 = columns[3][2];
+        F m41 = columns[0][3]; F m42 = columns[1][3]; F m43 = columns[2][3]; F m44 = columns[3][3];
+
+        // The 2x2 determinants of the two top rows, and of the two bottom rows.
+        // Every cofactor, and the determinant, is a combination of them
+        F s0 = m11 * m22 - m21 * m12;
+        F s1 = m11 * m23 - m21 * m13;
+        F s2 = m11 * m24 - m21 * m14;
+        F s3 = m12 * m23 - m22 * m13;
+        F s4 = m12 * m24 - m22 * m14;
+        F s5 = m13 * m24 - m23 * m14;
+
+        F c0 = m31 * m42 - m41 * m32;
+        F c1 = m31 * m43 - m41 * m33;
+        F c2 = m31 * m44 - m41 * m34;
+        F c3 = m32 * m43 - m42 * m33;
+        F c4 = m32 * m44 - m42 * m34;
+        F c5 = m33 * m44 - m43 * m34;
 
-        if (std::abs(det) > glMath::epsilon<F>())
+        F det = s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0;
+
+        if (glMath::abs(det) <= glMath::epsilon<F>()) return false;
+
+        F invDet = static_cast<F>(1.0) / det;
+
+        columns[0][0] = ( m22 * c5 - m23 * c4 + m24 * c3) * invDet;
+        columns[1][0] = (-m12 * c5 + m13 * c4 - m14 * c3) * invDet;
+        columns[2][0] = ( m42 * s5 - m43 * s4 + m44 * s3) * invDet;
+        columns[3][0] = (-m32 * s5 + m33 * s4 - m34 * s3) * invDet;
+
+        columns[0][1] = (-m21 * c5 + m23 * c2 - m24 * c1) * invDet;
+        columns[1][1] = ( m11 * c5 - m13 * c2 + m14 * c1) * invDet;
+        columns[2][1] = (-m41 * s5 + m43 * s2 - m44 * s1) * invDet;
+        columns[3][1] = ( m31 * s5 - m33 * s2 + m34 * s1) * invDet;
+
+        columns[0][2] = ( m21 * c4 - m22 * c2 + m24 * c0) * invDet;
+        columns[1][2] = (-m11 * c4 + m12 * c2 - m14 * c0) * invDet;
+        columns[2][2] = ( m41 * s4 - m42 * s2 + m44 * s0) * invDet;
+        columns[3][2] = (-m31 * s4 + m32 * s2 - m34 * s0) * invDet;
+
+        columns[0][3] = (-m21 * c3 + m22 * c1 - m23 * c0) * invDet;
+        columns[1][3] = ( m11 * c3 - m12 * c1 + m13 * c0) * invDet;
+        columns[2][3] = (-m41 * s3 + m42 * s1 - m43 * s0) * invDet;
+        columns[3][3] = ( m31 * s3 - m32 * s1 + m33 * s0) * invDet;
+
+        return true;
+    }
+
+    template <FloatingNumber F>
+    inline constexpr std::optional<mat4<F>> mat4<F>::getInversedMat() const noexcept
+    {
+        mat4<F> copy = *this;
+
+        if (!copy.inverse()) return std::nullopt;
+
+        return copy;
+    }
+
+    template <FloatingNumber F>
+    inline constexpr bool mat4<F>::inverseAffine() noexcept
+    {
+        assert(this->isAffine());
+
+        if constexpr (simd::hasMat4InverseKernel<F>)
         {
-            F invDet = static_cast<F>(1.0) / det;
+            if (!std::is_constant_evaluated())
+            {
+                return simd::mat4InverseAffine(indices, indices, glMath::epsilon<F>());
+            }
+        }
+
+        // The rows of the inverse of the 3x3 part are the cross products of its columns, 
+        // divided by its determinant
+        vec3<F> c0(columns[0][0], columns[0][1], columns[0][2]);
+        vec3<F> c1(columns[1][0], columns[1][1], columns[1][2]);
+        vec3<F> c2(columns[2][0], columns[2][1], columns[2][2]);
+        vec3<F> t (columns[3][0], columns[3][1], columns[3][2]);
+
+        vec3<F> r0 = vec3<F>::crossProduct(c1, c2);
+        vec3<F> r1 = vec3<F>::crossProduct(c2, c0);
+        vec3<F> r2 = vec3<F>::crossProduct(c0, c1);
+
+        F det = vec3<F>::dotProduct(c0, r0);
+
+        if (glMath::abs(det) <= glMath::epsilon<F>()) return false;
+
+        F invDet = static_cast<F>(1.0) / det;
+
+        r0 *= invDet;
+        r1 *= invDet;
+        r2 *= invDet;
+
+        columns[0][0] = r0.x; columns[1][0] = r0.y; columns[2][0] = r0.z; columns[3][0] = -vec3<F>::dotProduct(r0, t);
+        columns[0][1] = r1.x; columns[1][1] = r1.y; columns[2][1] = r1.z; columns[3][1] = -vec3<F>::dotProduct(r1, t);
+        columns[0][2] = r2.x; columns[1][2] = r2.y; columns[2][2] = r2.z; columns[3][2] = -vec3<F>::dotProduct(r2, t);
+
+        return true;
+    }
+
+    template <FloatingNumber F>
+    inline constexpr std::optional<mat4<F>> mat4<F>::getInversedAffineMat() const noexcept
+    {
+        mat4<F> copy = *this;
+
+        if (!copy.inverseAffine()) return std::nullopt;
+
+        return copy;
+    }
+
+
+    template <FloatingNumber F>
+    inline constexpr mat4<F>& mat4<F>::inverseRigid() noexcept
+    {
+        assert(this->isRigid());
 
-            *this = this->getAdjugate() * invDet;
+        if constexpr (simd::hasMat4InverseKernel<F>)
+        {
+            if (!std::is_constant_evaluated())
+            {
+                simd::mat4InverseRigid(indices, indices);
+                return *this;
+            }
         }
 
+        // The inverse of a rotation is its transpose
+        vec3<F> r0(columns[0][0], columns[0][1], columns[0][2]);
+        vec3<F> r1(columns[1][0], columns[1][1], columns[1][2]);
+        vec3<F> r2(columns[2][0], columns[2][1], columns[2][2]);
+        vec3<F> t (columns[3][0], columns[3][1], columns[3][2]);
+
+        columns[0][0] = r0.x; columns[1][0] = r0.y; columns[2][0] = r0.z; columns[3][0] = -vec3<F>::dotProduct(r0, t);
+        columns[0][1] = r1.x; columns[1][1] = r1.y; columns[2][1] = r1.z; columns[3][1] = -vec3<F>::dotProduct(r1, t);
+        columns[0][2] = r2.x; columns[1][2] = r2.y; columns[2][2] = r2.z; columns[3][2] = -vec3<F>::dotProduct(r2, t);
+
         return *this;
     }
 
     template <FloatingNumber F>
-    inline mat4<F> mat4<F>::getInversedMat() const
+    inline constexpr mat4<F> mat4<F>::getInversedRigidMat() const noexcept
     {
         mat4<F> copy = *this;
 
-        return copy.inverse();
+        return copy.inverseRigid();
+    }
+
+
+    template <FloatingNumber F>
+    inline constexpr bool mat4<F>::isAffine() const noexcept
+    {
+        return columns[0][3] == static_cast<F>(0.0) && 
+               columns[1][3] == static_cast<F>(0.0) && 
+               columns[2][3] == static_cast<F>(0.0) && 
+               columns[3][3] == static_cast<F>(1.0);
     }
 
+    template <FloatingNumber F>
+    inline constexpr bool mat4<F>::isRigid(F tolerance) const noexcept
+    {
+        if (!this->isAffine()) return false;
+
+        vec3<F> c0(columns[0][0], columns[0][1], columns[0][2]);
+        vec3<F> c1(columns[1][0], columns[1][1], columns[1][2]);
+        vec3<F> c2(columns[2][0], columns[2][1], columns[2][2]);
+
+        F f1 = static_cast<F>(1.0);
+
+        return glMath::abs(c0.lengthSquared() - f1) <= tolerance &&
+               glMath::abs(c1.lengthSquared() - f1) <= tolerance &&
+               glMath::abs(c2.lengthSquared() - f1) <= tolerance &&
+               glMath::abs(vec3<F>::dotProduct(c0, c1)) <= tolerance &&
+               glMath::abs(vec3<F>::dotProduct(c1, c2)) <= tolerance &&
+               glMath::abs(vec3<F>::dotProduct(c2, c0)) <= tolerance &&
+               vec3<F>::dotProduct(vec3<F>::crossProduct(c0, c1), c2) > static_cast<F>(0.0);
+    }
+
+
     template<FloatingNumber F>
-    inline mat4<F> mat4<F>::getAdjugate() const
+    inline constexpr mat4<F> mat4<F>::getAdjugate() const noexcept
     {
         // These values exist to not access multiple times the same element in *this,
         // and they're written in row-major, with indices going from 1-4
@@ -569,7 +1112,7 @@ namespace glMath
     }
 
     template<FloatingNumber F>
-    inline mat4<F> mat4<F>::getComatrix() const
+    inline constexpr mat4<F> mat4<F>::getComatrix() const noexcept
     {
         // These values exist to not access multiple times the same element in *this,
         // and they're written in row-major, with indices going from 1-4
@@ -716,7 +1259,7 @@ namespace glMath
     }
 
     template<FloatingNumber F>
-    inline mat3<F> mat4<F>::getNormalMat() const
+    inline constexpr mat3<F> mat4<F>::getNormalMat() const noexcept
     {
         mat3<F> mat3 = {
             columns[0][0], columns[1][0], columns[2][0],
@@ -724,11 +1267,14 @@ namespace glMath
             columns[0][2], columns[1][2], columns[2][2],
         };
 
-        return mat3.getInvertedMat().transposed();
+        // A singular matrix can't be inversed, it is only transposed, like mat3a::getNormalMat()
+        mat3.inverse();
+
+        return mat3.transposed();
     }
 
     template<FloatingNumber F>
-    inline mat3<F> mat4<F>::toMat3() const
+    inline constexpr mat3<F> mat4<F>::toMat3() const noexcept
     {
         mat3<F> mat3 = {
             columns[0][0], columns[1][0], columns[2][0],
@@ -740,31 +1286,42 @@ namespace glMath
     }
 
     template<FloatingNumber F>
-    inline F mat4<F>::determinant() const
+    inline constexpr F mat4<F>::determinant() const noexcept
     {
-        F det = columns[0][0] * this->getMinor(0, 0) -
-                columns[1][0] * this->getMinor(0, 1) +
-                columns[2][0] * this->getMinor(0, 2) -
-                columns[3][0] * this->getMinor(0, 3);
-
-        return det;
+        // Laplace expansion along the two top rows, with the same 2x2 determinants as inverse(),
+        // instead of building four 3x3 submatrices
+        F s0 = columns[0][0] * columns[1][1] - columns[0][1] * columns[1][0];
+        F s1 = columns[0][0] * columns[2][1] - columns[0][1] * columns[2][0];
+        F s2 = columns[0][0] * columns[3][1] - columns[0][1] * columns[3][0];
+        F s3 = columns[1][0] * columns[2][1] - columns[1][1] * columns[2][0];
+        F s4 = columns[1][0] * columns[3][1] - columns[1][1] * columns[3][0];
+        F s5 = columns[2][0] * columns[3][1] - columns[2][1] * columns[3][0];
+
+        F c0 = columns[0][2] * columns[1][3] - columns[0][3] * columns[1][2];
+        F c1 = columns[0][2] * columns[2][3] - columns[0][3] * columns[2][2];
+        F c2 = columns[0][2] * columns[3][3] - columns[0][3] * columns[3][2];
+        F c3 = columns[1][2] * columns[2][3] - columns[1][3] * columns[2][2];
+        F c4 = columns[1][2] * columns[3][3] - columns[1][3] * columns[3][2];
+        F c5 = columns[2][2] * columns[3][3] - columns[2][3] * columns[3][2];
+
+        return s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0;
     }
 
 
     template<FloatingNumber F>
-    inline F& mat4<F>::at(int row, int col)
+    inline constexpr F& mat4<F>::at(int row, int col) noexcept
     {
         return columns[col][row];
     }
     template<FloatingNumber F>
-    inline const F mat4<F>::at(int row, int col) const
+    inline constexpr const F mat4<F>::at(int row, int col) const noexcept
     {
         return columns[col][row];
     }
 
 
     template<FloatingNumber F>
-    inline mat3<F> mat4<F>::getSubmatrix(int row, int col) const
+    inline constexpr mat3<F> mat4<F>::getSubmatrix(int row, int col) const noexcept
     {
         mat3<F> res;
 
@@ -809,7 +1366,7 @@ namespace glMath
     }
 
     template<FloatingNumber F>
-    inline F mat4<F>::getMinor(int row, int col) const
+    inline constexpr F mat4<F>::getMinor(int row, int col) const noexcept
     {
         mat3<F> mat = this->getSubmatrix(row, col);
 
@@ -817,7 +1374,7 @@ namespace glMath
     }
 
     template<FloatingNumber F>
-    inline F mat4<F>::getCofactor(int row, int col) const
+    inline constexpr F mat4<F>::getCofactor(int row, int col) const noexcept
     {
         F minor = this->getMinor(row, col);
 
@@ -829,46 +1386,70 @@ namespace glMath
     #pragma region ReferenceOperators
 
     template<FloatingNumber F>
-    inline mat4<F>& mat4<F>::operator+=(const mat4<F>& other)
+    inline constexpr mat4<F>& mat4<F>::operator+=(const mat4<F>& other) noexcept
     {
         *this = *this + other;
         return *this;
     }
     template<FloatingNumber F>
-    inline mat4<F>& mat4<F>::operator+=(F scalar)
+    inline constexpr mat4<F>& mat4<F>::operator+=(F scalar) noexcept
     {
-        *this = *this + scalar;
+        for (int c = 0; c < 4; c++)
+        {
+            for (int r = 0; r < 4; r++)
+            {
+                columns[c][r] += scalar;
+            }
+        }
         return *this;
     }
 
     template<FloatingNumber F>
-    inline mat4<F>& mat4<F>::operator-=(const mat4<F>& other)
+    inline constexpr mat4<F>& mat4<F>::operator-=(const mat4<F>& other) noexcept
     {
         *this = *this - other;
         return *this;
     }
     template<FloatingNumber F>
-    inline mat4<F>& mat4<F>::operator-=(F scalar)
+    inline constexpr mat4<F>& mat4<F>::operator-=(F scalar) noexcept
     {
-        *this = *this - scalar;
+        for (int c = 0; c < 4; c++)
+        {
+            for (int r = 0; r < 4; r++)
+            {
+                columns[c][r] -= scalar;
+            }
+        }
         return *this;
     }
 
     template<FloatingNumber F>
-    inline mat4<F>& mat4<F>::operator*=(const mat4<F>& other)
+    inline constexpr mat4<F>& mat4<F>::operator*=(const mat4<F>& other) noexcept
     {
-        *this = *this * other;
+        // The kernels load all the columns of the left matrix before writing, 
+        // so the product can be written directly into *this, without a temporary
+        if constexpr (simd::hasMat4Kernel<F>)
+        {
+            if (!std::is_constant_evaluated())
+            {
+                simd::mat4Multiply(indices, other.indices, indices);
+                return *this;
+            }
+        }
+
+        *this = mat4<F>::multiplyScalar(*this, other);
+
         return *this;
     }
     template<FloatingNumber F>
-    inline mat4<F>& mat4<F>::operator*=(F scalar)
+    inline constexpr mat4<F>& mat4<F>::operator*=(F scalar) noexcept
     {
         *this = *this * scalar;
         return *this;
     }
 
     template<FloatingNumber F>
-    inline mat4<F>& mat4<F>::operator/=(F scalar)
+    inline constexpr mat4<F>& mat4<F>::operator/=(F scalar) noexcept
     {
         *this = *this / scalar;
         return *this;
@@ -880,23 +1461,23 @@ namespace glMath
     #pragma region Operators
 
     template<FloatingNumber F>
-    inline mat4<F> operator*(const mat4<F>& a, const mat4<F>& b) 
+    inline constexpr mat4<F> operator*(const mat4<F>& a, const mat4<F>& b) noexcept 
     {
-        mat4<F> res;
-
-        for (int col = 0; col < 4; col++) 
+        if constexpr (simd::hasMat4Kernel<F>)
         {
-            res.columns[col][0] = a.columns[0][0] * b.columns[col][0] + a.columns[1][0] * b.columns[col][1] + a.columns[2][0] * b.columns[col][2] + a.columns[3][0] * b.columns[col][3];
-            res.columns[col][1] = a.columns[0][1] * b.columns[col][0] + a.columns[1][1] * b.columns[col][1] + a.columns[2][1] * b.columns[col][2] + a.columns[3][1] * b.columns[col][3];
-            res.columns[col][2] = a.columns[0][2] * b.columns[col][0] + a.columns[1][2] * b.columns[col][1] + a.columns[2][2] * b.columns[col][2] + a.columns[3][2] * b.columns[col][3];
-            res.columns[col][3] = a.columns[0][3] * b.columns[col][0] + a.columns[1][3] * b.columns[col][1] + a.columns[2][3] * b.columns[col][2] + a.columns[3][3] * b.columns[col][3];
+            if (!std::is_constant_evaluated())
+            {
+                mat4<F> res;
+                simd::mat4Multiply(a.indices, b.indices, res.indices);
+                return res;
+            }
         }
 
-        return res;
+        return mat4<F>::multiplyScalar(a, b);
     }
 
     template<FloatingNumber F>
-    inline vec4<F> operator*(const mat4<F>& mat, const vec4<F>& vec) 
+    inline constexpr vec4<F> operator*(const mat4<F>& mat, const vec4<F>& vec) noexcept 
     {
         return vec4<F>(
             mat.columns[0][0] * vec.x + mat.columns[1][0] * vec.y + mat.columns[2][0] * vec.z + mat.columns[3][0] * vec.w,
@@ -909,26 +1490,32 @@ namespace glMath
 
 
     template<FloatingNumber F>
-    inline mat4<F> operator+(const mat4<F>& a, const mat4<F>& b)
+    inline constexpr mat4<F> operator+(const mat4<F>& a, const mat4<F>& b) noexcept
     {
         mat4<F> res;
 
-        for (int i = 0; i < 16; i++)
+        for (int c = 0; c < 4; c++)
         {
-            res.indices[i] = a.indices[i] + b.indices[i];
+            for (int r = 0; r < 4; r++)
+            {
+                res.columns[c][r] = a.columns[c][r] + b.columns[c][r];
+            }
         }
 
         return res;
     }
 
     template<FloatingNumber F>
-    inline mat4<F> operator-(const mat4<F>& a, const mat4<F>& b)
+    inline constexpr mat4<F> operator-(const mat4<F>& a, const mat4<F>& b) noexcept
     {
         mat4<F> res;
 
-        for (int i = 0; i < 16; i++)
+        for (int c = 0; c < 4; c++)
         {
-            res.indices[i] = a.indices[i] - b.indices[i];
+            for (int r = 0; r < 4; r++)
+            {
+                res.columns[c][r] = a.columns[c][r] - b.columns[c][r];
+            }
         }
 
         return res;
@@ -936,26 +1523,32 @@ namespace glMath
 
 
     template<FloatingNumber F>
-    inline mat4<F> operator*(const mat4<F>& mat, F scalar)
+    inline constexpr mat4<F> operator*(const mat4<F>& mat, F scalar) noexcept
     {
         mat4<F> res;
 
-        for (int i = 0; i < 16; i++)
+        for (int c = 0; c < 4; c++)
         {
-            res.indices[i] = mat.indices[i] * scalar;
+            for (int r = 0; r < 4; r++)
+            {
+                res.columns[c][r] = mat.columns[c][r] * scalar;
+            }
         }
 
         return res;
     }
 
     template<FloatingNumber F>
-    inline mat4<F> operator*(F scalar, const mat4<F>& mat)
+    inline constexpr mat4<F> operator*(F scalar, const mat4<F>& mat) noexcept
     {
         mat4<F> res;
 
-        for (int i = 0; i < 16; i++)
+        for (int c = 0; c < 4; c++)
         {
-            res.indices[i] = mat.indices[i] * scalar;
+            for (int r = 0; r < 4; r++)
+            {
+                res.columns[c][r] = mat.columns[c][r] * scalar;
+            }
         }
 
         return res;
@@ -963,18 +1556,21 @@ namespace glMath
 
 
     template<FloatingNumber F>
-    inline mat4<F> operator/(const mat4<F>& mat, F scalar)
+    inline constexpr mat4<F> operator/(const mat4<F>& mat, F scalar) noexcept
     {
-        if (std::abs(scalar) < glMath::epsilon<F>()) return mat;
+        if (glMath::abs(scalar) < glMath::epsilon<F>()) return mat;
         
         
         F invScalar = static_cast<F>(1.0) / scalar;
 
         mat4<F> res;
 
-        for (int i = 0; i < 16; i++)
+        for (int c = 0; c < 4; c++)
         {
-            res.indices[i] = mat.indices[i] * invScalar;
+            for (int r = 0; r < 4; r++)
+            {
+                res.columns[c][r] = mat.columns[c][r] * invScalar;
+            }
         }
 
         return res;
@@ -983,18 +1579,21 @@ namespace glMath
 
 
     template<FloatingNumber F>
-    inline bool operator==(const mat4<F>& a, const mat4<F>& b)
+    inline constexpr bool operator==(const mat4<F>& a, const mat4<F>& b) noexcept
     {
-        for (int i = 0; i < 16; i++)
+        for (int c = 0; c < 4; c++)
         {
-            if (std::abs(b.indices[i] - a.indices[i]) > glMath::epsilon<F>()) return false;
+            for (int r = 0; r < 4; r++)
+            {
+                if (glMath::abs(b.columns[c][r] - a.columns[c][r]) > glMath::epsilon<F>()) return false;
+            }
         }
 
         return true;
     }
 
     template<FloatingNumber F>
-    inline bool operator!=(const mat4<F>& a, const mat4<F>& b)
+    inline constexpr bool operator!=(const mat4<F>& a, const mat4<F>& b) noexcept
     {
         return !(a == b);
     }
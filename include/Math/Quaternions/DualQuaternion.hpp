@@ -19,33 +19,36 @@ namespace glMath
         quat<F> dual;
 
     public:
-        dualQuat();
-        dualQuat(const quat<F>& rotation, const vec3<F>& translation);
-        dualQuat(const quat<F>& rotation, const quat<F>& translation);
-        dualQuat(const quat<F>& rotation);
-        dualQuat(const vec3<F>& translation);
+        inline constexpr dualQuat() noexcept;
+        inline constexpr dualQuat(const quat<F>& rotation, const vec3<F>& translation) noexcept;
+        inline constexpr dualQuat(const quat<F>& rotation, const quat<F>& translation) noexcept;
+        inline constexpr dualQuat(const quat<F>& rotation) noexcept;
+        inline constexpr dualQuat(const vec3<F>& translation) noexcept;
         
-        inline static dualQuat identity() { return dualQuat(quat<F>(1.0, 0.0, 0.0, 0.0), quat<F>(0.0, 0.0, 0.0, 0.0)); };
+        inline static constexpr dualQuat identity() noexcept { return dualQuat(quat<F>(1.0, 0.0, 0.0, 0.0), quat<F>(0.0, 0.0, 0.0, 0.0)); };
 
         template<FloatingNumber type>
         dualQuat<type> as() const;
 
-        quat<F> getRotation() const;
+        inline constexpr quat<F> getRotation() const noexcept;
 
-        vec3<F> getTranslation() const;
+        inline constexpr vec3<F> getTranslation() const noexcept;
 
 
         dualQuat& normalize();
         dualQuat getNormalizedDualQuat() const;
         static dualQuat normalized(const dualQuat& dQuat);
 
-        dualQuat& conjugate();
-        dualQuat getConjugatedDualQuat() const;
-        static dualQuat conjugated(const dualQuat& dQuat);
+        // Like normalize(), with a fast 1 / sqrt (the hardware estimate and one Newton-Raphson step) instead of a square root and a division
+        dualQuat& normalizeFast();
 
-        dualQuat& inverse();
-        dualQuat getInvertedDualQuat() const;
-        static dualQuat inverted(const dualQuat& dQuat);
+        inline constexpr dualQuat& conjugate() noexcept;
+        inline constexpr dualQuat getConjugatedDualQuat() const noexcept;
+        inline static constexpr dualQuat conjugated(const dualQuat& dQuat) noexcept;
+
+        inline constexpr dualQuat& inverse() noexcept;
+        inline constexpr dualQuat getInvertedDualQuat() const noexcept;
+        inline static constexpr dualQuat inverted(const dualQuat& dQuat) noexcept;
 
 
         dualQuat combineLocal(const dualQuat& other) const;
@@ -54,43 +57,58 @@ namespace glMath
         static dualQuat combineGlobal(const dualQuat& a, const dualQuat& b);
 
 
-        mat3<F> toMat3() const;
-        mat4<F> toMat4() const;
+        inline constexpr mat3<F> toMat3() const noexcept;
+        inline constexpr mat4<F> toMat4() const noexcept;
 
         static dualQuat<F> lerp(const dualQuat<F>& start, const dualQuat<F>& end, F t);
         static dualQuat<F> lerpUnclamped(const dualQuat<F>& start, const dualQuat<F>& end, F t);
 
+        // Screw linear interpolation : the rotation and the translation move together along the screw going from start to end,
+        // at a constant speed, where lerp() (dual quaternion linear blending) only approximates it.
+        // P being exactMath or fastMath, for the precision of the acos and sines, or polynomialMath,
+        // whose weights are a polynomial (fast::slerpWeights()), start and end having to be normalized
+        template<MathPolicy P = exactMath>
+        static dualQuat<F> sclerp(const dualQuat<F>& start, const dualQuat<F>& end, F t);
+        template<MathPolicy P = exactMath>
+        static dualQuat<F> sclerpUnclamped(const dualQuat<F>& start, const dualQuat<F>& end, F t);
+
         vec3<F> transformPoint(const vec3<F>& point) const;
         static vec3<F> transformPoint(const vec3<F>& point, const dualQuat<F>& dQuat);
 
 
-        dualQuat& operator+=(const dualQuat& other);
+        inline constexpr dualQuat& operator+=(const dualQuat& other) noexcept;
 
-        dualQuat& operator-=(const dualQuat& other);
+        inline constexpr dualQuat& operator-=(const dualQuat& other) noexcept;
         
-        dualQuat& operator*=(const dualQuat& other);
-        dualQuat& operator*=(F scalar);
+        inline constexpr dualQuat& operator*=(const dualQuat& other) noexcept;
+        inline constexpr dualQuat& operator*=(F scalar) noexcept;
 
-        dualQuat& operator/=(F scalar);
+        inline constexpr dualQuat& operator/=(F scalar) noexcept;
     };
 
     template<FloatingNumber F>
-    dualQuat<F> operator*(const dualQuat<F>& a, const dualQuat<F>& b);
+    inline constexpr dualQuat<F> operator*(const dualQuat<F>& a, const dualQuat<F>& b) noexcept;
+
+    template<FloatingNumber F>
+    inline constexpr dualQuat<F> operator+(const dualQuat<F>& a, const dualQuat<F>& b) noexcept;
+
+    template<FloatingNumber F>
+    inline constexpr dualQuat<F> operator-(const dualQuat<F>& a, const dualQuat<F>& b) noexcept;
 
     template<FloatingNumber F>
-    dualQuat<F> operator+(const dualQuat<F>& a, const dualQuat<F>& b);
+    inline constexpr dualQuat<F> operator*(const dualQuat<F>& dQuat, F scalar) noexcept;
 
     template<FloatingNumber F>
-    dualQuat<F> operator*(const dualQuat<F>& dQuat, F scalar);
+    inline constexpr dualQuat<F> operator*(F scalar, const dualQuat<F>& dQuat) noexcept;
 
     template<FloatingNumber F>
-    dualQuat<F> operator*(F scalar, const dualQuat<F>& dQuat);
+    inline constexpr dualQuat<F> operator/(const dualQuat<F>& dQuat, F scalar) noexcept;
 
 
     template<FloatingNumber F>
-    bool operator==(const dualQuat<F>& a, const dualQuat<F>& b);
+    inline constexpr bool operator==(const dualQuat<F>& a, const dualQuat<F>& b) noexcept;
     template<FloatingNumber F>
-    bool operator!=(const dualQuat<F>& a, const dualQuat<F>& b);
+    inline constexpr bool operator!=(const dualQuat<F>& a, const dualQuat<F>& b) noexcept;
 }
 
 #include "Math\Quaternions\DualQuaternion.inl"
\ No newline at end of file
@@ -9,7 +9,7 @@ namespace glMath
     #pragma region Constructors
 
     template<FloatingNumber F>
-    inline dualQuat<F>::dualQuat()
+    inline constexpr dualQuat<F>::dualQuat() noexcept
     {
         quat<F> quat0;
 
@@ -18,21 +18,21 @@ namespace glMath
     }
 
     template<FloatingNumber F>
-    inline dualQuat<F>::dualQuat(const quat<F>& rotation, const vec3<F>& translation)
+    inline constexpr dualQuat<F>::dualQuat(const quat<F>& rotation, const vec3<F>& translation) noexcept
     {
         real = rotation;
         dual = static_cast<F>(0.5) * (quat<F>::getPureQuat(translation) * rotation);
     }
 
     template<FloatingNumber F>
-    inline dualQuat<F>::dualQuat(const quat<F>& rotation, const quat<F>& translation)
+    inline constexpr dualQuat<F>::dualQuat(const quat<F>& rotation, const quat<F>& translation) noexcept
     {
         real = rotation;
         dual = translation;
     }
 
     template<FloatingNumber F>
-    inline dualQuat<F>::dualQuat(const quat<F>& rotation)
+    inline constexpr dualQuat<F>::dualQuat(const quat<F>& rotation) noexcept
     {
         F f0 = static_cast<F>(0.0);
 
@@ -41,7 +41,7 @@ namespace glMath
     }
 
     template<FloatingNumber F>
-    inline dualQuat<F>::dualQuat(const vec3<F>& translation)
+    inline constexpr dualQuat<F>::dualQuat(const vec3<F>& translation) noexcept
     {
         F f0 = static_cast<F>(0.0);
         F f05 = static_cast<F>(0.5);
@@ -70,6 +70,22 @@ namespace glMath
         return *this;
     }
 
+    template <FloatingNumber F>
+    inline dualQuat<F>& dualQuat<F>::normalizeFast()
+    {
+        F lengthSq = real.lengthSquared();
+
+        if (lengthSq > glMath::epsilon<F>() * glMath::epsilon<F>())
+        {
+            F invLen = glMath::rsqrtFast(lengthSq);
+
+            real = real * invLen;
+            dual = dual * invLen;
+        }
+
+        return *this;
+    }
+
     template <FloatingNumber F>
     inline dualQuat<F> dualQuat<F>::getNormalizedDualQuat() const
     {
@@ -86,7 +102,7 @@ namespace glMath
 
 
     template <FloatingNumber F>
-    inline dualQuat<F>& dualQuat<F>::conjugate()
+    inline constexpr dualQuat<F>& dualQuat<F>::conjugate() noexcept
     {
         real = real * static_cast<F>(-1.0);
         dual = dual * static_cast<F>(-1.0);
@@ -95,7 +111,7 @@ namespace glMath
     }
 
     template <FloatingNumber F>
-    inline dualQuat<F> dualQuat<F>::getConjugatedDualQuat() const
+    inline constexpr dualQuat<F> dualQuat<F>::getConjugatedDualQuat() const noexcept
     {
         dualQuat<F> copy = *this;
 
@@ -103,14 +119,14 @@ namespace glMath
     }
 
     template<FloatingNumber F>
-    inline dualQuat<F> dualQuat<F>::conjugated(const dualQuat<F>& dQuat)
+    inline constexpr dualQuat<F> dualQuat<F>::conjugated(const dualQuat<F>& dQuat) noexcept
     {
         return dQuat.getConjugatedDualQuat();
     }
 
 
     template <FloatingNumber F>
-    inline dualQuat<F>& dualQuat<F>::inverse()
+    inline constexpr dualQuat<F>& dualQuat<F>::inverse() noexcept
     {
         F lSqr2 = real.lengthSquared();
 
@@ -135,7 +151,7 @@ namespace glMath
     }
 
     template <FloatingNumber F>
-    inline dualQuat<F> dualQuat<F>::getInvertedDualQuat() const
+    inline constexpr dualQuat<F> dualQuat<F>::getInvertedDualQuat() const noexcept
     {
         dualQuat<F> copy = *this;
 
@@ -143,7 +159,7 @@ namespace glMath
     }
 
     template<FloatingNumber F>
-    inline dualQuat<F> dualQuat<F>::inverted(const dualQuat<F>& dQuat)
+    inline constexpr dualQuat<F> dualQuat<F>::inverted(const dualQuat<F>& dQuat) noexcept
     {
         return dQuat.getInvertedDualQuat();
     }
@@ -164,13 +180,13 @@ namespace glMath
     #pragma region MemberMethods
 
     template<FloatingNumber F>
-    inline quat<F> dualQuat<F>::getRotation() const
+    inline constexpr quat<F> dualQuat<F>::getRotation() const noexcept
     {
         return real;
     }
 
     template<FloatingNumber F>
-    inline vec3<F> dualQuat<F>::getTranslation() const
+    inline constexpr vec3<F> dualQuat<F>::getTranslation() const noexcept
     {
 
         return  ( static_cast<F>(2.0) * (dual * real.getConjugatedQuat()) ).template xyz();
@@ -178,7 +194,7 @@ namespace glMath
 
 
     template<FloatingNumber F>
-    inline mat3<F> dualQuat<F>::toMat3() const
+    inline constexpr mat3<F> dualQuat<F>::toMat3() const noexcept
     {
         F xx = real.x * real.x;
         F yy = real.y * real.y;
@@ -200,7 +216,7 @@ namespace glMath
     }
 
     template<FloatingNumber F>
-    inline mat4<F> dualQuat<F>::toMat4() const
+    inline constexpr mat4<F> dualQuat<F>::toMat4() const noexcept
     {
         F xx = real.x * real.x;
         F yy = real.y * real.y;
@@ -280,6 +296,95 @@ namespace glMath
         
         return interp.normalize();
     }
+
+    template<FloatingNumber F>
+    template<MathPolicy P>
+    inline dualQuat<F> dualQuat<F>::sclerp(const dualQuat<F>& start, const dualQuat<F>& end, F t) 
+    {
+        t = glMath::clamp01(t);
+
+        return dualQuat<F>::sclerpUnclamped<P>(start, end, t);
+    }
+
+    template<FloatingNumber F>
+    template<MathPolicy P>
+    inline dualQuat<F> dualQuat<F>::sclerpUnclamped(const dualQuat<F>& start, const dualQuat<F>& end, F t) 
+    {
+        dualQuat<F> s = start;
+        dualQuat<F> e = end;
+
+        if constexpr (!std::is_same_v<P, polynomialMath>)
+        {
+            s.normalize();
+            e.normalize();
+        }
+
+        // The shortest path
+        if (quat<F>::dotProduct(s.real, e.real) < static_cast<F>(0.0)) 
+        {
+            e = e * static_cast<F>(-1.0);
+        }
+
+        // The motion from start to end, diff = start^-1 * end, a rotation of angle a around an axis l and a translation of d along it, 
+        // its real part being (cos(a/2), sin(a/2) * l). The result is start * diff^t
+        quat<F> startRealConj = s.real.getConjugatedQuat();
+        quat<F> diffReal = startRealConj * e.real;
+        quat<F> diffDual = startRealConj * e.dual + s.dual.getConjugatedQuat() * e.real;
+
+        F cosHalf = glMath::min(diffReal.w, static_cast<F>(1.0));
+        F sinHalfSq = diffReal.x * diffReal.x + diffReal.y * diffReal.y + diffReal.z * diffReal.z;
+
+        // The real part of diff^t is the slerp from the identity to diffReal : (cos(t * a/2), sin(t * a/2) * l) = weights.start + weights.end * diffReal
+        lerpWeights<F> weights;
+
+        if constexpr (std::is_same_v<P, polynomialMath>)
+        {
+            weights = P::slerpWeights(cosHalf, t);
+        }
+        else if (sinHalfSq < static_cast<F>(1e-8))
+        {
+            // sin(x * a/2) / sin(a/2) = x * (1 + (1 - x^2) / 6 * (a/2)^2 + ...), (a/2)^2 being sin(a/2)^2 at this size.
+            // The next terms are under 1e-17, so the doubles stay exact too, where (1 - t, t) alone would be off by 1e-9
+            F startT = static_cast<F>(1.0) - t;
+            F sixth = sinHalfSq / static_cast<F>(6.0);
+
+            weights = { startT * (static_cast<F>(1.0) + (static_cast<F>(1.0) - startT * startT) * sixth), t * (static_cast<F>(1.0) + (static_cast<F>(1.0) - t * t) * sixth) };
+        }
+        else
+        {
+            // From the sine rather than from acos(cosHalf), which loses half of the digits for the small angles
+            F sinHalf = std::sqrt(sinHalfSq);
+            F halfAngle = P::atan2(sinHalf, cosHalf);
+
+            weights = { P::sin((static_cast<F>(1.0) - t) * halfAngle) / sinHalf, P::sin(t * halfAngle) / sinHalf };
+        }
+
+        F cosHalfT = weights.start + weights.end * cosHalf;
+        quat<F> realT(cosHalfT, diffReal.x * weights.end, diffReal.y * weights.end, diffReal.z * weights.end);
+
+        // The dual part of diff is (-d/2 * sin(a/2), d/2 * cos(a/2) * l + sin(a/2) * m), m being the moment of the axis, 
+        // and the one of diff^t the same with t * d and t * a. With weights.end = sin(t * a/2) / sin(a/2), no angle is needed :
+        // w = t * diffDual.w * weights.end, 
+        // xyz = weights.end * diffDual.xyz - diffDual.w * diffReal.xyz * k, k = (t * cos(t * a/2) - weights.end * cos(a/2)) / sin(a/2)^2
+        // k cancels for the small angles, where its series t * (1 - t^2) / 3 * (1 + (4 - t^2) / 10 * sin(a/2)^2) is used instead
+        constexpr F seriesBound = std::is_same_v<F, float> ? static_cast<F>(1e-2) : static_cast<F>(1e-4);
+
+        F k = sinHalfSq > seriesBound 
+            ? (t * cosHalfT - weights.end * cosHalf) / sinHalfSq
+            : t * (static_cast<F>(1.0) - t * t) / static_cast<F>(3.0) * (static_cast<F>(1.0) + (static_cast<F>(4.0) - t * t) * static_cast<F>(0.1) * sinHalfSq);
+
+        F kDualW = k * diffDual.w;
+        quat<F> dualT(t * diffDual.w * weights.end, 
+                      diffDual.x * weights.end - diffReal.x * kDualW,
+                      diffDual.y * weights.end - diffReal.y * kDualW,
+                      diffDual.z * weights.end - diffReal.z * kDualW);
+
+        dualQuat<F> diffT;
+        diffT.real = realT;
+        diffT.dual = dualT;
+
+        return s * diffT;
+    }
     
     template<FloatingNumber F>
     inline vec3<F> dualQuat<F>::transformPoint(const vec3<F>& point, const dualQuat<F>& dQuat) 
@@ -294,14 +399,14 @@ namespace glMath
     #pragma region ReferenceOperators
 
     template<FloatingNumber F>
-    inline dualQuat<F>& dualQuat<F>::operator+=(const dualQuat<F>& other)
+    inline constexpr dualQuat<F>& dualQuat<F>::operator+=(const dualQuat<F>& other) noexcept
     {
         *this = *this + other;
         return *this;
     }
 
     template<FloatingNumber F>
-    inline dualQuat<F>& dualQuat<F>::operator-=(const dualQuat<F>& other)
+    inline constexpr dualQuat<F>& dualQuat<F>::operator-=(const dualQuat<F>& other) noexcept
     {
         *this = *this - other;
         return *this;
@@ -309,20 +414,20 @@ namespace glMath
 
 
     template<FloatingNumber F>
-    inline dualQuat<F>& dualQuat<F>::operator*=(const dualQuat<F>& other)
+    inline constexpr dualQuat<F>& dualQuat<F>::operator*=(const dualQuat<F>& other) noexcept
     {
         *this = *this * other;
         return *this;
     }
     template<FloatingNumber F>
-    inline dualQuat<F>& dualQuat<F>::operator*=(F scalar)
+    inline constexpr dualQuat<F>& dualQuat<F>::operator*=(F scalar) noexcept
     {
         *this = *this * scalar;
         return *this;
     }
 
     template<FloatingNumber F>
-    inline dualQuat<F>& dualQuat<F>::operator/=(F scalar)
+    inline constexpr dualQuat<F>& dualQuat<F>::operator/=(F scalar) noexcept
     {
         *this = *this / scalar;
         return *this;
@@ -333,7 +438,7 @@ namespace glMath
     #pragma region Operators
     
     template <FloatingNumber F>
-    inline dualQuat<F> operator*(const dualQuat<F>& a, const dualQuat<F>& b)
+    inline constexpr dualQuat<F> operator*(const dualQuat<F>& a, const dualQuat<F>& b) noexcept
     {
         dualQuat<F> res;
 
@@ -344,7 +449,7 @@ namespace glMath
     }
 
     template <FloatingNumber F>
-    inline dualQuat<F> operator+(const dualQuat<F>& a, const dualQuat<F>& b)
+    inline constexpr dualQuat<F> operator+(const dualQuat<F>& a, const dualQuat<F>& b) noexcept
     {
         dualQuat<F> res;
 
@@ -355,7 +460,18 @@ namespace glMath
     }
 
     template <FloatingNumber F>
-    inline dualQuat<F> operator*(const dualQuat<F>& dQuat, F scalar)
+    inline constexpr dualQuat<F> operator-(const dualQuat<F>& a, const dualQuat<F>& b) noexcept
+    {
+        dualQuat<F> res;
+
+        res.real = a.real - b.real;
+        res.dual = a.dual - b.dual;
+
+        return res;
+    }
+
+    template <FloatingNumber F>
+    inline constexpr dualQuat<F> operator*(const dualQuat<F>& dQuat, F scalar) noexcept
     {
         dualQuat<F> res = dQuat;
 
@@ -366,7 +482,7 @@ namespace glMath
     }
 
     template <FloatingNumber F>
-    inline dualQuat<F> operator*(F scalar, const dualQuat<F>& dQuat)
+    inline constexpr dualQuat<F> operator*(F scalar, const dualQuat<F>& dQuat) noexcept
     {
         dualQuat<F> res = dQuat;
 
@@ -376,22 +492,33 @@ namespace glMath
         return res;
     }
 
+    template <FloatingNumber F>
+    inline constexpr dualQuat<F> operator/(const dualQuat<F>& dQuat, F scalar) noexcept
+    {
+        dualQuat<F> res = dQuat;
+
+        res.real = res.real / scalar;
+        res.dual = res.dual / scalar;
+
+        return res;
+    }
+
 
     template<FloatingNumber F>
-    inline bool operator==(const dualQuat<F>& a, const dualQuat<F>& b)
+    inline constexpr bool operator==(const dualQuat<F>& a, const dualQuat<F>& b) noexcept
     {
-        return std::abs(a.real.w - b.real.w) < glMath::epsilon<F>() && 
-               std::abs(a.real.x - b.real.x) < glMath::epsilon<F>() && 
-               std::abs(a.real.y - b.real.y) < glMath::epsilon<F>() &&
-               std::abs(a.real.z - b.real.z) < glMath::epsilon<F>() &&
+        return glMath::abs(a.real.w - b.real.w) < glMath::epsilon<F>() && 
+               glMath::abs(a.real.x - b.real.x) < glMath::epsilon<F>() && 
+               glMath::abs(a.real.y - b.real.y) < glMath::epsilon<F>() &&
+               glMath::abs(a.real.z - b.real.z) < glMath::epsilon<F>() &&
 
-               std::abs(a.dual.w - b.dual.w) < glMath::epsilon<F>() && 
-               std::abs(a.dual.x - b.dual.x) < glMath::epsilon<F>() && 
-               std::abs(a.dual.y - b.dual.y) < glMath::epsilon<F>() &&
-               std::abs(a.dual.z - b.dual.z) < glMath::epsilon<F>();
+               glMath::abs(a.dual.w - b.dual.w) < glMath::epsilon<F>() && 
+               glMath::abs(a.dual.x - b.dual.x) < glMath::epsilon<F>() && 
+               glMath::abs(a.dual.y - b.dual.y) < glMath::epsilon<F>() &&
+               glMath::abs(a.dual.z - b.dual.z) < glMath::epsilon<F>();
     }
     template<FloatingNumber F>
-    inline bool operator!=(const dualQuat<F>& a, const dualQuat<F>& b)
+    inline constexpr bool operator!=(const dualQuat<F>& a, const dualQuat<F>& b) noexcept
     {
         return !(a == b);
     }
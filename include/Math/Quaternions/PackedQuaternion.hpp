@@ -0,0 +1,75 @@
+#pragma once
+
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+#include "Math\Concepts.hpp"
+#include "Math\Quaternions\Quaternion.hpp"
+
+namespace glMath
+{
+    /// @brief A unit quaternion compressed with the smallest-three encoding : the component of largest magnitude is dropped,
+    /// its index being stored on 2 bits, and the quaternion is negated if that component is negative (q and -q are the same rotation).
+    /// The 3 others are all in [-1 / sqrt(2), 1 / sqrt(2)], and are quantized on (Bits - 2) / 3 bits each. The dropped one is
+    /// rebuilt from the length, which is 1.
+    ///
+    /// packedQuat<32> takes 4 bytes (10 bits per component), packedQuat<48> 6 bytes (15 bits) and packedQuat<64> 8 bytes (20 bits),
+    /// instead of the 16 bytes of a quat<float>. Their largest angular errors, unpacked to quat<float>, are about 0.26, 0.008 and 0.00025 degrees
+    /// @tparam Bits The size of the packed quaternion, 32, 48 or 64
+    template<std::size_t Bits> requires (Bits == 32 || Bits == 48 || Bits == 64)
+    struct packedQuat
+    {
+    public:
+        /// @brief The number of bits of each of the 3 stored components
+        inline static constexpr std::size_t componentBits = (Bits - 2) / 3;
+        /// @brief The largest quantized value, even so that 0 is stored exactly, at maxLevel / 2
+        inline static constexpr std::uint32_t maxLevel = (std::uint32_t(1) << componentBits) - 2;
+
+        // The bits as 16 bits words, so that packedQuat<48> takes 6 bytes, from the lowest :
+        // the third stored component, the second, the first, then the index of the dropped one (0 for w ... 3 for z)
+        std::array<std::uint16_t, Bits / 16> words;
+
+    private:
+        // w dropped, and the 3 others at 0
+        inline static constexpr std::uint64_t identityBits = 
+            (std::uint64_t(maxLevel / 2) << (componentBits * 2)) | (std::uint64_t(maxLevel / 2) << componentBits) | (maxLevel / 2);
+
+        // The Bits / 16 words of bits, the lowest first
+        inline static constexpr std::array<std::uint16_t, Bits / 16> splitBits(std::uint64_t bits) noexcept;
+
+    public:
+        /// @brief The identity quaternion
+        inline constexpr packedQuat() noexcept;
+        /// @brief Packs rot, which must be normalized
+        template<FloatingNumber F>
+        explicit packedQuat(const quat<F>& rot);
+
+        /// @brief The packed quaternion from its bits, as returned by bits()
+        inline static constexpr packedQuat fromBits(std::uint64_t bits) noexcept;
+        /// @brief The Bits bits of the packed quaternion, in the lowest bits of the result
+        inline constexpr std::uint64_t bits() const noexcept;
+
+        /// @brief Unpacks the quaternion, the result being normalized
+        template<FloatingNumber F>
+        quat<F> to() const;
+
+        /// @brief Packs every quaternion of rots, which must be normalized, 4 at a time with SIMD
+        /// @param results At least as big as rots
+        template<FloatingNumber F>
+        static void pack(std::span<const quat<F>> rots, std::span<packedQuat> results);
+        /// @brief Unpacks every quaternion of packed, 4 at a time with SIMD, the results being normalized
+        /// @param results At least as big as packed
+        template<FloatingNumber F>
+        static void unpack(std::span<const packedQuat> packed, std::span<quat<F>> results);
+    };
+
+    template<std::size_t Bits>
+    inline constexpr bool operator==(const packedQuat<Bits>& a, const packedQuat<Bits>& b) noexcept;
+    template<std::size_t Bits>
+    inline constexpr bool operator!=(const packedQuat<Bits>& a, const packedQuat<Bits>& b) noexcept;
+}
+
+#include "Math\Quaternions\PackedQuaternion.inl"
@@ -0,0 +1,182 @@
+#include <concepts>
+#include <cassert>
+#include <cmath>
+
+#include "Math\MathInternal.hpp"
+
+namespace glMath
+{
+    #pragma region Constructors
+
+    template<std::size_t Bits> requires (Bits == 32 || Bits == 48 || Bits == 64)
+    inline constexpr packedQuat<Bits>::packedQuat() noexcept
+        : words(packedQuat<Bits>::splitBits(identityBits))
+    {
+    }
+
+    template<std::size_t Bits> requires (Bits == 32 || Bits == 48 || Bits == 64)
+    template<FloatingNumber F>
+    inline packedQuat<Bits>::packedQuat(const quat<F>& rot)
+    {
+        // The first component of largest magnitude
+        std::uint32_t index = 0;
+        F largest = glMath::abs(rot.data[0]);
+
+        for (std::uint32_t i = 1; i < 4; i++)
+        {
+            F value = glMath::abs(rot.data[i]);
+            if (value > largest) { largest = value; index = i; }
+        }
+
+        F sign = rot.data[index] < static_cast<F>(0.0) ? static_cast<F>(-1.0) : static_cast<F>(1.0);
+
+        // [-1 / sqrt(2), 1 / sqrt(2)] to [0, maxLevel], rounded to the nearest
+        F scale = glMath::sqrtOf2<F>() * static_cast<F>(maxLevel / 2) * sign;
+        F offset = static_cast<F>(maxLevel / 2) + static_cast<F>(0.5);
+
+        std::uint64_t bits = index;
+
+        for (std::uint32_t i = 0; i < 4; i++)
+        {
+            if (i == index) continue;
+
+            // Rounded once with FMA, like the madd of the pack kernel, so that both give the same levels at every optimization level
+        #if defined(GLMATH_SIMD_FMA)
+            F scaled = std::fma(rot.data[i], scale, offset);
+        #else
+            F scaled = rot.data[i] * scale + offset;
+        #endif
+            F level = glMath::clamp(scaled, static_cast<F>(0.0), static_cast<F>(maxLevel));
+            bits = (bits << componentBits) | static_cast<std::uint64_t>(level);
+        }
+
+        *this = packedQuat<Bits>::fromBits(bits);
+    }
+
+    #pragma endregion
+
+    #pragma region Bits
+
+    template<std::size_t Bits> requires (Bits == 32 || Bits == 48 || Bits == 64)
+    inline constexpr packedQuat<Bits> packedQuat<Bits>::fromBits(std::uint64_t bits) noexcept
+    {
+        packedQuat<Bits> packed;
+        packed.words = packedQuat<Bits>::splitBits(bits);
+
+        return packed;
+    }
+
+    template<std::size_t Bits> requires (Bits == 32 || Bits == 48 || Bits == 64)
+    inline constexpr std::uint64_t packedQuat<Bits>::bits() const noexcept
+    {
+        std::uint64_t bits = 0;
+        for (std::size_t i = 0; i < Bits / 16; i++) bits |= static_cast<std::uint64_t>(words[i]) << (i * 16);
+
+        return bits;
+    }
+
+    template<std::size_t Bits> requires (Bits == 32 || Bits == 48 || Bits == 64)
+    inline constexpr std::array<std::uint16_t, Bits / 16> packedQuat<Bits>::splitBits(std::uint64_t bits) noexcept
+    {
+        std::array<std::uint16_t, Bits / 16> split = {};
+        for (std::size_t i = 0; i < Bits / 16; i++) split[i] = static_cast<std::uint16_t>(bits >> (i * 16));
+
+        return split;
+    }
+
+    #pragma endregion
+
+    #pragma region Conversions
+
+    template<std::size_t Bits> requires (Bits == 32 || Bits == 48 || Bits == 64)
+    template<FloatingNumber F>
+    inline quat<F> packedQuat<Bits>::to() const
+    {
+        constexpr std::uint64_t mask = (std::uint64_t(1) << componentBits) - 1;
+        constexpr std::int64_t zero = maxLevel / 2;
+
+        std::uint64_t packed = bits();
+        std::uint32_t index = static_cast<std::uint32_t>(packed >> (componentBits * 3)) & 3;
+
+        // The levels are centered on 0 as integers, so that 0 stays exact
+        F scale = static_cast<F>(1.0) / (glMath::sqrtOf2<F>() * static_cast<F>(zero));
+
+        F a = static_cast<F>(static_cast<std::int64_t>((packed >> (componentBits * 2)) & mask) - zero) * scale;
+        F b = static_cast<F>(static_cast<std::int64_t>((packed >> componentBits) & mask) - zero) * scale;
+        F c = static_cast<F>(static_cast<std::int64_t>(packed & mask) - zero) * scale;
+
+        // The rounding can bring the 3 components slightly over a length of 1, they are scaled back in that case
+        F lengthSq = a * a + b * b + c * c;
+        F dropped = std::sqrt(glMath::max(static_cast<F>(1.0) - lengthSq, static_cast<F>(0.0)));
+        F invLength = static_cast<F>(1.0) / std::sqrt(glMath::max(lengthSq, static_cast<F>(1.0)));
+
+        a *= invLength;
+        b *= invLength;
+        c *= invLength;
+
+        switch (index)
+        {
+            case 0:  return quat<F>(dropped, a, b, c);
+            case 1:  return quat<F>(a, dropped, b, c);
+            case 2:  return quat<F>(a, b, dropped, c);
+            default: return quat<F>(a, b, c, dropped);
+        }
+    }
+
+    template<std::size_t Bits> requires (Bits == 32 || Bits == 48 || Bits == 64)
+    template<FloatingNumber F>
+    inline void packedQuat<Bits>::pack(std::span<const quat<F>> rots, std::span<packedQuat<Bits>> results)
+    {
+        assert(results.size() >= rots.size());
+
+        std::size_t i = 0;
+
+        if constexpr (simd::hasPackedQuatKernel<F>)
+        {
+            i = simd::quatPackSmallestThree<Bits>(reinterpret_cast<const F*>(rots.data()), reinterpret_cast<std::uint16_t*>(results.data()), rots.size());
+        }
+
+        // The tail (or everything, without SIMD)
+        for (; i < rots.size(); i++)
+        {
+            results[i] = packedQuat<Bits>(rots[i]);
+        }
+    }
+
+    template<std::size_t Bits> requires (Bits == 32 || Bits == 48 || Bits == 64)
+    template<FloatingNumber F>
+    inline void packedQuat<Bits>::unpack(std::span<const packedQuat<Bits>> packed, std::span<quat<F>> results)
+    {
+        assert(results.size() >= packed.size());
+
+        std::size_t i = 0;
+
+        if constexpr (simd::hasPackedQuatKernel<F>)
+        {
+            i = simd::quatUnpackSmallestThree<Bits>(reinterpret_cast<const std::uint16_t*>(packed.data()), reinterpret_cast<F*>(results.data()), packed.size());
+        }
+
+        // The tail (or everything, without SIMD)
+        for (; i < packed.size(); i++)
+        {
+            results[i] = packed[i].template to<F>();
+        }
+    }
+
+    #pragma endregion
+
+    #pragma region Operators
+
+    template<std::size_t Bits>
+    inline constexpr bool operator==(const packedQuat<Bits>& a, const packedQuat<Bits>& b) noexcept
+    {
+        return a.words == b.words;
+    }
+    template<std::size_t Bits>
+    inline constexpr bool operator!=(const packedQuat<Bits>& a, const packedQuat<Bits>& b) noexcept
+    {
+        return a.words != b.words;
+    }
+
+    #pragma endregion
+}
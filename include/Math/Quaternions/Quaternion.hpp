@@ -1,5 +1,8 @@
 #pragma once
 
+#include <cstddef>
+#include <span>
+
 #include "Math\Concepts.hpp"
 
 
@@ -8,6 +11,9 @@ namespace glMath
     template<FloatingNumber F>
     struct vec3;
 
+    template<FloatingNumber F>
+    struct vec3a;
+
     template<FloatingNumber F>
     struct mat4;
 
@@ -25,16 +31,16 @@ namespace glMath
         };
 
     public:
-        quat();
-        quat(F qw, const vec3<F>& xyz);
-        quat(F qw, F qx, F qy, F qz);
+        inline constexpr quat() noexcept;
+        inline constexpr quat(F qw, const vec3<F>& xyz) noexcept;
+        inline constexpr quat(F qw, F qx, F qy, F qz) noexcept;
 
-        inline static quat identity() { return quat(1.0, 0.0, 0.0, 0.0); };
-        static quat<F> getPureQuat(const vec3<F>& vec);
+        inline static constexpr quat identity() noexcept { return quat(1.0, 0.0, 0.0, 0.0); };
+        inline static constexpr quat<F> getPureQuat(const vec3<F>& vec) noexcept;
 
         
-        inline vec3<F> xyz() const { return vec3<F>(x, y, z); };
-        inline vec3<F> zyx() const { return vec3<F>(z, y, x); };
+        inline constexpr vec3<F> xyz() const noexcept { return vec3<F>(x, y, z); };
+        inline constexpr vec3<F> zyx() const noexcept { return vec3<F>(z, y, x); };
 
 
         template<FloatingNumber type>
@@ -46,11 +52,17 @@ namespace glMath
         quat& normalize();
         quat getNormalizedQuat() const;
 
-        quat& conjugate();
-        quat getConjugatedQuat() const;
+        // Like normalize(), with a fast 1 / sqrt (the hardware estimate and one Newton-Raphson step) instead of a square root and a division.
+        // With floats the length is within 5e-7 of 1, doubles are exact
+        quat& normalizeFast();
+        // Renormalizes every quaternion of quats with normalizeFast(), 4 at a time with SSE
+        static void normalizeFast(std::span<quat> quats);
 
-        quat& inverse();
-        quat getInvertedQuat() const;
+        inline constexpr quat& conjugate() noexcept;
+        inline constexpr quat getConjugatedQuat() const noexcept;
+
+        inline constexpr quat& inverse() noexcept;
+        inline constexpr quat getInvertedQuat() const noexcept;
 
         quat combineLocal(const quat& other) const;
         static quat combineLocal(const quat& a, const quat& b);
@@ -58,73 +70,102 @@ namespace glMath
         static quat combineGlobal(const quat& a, const quat& b);
 
         F length() const;
-        F lengthSquared() const;
+        inline constexpr F lengthSquared() const noexcept;
 
         static F length(const quat& quat);
-        static F lengthSquared(const quat& quat);
+        inline static constexpr F lengthSquared(const quat& quat) noexcept;
 
-        F dotProduct(const quat<F>& other) const;
-        static F dotProduct(const quat<F>& a, const quat<F>& b);
+        inline constexpr F dotProduct(const quat<F>& other) const noexcept;
+        inline static constexpr F dotProduct(const quat<F>& a, const quat<F>& b) noexcept;
 
         vec3<F> rotatePoint(const vec3<F>& point) const;
         vec3<F> rotatePointAroundPivot(const vec3<F>& point, const vec3<F>& pivot) const;
-
+        // Like rotatePoint(vec3), with the cross products computed in one register
+        vec3a<F> rotatePoint(const vec3a<F>& point) const;
+        // rotatePoint(point, assumeNormalized) doesn't normalize the quaternion, which must be a unit one
+        inline constexpr vec3<F> rotatePoint(const vec3<F>& point, assumeNormalizedTag) const noexcept;
+        vec3a<F> rotatePoint(const vec3a<F>& point, assumeNormalizedTag) const;
+
+        // results[i] = rotatePoint(points[i]), the quaternion being normalized once for the whole span,
+        // then the points are rotated 4 at a time with SSE. results can be points, but must not partially overlap it
+        void rotatePoints(std::span<const vec3<F>> points, std::span<vec3<F>> results) const;
+        // Like rotatePoints(points, results), without normalizing the quaternion, which must be a unit one
+        void rotatePoints(std::span<const vec3<F>> points, std::span<vec3<F>> results, assumeNormalizedTag) const;
+
+        // P being exactMath or fastMath, for the precision of the sines and cosines, here and in fromEuler() and slerp()
+        template<MathPolicy P = exactMath>
         static quat fromAxisAngle(const vec3<F> axis, F angle);
+        // From the precomputed sine and cosine of HALF the angle (glMath::sincos(angleInRadians / 2))
+        static quat fromAxisAngle(const vec3<F> axis, const sinCos<F>& halfAngle);
 
         static quat lookAtFree(const vec3<F>& eye, const vec3<F>& target);
         static quat lookAt(const vec3<F>& eye, const vec3<F>& target, const vec3<F>& up);
 
+        template<MathPolicy P = exactMath>
         static quat fromEuler(const vec3<F>& rotation);
+        template<MathPolicy P = exactMath>
         static quat fromEuler(F vx, F vy, F vz);
+        // From the precomputed sines and cosines of HALF the angles, in radians
+        inline static constexpr quat fromEuler(const sinCos<F>& halfX, const sinCos<F>& halfY, const sinCos<F>& halfZ) noexcept;
+        // Converts every rotation (in degrees) of rotations into out, the sines and cosines being computed in batches
+        // (with fastMath, fast::sincos computes them 4 or 8 at once in SIMD registers)
+        template<MathPolicy P = exactMath>
+        static void fromEuler(std::span<const vec3<F>> rotations, std::span<quat> out);
 
         static vec3<F> rotatePoint(const vec3<F>& point, const quat<F>& rot);
         static vec3<F> rotatePointAroundPivot(const vec3<F>& point, const vec3<F> pivot, const quat<F>& rot);
+        static vec3a<F> rotatePoint(const vec3a<F>& point, const quat<F>& rot);
+        inline static constexpr vec3<F> rotatePoint(const vec3<F>& point, const quat<F>& rot, assumeNormalizedTag) noexcept;
+        static vec3a<F> rotatePoint(const vec3a<F>& point, const quat<F>& rot, assumeNormalizedTag);
 
         static quat<F> lerp(const quat<F>& start, const quat<F>& end, F t);
         static quat<F> lerpUnclamped(const quat<F>& start, const quat<F>& end, F t);
 
+        // With polynomialMath, the weights are a polynomial (fast::slerpWeights()) and start and end aren't normalized, they have to be
+        template<MathPolicy P = exactMath>
         static quat<F> slerp(const quat<F>& start, const quat<F>& end, F t);
+        template<MathPolicy P = exactMath>
         static quat<F> slerpUnclamped(const quat<F>& start, const quat<F>& end, F t);
 
         vec3<F> toEuler() const;
 
-        mat3<F> toMat3() const;
-        mat4<F> toMat4() const;
+        inline constexpr mat3<F> toMat3() const noexcept;
+        inline constexpr mat4<F> toMat4() const noexcept;
 
 
-        quat& operator+=(const quat& other);
+        inline constexpr quat& operator+=(const quat& other) noexcept;
 
-        quat& operator-=(const quat& other);
+        inline constexpr quat& operator-=(const quat& other) noexcept;
 
-        quat& operator*=(const quat& other);
-        quat& operator*=(F scalar);
+        inline constexpr quat& operator*=(const quat& other) noexcept;
+        inline constexpr quat& operator*=(F scalar) noexcept;
 
-        quat& operator/=(F scalar);
+        inline constexpr quat& operator/=(F scalar) noexcept;
     };
 
     template<FloatingNumber F>
-    inline quat<F> operator*(const quat<F>& a, const quat<F>& b);
+    inline constexpr quat<F> operator*(const quat<F>& a, const quat<F>& b) noexcept;
 
     template<FloatingNumber F>
-    inline quat<F> operator+(const quat<F>& a, const quat<F>& b);
+    inline constexpr quat<F> operator+(const quat<F>& a, const quat<F>& b) noexcept;
 
     template<FloatingNumber F>
-    inline quat<F> operator-(const quat<F>& a, const quat<F>& b);
+    inline constexpr quat<F> operator-(const quat<F>& a, const quat<F>& b) noexcept;
 
     template<FloatingNumber F>
-    inline quat<F> operator*(const quat<F>& rot, F scalar);
+    inline constexpr quat<F> operator*(const quat<F>& rot, F scalar) noexcept;
 
     template<FloatingNumber F>
-    inline quat<F> operator*(F scalar, const quat<F>& rot);
+    inline constexpr quat<F> operator*(F scalar, const quat<F>& rot) noexcept;
 
     template<FloatingNumber F>
-    inline quat<F> operator/(const quat<F>& rot, F scalar);
+    inline constexpr quat<F> operator/(const quat<F>& rot, F scalar) noexcept;
 
 
     template<FloatingNumber F>
-    bool operator==(const quat<F>& a, const quat<F>& b);
+    inline constexpr bool operator==(const quat<F>& a, const quat<F>& b) noexcept;
     template<FloatingNumber F>
-    bool operator!=(const quat<F>& a, const quat<F>& b);
+    inline constexpr bool operator!=(const quat<F>& a, const quat<F>& b) noexcept;
 }
 
 #include "Math\Quaternions\Quaternion.inl"
\ No newline at end of file
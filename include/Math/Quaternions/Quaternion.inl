@@ -2,6 +2,8 @@
 #include <cmath>
 
 #include <algorithm>
+#include <cassert>
+#include <span>
 
 #include "Math\MathInternal.hpp"
 
@@ -10,7 +12,7 @@ namespace glMath
     #pragma region Constructors
 
     template<FloatingNumber F>
-    inline quat<F>::quat()
+    inline constexpr quat<F>::quat() noexcept
     {
         F f0 = static_cast<F>(0.0);
 
@@ -21,7 +23,7 @@ namespace glMath
     }
 
     template<FloatingNumber F>
-    inline quat<F>::quat(F qw, const vec3<F>& xyz)
+    inline constexpr quat<F>::quat(F qw, const vec3<F>& xyz) noexcept
     {
         w = qw;
         x = xyz.x;
@@ -30,7 +32,7 @@ namespace glMath
     }
 
     template<FloatingNumber F>
-    inline quat<F>::quat(F qw, F qx, F qy, F qz)
+    inline constexpr quat<F>::quat(F qw, F qx, F qy, F qz) noexcept
     {
         w = qw;
         x = qx;
@@ -43,30 +45,35 @@ namespace glMath
     #pragma region StaticConstructors
 
     template<FloatingNumber F>
-    inline quat<F> quat<F>::getPureQuat(const vec3<F>& vec)
+    inline constexpr quat<F> quat<F>::getPureQuat(const vec3<F>& vec) noexcept
     {
         return quat<F>(static_cast<F>(0.0), vec.x, vec.y, vec.z);
     }
 
 
     template<FloatingNumber F>
+    template<MathPolicy P>
     inline quat<F> quat<F>::fromEuler(const vec3<F>& rotation)
     {
-        return quat<F>::fromEuler(rotation.x, rotation.y, rotation.z);
+        return quat<F>::fromEuler<P>(rotation.x, rotation.y, rotation.z);
     }
 
     template<FloatingNumber F>
+    template<MathPolicy P>
     inline quat<F> quat<F>::fromEuler(F vx, F vy, F vz)
     {
-        // return quat<F>::fromEuler( vec3<F>(vx, vy, vz) );
+        // The scalar type's constant, so that quat<float8>::fromEuler<fastMath> converts 8 rotations at once
+        F halfDegToRad = static_cast<F>(glMath::degToRad<typename scalarType<F>::type>() * static_cast<typename scalarType<F>::type>(0.5));
 
-        F qx = (vx * glMath::degToRad<F>()) * static_cast<F>(0.5);
-        F qy = (vy * glMath::degToRad<F>()) * static_cast<F>(0.5);
-        F qz = (vz * glMath::degToRad<F>()) * static_cast<F>(0.5);
+        return quat<F>::fromEuler(P::sincos(vx * halfDegToRad), P::sincos(vy * halfDegToRad), P::sincos(vz * halfDegToRad));
+    }
 
-        F cx = std::cos(qx); F sx = std::sin(qx);
-        F cy = std::cos(qy); F sy = std::sin(qy);
-        F cz = std::cos(qz); F sz = std::sin(qz);
+    template<FloatingNumber F>
+    inline constexpr quat<F> quat<F>::fromEuler(const sinCos<F>& halfX, const sinCos<F>& halfY, const sinCos<F>& halfZ) noexcept
+    {
+        F cx = halfX.cos; F sx = halfX.sin;
+        F cy = halfY.cos; F sy = halfY.sin;
+        F cz = halfZ.cos; F sz = halfZ.sin;
 
         
 
@@ -91,6 +98,48 @@ namespace glMath
         );
     }
 
+    template<FloatingNumber F>
+    template<MathPolicy P>
+    inline void quat<F>::fromEuler(std::span<const vec3<F>> rotations, std::span<quat<F>> out)
+    {
+        static_assert(std::floating_point<F>, "glMath::quat::fromEuler(span) : the batched version needs float or double");
+
+        assert(out.size() >= rotations.size());
+
+        // The half angles of a block of rotations, all the x, then all the y, then all the z, packed in the 3 * count first values
+        // so one batch computes their sines and cosines without reading the rest of the arrays
+        constexpr std::size_t blockSize = 64;
+
+        F halfAngles[blockSize * 3];
+        F sines[blockSize * 3];
+        F cosines[blockSize * 3];
+
+        F halfDegToRad = glMath::degToRad<F>() * static_cast<F>(0.5);
+
+        for (std::size_t start = 0; start < rotations.size(); start += blockSize)
+        {
+            std::size_t count = std::min(blockSize, rotations.size() - start);
+
+            for (std::size_t i = 0; i < count; i++)
+            {
+                halfAngles[i]             = rotations[start + i].x * halfDegToRad;
+                halfAngles[i + count]     = rotations[start + i].y * halfDegToRad;
+                halfAngles[i + count * 2] = rotations[start + i].z * halfDegToRad;
+            }
+
+            P::sincos(std::span<const F>(halfAngles).first(count * 3), std::span<F>(sines).first(count * 3), std::span<F>(cosines).first(count * 3));
+
+            for (std::size_t i = 0; i < count; i++)
+            {
+                out[start + i] = quat<F>::fromEuler(
+                    sinCos<F>{ sines[i],             cosines[i] },
+                    sinCos<F>{ sines[i + count],     cosines[i + count] },
+                    sinCos<F>{ sines[i + count * 2], cosines[i + count * 2] }
+                );
+            }
+        }
+    }
+
     #pragma endregion
 
     #pragma region Casting
@@ -121,17 +170,32 @@ namespace glMath
     {
         F l = this->length();
 
-        if (std::abs(l) > glMath::epsilon<F>()) 
+        if constexpr (LaneNumber<F>)
         {
-            F invLen = static_cast<F>(1.0) / l;
-    
+            F minLength = static_cast<F>(glMath::epsilon<typename F::valueType>());
+            F invLen = glMath::select(glMath::abs(l) > minLength, static_cast<F>(1.0) / l, static_cast<F>(1.0));
+
             w *= invLen;
             x *= invLen;
             y *= invLen;
             z *= invLen;
+
+            return *this;
         }
+        else
+        {
+            if (std::abs(l) > glMath::epsilon<F>()) 
+            {
+                F invLen = static_cast<F>(1.0) / l;
+    
+                w *= invLen;
+                x *= invLen;
+                y *= invLen;
+                z *= invLen;
+            }
 
-        return *this;
+            return *this;
+        }
     }
  
     template<FloatingNumber F>
@@ -142,9 +206,58 @@ namespace glMath
         return copy.normalize();
     }
 
+    template<FloatingNumber F>
+    inline quat<F>& quat<F>::normalizeFast()
+    {
+        F lengthSq = this->lengthSquared();
+
+        if constexpr (LaneNumber<F>)
+        {
+            F minLengthSq = static_cast<F>(glMath::epsilon<typename F::valueType>() * glMath::epsilon<typename F::valueType>());
+            F invLen = glMath::select(lengthSq > minLengthSq, glMath::rsqrtFast(lengthSq), static_cast<F>(1.0));
+
+            w *= invLen;
+            x *= invLen;
+            y *= invLen;
+            z *= invLen;
+
+            return *this;
+        }
+        else
+        {
+            if (lengthSq > glMath::epsilon<F>() * glMath::epsilon<F>()) 
+            {
+                F invLen = glMath::rsqrtFast(lengthSq);
+    
+                w *= invLen;
+                x *= invLen;
+                y *= invLen;
+                z *= invLen;
+            }
+
+            return *this;
+        }
+    }
+
+    template<FloatingNumber F>
+    inline void quat<F>::normalizeFast(std::span<quat<F>> quats)
+    {
+        std::size_t i = 0;
+
+        if constexpr (simd::hasRsqrtKernel<F>)
+        {
+            i = simd::quatNormalizeFast(reinterpret_cast<F*>(quats.data()), quats.size(), glMath::epsilon<F>() * glMath::epsilon<F>());
+        }
+
+        for (; i < quats.size(); i++)
+        {
+            quats[i].normalizeFast();
+        }
+    }
+
 
     template<FloatingNumber F>
-    inline quat<F>& quat<F>::conjugate()
+    inline constexpr quat<F>& quat<F>::conjugate() noexcept
     {
         x *= static_cast<F>(-1.0);
         y *= static_cast<F>(-1.0);
@@ -154,7 +267,7 @@ namespace glMath
     }
 
     template<FloatingNumber F>
-    inline quat<F> quat<F>::getConjugatedQuat() const
+    inline constexpr quat<F> quat<F>::getConjugatedQuat() const noexcept
     {
         quat copy = *this;
 
@@ -163,12 +276,23 @@ namespace glMath
 
 
     template<FloatingNumber F>
-    inline quat<F>& quat<F>::inverse()
+    inline constexpr quat<F>& quat<F>::inverse() noexcept
     {
         quat<F> conj = this->getConjugatedQuat();
         F l = this->lengthSquared();
 
-        if (l > glMath::epsilon<F>())
+        if constexpr (LaneNumber<F>)
+        {
+            // The lanes of (almost) zero quaternions are left untouched
+            auto invertible = l > static_cast<F>(glMath::epsilon<typename F::valueType>());
+            F invLengthSq = static_cast<F>(1.0) / l;
+
+            w = glMath::select(invertible, conj.w * invLengthSq, w);
+            x = glMath::select(invertible, conj.x * invLengthSq, x);
+            y = glMath::select(invertible, conj.y * invLengthSq, y);
+            z = glMath::select(invertible, conj.z * invLengthSq, z);
+        }
+        else if (l > glMath::epsilon<F>())
         {
             w = conj.w / l;
             x = conj.x / l; 
@@ -180,7 +304,7 @@ namespace glMath
     }
 
     template<FloatingNumber F>
-    inline quat<F> quat<F>::getInvertedQuat() const
+    inline constexpr quat<F> quat<F>::getInvertedQuat() const noexcept
     {
         quat copy = *this;
 
@@ -201,18 +325,18 @@ namespace glMath
     template<FloatingNumber F>
     inline F quat<F>::length() const 
     {
-        return std::sqrt( (w * w) + (x * x) + (y * y) + (z * z) );
+        return glMath::sqrt( (w * w) + (x * x) + (y * y) + (z * z) );
     }
 
     template<FloatingNumber F>
-    inline F quat<F>::lengthSquared() const 
+    inline constexpr F quat<F>::lengthSquared() const noexcept 
     {
         return (w * w) + (x * x) + (y * y) + (z * z);
     }
 
     
     template<FloatingNumber F>
-    inline F quat<F>::dotProduct(const quat<F>& other) const
+    inline constexpr F quat<F>::dotProduct(const quat<F>& other) const noexcept
     {
         return (w * other.w) + (x * other.x) + (y * other.y) + (z * other.z);
     }
@@ -220,7 +344,7 @@ namespace glMath
 
 
     template<FloatingNumber F>
-    inline mat3<F> quat<F>::toMat3() const 
+    inline constexpr mat3<F> quat<F>::toMat3() const noexcept 
     {
         F xx = x * x;
         F yy = y * y;
@@ -240,7 +364,7 @@ namespace glMath
     }
 
     template<FloatingNumber F>
-    inline mat4<F> quat<F>::toMat4() const 
+    inline constexpr mat4<F> quat<F>::toMat4() const noexcept 
     {
         F xx = x * x;
         F yy = y * y;
@@ -402,35 +526,38 @@ namespace glMath
     template<FloatingNumber F>
     inline F quat<F>::length(const quat<F>& quat)  
     {
-        return std::sqrt( (quat.w * quat.w) + (quat.x * quat.x) + (quat.y * quat.y) + (quat.z * quat.z) );
+        return glMath::sqrt( (quat.w * quat.w) + (quat.x * quat.x) + (quat.y * quat.y) + (quat.z * quat.z) );
     }
 
     template<FloatingNumber F>
-    inline F quat<F>::lengthSquared(const quat<F>& quat)  
+    inline constexpr F quat<F>::lengthSquared(const quat<F>& quat) noexcept  
     {
         return (quat.w * quat.w) + (quat.x * quat.x) + (quat.y * quat.y) + (quat.z * quat.z);
     }
 
 
     template<FloatingNumber F>
-    inline F quat<F>::dotProduct(const quat<F>& a, const quat<F>& b)  
+    inline constexpr F quat<F>::dotProduct(const quat<F>& a, const quat<F>& b) noexcept  
     {
         return (a.w * b.w) + (a.x * b.x) + (a.y * b.y) + (a.z * b.z);
     }
 
     template<FloatingNumber F>
+    template<MathPolicy P>
     inline quat<F> quat<F>::fromAxisAngle(const vec3<F> axis, F angle)
     {
-        vec3<F> rotAxis = axis.getNormalizedVec();
-        F theta = (angle * glMath::degToRad<F>()) / static_cast<F>(2.0);
+        return quat<F>::fromAxisAngle(axis, P::sincos((angle * glMath::degToRad<F>()) / static_cast<F>(2.0)));
+    }
 
-        F cosTheta = static_cast<F>(std::cos(theta));
-        F sinTheta = static_cast<F>(std::sin(theta));
+    template<FloatingNumber F>
+    inline quat<F> quat<F>::fromAxisAngle(const vec3<F> axis, const sinCos<F>& halfAngle)
+    {
+        vec3<F> rotAxis = axis.getNormalizedVec();
 
-        F w = cosTheta;
-        F x = rotAxis.x * sinTheta;
-        F y = rotAxis.y * sinTheta;
-        F z = rotAxis.z * sinTheta;
+        F w = halfAngle.cos;
+        F x = rotAxis.x * halfAngle.sin;
+        F y = rotAxis.y * halfAngle.sin;
+        F z = rotAxis.z * halfAngle.sin;
 
         return quat(w, x, y, z);
     }
@@ -548,13 +675,33 @@ namespace glMath
     template<FloatingNumber F>
     inline vec3<F> quat<F>::rotatePoint(const vec3<F>& point, const quat<F>& rot)
     {
-        quat<F> q = rot.getNormalizedQuat();
+        return quat<F>::rotatePoint(point, rot.getNormalizedQuat(), assumeNormalized);
+    }
+
+    template<FloatingNumber F>
+    inline vec3a<F> quat<F>::rotatePoint(const vec3a<F>& point, const quat<F>& rot)
+    {
+        return quat<F>::rotatePoint(point, rot.getNormalizedQuat(), assumeNormalized);
+    }
 
-        vec3<F> u(q.x, q.y, q.z);
+    template<FloatingNumber F>
+    inline constexpr vec3<F> quat<F>::rotatePoint(const vec3<F>& point, const quat<F>& rot, assumeNormalizedTag) noexcept
+    {
+        vec3<F> u(rot.x, rot.y, rot.z);
 
         vec3<F> t = u.crossProduct(point) * static_cast<F>(2.0);
 
-        return point + (t * q.w) + u.crossProduct(t);
+        return point + (t * rot.w) + u.crossProduct(t);
+    }
+
+    template<FloatingNumber F>
+    inline vec3a<F> quat<F>::rotatePoint(const vec3a<F>& point, const quat<F>& rot, assumeNormalizedTag)
+    {
+        vec3a<F> u(rot.x, rot.y, rot.z);
+
+        vec3a<F> t = u.crossProduct(point) * static_cast<F>(2.0);
+
+        return point + (t * rot.w) + u.crossProduct(t);
     }
 
     template<FloatingNumber F>
@@ -575,10 +722,50 @@ namespace glMath
         return quat<F>::rotatePoint(point, *this);
     }
     template<FloatingNumber F>
+    inline vec3a<F> quat<F>::rotatePoint(const vec3a<F>& point) const
+    {
+        return quat<F>::rotatePoint(point, *this);
+    }
+    template<FloatingNumber F>
     inline vec3<F> quat<F>::rotatePointAroundPivot(const vec3<F>& point, const vec3<F>& pivot) const
     {
         return quat<F>::rotatePointAroundPivot(point, pivot, *this);
     }
+    template<FloatingNumber F>
+    inline constexpr vec3<F> quat<F>::rotatePoint(const vec3<F>& point, assumeNormalizedTag) const noexcept
+    {
+        return quat<F>::rotatePoint(point, *this, assumeNormalized);
+    }
+    template<FloatingNumber F>
+    inline vec3a<F> quat<F>::rotatePoint(const vec3a<F>& point, assumeNormalizedTag) const
+    {
+        return quat<F>::rotatePoint(point, *this, assumeNormalized);
+    }
+
+    template<FloatingNumber F>
+    inline void quat<F>::rotatePoints(std::span<const vec3<F>> points, std::span<vec3<F>> results) const
+    {
+        this->getNormalizedQuat().rotatePoints(points, results, assumeNormalized);
+    }
+
+    template<FloatingNumber F>
+    inline void quat<F>::rotatePoints(std::span<const vec3<F>> points, std::span<vec3<F>> results, assumeNormalizedTag) const
+    {
+        assert(results.size() >= points.size());
+
+        std::size_t i = 0;
+
+        if constexpr (simd::hasQuatRotateKernel<F>)
+        {
+            i = simd::quatRotateVec3(data, reinterpret_cast<const F*>(points.data()), reinterpret_cast<F*>(results.data()), points.size());
+        }
+
+        // The tail (or everything, without SIMD)
+        for (; i < points.size(); i++)
+        {
+            results[i] = quat<F>::rotatePoint(points[i], *this, assumeNormalized);
+        }
+    }
 
 
     template<FloatingNumber F> inline quat<F> quat<F>::lerp(const quat<F>& start, const quat<F>& end, F t) 
@@ -594,37 +781,71 @@ namespace glMath
     }
 
 
-    template<FloatingNumber F> inline quat<F> quat<F>::slerp(const quat<F>& start, const quat<F>& end, F t) 
+    template<FloatingNumber F> template<MathPolicy P> inline quat<F> quat<F>::slerp(const quat<F>& start, const quat<F>& end, F t) 
     { 
         t = glMath::clamp01(t);
-        return quat<F>::slerpUnclamped(start, end, t);
+        return quat<F>::slerpUnclamped<P>(start, end, t);
     }
 
-    template<FloatingNumber F> inline quat<F> quat<F>::slerpUnclamped(const quat<F>& start, const quat<F>& end, F t) 
+    template<FloatingNumber F> template<MathPolicy P> inline quat<F> quat<F>::slerpUnclamped(const quat<F>& start, const quat<F>& end, F t) 
     { 
+        if constexpr (std::is_same_v<P, polynomialMath>)
+        {
+            // Unit quaternions, whose weights have no nearly parallel case, and whose result is already normalized
+            F dot = quat<F>::dotProduct(start, end);
+            F sign = glMath::select(dot < static_cast<F>(0.0), static_cast<F>(-1.0), static_cast<F>(1.0));
+
+            lerpWeights<F> weights = P::slerpWeights(dot * sign, t);
+
+            return (start * weights.start) + (end * (weights.end * sign));
+        }
+
         quat<F> s = start.getNormalizedQuat();
         quat<F> e = end.getNormalizedQuat();
 
         F dot = quat<F>::dotProduct(s, e);
 
-        if (dot < static_cast<F>(0.0))
+        if constexpr (LaneNumber<F>)
         {
-            e = e * static_cast<F>(-1.0);
-            dot = -dot;
-        }
+            F f1 = static_cast<F>(1.0);
 
-        if (dot > static_cast<F>(0.9995))
-        {
-            return quat<F>::lerpUnclamped(s, e, t);
+            // The shortest path, lane by lane
+            F sign = glMath::select(dot < static_cast<F>(0.0), -f1, f1);
+            e = e * sign;
+            dot = dot * sign;
+
+            F ang = P::acos(glMath::min(dot, f1));
+            F sinAng = P::sin(ang);
+
+            auto nearlyParallel = dot > static_cast<F>(0.9995);
+
+            F wA = glMath::select(nearlyParallel, f1 - t, P::sin((f1 - t) * ang) / sinAng);
+            F wB = glMath::select(nearlyParallel, t, P::sin(t * ang) / sinAng);
+
+            // Normalized like lerpUnclamped() for the nearly parallel lanes, the others are already unit quaternions
+            return ((s * wA) + (e * wB)).normalize();
         }
+        else
+        {
+            if (dot < static_cast<F>(0.0))
+            {
+                e = e * static_cast<F>(-1.0);
+                dot = -dot;
+            }
 
-        F ang = std::acos(dot);
-        F sinAng = std::sin(ang);
+            if (dot > static_cast<F>(0.9995))
+            {
+                return quat<F>::lerpUnclamped(s, e, t);
+            }
 
-        F wA = std::sin((static_cast<F>(1.0) - t) * ang) / sinAng;
-        F wB = std::sin(t * ang) / sinAng;
+            F ang = P::acos(dot);
+            F sinAng = P::sin(ang);
 
-        return (s * wA) + (e * wB);
+            F wA = P::sin((static_cast<F>(1.0) - t) * ang) / sinAng;
+            F wB = P::sin(t * ang) / sinAng;
+
+            return (s * wA) + (e * wB);
+        }
     }
 
     #pragma endregion
@@ -632,14 +853,14 @@ namespace glMath
     #pragma region ReferenceOperators
 
     template<FloatingNumber F>
-    inline quat<F>& quat<F>::operator+=(const quat<F>& other)
+    inline constexpr quat<F>& quat<F>::operator+=(const quat<F>& other) noexcept
     {
         *this = *this + other;
         return *this;
     }
 
     template<FloatingNumber F>
-    inline quat<F>& quat<F>::operator-=(const quat<F>& other)
+    inline constexpr quat<F>& quat<F>::operator-=(const quat<F>& other) noexcept
     {
         *this = *this - other;
         return *this;
@@ -647,20 +868,20 @@ namespace glMath
 
 
     template<FloatingNumber F>
-    inline quat<F>& quat<F>::operator*=(const quat<F>& other)
+    inline constexpr quat<F>& quat<F>::operator*=(const quat<F>& other) noexcept
     {
         *this = *this * other;
         return *this;
     }
     template<FloatingNumber F>
-    inline quat<F>& quat<F>::operator*=(F scalar)
+    inline constexpr quat<F>& quat<F>::operator*=(F scalar) noexcept
     {
         *this = *this * scalar;
         return *this;
     }
 
     template<FloatingNumber F>
-    inline quat<F>& quat<F>::operator/=(F scalar)
+    inline constexpr quat<F>& quat<F>::operator/=(F scalar) noexcept
     {
         *this = *this / scalar;
         return *this;
@@ -673,7 +894,7 @@ namespace glMath
     #pragma region Operators
 
     template<FloatingNumber F>
-    inline quat<F> operator*(const quat<F>& a, const quat<F>& b)
+    inline constexpr quat<F> operator*(const quat<F>& a, const quat<F>& b) noexcept
     {
         // Voilà la formule complète : 
         //
@@ -692,7 +913,7 @@ namespace glMath
 
 
     template<FloatingNumber F>
-    inline quat<F> operator+(const quat<F>& a, const quat<F>& b)
+    inline constexpr quat<F> operator+(const quat<F>& a, const quat<F>& b) noexcept
     {
         return quat<F>(
             a.w + b.w,
@@ -703,7 +924,7 @@ namespace glMath
     }
 
     template<FloatingNumber F>
-    inline quat<F> operator-(const quat<F>& a, const quat<F>& b)
+    inline constexpr quat<F> operator-(const quat<F>& a, const quat<F>& b) noexcept
     {
         return quat<F>(
             a.w - b.w,
@@ -714,7 +935,7 @@ namespace glMath
     }
 
     template<FloatingNumber F>
-    inline quat<F> operator*(const quat<F>& rot, F scalar)
+    inline constexpr quat<F> operator*(const quat<F>& rot, F scalar) noexcept
     {
         return quat<F>(
             rot.w * scalar,
@@ -725,7 +946,7 @@ namespace glMath
     }
 
     template<FloatingNumber F>
-    inline quat<F> operator*(F scalar, const quat<F>& rot)
+    inline constexpr quat<F> operator*(F scalar, const quat<F>& rot) noexcept
     {
         return quat<F>(
             rot.w * scalar,
@@ -736,33 +957,43 @@ namespace glMath
     }
 
     template<FloatingNumber F>
-    inline quat<F> operator/(const quat<F>& rot, F scalar)
+    inline constexpr quat<F> operator/(const quat<F>& rot, F scalar) noexcept
     {
-        if (std::abs(scalar) < glMath::epsilon<F>()) return rot;
-        
-        
-        F invScalar = static_cast<F>(1.0) / scalar;
-        
-        return quat<F>(
-            rot.w * invScalar,
-            rot.x * invScalar,
-            rot.y * invScalar,
-            rot.z * invScalar
-        );
-        
+        if constexpr (LaneNumber<F>)
+        {
+            // The lanes divided by (almost) 0 are multiplied by 1 instead
+            F minScalar = static_cast<F>(glMath::epsilon<typename F::valueType>());
+            F invScalar = glMath::select(glMath::abs(scalar) < minScalar, static_cast<F>(1.0), static_cast<F>(1.0) / scalar);
+
+            return quat<F>(rot.w * invScalar, rot.x * invScalar, rot.y * invScalar, rot.z * invScalar);
+        }
+        else
+        {
+            if (glMath::abs(scalar) < glMath::epsilon<F>()) return rot;
+            
+            
+            F invScalar = static_cast<F>(1.0) / scalar;
+            
+            return quat<F>(
+                rot.w * invScalar,
+                rot.x * invScalar,
+                rot.y * invScalar,
+                rot.z * invScalar
+            );
+        }
     }
 
 
     template<FloatingNumber F>
-    inline bool operator==(const quat<F>& a, const quat<F>& b)
+    inline constexpr bool operator==(const quat<F>& a, const quat<F>& b) noexcept
     {
-        return std::abs(a.w - b.w) < glMath::epsilon<F>() && 
-               std::abs(a.x - b.x) < glMath::epsilon<F>() && 
-               std::abs(a.y - b.y) < glMath::epsilon<F>() &&
-               std::abs(a.z - b.z) < glMath::epsilon<F>() ;
+        return glMath::abs(a.w - b.w) < glMath::epsilon<F>() && 
+               glMath::abs(a.x - b.x) < glMath::epsilon<F>() && 
+               glMath::abs(a.y - b.y) < glMath::epsilon<F>() &&
+               glMath::abs(a.z - b.z) < glMath::epsilon<F>() ;
     }
     template<FloatingNumber F>
-    inline bool operator!=(const quat<F>& a, const quat<F>& b)
+    inline constexpr bool operator!=(const quat<F>& a, const quat<F>& b) noexcept
     {
         return !(a == b);
     }
@@ -0,0 +1,2293 @@
+#pragma once
+
+#include <cfloat>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+#include "Math\Concepts.hpp"
+
+// The SIMD paths are chosen at compile time, from what the compiler is allowed to emit :
+// -msse2 / -mavx / -mfma (or -march=...) with gcc and clang, /arch:AVX and /arch:AVX2 with msvc.
+// Defining GLMATH_FORCE_SCALAR before including the library disables all of them,
+// and every function falls back to its scalar code.
+
+#if !defined(GLMATH_FORCE_SCALAR)
+
+    #if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+        #define GLMATH_SIMD_SSE2 1
+    #endif
+
+    #if defined(__AVX__)
+        #define GLMATH_SIMD_AVX 1
+    #endif
+
+    #if defined(__FMA__) || (defined(_MSC_VER) && defined(__AVX2__))
+        #define GLMATH_SIMD_FMA 1
+    #endif
+
+#endif
+
+#if defined(GLMATH_SIMD_SSE2)
+    #include <immintrin.h>
+#endif
+
+namespace glMath::simd
+{
+    // Declared for every type so that the name always exists in the discarded
+    // branches of the ``if constexpr`` dispatches, only the overloads below are defined
+    template<typename T>
+    void mat4Multiply(const T* a, const T* b, T* out) = delete;
+    template<typename T>
+    bool mat4Inverse(const T* mat, T* out, T minDeterminant) = delete;
+    template<typename T>
+    bool mat4InverseAffine(const T* mat, T* out, T minDeterminant) = delete;
+    template<typename T>
+    void mat4InverseRigid(const T* mat, T* out) = delete;
+    template<typename T>
+    std::size_t mat4TransformVec3(const T* mat, const T* in, T* out, std::size_t count, bool isPoint, bool perspectiveDivide) = delete;
+    template<typename T>
+    std::size_t mat4TransformVec4(const T* mat, const T* in, T* out, std::size_t count, bool isPoint) = delete;
+    template<typename T>
+    void mat3x4Multiply(const T* a, const T* b, T* out) = delete;
+    template<typename T>
+    void mat4ToMat3x4(const T* mats, T* out, std::size_t count) = delete;
+    template<typename T>
+    void mat3x4ToMat4(const T* mats, T* out, std::size_t count) = delete;
+    template<typename T>
+    void mat3aMultiply(const T* a, const T* b, T* out) = delete;
+    template<typename T>
+    void mat3aTranspose(const T* mat, T* out) = delete;
+    template<typename T>
+    bool mat3aInverse(const T* mat, T* out, T minDeterminant) = delete;
+    template<typename T>
+    void mat3aNormalMats(const T* mats, T* out, std::size_t count, T minDeterminant) = delete;
+    template<typename T>
+    std::size_t frustumTestSpheres(const T* planes, const T* x, const T* y, const T* z, const T* radius, 
+                                   std::size_t count, std::uint64_t* mask) = delete;
+    template<typename T>
+    std::size_t frustumTestAABBs(const T* planes, const T* centerX, const T* centerY, const T* centerZ, 
+                                 const T* extentX, const T* extentY, const T* extentZ, std::size_t count, std::uint64_t* mask) = delete;
+    template<typename T>
+    std::size_t soaDotProduct(const T* const* a, const T* const* b, std::size_t dimensions, T* out, std::size_t count) = delete;
+    template<typename T>
+    std::size_t soaLengths(const T* const* components, std::size_t dimensions, T* out, std::size_t count) = delete;
+    template<typename T>
+    std::size_t soaNormalize(T* const* components, std::size_t dimensions, std::size_t count) = delete;
+    template<typename T>
+    std::size_t soaNormalizeFast(T* const* components, std::size_t dimensions, std::size_t count) = delete;
+    template<typename T>
+    std::size_t soaCrossProduct(const T* const* a, const T* const* b, T* const* out, std::size_t count) = delete;
+    template<typename T>
+    std::size_t soaLerp(const T* a, const T* b, T t, T* out, std::size_t count) = delete;
+    template<typename T>
+    std::size_t soaMinMax(const T* a, const T* b, T* out, std::size_t count, bool max) = delete;
+    template<typename T>
+    std::size_t soaTransform(const T* mat, const T* const* in, std::size_t inDimensions, T w, 
+                             T* const* out, std::size_t outDimensions, bool perspectiveDivide, std::size_t count) = delete;
+    template<typename T>
+    T rsqrtFast(T value) = delete;
+    template<typename T>
+    std::size_t quatNormalizeFast(T* quats, std::size_t count, T minLengthSquared) = delete;
+    template<typename T>
+    std::size_t quatRotateVec3(const T* rot, const T* in, T* out, std::size_t count) = delete;
+    template<std::size_t Bits, typename T>
+    std::size_t quatPackSmallestThree(const T* quats, std::uint16_t* out, std::size_t count) = delete;
+    template<std::size_t Bits, typename T>
+    std::size_t quatUnpackSmallestThree(const std::uint16_t* packed, T* quats, std::size_t count) = delete;
+
+    #if defined(GLMATH_SIMD_SSE2)
+
+    // Returns a * b + c, in one instruction if FMA is available
+    inline __m128 madd(__m128 a, __m128 b, __m128 c)
+    {
+        #if defined(GLMATH_SIMD_FMA)
+        return _mm_fmadd_ps(a, b, c);
+        #else
+        return _mm_add_ps(_mm_mul_ps(a, b), c);
+        #endif
+    }
+
+    #if defined(GLMATH_SIMD_AVX)
+
+    // Returns a * b + c, in one instruction if FMA is available
+    inline __m256 madd(__m256 a, __m256 b, __m256 c)
+    {
+        #if defined(GLMATH_SIMD_FMA)
+        return _mm256_fmadd_ps(a, b, c);
+        #else
+        return _mm256_add_ps(_mm256_mul_ps(a, b), c);
+        #endif
+    }
+
+    #endif
+
+    // 1 / sqrt(x) from the rsqrtps estimate (12 bits, a relative error up to 3.7e-4) refined by one Newton-Raphson step,
+    // y * (1.5 - 0.5 * x * y * y), which leaves a relative error under 5e-7. 0 gives NaN, so the callers mask it
+    inline __m128 rsqrtNewton(__m128 x)
+    {
+        __m128 y = _mm_rsqrt_ps(x);
+        __m128 halfXYY = _mm_mul_ps(_mm_mul_ps(_mm_set1_ps(0.5f), x), _mm_mul_ps(y, y));
+
+        return _mm_mul_ps(y, _mm_sub_ps(_mm_set1_ps(1.5f), halfXYY));
+    }
+
+    #if defined(GLMATH_SIMD_AVX)
+
+    inline __m256 rsqrtNewton(__m256 x)
+    {
+        __m256 y = _mm256_rsqrt_ps(x);
+        __m256 halfXYY = _mm256_mul_ps(_mm256_mul_ps(_mm256_set1_ps(0.5f), x), _mm256_mul_ps(y, y));
+
+        return _mm256_mul_ps(y, _mm256_sub_ps(_mm256_set1_ps(1.5f), halfXYY));
+    }
+
+    #endif
+
+    // The Newton-Raphson step is done on the float, so the compiler can merge it with what comes around
+    inline float rsqrtFast(float value)
+    {
+        float y = _mm_cvtss_f32(_mm_rsqrt_ss(_mm_set_ss(value)));
+
+        return y * (1.5f - 0.5f * value * y * y);
+    }
+
+    // Multiplies two column-major 4x4 float matrices, each column being one register.
+    // The 4 columns of a are loaded before anything is written, so out can be a or b.
+    inline void mat4Multiply(const float* a, const float* b, float* out)
+    {
+        __m128 a0 = _mm_load_ps(a + 0);
+        __m128 a1 = _mm_load_ps(a + 4);
+        __m128 a2 = _mm_load_ps(a + 8);
+        __m128 a3 = _mm_load_ps(a + 12);
+
+        for (int col = 0; col < 4; col++)
+        {
+            const float* bCol = b + col * 4;
+
+            __m128 res = _mm_mul_ps(a0, _mm_set1_ps(bCol[0]));
+            res = madd(a1, _mm_set1_ps(bCol[1]), res);
+            res = madd(a2, _mm_set1_ps(bCol[2]), res);
+            res = madd(a3, _mm_set1_ps(bCol[3]), res);
+
+            _mm_store_ps(out + col * 4, res);
+        }
+    }
+
+
+    // Shuffles the lanes of a single register
+    template<int x, int y, int z, int w>
+    inline __m128 swizzle(__m128 vec)
+    {
+        return _mm_castsi128_ps(_mm_shuffle_epi32(_mm_castps_si128(vec), _MM_SHUFFLE(w, z, y, x)));
+    }
+
+    // The three helpers below work on 2x2 matrices stored in one register as (m00, m01, m10, m11)
+
+    // a * b
+    inline __m128 mat2Multiply(__m128 a, __m128 b)
+    {
+        return _mm_add_ps(_mm_mul_ps(a, swizzle<0, 3, 0, 3>(b)), _mm_mul_ps(swizzle<1, 0, 3, 2>(a), swizzle<2, 1, 2, 1>(b)));
+    }
+    // adjugate(a) * b
+    inline __m128 mat2AdjMultiply(__m128 a, __m128 b)
+    {
+        return _mm_sub_ps(_mm_mul_ps(swizzle<3, 3, 0, 0>(a), b), _mm_mul_ps(swizzle<1, 1, 2, 2>(a), swizzle<2, 3, 0, 1>(b)));
+    }
+    // a * adjugate(b)
+    inline __m128 mat2MultiplyAdj(__m128 a, __m128 b)
+    {
+        return _mm_sub_ps(_mm_mul_ps(a, swizzle<3, 0, 3, 0>(b)), _mm_mul_ps(swizzle<1, 0, 3, 2>(a), swizzle<2, 1, 2, 1>(b)));
+    }
+
+    // Inverts a 4x4 float matrix by splitting it in four 2x2 blocks (A B / C D). 
+    // The four block determinants are computed once, in one register, and reused for the 
+    // determinant of the whole matrix and for every block of the adjugate.
+    // The inverse of the transpose being the transpose of the inverse, it works the same 
+    // on column-major and row-major data. Returns false, without writing out, if |det| <= minDeterminant.
+    inline bool mat4Inverse(const float* mat, float* out, float minDeterminant)
+    {
+        __m128 c0 = _mm_load_ps(mat + 0);
+        __m128 c1 = _mm_load_ps(mat + 4);
+        __m128 c2 = _mm_load_ps(mat + 8);
+        __m128 c3 = _mm_load_ps(mat + 12);
+
+        __m128 A = _mm_movelh_ps(c0, c1);
+        __m128 B = _mm_movehl_ps(c1, c0);
+        __m128 C = _mm_movelh_ps(c2, c3);
+        __m128 D = _mm_movehl_ps(c3, c2);
+
+        // |A|, |B|, |C|, |D|
+        __m128 detSub = _mm_sub_ps(
+            _mm_mul_ps(_mm_shuffle_ps(c0, c2, _MM_SHUFFLE(2, 0, 2, 0)), _mm_shuffle_ps(c1, c3, _MM_SHUFFLE(3, 1, 3, 1))),
+            _mm_mul_ps(_mm_shuffle_ps(c0, c2, _MM_SHUFFLE(3, 1, 3, 1)), _mm_shuffle_ps(c1, c3, _MM_SHUFFLE(2, 0, 2, 0)))
+        );
+
+        __m128 detA = swizzle<0, 0, 0, 0>(detSub);
+        __m128 detB = swizzle<1, 1, 1, 1>(detSub);
+        __m128 detC = swizzle<2, 2, 2, 2>(detSub);
+        __m128 detD = swizzle<3, 3, 3, 3>(detSub);
+
+        __m128 adjDC = mat2AdjMultiply(D, C);
+        __m128 adjAB = mat2AdjMultiply(A, B);
+
+        __m128 X = _mm_sub_ps(_mm_mul_ps(detD, A), mat2Multiply(B, adjDC));
+        __m128 W = _mm_sub_ps(_mm_mul_ps(detA, D), mat2Multiply(C, adjAB));
+        __m128 Y = _mm_sub_ps(_mm_mul_ps(detB, C), mat2MultiplyAdj(D, adjAB));
+        __m128 Z = _mm_sub_ps(_mm_mul_ps(detC, B), mat2MultiplyAdj(A, adjDC));
+
+        // det = |A||D| + |B||C| - tr(adj(A)B adj(D)C)
+        __m128 tr = _mm_mul_ps(adjAB, swizzle<0, 2, 1, 3>(adjDC));
+        tr = _mm_add_ps(tr, swizzle<1, 0, 3, 2>(tr));
+        tr = _mm_add_ps(tr, swizzle<2, 3, 0, 1>(tr));
+
+        __m128 det = _mm_sub_ps(_mm_add_ps(_mm_mul_ps(detA, detD), _mm_mul_ps(detB, detC)), tr);
+
+        float detValue = _mm_cvtss_f32(det);
+        if (!(detValue > minDeterminant || detValue < -minDeterminant)) return false;
+
+        __m128 invDet = _mm_div_ps(_mm_setr_ps(1.0f, -1.0f, -1.0f, 1.0f), det);
+
+        X = _mm_mul_ps(X, invDet);
+        Y = _mm_mul_ps(Y, invDet);
+        Z = _mm_mul_ps(Z, invDet);
+        W = _mm_mul_ps(W, invDet);
+
+        _mm_store_ps(out + 0,  _mm_shuffle_ps(X, Y, _MM_SHUFFLE(1, 3, 1, 3)));
+        _mm_store_ps(out + 4,  _mm_shuffle_ps(X, Y, _MM_SHUFFLE(0, 2, 0, 2)));
+        _mm_store_ps(out + 8,  _mm_shuffle_ps(Z, W, _MM_SHUFFLE(1, 3, 1, 3)));
+        _mm_store_ps(out + 12, _mm_shuffle_ps(Z, W, _MM_SHUFFLE(0, 2, 0, 2)));
+
+        return true;
+    }
+
+
+    // The cross product of the xyz lanes of a and b, the w lane stays 0 if it is 0 in a and b
+    inline __m128 crossProduct(__m128 a, __m128 b)
+    {
+        __m128 res = _mm_sub_ps(
+            _mm_mul_ps(a, swizzle<1, 2, 0, 3>(b)),
+            _mm_mul_ps(swizzle<1, 2, 0, 3>(a), b)
+        );
+
+        return swizzle<1, 2, 0, 3>(res);
+    }
+
+    // The translation column of the inverse of an affine matrix, -(c0 * t.x + c1 * t.y + c2 * t.z), with w = 1, 
+    // c0, c1 and c2 being the three first columns of the inverse
+    inline __m128 affineInverseTranslation(__m128 c0, __m128 c1, __m128 c2, const float* translation)
+    {
+        __m128 t = _mm_mul_ps(c0, _mm_set1_ps(translation[0]));
+        t = madd(c1, _mm_set1_ps(translation[1]), t);
+        t = madd(c2, _mm_set1_ps(translation[2]), t);
+
+        return _mm_sub_ps(_mm_setr_ps(0.0f, 0.0f, 0.0f, 1.0f), t);
+    }
+
+    // Inverts a column-major 4x4 float matrix whose bottom row is (0, 0, 0, 1) : 
+    // the 3x3 part is inverted from the cross products of its columns, then the translation is rotated back.
+    // Returns false, without writing out, if the 3x3 determinant |det| <= minDeterminant.
+    inline bool mat4InverseAffine(const float* mat, float* out, float minDeterminant)
+    {
+        __m128 c0 = _mm_load_ps(mat + 0);
+        __m128 c1 = _mm_load_ps(mat + 4);
+        __m128 c2 = _mm_load_ps(mat + 8);
+
+        // The rows of the inverse, times the determinant
+        __m128 r0 = crossProduct(c1, c2);
+        __m128 r1 = crossProduct(c2, c0);
+        __m128 r2 = crossProduct(c0, c1);
+        __m128 r3 = _mm_setzero_ps();
+
+        __m128 dot = _mm_mul_ps(c0, r0);
+        float det = _mm_cvtss_f32(_mm_add_ss(_mm_add_ss(dot, swizzle<1, 1, 1, 1>(dot)), swizzle<2, 2, 2, 2>(dot)));
+
+        if (!(det > minDeterminant || det < -minDeterminant)) return false;
+
+        __m128 invDet = _mm_set1_ps(1.0f / det);
+        r0 = _mm_mul_ps(r0, invDet);
+        r1 = _mm_mul_ps(r1, invDet);
+        r2 = _mm_mul_ps(r2, invDet);
+
+        _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+
+        __m128 t = affineInverseTranslation(r0, r1, r2, mat + 12);
+
+        _mm_store_ps(out + 0, r0);
+        _mm_store_ps(out + 4, r1);
+        _mm_store_ps(out + 8, r2);
+        _mm_store_ps(out + 12, t);
+
+        return true;
+    }
+
+    // Inverts a column-major 4x4 float matrix made of a rotation and a translation only :
+    // the 3x3 part is transposed, then the translation is rotated back.
+    inline void mat4InverseRigid(const float* mat, float* out)
+    {
+        __m128 c0 = _mm_load_ps(mat + 0);
+        __m128 c1 = _mm_load_ps(mat + 4);
+        __m128 c2 = _mm_load_ps(mat + 8);
+        __m128 c3 = _mm_setzero_ps();
+
+        _MM_TRANSPOSE4_PS(c0, c1, c2, c3);
+
+        __m128 t = affineInverseTranslation(c0, c1, c2, mat + 12);
+
+        _mm_store_ps(out + 0, c0);
+        _mm_store_ps(out + 4, c1);
+        _mm_store_ps(out + 8, c2);
+        _mm_store_ps(out + 12, t);
+    }
+
+
+    // Multiplies two row-major 3x4 float matrices, as if both had a (0, 0, 0, 1) bottom row, each row being one register.
+    // All the rows are loaded before anything is written, so out can be a or b.
+    inline void mat3x4Multiply(const float* a, const float* b, float* out)
+    {
+        __m128 b0 = _mm_load_ps(b + 0);
+        __m128 b1 = _mm_load_ps(b + 4);
+        __m128 b2 = _mm_load_ps(b + 8);
+
+        __m128 aRows[3] = { _mm_load_ps(a + 0), _mm_load_ps(a + 4), _mm_load_ps(a + 8) };
+
+        // Keeps only the w lane, the translation of a, which the implicit (0, 0, 0, 1) row of b adds as is
+        __m128 wMask = _mm_castsi128_ps(_mm_setr_epi32(0, 0, 0, -1));
+
+        for (int row = 0; row < 3; row++)
+        {
+            __m128 aRow = aRows[row];
+
+            __m128 res = madd(swizzle<0, 0, 0, 0>(aRow), b0, _mm_and_ps(aRow, wMask));
+            res = madd(swizzle<1, 1, 1, 1>(aRow), b1, res);
+            res = madd(swizzle<2, 2, 2, 2>(aRow), b2, res);
+
+            _mm_store_ps(out + row * 4, res);
+        }
+    }
+
+    // Packs column-major 4x4 float matrices into row-major 3x4 ones, by transposing them and dropping the last row
+    inline void mat4ToMat3x4(const float* mats, float* out, std::size_t count)
+    {
+        for (std::size_t i = 0; i < count; i++)
+        {
+            const float* src = mats + i * 16;
+            float* dst = out + i * 12;
+
+            __m128 r0 = _mm_load_ps(src + 0);
+            __m128 r1 = _mm_load_ps(src + 4);
+            __m128 r2 = _mm_load_ps(src + 8);
+            __m128 r3 = _mm_load_ps(src + 12);
+
+            _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+
+            _mm_store_ps(dst + 0, r0);
+            _mm_store_ps(dst + 4, r1);
+            _mm_store_ps(dst + 8, r2);
+        }
+    }
+
+    // Unpacks row-major 3x4 float matrices into column-major 4x4 ones, with a (0, 0, 0, 1) bottom row
+    inline void mat3x4ToMat4(const float* mats, float* out, std::size_t count)
+    {
+        for (std::size_t i = 0; i < count; i++)
+        {
+            const float* src = mats + i * 12;
+            float* dst = out + i * 16;
+
+            __m128 c0 = _mm_load_ps(src + 0);
+            __m128 c1 = _mm_load_ps(src + 4);
+            __m128 c2 = _mm_load_ps(src + 8);
+            __m128 c3 = _mm_setr_ps(0.0f, 0.0f, 0.0f, 1.0f);
+
+            _MM_TRANSPOSE4_PS(c0, c1, c2, c3);
+
+            _mm_store_ps(dst + 0, c0);
+            _mm_store_ps(dst + 4, c1);
+            _mm_store_ps(dst + 8, c2);
+            _mm_store_ps(dst + 12, c3);
+        }
+    }
+
+
+    // Multiplies two padded column-major 3x3 float matrices (3 columns of 4 values, the 4th being 0), each column being one register.
+    // Both matrices are loaded before anything is written, so out can be a or b.
+    inline void mat3aMultiply(const float* a, const float* b, float* out)
+    {
+        __m128 a0 = _mm_load_ps(a + 0);
+        __m128 a1 = _mm_load_ps(a + 4);
+        __m128 a2 = _mm_load_ps(a + 8);
+
+        __m128 bColumns[3] = { _mm_load_ps(b + 0), _mm_load_ps(b + 4), _mm_load_ps(b + 8) };
+
+        for (int col = 0; col < 3; col++)
+        {
+            __m128 bCol = bColumns[col];
+
+            __m128 res = _mm_mul_ps(a0, swizzle<0, 0, 0, 0>(bCol));
+            res = madd(a1, swizzle<1, 1, 1, 1>(bCol), res);
+            res = madd(a2, swizzle<2, 2, 2, 2>(bCol), res);
+
+            _mm_store_ps(out + col * 4, res);
+        }
+    }
+
+    // Transposes a padded column-major 3x3 float matrix, the padding staying 0. out can be mat.
+    inline void mat3aTranspose(const float* mat, float* out)
+    {
+        __m128 c0 = _mm_load_ps(mat + 0);
+        __m128 c1 = _mm_load_ps(mat + 4);
+        __m128 c2 = _mm_load_ps(mat + 8);
+        __m128 c3 = _mm_setzero_ps();
+
+        _MM_TRANSPOSE4_PS(c0, c1, c2, c3);
+
+        _mm_store_ps(out + 0, c0);
+        _mm_store_ps(out + 4, c1);
+        _mm_store_ps(out + 8, c2);
+    }
+
+    // Computes the rows of the inverse of the 3x3 matrix whose columns are c0, c1 and c2 (their w being 0), 
+    // from the cross products of the columns. Returns false, leaving the rows untouched, if |det| <= minDeterminant.
+    inline bool mat3InverseRows(__m128 c0, __m128 c1, __m128 c2, __m128& r0, __m128& r1, __m128& r2, float minDeterminant)
+    {
+        __m128 cross0 = crossProduct(c1, c2);
+
+        __m128 dot = _mm_mul_ps(c0, cross0);
+        float det = _mm_cvtss_f32(_mm_add_ss(_mm_add_ss(dot, swizzle<1, 1, 1, 1>(dot)), swizzle<2, 2, 2, 2>(dot)));
+
+        if (!(det > minDeterminant || det < -minDeterminant)) return false;
+
+        __m128 invDet = _mm_set1_ps(1.0f / det);
+        r0 = _mm_mul_ps(cross0, invDet);
+        r1 = _mm_mul_ps(crossProduct(c2, c0), invDet);
+        r2 = _mm_mul_ps(crossProduct(c0, c1), invDet);
+
+        return true;
+    }
+
+    // Inverts a padded column-major 3x3 float matrix. Returns false, without writing out, if |det| <= minDeterminant.
+    inline bool mat3aInverse(const float* mat, float* out, float minDeterminant)
+    {
+        __m128 r0, r1, r2;
+        if (!mat3InverseRows(_mm_load_ps(mat + 0), _mm_load_ps(mat + 4), _mm_load_ps(mat + 8), r0, r1, r2, minDeterminant)) return false;
+
+        __m128 r3 = _mm_setzero_ps();
+        _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+
+        _mm_store_ps(out + 0, r0);
+        _mm_store_ps(out + 4, r1);
+        _mm_store_ps(out + 8, r2);
+
+        return true;
+    }
+
+    // Writes the normal matrices (the top-left 3x3 part inversed and then transposed) of column-major 4x4 float matrices 
+    // as padded 3x3 matrices. The rows of the inverse being the columns of its transpose, no transpose is needed, 
+    // except for the matrices that can't be inversed, which are only transposed.
+    inline void mat3aNormalMats(const float* mats, float* out, std::size_t count, float minDeterminant)
+    {
+        __m128 xyzMask = _mm_castsi128_ps(_mm_setr_epi32(-1, -1, -1, 0));
+
+        for (std::size_t i = 0; i < count; i++)
+        {
+            const float* src = mats + i * 16;
+            float* dst = out + i * 12;
+
+            __m128 c0 = _mm_and_ps(_mm_load_ps(src + 0), xyzMask);
+            __m128 c1 = _mm_and_ps(_mm_load_ps(src + 4), xyzMask);
+            __m128 c2 = _mm_and_ps(_mm_load_ps(src + 8), xyzMask);
+
+            __m128 r0, r1, r2;
+            if (!mat3InverseRows(c0, c1, c2, r0, r1, r2, minDeterminant))
+            {
+                __m128 c3 = _mm_setzero_ps();
+                _MM_TRANSPOSE4_PS(c0, c1, c2, c3);
+
+                r0 = c0; r1 = c1; r2 = c2;
+            }
+
+            _mm_store_ps(dst + 0, r0);
+            _mm_store_ps(dst + 4, r1);
+            _mm_store_ps(dst + 8, r2);
+        }
+    }
+
+
+    // Loads 4 packed vec3<float>, (x0 y0 z0 x1) (y1 z1 x2 y2) (z2 x3 y3 z3), as 3 registers deinterleaved in x, y and z
+    inline void loadVec3x4(const float* src, __m128& x, __m128& y, __m128& z)
+    {
+        __m128 p0 = _mm_loadu_ps(src + 0);
+        __m128 p1 = _mm_loadu_ps(src + 4);
+        __m128 p2 = _mm_loadu_ps(src + 8);
+
+        __m128 x2y1x3z2 = _mm_shuffle_ps(p1, p2, _MM_SHUFFLE(0, 1, 0, 2));
+        __m128 y2y1y3z2 = _mm_shuffle_ps(p1, p2, _MM_SHUFFLE(0, 2, 0, 3));
+        __m128 y0y0y1y1 = _mm_shuffle_ps(p0, p1, _MM_SHUFFLE(0, 0, 1, 1));
+        __m128 z0z0z1z1 = _mm_shuffle_ps(p0, p1, _MM_SHUFFLE(1, 1, 2, 2));
+        __m128 z2z2z3z3 = _mm_shuffle_ps(p2, p2, _MM_SHUFFLE(3, 3, 0, 0));
+
+        x = _mm_shuffle_ps(p0, x2y1x3z2, _MM_SHUFFLE(2, 0, 3, 0));
+        y = _mm_shuffle_ps(y0y0y1y1, y2y1y3z2, _MM_SHUFFLE(2, 0, 2, 0));
+        z = _mm_shuffle_ps(z0z0z1z1, z2z2z3z3, _MM_SHUFFLE(2, 0, 2, 0));
+    }
+
+    // Stores the x, y and z registers of 4 vec3<float> packed again, (x0 y0 z0 x1) (y1 z1 x2 y2) (z2 x3 y3 z3)
+    inline void storeVec3x4(float* dst, __m128 x, __m128 y, __m128 z)
+    {
+        __m128 x0y0x1y1 = _mm_unpacklo_ps(x, y);
+        __m128 x2y2x3y3 = _mm_unpackhi_ps(x, y);
+        __m128 z0z0x1x1 = _mm_shuffle_ps(z, x, _MM_SHUFFLE(1, 1, 0, 0));
+        __m128 y1y1z1z1 = _mm_shuffle_ps(y, z, _MM_SHUFFLE(1, 1, 1, 1));
+        __m128 z2z2x3x3 = _mm_shuffle_ps(z, x, _MM_SHUFFLE(3, 3, 2, 2));
+        __m128 y3y3z3z3 = _mm_shuffle_ps(y, z, _MM_SHUFFLE(3, 3, 3, 3));
+
+        _mm_storeu_ps(dst + 0, _mm_shuffle_ps(x0y0x1y1, z0z0x1x1, _MM_SHUFFLE(2, 0, 1, 0)));
+        _mm_storeu_ps(dst + 4, _mm_shuffle_ps(y1y1z1z1, x2y2x3y3, _MM_SHUFFLE(1, 0, 2, 0)));
+        _mm_storeu_ps(dst + 8, _mm_shuffle_ps(z2z2x3x3, y3y3z3z3, _MM_SHUFFLE(2, 0, 2, 0)));
+    }
+
+    // Transforms packed vec3<float> (x, y, z, x, y, z...) by a column-major 4x4 matrix, 4 points per step :
+    // 4 points are loaded as 3 registers and deinterleaved in x, y and z registers, so every
+    // register operation works on the same component of 4 points. With isPoint, w is 1, else it is 0.
+    // Only handles count rounded down to a multiple of 4, and returns that number, the caller does the tail.
+    // The 4 points are read before being written, so in and out can be the same array.
+    inline std::size_t mat4TransformVec3(const float* mat, const float* in, float* out, std::size_t count, bool isPoint, bool perspectiveDivide)
+    {
+        __m128 m00 = _mm_set1_ps(mat[0]); __m128 m01 = _mm_set1_ps(mat[4]); __m128 m02 = _mm_set1_ps(mat[8]);  
+        __m128 m10 = _mm_set1_ps(mat[1]); __m128 m11 = _mm_set1_ps(mat[5]); __m128 m12 = _mm_set1_ps(mat[9]);  
+        __m128 m20 = _mm_set1_ps(mat[2]); __m128 m21 = _mm_set1_ps(mat[6]); __m128 m22 = _mm_set1_ps(mat[10]); 
+        __m128 m30 = _mm_set1_ps(mat[3]); __m128 m31 = _mm_set1_ps(mat[7]); __m128 m32 = _mm_set1_ps(mat[11]); 
+
+        __m128 zero = _mm_setzero_ps();
+        __m128 m03 = isPoint ? _mm_set1_ps(mat[12]) : zero;
+        __m128 m13 = isPoint ? _mm_set1_ps(mat[13]) : zero;
+        __m128 m23 = isPoint ? _mm_set1_ps(mat[14]) : zero;
+        __m128 m33 = isPoint ? _mm_set1_ps(mat[15]) : zero;
+
+        std::size_t blocks = count / 4;
+
+        for (std::size_t block = 0; block < blocks; block++)
+        {
+            const float* src = in + block * 12;
+            float* dst = out + block * 12;
+
+            __m128 x, y, z;
+            loadVec3x4(src, x, y, z);
+
+            __m128 rx = madd(m00, x, madd(m01, y, madd(m02, z, m03)));
+            __m128 ry = madd(m10, x, madd(m11, y, madd(m12, z, m13)));
+            __m128 rz = madd(m20, x, madd(m21, y, madd(m22, z, m23)));
+
+            if (perspectiveDivide)
+            {
+                __m128 invW = _mm_div_ps(_mm_set1_ps(1.0f), madd(m30, x, madd(m31, y, madd(m32, z, m33))));
+
+                rx = _mm_mul_ps(rx, invW);
+                ry = _mm_mul_ps(ry, invW);
+                rz = _mm_mul_ps(rz, invW);
+            }
+
+            storeVec3x4(dst, rx, ry, rz);
+        }
+
+        return blocks * 4;
+    }
+
+    // Rotates packed vec3<float> by a unit quaternion (w, x, y, z), 4 points per step, deinterleaved like in mat4TransformVec3 :
+    // with u the vector part of the quaternion, t = 2 * cross(u, v) and v' = v + w * t + cross(u, t), 2 cross products
+    // on the x, y and z registers. Only handles count rounded down to a multiple of 4, and returns that number, the caller does the tail.
+    // The 4 points are read before being written, so in and out can be the same array.
+    inline std::size_t quatRotateVec3(const float* rot, const float* in, float* out, std::size_t count)
+    {
+        __m128 w = _mm_set1_ps(rot[0]);
+        __m128 ux = _mm_set1_ps(rot[1]);
+        __m128 uy = _mm_set1_ps(rot[2]);
+        __m128 uz = _mm_set1_ps(rot[3]);
+        __m128 ux2 = _mm_add_ps(ux, ux);
+        __m128 uy2 = _mm_add_ps(uy, uy);
+        __m128 uz2 = _mm_add_ps(uz, uz);
+
+        std::size_t blocks = count / 4;
+
+        for (std::size_t block = 0; block < blocks; block++)
+        {
+            __m128 x, y, z;
+            loadVec3x4(in + block * 12, x, y, z);
+
+            __m128 tx = _mm_sub_ps(_mm_mul_ps(uy2, z), _mm_mul_ps(uz2, y));
+            __m128 ty = _mm_sub_ps(_mm_mul_ps(uz2, x), _mm_mul_ps(ux2, z));
+            __m128 tz = _mm_sub_ps(_mm_mul_ps(ux2, y), _mm_mul_ps(uy2, x));
+
+            __m128 rx = madd(w, tx, _mm_add_ps(x, _mm_sub_ps(_mm_mul_ps(uy, tz), _mm_mul_ps(uz, ty))));
+            __m128 ry = madd(w, ty, _mm_add_ps(y, _mm_sub_ps(_mm_mul_ps(uz, tx), _mm_mul_ps(ux, tz))));
+            __m128 rz = madd(w, tz, _mm_add_ps(z, _mm_sub_ps(_mm_mul_ps(ux, ty), _mm_mul_ps(uy, tx))));
+
+            storeVec3x4(out + block * 12, rx, ry, rz);
+        }
+
+        return blocks * 4;
+    }
+
+    // Transforms aligned vec4<float> by a column-major 4x4 matrix, one vector per register.
+    // With isPoint, the w of each vector is used, else it is taken as 0. Handles every vector, and returns count.
+    inline std::size_t mat4TransformVec4(const float* mat, const float* in, float* out, std::size_t count, bool isPoint)
+    {
+        __m128 c0 = _mm_load_ps(mat + 0);
+        __m128 c1 = _mm_load_ps(mat + 4);
+        __m128 c2 = _mm_load_ps(mat + 8);
+        __m128 c3 = isPoint ? _mm_load_ps(mat + 12) : _mm_setzero_ps();
+
+        for (std::size_t i = 0; i < count; i++)
+        {
+            const float* src = in + i * 4;
+
+            __m128 res = _mm_mul_ps(c0, _mm_set1_ps(src[0]));
+            res = madd(c1, _mm_set1_ps(src[1]), res);
+            res = madd(c2, _mm_set1_ps(src[2]), res);
+            res = madd(c3, _mm_set1_ps(src[3]), res);
+
+            _mm_store_ps(out + i * 4, res);
+        }
+
+        return count;
+    }
+
+    // Tests spheres, stored as separate x, y, z, radius arrays, against the 6 planes of a frustum (a, b, c, d each, one after the other). 
+    // Works on 8 spheres per step with AVX, then 4 with SSE, and sets the bit of every visible sphere in mask, which must be zeroed. 
+    // A sphere is culled when dist < -radius, like frustum::intersectsSphere : the comparisons are "not less than", true on NaN, 
+    // so a sphere with a NaN is kept by both paths. Returns how many spheres were handled, always a multiple of 4
+    inline std::size_t frustumTestSpheres(const float* planes, const float* x, const float* y, const float* z, const float* radius, 
+                                          std::size_t count, std::uint64_t* mask)
+    {
+        std::size_t i = 0;
+
+        #if defined(GLMATH_SIMD_AVX)
+        for (; i + 8 <= count; i += 8)
+        {
+            __m256 cx = _mm256_loadu_ps(x + i);
+            __m256 cy = _mm256_loadu_ps(y + i);
+            __m256 cz = _mm256_loadu_ps(z + i);
+            __m256 negRadius = _mm256_sub_ps(_mm256_setzero_ps(), _mm256_loadu_ps(radius + i));
+
+            __m256 inside = _mm256_castsi256_ps(_mm256_set1_epi32(-1));
+
+            for (int p = 0; p < 6; p++)
+            {
+                const float* plane = planes + p * 4;
+
+                __m256 dist = madd(_mm256_set1_ps(plane[0]), cx, _mm256_set1_ps(plane[3]));
+                dist = madd(_mm256_set1_ps(plane[1]), cy, dist);
+                dist = madd(_mm256_set1_ps(plane[2]), cz, dist);
+
+                inside = _mm256_and_ps(inside, _mm256_cmp_ps(dist, negRadius, _CMP_NLT_UQ));
+            }
+
+            mask[i >> 6] |= static_cast<std::uint64_t>(_mm256_movemask_ps(inside)) << (i & 63);
+        }
+        #endif
+
+        for (; i + 4 <= count; i += 4)
+        {
+            __m128 cx = _mm_loadu_ps(x + i);
+            __m128 cy = _mm_loadu_ps(y + i);
+            __m128 cz = _mm_loadu_ps(z + i);
+            __m128 negRadius = _mm_sub_ps(_mm_setzero_ps(), _mm_loadu_ps(radius + i));
+
+            __m128 inside = _mm_castsi128_ps(_mm_set1_epi32(-1));
+
+            for (int p = 0; p < 6; p++)
+            {
+                const float* plane = planes + p * 4;
+
+                __m128 dist = madd(_mm_set1_ps(plane[0]), cx, _mm_set1_ps(plane[3]));
+                dist = madd(_mm_set1_ps(plane[1]), cy, dist);
+                dist = madd(_mm_set1_ps(plane[2]), cz, dist);
+
+                inside = _mm_and_ps(inside, _mm_cmpnlt_ps(dist, negRadius));
+            }
+
+            mask[i >> 6] |= static_cast<std::uint64_t>(_mm_movemask_ps(inside)) << (i & 63);
+        }
+
+        return i;
+    }
+
+    // Same as frustumTestSpheres, for boxes given by their center and half extents. 
+    // Each box is projected on the normal of each plane, which gives the radius it is tested with
+    inline std::size_t frustumTestAABBs(const float* planes, const float* centerX, const float* centerY, const float* centerZ, 
+                                        const float* extentX, const float* extentY, const float* extentZ, std::size_t count, std::uint64_t* mask)
+    {
+        float absNormals[6 * 3];
+        for (int p = 0; p < 6; p++)
+        {
+            absNormals[p * 3 + 0] = std::abs(planes[p * 4 + 0]);
+            absNormals[p * 3 + 1] = std::abs(planes[p * 4 + 1]);
+            absNormals[p * 3 + 2] = std::abs(planes[p * 4 + 2]);
+        }
+
+        std::size_t i = 0;
+
+        #if defined(GLMATH_SIMD_AVX)
+        for (; i + 8 <= count; i += 8)
+        {
+            __m256 cx = _mm256_loadu_ps(centerX + i);
+            __m256 cy = _mm256_loadu_ps(centerY + i);
+            __m256 cz = _mm256_loadu_ps(centerZ + i);
+            __m256 ex = _mm256_loadu_ps(extentX + i);
+            __m256 ey = _mm256_loadu_ps(extentY + i);
+            __m256 ez = _mm256_loadu_ps(extentZ + i);
+
+            __m256 inside = _mm256_castsi256_ps(_mm256_set1_epi32(-1));
+
+            for (int p = 0; p < 6; p++)
+            {
+                const float* plane = planes + p * 4;
+                const float* absNormal = absNormals + p * 3;
+
+                __m256 dist = madd(_mm256_set1_ps(plane[0]), cx, _mm256_set1_ps(plane[3]));
+                dist = madd(_mm256_set1_ps(plane[1]), cy, dist);
+                dist = madd(_mm256_set1_ps(plane[2]), cz, dist);
+
+                __m256 radius = _mm256_mul_ps(_mm256_set1_ps(absNormal[0]), ex);
+                radius = madd(_mm256_set1_ps(absNormal[1]), ey, radius);
+                radius = madd(_mm256_set1_ps(absNormal[2]), ez, radius);
+
+                inside = _mm256_and_ps(inside, _mm256_cmp_ps(dist, _mm256_sub_ps(_mm256_setzero_ps(), radius), _CMP_NLT_UQ));
+            }
+
+            mask[i >> 6] |= static_cast<std::uint64_t>(_mm256_movemask_ps(inside)) << (i & 63);
+        }
+        #endif
+
+        for (; i + 4 <= count; i += 4)
+        {
+            __m128 cx = _mm_loadu_ps(centerX + i);
+            __m128 cy = _mm_loadu_ps(centerY + i);
+            __m128 cz = _mm_loadu_ps(centerZ + i);
+            __m128 ex = _mm_loadu_ps(extentX + i);
+            __m128 ey = _mm_loadu_ps(extentY + i);
+            __m128 ez = _mm_loadu_ps(extentZ + i);
+
+            __m128 inside = _mm_castsi128_ps(_mm_set1_epi32(-1));
+
+            for (int p = 0; p < 6; p++)
+            {
+                const float* plane = planes + p * 4;
+                const float* absNormal = absNormals + p * 3;
+
+                __m128 dist = madd(_mm_set1_ps(plane[0]), cx, _mm_set1_ps(plane[3]));
+                dist = madd(_mm_set1_ps(plane[1]), cy, dist);
+                dist = madd(_mm_set1_ps(plane[2]), cz, dist);
+
+                __m128 radius = _mm_mul_ps(_mm_set1_ps(absNormal[0]), ex);
+                radius = madd(_mm_set1_ps(absNormal[1]), ey, radius);
+                radius = madd(_mm_set1_ps(absNormal[2]), ez, radius);
+
+                inside = _mm_and_ps(inside, _mm_cmpnlt_ps(dist, _mm_sub_ps(_mm_setzero_ps(), radius)));
+            }
+
+            mask[i >> 6] |= static_cast<std::uint64_t>(_mm_movemask_ps(inside)) << (i & 63);
+        }
+
+        return i;
+    }
+
+
+    // The structure-of-arrays kernels below work on vectors stored as one array per component (x[], y[], z[]...), 
+    // given as an array of pointers to those arrays. They use unaligned loads, so subspans can be passed, 
+    // and every element is read before its result is written, so the output can be one of the inputs. 
+    // Like the frustum kernels, they work on 8 vectors per step with AVX, then 4 with SSE, and return how many were handled
+
+    // Writes the dot products of the vectors of a and b, which have dimensions components each
+    inline std::size_t soaDotProduct(const float* const* a, const float* const* b, std::size_t dimensions, float* out, std::size_t count)
+    {
+        std::size_t i = 0;
+
+        #if defined(GLMATH_SIMD_AVX)
+        for (; i + 8 <= count; i += 8)
+        {
+            __m256 dot = _mm256_mul_ps(_mm256_loadu_ps(a[0] + i), _mm256_loadu_ps(b[0] + i));
+            for (std::size_t c = 1; c < dimensions; c++)
+            {
+                dot = madd(_mm256_loadu_ps(a[c] + i), _mm256_loadu_ps(b[c] + i), dot);
+            }
+
+            _mm256_storeu_ps(out + i, dot);
+        }
+        #endif
+
+        for (; i + 4 <= count; i += 4)
+        {
+            __m128 dot = _mm_mul_ps(_mm_loadu_ps(a[0] + i), _mm_loadu_ps(b[0] + i));
+            for (std::size_t c = 1; c < dimensions; c++)
+            {
+                dot = madd(_mm_loadu_ps(a[c] + i), _mm_loadu_ps(b[c] + i), dot);
+            }
+
+            _mm_storeu_ps(out + i, dot);
+        }
+
+        return i;
+    }
+
+    // Writes the lengths of the vectors, which have dimensions components each
+    inline std::size_t soaLengths(const float* const* components, std::size_t dimensions, float* out, std::size_t count)
+    {
+        std::size_t i = soaDotProduct(components, components, dimensions, out, count);
+
+        std::size_t j = 0;
+
+        #if defined(GLMATH_SIMD_AVX)
+        for (; j + 8 <= i; j += 8)
+        {
+            _mm256_storeu_ps(out + j, _mm256_sqrt_ps(_mm256_loadu_ps(out + j)));
+        }
+        #endif
+
+        for (; j < i; j += 4)
+        {
+            _mm_storeu_ps(out + j, _mm_sqrt_ps(_mm_loadu_ps(out + j)));
+        }
+
+        return i;
+    }
+
+    // Normalizes the vectors in place, the ones of length 0 being left untouched like vec3::normalize() does
+    inline std::size_t soaNormalize(float* const* components, std::size_t dimensions, std::size_t count)
+    {
+        std::size_t i = 0;
+
+        #if defined(GLMATH_SIMD_AVX)
+        for (; i + 8 <= count; i += 8)
+        {
+            __m256 lengthSq = _mm256_setzero_ps();
+            for (std::size_t c = 0; c < dimensions; c++)
+            {
+                __m256 v = _mm256_loadu_ps(components[c] + i);
+                lengthSq = madd(v, v, lengthSq);
+            }
+
+            __m256 one = _mm256_set1_ps(1.0f);
+            __m256 isZero = _mm256_cmp_ps(lengthSq, _mm256_setzero_ps(), _CMP_LE_OQ);
+            __m256 invLength = _mm256_div_ps(one, _mm256_sqrt_ps(lengthSq));
+            invLength = _mm256_blendv_ps(invLength, one, isZero);
+
+            for (std::size_t c = 0; c < dimensions; c++)
+            {
+                _mm256_storeu_ps(components[c] + i, _mm256_mul_ps(_mm256_loadu_ps(components[c] + i), invLength));
+            }
+        }
+        #endif
+
+        for (; i + 4 <= count; i += 4)
+        {
+            __m128 lengthSq = _mm_setzero_ps();
+            for (std::size_t c = 0; c < dimensions; c++)
+            {
+                __m128 v = _mm_loadu_ps(components[c] + i);
+                lengthSq = madd(v, v, lengthSq);
+            }
+
+            __m128 one = _mm_set1_ps(1.0f);
+            __m128 isZero = _mm_cmple_ps(lengthSq, _mm_setzero_ps());
+            __m128 invLength = _mm_div_ps(one, _mm_sqrt_ps(lengthSq));
+            invLength = _mm_or_ps(_mm_andnot_ps(isZero, invLength), _mm_and_ps(isZero, one));
+
+            for (std::size_t c = 0; c < dimensions; c++)
+            {
+                _mm_storeu_ps(components[c] + i, _mm_mul_ps(_mm_loadu_ps(components[c] + i), invLength));
+            }
+        }
+
+        return i;
+    }
+
+    // Like soaNormalize, with rsqrtNewton instead of a square root and a division. 
+    // The vectors whose squared length is 0 or denormal are left untouched, rsqrtps giving infinity for them
+    inline std::size_t soaNormalizeFast(float* const* components, std::size_t dimensions, std::size_t count)
+    {
+        std::size_t i = 0;
+
+        #if defined(GLMATH_SIMD_AVX)
+        for (; i + 8 <= count; i += 8)
+        {
+            __m256 lengthSq = _mm256_setzero_ps();
+            for (std::size_t c = 0; c < dimensions; c++)
+            {
+                __m256 v = _mm256_loadu_ps(components[c] + i);
+                lengthSq = madd(v, v, lengthSq);
+            }
+
+            __m256 isTiny = _mm256_cmp_ps(lengthSq, _mm256_set1_ps(FLT_MIN), _CMP_LT_OQ);
+            __m256 invLength = _mm256_blendv_ps(rsqrtNewton(lengthSq), _mm256_set1_ps(1.0f), isTiny);
+
+            for (std::size_t c = 0; c < dimensions; c++)
+            {
+                _mm256_storeu_ps(components[c] + i, _mm256_mul_ps(_mm256_loadu_ps(components[c] + i), invLength));
+            }
+        }
+        #endif
+
+        for (; i + 4 <= count; i += 4)
+        {
+            __m128 lengthSq = _mm_setzero_ps();
+            for (std::size_t c = 0; c < dimensions; c++)
+            {
+                __m128 v = _mm_loadu_ps(components[c] + i);
+                lengthSq = madd(v, v, lengthSq);
+            }
+
+            __m128 isTiny = _mm_cmplt_ps(lengthSq, _mm_set1_ps(FLT_MIN));
+            __m128 invLength = _mm_or_ps(_mm_andnot_ps(isTiny, rsqrtNewton(lengthSq)), _mm_and_ps(isTiny, _mm_set1_ps(1.0f)));
+
+            for (std::size_t c = 0; c < dimensions; c++)
+            {
+                _mm_storeu_ps(components[c] + i, _mm_mul_ps(_mm_loadu_ps(components[c] + i), invLength));
+            }
+        }
+
+        return i;
+    }
+
+    // Writes the cross products of the 3D vectors of a and b
+    inline std::size_t soaCrossProduct(const float* const* a, const float* const* b, float* const* out, std::size_t count)
+    {
+        std::size_t i = 0;
+
+        #if defined(GLMATH_SIMD_AVX)
+        for (; i + 8 <= count; i += 8)
+        {
+            __m256 ax = _mm256_loadu_ps(a[0] + i), ay = _mm256_loadu_ps(a[1] + i), az = _mm256_loadu_ps(a[2] + i);
+            __m256 bx = _mm256_loadu_ps(b[0] + i), by = _mm256_loadu_ps(b[1] + i), bz = _mm256_loadu_ps(b[2] + i);
+
+            _mm256_storeu_ps(out[0] + i, _mm256_sub_ps(_mm256_mul_ps(ay, bz), _mm256_mul_ps(az, by)));
+            _mm256_storeu_ps(out[1] + i, _mm256_sub_ps(_mm256_mul_ps(az, bx), _mm256_mul_ps(ax, bz)));
+            _mm256_storeu_ps(out[2] + i, _mm256_sub_ps(_mm256_mul_ps(ax, by), _mm256_mul_ps(ay, bx)));
+        }
+        #endif
+
+        for (; i + 4 <= count; i += 4)
+        {
+            __m128 ax = _mm_loadu_ps(a[0] + i), ay = _mm_loadu_ps(a[1] + i), az = _mm_loadu_ps(a[2] + i);
+            __m128 bx = _mm_loadu_ps(b[0] + i), by = _mm_loadu_ps(b[1] + i), bz = _mm_loadu_ps(b[2] + i);
+
+            _mm_storeu_ps(out[0] + i, _mm_sub_ps(_mm_mul_ps(ay, bz), _mm_mul_ps(az, by)));
+            _mm_storeu_ps(out[1] + i, _mm_sub_ps(_mm_mul_ps(az, bx), _mm_mul_ps(ax, bz)));
+            _mm_storeu_ps(out[2] + i, _mm_sub_ps(_mm_mul_ps(ax, by), _mm_mul_ps(ay, bx)));
+        }
+
+        return i;
+    }
+
+    // Writes a + (b - a) * t for one component array, t not being clamped
+    inline std::size_t soaLerp(const float* a, const float* b, float t, float* out, std::size_t count)
+    {
+        std::size_t i = 0;
+
+        #if defined(GLMATH_SIMD_AVX)
+        __m256 t8 = _mm256_set1_ps(t);
+        for (; i + 8 <= count; i += 8)
+        {
+            __m256 start = _mm256_loadu_ps(a + i);
+            _mm256_storeu_ps(out + i, madd(_mm256_sub_ps(_mm256_loadu_ps(b + i), start), t8, start));
+        }
+        #endif
+
+        __m128 t4 = _mm_set1_ps(t);
+        for (; i + 4 <= count; i += 4)
+        {
+            __m128 start = _mm_loadu_ps(a + i);
+            _mm_storeu_ps(out + i, madd(_mm_sub_ps(_mm_loadu_ps(b + i), start), t4, start));
+        }
+
+        return i;
+    }
+
+    // Writes the smallest of a and b, or the biggest with max, for one component array
+    inline std::size_t soaMinMax(const float* a, const float* b, float* out, std::size_t count, bool max)
+    {
+        std::size_t i = 0;
+
+        #if defined(GLMATH_SIMD_AVX)
+        for (; i + 8 <= count; i += 8)
+        {
+            __m256 va = _mm256_loadu_ps(a + i);
+            __m256 vb = _mm256_loadu_ps(b + i);
+            _mm256_storeu_ps(out + i, max ? _mm256_max_ps(va, vb) : _mm256_min_ps(va, vb));
+        }
+        #endif
+
+        for (; i + 4 <= count; i += 4)
+        {
+            __m128 va = _mm_loadu_ps(a + i);
+            __m128 vb = _mm_loadu_ps(b + i);
+            _mm_storeu_ps(out + i, max ? _mm_max_ps(va, vb) : _mm_min_ps(va, vb));
+        }
+
+        return i;
+    }
+
+    // Transforms vectors by a column-major 4x4 matrix. The w of each vector is read from in[3] if inDimensions is 4, 
+    // else it is w for all of them (1 for points, 0 for directions). outDimensions (3 or 4) rows of the matrix are written, 
+    // and with perspectiveDivide, the 3 first are divided by the 4th one, which isn't written
+    inline std::size_t soaTransform(const float* mat, const float* const* in, std::size_t inDimensions, float w, 
+                                    float* const* out, std::size_t outDimensions, bool perspectiveDivide, std::size_t count)
+    {
+        std::size_t rows = perspectiveDivide ? 4 : outDimensions;
+
+        std::size_t i = 0;
+
+        #if defined(GLMATH_SIMD_AVX)
+        for (; i + 8 <= count; i += 8)
+        {
+            __m256 x = _mm256_loadu_ps(in[0] + i);
+            __m256 y = _mm256_loadu_ps(in[1] + i);
+            __m256 z = _mm256_loadu_ps(in[2] + i);
+            __m256 vw = inDimensions == 4 ? _mm256_loadu_ps(in[3] + i) : _mm256_set1_ps(w);
+
+            __m256 res[4];
+            for (std::size_t r = 0; r < rows; r++)
+            {
+                res[r] = _mm256_mul_ps(_mm256_set1_ps(mat[r]), x);
+                res[r] = madd(_mm256_set1_ps(mat[4 + r]), y, res[r]);
+                res[r] = madd(_mm256_set1_ps(mat[8 + r]), z, res[r]);
+                res[r] = madd(_mm256_set1_ps(mat[12 + r]), vw, res[r]);
+            }
+
+            if (perspectiveDivide)
+            {
+                __m256 invW = _mm256_div_ps(_mm256_set1_ps(1.0f), res[3]);
+                for (std::size_t r = 0; r < 3; r++) res[r] = _mm256_mul_ps(res[r], invW);
+            }
+
+            for (std::size_t r = 0; r < outDimensions; r++)
+            {
+                _mm256_storeu_ps(out[r] + i, res[r]);
+            }
+        }
+        #endif
+
+        for (; i + 4 <= count; i += 4)
+        {
+            __m128 x = _mm_loadu_ps(in[0] + i);
+            __m128 y = _mm_loadu_ps(in[1] + i);
+            __m128 z = _mm_loadu_ps(in[2] + i);
+            __m128 vw = inDimensions == 4 ? _mm_loadu_ps(in[3] + i) : _mm_set1_ps(w);
+
+            __m128 res[4];
+            for (std::size_t r = 0; r < rows; r++)
+            {
+                res[r] = _mm_mul_ps(_mm_set1_ps(mat[r]), x);
+                res[r] = madd(_mm_set1_ps(mat[4 + r]), y, res[r]);
+                res[r] = madd(_mm_set1_ps(mat[8 + r]), z, res[r]);
+                res[r] = madd(_mm_set1_ps(mat[12 + r]), vw, res[r]);
+            }
+
+            if (perspectiveDivide)
+            {
+                __m128 invW = _mm_div_ps(_mm_set1_ps(1.0f), res[3]);
+                for (std::size_t r = 0; r < 3; r++) res[r] = _mm_mul_ps(res[r], invW);
+            }
+
+            for (std::size_t r = 0; r < outDimensions; r++)
+            {
+                _mm_storeu_ps(out[r] + i, res[r]);
+            }
+        }
+
+        return i;
+    }
+
+    // Normalizes quaternions (w, x, y, z each, aligned on 16 bytes) 4 at a time : they are transposed so that 
+    // each register holds one component of the 4, which gives the 4 squared lengths without horizontal adds.
+    // The quaternions whose squared length is at most minLengthSquared are left untouched
+    inline std::size_t quatNormalizeFast(float* quats, std::size_t count, float minLengthSquared)
+    {
+        std::size_t i = 0;
+
+        for (; i + 4 <= count; i += 4)
+        {
+            float* ptr = quats + i * 4;
+
+            __m128 q0 = _mm_load_ps(ptr);
+            __m128 q1 = _mm_load_ps(ptr + 4);
+            __m128 q2 = _mm_load_ps(ptr + 8);
+            __m128 q3 = _mm_load_ps(ptr + 12);
+
+            __m128 c0 = q0, c1 = q1, c2 = q2, c3 = q3;
+            _MM_TRANSPOSE4_PS(c0, c1, c2, c3);
+
+            __m128 lengthSq = _mm_mul_ps(c0, c0);
+            lengthSq = madd(c1, c1, lengthSq);
+            lengthSq = madd(c2, c2, lengthSq);
+            lengthSq = madd(c3, c3, lengthSq);
+
+            __m128 isTiny = _mm_cmple_ps(lengthSq, _mm_set1_ps(minLengthSquared));
+            __m128 invLength = _mm_or_ps(_mm_andnot_ps(isTiny, rsqrtNewton(lengthSq)), _mm_and_ps(isTiny, _mm_set1_ps(1.0f)));
+
+            _mm_store_ps(ptr,      _mm_mul_ps(q0, _mm_shuffle_ps(invLength, invLength, _MM_SHUFFLE(0, 0, 0, 0))));
+            _mm_store_ps(ptr + 4,  _mm_mul_ps(q1, _mm_shuffle_ps(invLength, invLength, _MM_SHUFFLE(1, 1, 1, 1))));
+            _mm_store_ps(ptr + 8,  _mm_mul_ps(q2, _mm_shuffle_ps(invLength, invLength, _MM_SHUFFLE(2, 2, 2, 2))));
+            _mm_store_ps(ptr + 12, _mm_mul_ps(q3, _mm_shuffle_ps(invLength, invLength, _MM_SHUFFLE(3, 3, 3, 3))));
+        }
+
+        return i;
+    }
+
+    // The smallest-three kernels below work on the packedQuat<Bits> layout : the index of the dropped component on 2 bits,
+    // above the 3 other components quantized on (Bits - 2) / 3 bits each, the first one in the highest bits.
+    // The 4 fields of 4 quaternions are handled as 4 registers of 32 bits integers, one field of the 4 per register
+
+    // The low 32 bits of the 4 64 bits lanes of lo and hi, shifted right by shift
+    inline __m128i lowHalves(__m128i lo, __m128i hi, int shift)
+    {
+        __m128i count = _mm_cvtsi32_si128(shift);
+        return _mm_castps_si128(_mm_shuffle_ps(_mm_castsi128_ps(_mm_srl_epi64(lo, count)), 
+                                               _mm_castsi128_ps(_mm_srl_epi64(hi, count)), _MM_SHUFFLE(2, 0, 2, 0)));
+    }
+
+    // Packs normalized quaternions (w, x, y, z each) 4 at a time : they are transposed so that each register holds one component 
+    // of the 4, the largest one is found and dropped, the 3 others are put on its side (so negated if it is negative), 
+    // rounded and packed. Only handles count rounded down to a multiple of 4, and returns that number, the caller does the tail
+    template<std::size_t Bits>
+    inline std::size_t quatPackSmallestThree(const float* quats, std::uint16_t* out, std::size_t count)
+    {
+        constexpr int bits = static_cast<int>((Bits - 2) / 3);
+        constexpr int maxLevel = (1 << bits) - 2;
+
+        const __m128 signMask = _mm_set1_ps(-0.0f);
+        // [-1 / sqrt(2), 1 / sqrt(2)] to [0, maxLevel], + 0.5 to round to the nearest when truncated
+        const __m128 scale = _mm_set1_ps(1.41421356f * static_cast<float>(maxLevel / 2));
+        const __m128 offset = _mm_set1_ps(static_cast<float>(maxLevel / 2) + 0.5f);
+        const __m128 maxValue = _mm_set1_ps(static_cast<float>(maxLevel));
+
+        std::size_t blocks = count / 4;
+
+        for (std::size_t block = 0; block < blocks; block++)
+        {
+            __m128 w = _mm_loadu_ps(quats + block * 16);
+            __m128 x = _mm_loadu_ps(quats + block * 16 + 4);
+            __m128 y = _mm_loadu_ps(quats + block * 16 + 8);
+            __m128 z = _mm_loadu_ps(quats + block * 16 + 12);
+            _MM_TRANSPOSE4_PS(w, x, y, z);
+
+            __m128 absW = _mm_andnot_ps(signMask, w);
+            __m128 absX = _mm_andnot_ps(signMask, x);
+            __m128 absY = _mm_andnot_ps(signMask, y);
+            __m128 absZ = _mm_andnot_ps(signMask, z);
+            __m128 largest = _mm_max_ps(_mm_max_ps(absW, absX), _mm_max_ps(absY, absZ));
+
+            // The first component equal to the largest, like the scalar code
+            __m128 isW = _mm_cmpeq_ps(absW, largest);
+            __m128 isX = _mm_andnot_ps(isW, _mm_cmpeq_ps(absX, largest));
+            __m128 isWX = _mm_or_ps(isW, isX);
+            __m128 isY = _mm_andnot_ps(isWX, _mm_cmpeq_ps(absY, largest));
+            __m128 isZ = _mm_andnot_ps(_mm_or_ps(isWX, isY), _mm_castsi128_ps(_mm_set1_epi32(-1)));
+
+            __m128 dropped = _mm_or_ps(_mm_or_ps(_mm_and_ps(isW, w), _mm_and_ps(isX, x)), _mm_or_ps(_mm_and_ps(isY, y), _mm_and_ps(isZ, z)));
+            __m128 sign = _mm_and_ps(dropped, signMask);
+
+            // The 3 other components, in order
+            __m128 a = _mm_or_ps(_mm_and_ps(isW, x), _mm_andnot_ps(isW, w));
+            __m128 b = _mm_or_ps(_mm_and_ps(isWX, y), _mm_andnot_ps(isWX, x));
+            __m128 c = _mm_or_ps(_mm_and_ps(isZ, y), _mm_andnot_ps(isZ, z));
+
+            __m128i levelA = _mm_cvttps_epi32(_mm_min_ps(_mm_max_ps(madd(_mm_xor_ps(a, sign), scale, offset), _mm_setzero_ps()), maxValue));
+            __m128i levelB = _mm_cvttps_epi32(_mm_min_ps(_mm_max_ps(madd(_mm_xor_ps(b, sign), scale, offset), _mm_setzero_ps()), maxValue));
+            __m128i levelC = _mm_cvttps_epi32(_mm_min_ps(_mm_max_ps(madd(_mm_xor_ps(c, sign), scale, offset), _mm_setzero_ps()), maxValue));
+
+            __m128i index = _mm_or_si128(_mm_and_si128(_mm_castps_si128(isX), _mm_set1_epi32(1)),
+                            _mm_or_si128(_mm_and_si128(_mm_castps_si128(isY), _mm_set1_epi32(2)), 
+                                         _mm_and_si128(_mm_castps_si128(isZ), _mm_set1_epi32(3))));
+
+            if constexpr (Bits == 32)
+            {
+                __m128i packed = _mm_or_si128(_mm_or_si128(_mm_slli_epi32(index, bits * 3), _mm_slli_epi32(levelA, bits * 2)),
+                                              _mm_or_si128(_mm_slli_epi32(levelB, bits), levelC));
+
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(out + block * 8), packed);
+            }
+            else
+            {
+                // The fields widened to 64 bits lanes, quaternions 0 and 1 in lo, 2 and 3 in hi
+                __m128i zero = _mm_setzero_si128();
+                __m128i countA = _mm_cvtsi32_si128(bits * 2);
+                __m128i countI = _mm_cvtsi32_si128(bits * 3);
+
+                __m128i lo = _mm_or_si128(_mm_or_si128(_mm_sll_epi64(_mm_unpacklo_epi32(index, zero), countI), _mm_sll_epi64(_mm_unpacklo_epi32(levelA, zero), countA)),
+                                          _mm_or_si128(_mm_slli_epi64(_mm_unpacklo_epi32(levelB, zero), bits), _mm_unpacklo_epi32(levelC, zero)));
+                __m128i hi = _mm_or_si128(_mm_or_si128(_mm_sll_epi64(_mm_unpackhi_epi32(index, zero), countI), _mm_sll_epi64(_mm_unpackhi_epi32(levelA, zero), countA)),
+                                          _mm_or_si128(_mm_slli_epi64(_mm_unpackhi_epi32(levelB, zero), bits), _mm_unpackhi_epi32(levelC, zero)));
+
+                if constexpr (Bits == 64)
+                {
+                    _mm_storeu_si128(reinterpret_cast<__m128i*>(out + block * 16), lo);
+                    _mm_storeu_si128(reinterpret_cast<__m128i*>(out + block * 16 + 8), hi);
+                }
+                else
+                {
+                    // 6 bytes each : the low 3 words of every lane
+                    alignas(16) std::uint16_t lanes[16];
+                    _mm_store_si128(reinterpret_cast<__m128i*>(lanes), lo);
+                    _mm_store_si128(reinterpret_cast<__m128i*>(lanes + 8), hi);
+
+                    std::uint16_t* dst = out + block * 12;
+                    for (std::size_t k = 0; k < 4; k++)
+                    {
+                        dst[k * 3 + 0] = lanes[k * 4 + 0];
+                        dst[k * 3 + 1] = lanes[k * 4 + 1];
+                        dst[k * 3 + 2] = lanes[k * 4 + 2];
+                    }
+                }
+            }
+        }
+
+        return blocks * 4;
+    }
+
+    // Unpacks quaternions 4 at a time : the 3 stored components are centered on 0 as integers and scaled back, 
+    // the dropped one is rebuilt from the length, 1, and each of the 4 output components is selected by the index, 
+    // before the 4 quaternions are transposed back. The 3 stored components are scaled back to a length of 1
+    // when the rounding brought them over it. The 48 bits version loads 8 bytes per quaternion, so it stops one quaternion early.
+    // Only handles count rounded down to a multiple of 4, and returns that number, the caller does the tail
+    template<std::size_t Bits>
+    inline std::size_t quatUnpackSmallestThree(const std::uint16_t* packed, float* quats, std::size_t count)
+    {
+        constexpr int bits = static_cast<int>((Bits - 2) / 3);
+        constexpr int maxLevel = (1 << bits) - 2;
+
+        const __m128i mask = _mm_set1_epi32((1 << bits) - 1);
+        const __m128i zeroLevel = _mm_set1_epi32(maxLevel / 2);
+        const __m128 scale = _mm_set1_ps(1.0f / (1.41421356f * static_cast<float>(maxLevel / 2)));
+        const __m128 one = _mm_set1_ps(1.0f);
+
+        std::size_t blocks = Bits == 48 ? (count > 0 ? (count - 1) / 4 : 0) : count / 4;
+
+        for (std::size_t block = 0; block < blocks; block++)
+        {
+            __m128i index, levelA, levelB, levelC;
+
+            if constexpr (Bits == 32)
+            {
+                __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(packed + block * 8));
+
+                index = _mm_srli_epi32(v, bits * 3);
+                levelA = _mm_and_si128(_mm_srli_epi32(v, bits * 2), mask);
+                levelB = _mm_and_si128(_mm_srli_epi32(v, bits), mask);
+                levelC = _mm_and_si128(v, mask);
+            }
+            else
+            {
+                // Quaternions 0 and 1 in the 64 bits lanes of lo, 2 and 3 in the ones of hi
+                __m128i lo, hi;
+
+                if constexpr (Bits == 64)
+                {
+                    lo = _mm_loadu_si128(reinterpret_cast<const __m128i*>(packed + block * 16));
+                    hi = _mm_loadu_si128(reinterpret_cast<const __m128i*>(packed + block * 16 + 8));
+                }
+                else
+                {
+                    const std::uint16_t* src = packed + block * 12;
+                    lo = _mm_unpacklo_epi64(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(src)), _mm_loadl_epi64(reinterpret_cast<const __m128i*>(src + 3)));
+                    hi = _mm_unpacklo_epi64(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(src + 6)), _mm_loadl_epi64(reinterpret_cast<const __m128i*>(src + 9)));
+                }
+
+                // The bits above the index are the next quaternion with 48 bits, so it is masked too
+                index = _mm_and_si128(lowHalves(lo, hi, bits * 3), _mm_set1_epi32(3));
+                levelA = _mm_and_si128(lowHalves(lo, hi, bits * 2), mask);
+                levelB = _mm_and_si128(lowHalves(lo, hi, bits), mask);
+                levelC = _mm_and_si128(lowHalves(lo, hi, 0), mask);
+            }
+
+            __m128 a = _mm_mul_ps(_mm_cvtepi32_ps(_mm_sub_epi32(levelA, zeroLevel)), scale);
+            __m128 b = _mm_mul_ps(_mm_cvtepi32_ps(_mm_sub_epi32(levelB, zeroLevel)), scale);
+            __m128 c = _mm_mul_ps(_mm_cvtepi32_ps(_mm_sub_epi32(levelC, zeroLevel)), scale);
+
+            __m128 lengthSq = _mm_add_ps(_mm_add_ps(_mm_mul_ps(a, a), _mm_mul_ps(b, b)), _mm_mul_ps(c, c));
+            __m128 dropped = _mm_sqrt_ps(_mm_max_ps(_mm_sub_ps(one, lengthSq), _mm_setzero_ps()));
+            __m128 invLength = _mm_div_ps(one, _mm_sqrt_ps(_mm_max_ps(lengthSq, one)));
+
+            a = _mm_mul_ps(a, invLength);
+            b = _mm_mul_ps(b, invLength);
+            c = _mm_mul_ps(c, invLength);
+
+            __m128 isW = _mm_castsi128_ps(_mm_cmpeq_epi32(index, _mm_setzero_si128()));
+            __m128 isX = _mm_castsi128_ps(_mm_cmpeq_epi32(index, _mm_set1_epi32(1)));
+            __m128 isY = _mm_castsi128_ps(_mm_cmpeq_epi32(index, _mm_set1_epi32(2)));
+            __m128 isZ = _mm_castsi128_ps(_mm_cmpeq_epi32(index, _mm_set1_epi32(3)));
+
+            // w : dropped or a, x : a, dropped or b, y : b, dropped or c, z : c or dropped
+            __m128 w = _mm_or_ps(_mm_and_ps(isW, dropped), _mm_andnot_ps(isW, a));
+            __m128 x = _mm_or_ps(_mm_and_ps(isW, a), _mm_andnot_ps(isW, _mm_or_ps(_mm_and_ps(isX, dropped), _mm_andnot_ps(isX, b))));
+            __m128 y = _mm_or_ps(_mm_and_ps(isZ, c), _mm_andnot_ps(isZ, _mm_or_ps(_mm_and_ps(isY, dropped), _mm_andnot_ps(isY, b))));
+            __m128 z = _mm_or_ps(_mm_and_ps(isZ, dropped), _mm_andnot_ps(isZ, c));
+
+            _MM_TRANSPOSE4_PS(w, x, y, z);
+
+            _mm_storeu_ps(quats + block * 16, w);
+            _mm_storeu_ps(quats + block * 16 + 4, x);
+            _mm_storeu_ps(quats + block * 16 + 8, y);
+            _mm_storeu_ps(quats + block * 16 + 12, z);
+        }
+
+        return blocks * 4;
+    }
+
+    #endif
+
+    #if defined(GLMATH_SIMD_AVX)
+
+    // Returns a * b + c, in one instruction if FMA is available
+    inline __m256d madd(__m256d a, __m256d b, __m256d c)
+    {
+        #if defined(GLMATH_SIMD_FMA)
+        return _mm256_fmadd_pd(a, b, c);
+        #else
+        return _mm256_add_pd(_mm256_mul_pd(a, b), c);
+        #endif
+    }
+
+    // Multiplies two column-major 4x4 double matrices, each column being one register.
+    // The 4 columns of a are loaded before anything is written, so out can be a or b.
+    inline void mat4Multiply(const double* a, const double* b, double* out)
+    {
+        __m256d a0 = _mm256_load_pd(a + 0);
+        __m256d a1 = _mm256_load_pd(a + 4);
+        __m256d a2 = _mm256_load_pd(a + 8);
+        __m256d a3 = _mm256_load_pd(a + 12);
+
+        for (int col = 0; col < 4; col++)
+        {
+            const double* bCol = b + col * 4;
+
+            __m256d res = _mm256_mul_pd(a0, _mm256_set1_pd(bCol[0]));
+            res = madd(a1, _mm256_set1_pd(bCol[1]), res);
+            res = madd(a2, _mm256_set1_pd(bCol[2]), res);
+            res = madd(a3, _mm256_set1_pd(bCol[3]), res);
+
+            _mm256_store_pd(out + col * 4, res);
+        }
+    }
+
+    // The double version of mat3x4Multiply. The values of a are copied first, so out can still be a or b.
+    inline void mat3x4Multiply(const double* a, const double* b, double* out)
+    {
+        __m256d b0 = _mm256_load_pd(b + 0);
+        __m256d b1 = _mm256_load_pd(b + 4);
+        __m256d b2 = _mm256_load_pd(b + 8);
+
+        double aValues[12];
+        for (int i = 0; i < 12; i++) aValues[i] = a[i];
+
+        for (int row = 0; row < 3; row++)
+        {
+            const double* aRow = aValues + row * 4;
+
+            __m256d res = _mm256_setr_pd(0.0, 0.0, 0.0, aRow[3]);
+            res = madd(_mm256_set1_pd(aRow[0]), b0, res);
+            res = madd(_mm256_set1_pd(aRow[1]), b1, res);
+            res = madd(_mm256_set1_pd(aRow[2]), b2, res);
+
+            _mm256_store_pd(out + row * 4, res);
+        }
+    }
+
+    // The double version of mat3aMultiply. The values of b are copied first, so out can still be a or b.
+    inline void mat3aMultiply(const double* a, const double* b, double* out)
+    {
+        __m256d a0 = _mm256_load_pd(a + 0);
+        __m256d a1 = _mm256_load_pd(a + 4);
+        __m256d a2 = _mm256_load_pd(a + 8);
+
+        double bValues[12];
+        for (int i = 0; i < 12; i++) bValues[i] = b[i];
+
+        for (int col = 0; col < 3; col++)
+        {
+            const double* bCol = bValues + col * 4;
+
+            __m256d res = _mm256_mul_pd(a0, _mm256_set1_pd(bCol[0]));
+            res = madd(a1, _mm256_set1_pd(bCol[1]), res);
+            res = madd(a2, _mm256_set1_pd(bCol[2]), res);
+
+            _mm256_store_pd(out + col * 4, res);
+        }
+    }
+
+    // Transposes the 4x4 double matrix held by r0, r1, r2 and r3
+    inline void transpose4(__m256d& r0, __m256d& r1, __m256d& r2, __m256d& r3)
+    {
+        __m256d t0 = _mm256_unpacklo_pd(r0, r1);
+        __m256d t1 = _mm256_unpackhi_pd(r0, r1);
+        __m256d t2 = _mm256_unpacklo_pd(r2, r3);
+        __m256d t3 = _mm256_unpackhi_pd(r2, r3);
+
+        r0 = _mm256_permute2f128_pd(t0, t2, 0x20);
+        r1 = _mm256_permute2f128_pd(t1, t3, 0x20);
+        r2 = _mm256_permute2f128_pd(t0, t2, 0x31);
+        r3 = _mm256_permute2f128_pd(t1, t3, 0x31);
+    }
+
+    // The double version of mat4ToMat3x4
+    inline void mat4ToMat3x4(const double* mats, double* out, std::size_t count)
+    {
+        for (std::size_t i = 0; i < count; i++)
+        {
+            const double* src = mats + i * 16;
+            double* dst = out + i * 12;
+
+            __m256d r0 = _mm256_load_pd(src + 0);
+            __m256d r1 = _mm256_load_pd(src + 4);
+            __m256d r2 = _mm256_load_pd(src + 8);
+            __m256d r3 = _mm256_load_pd(src + 12);
+
+            transpose4(r0, r1, r2, r3);
+
+            _mm256_store_pd(dst + 0, r0);
+            _mm256_store_pd(dst + 4, r1);
+            _mm256_store_pd(dst + 8, r2);
+        }
+    }
+
+    // The double version of mat3x4ToMat4
+    inline void mat3x4ToMat4(const double* mats, double* out, std::size_t count)
+    {
+        for (std::size_t i = 0; i < count; i++)
+        {
+            const double* src = mats + i * 12;
+            double* dst = out + i * 16;
+
+            __m256d c0 = _mm256_load_pd(src + 0);
+            __m256d c1 = _mm256_load_pd(src + 4);
+            __m256d c2 = _mm256_load_pd(src + 8);
+            __m256d c3 = _mm256_setr_pd(0.0, 0.0, 0.0, 1.0);
+
+            transpose4(c0, c1, c2, c3);
+
+            _mm256_store_pd(dst + 0, c0);
+            _mm256_store_pd(dst + 4, c1);
+            _mm256_store_pd(dst + 8, c2);
+            _mm256_store_pd(dst + 12, c3);
+        }
+    }
+
+    // Transforms aligned vec4<double> by a column-major 4x4 matrix, one vector per register.
+    // With isPoint, the w of each vector is used, else it is taken as 0. Handles every vector, and returns count.
+    inline std::size_t mat4TransformVec4(const double* mat, const double* in, double* out, std::size_t count, bool isPoint)
+    {
+        __m256d c0 = _mm256_load_pd(mat + 0);
+        __m256d c1 = _mm256_load_pd(mat + 4);
+        __m256d c2 = _mm256_load_pd(mat + 8);
+        __m256d c3 = isPoint ? _mm256_load_pd(mat + 12) : _mm256_setzero_pd();
+
+        for (std::size_t i = 0; i < count; i++)
+        {
+            const double* src = in + i * 4;
+
+            __m256d res = _mm256_mul_pd(c0, _mm256_set1_pd(src[0]));
+            res = madd(c1, _mm256_set1_pd(src[1]), res);
+            res = madd(c2, _mm256_set1_pd(src[2]), res);
+            res = madd(c3, _mm256_set1_pd(src[3]), res);
+
+            _mm256_store_pd(out + i * 4, res);
+        }
+
+        return count;
+    }
+
+    // The double version of frustumTestSpheres, 4 spheres per step
+    inline std::size_t frustumTestSpheres(const double* planes, const double* x, const double* y, const double* z, const double* radius, 
+                                          std::size_t count, std::uint64_t* mask)
+    {
+        std::size_t i = 0;
+
+        for (; i + 4 <= count; i += 4)
+        {
+            __m256d cx = _mm256_loadu_pd(x + i);
+            __m256d cy = _mm256_loadu_pd(y + i);
+            __m256d cz = _mm256_loadu_pd(z + i);
+            __m256d negRadius = _mm256_sub_pd(_mm256_setzero_pd(), _mm256_loadu_pd(radius + i));
+
+            __m256d inside = _mm256_castsi256_pd(_mm256_set1_epi64x(-1));
+
+            for (int p = 0; p < 6; p++)
+            {
+                const double* plane = planes + p * 4;
+
+                __m256d dist = madd(_mm256_set1_pd(plane[0]), cx, _mm256_set1_pd(plane[3]));
+                dist = madd(_mm256_set1_pd(plane[1]), cy, dist);
+                dist = madd(_mm256_set1_pd(plane[2]), cz, dist);
+
+                inside = _mm256_and_pd(inside, _mm256_cmp_pd(dist, negRadius, _CMP_NLT_UQ));
+            }
+
+            mask[i >> 6] |= static_cast<std::uint64_t>(_mm256_movemask_pd(inside)) << (i & 63);
+        }
+
+        return i;
+    }
+
+    // The double version of frustumTestAABBs, 4 boxes per step
+    inline std::size_t frustumTestAABBs(const double* planes, const double* centerX, const double* centerY, const double* centerZ, 
+                                        const double* extentX, const double* extentY, const double* extentZ, std::size_t count, std::uint64_t* mask)
+    {
+        double absNormals[6 * 3];
+        for (int p = 0; p < 6; p++)
+        {
+            absNormals[p * 3 + 0] = std::abs(planes[p * 4 + 0]);
+            absNormals[p * 3 + 1] = std::abs(planes[p * 4 + 1]);
+            absNormals[p * 3 + 2] = std::abs(planes[p * 4 + 2]);
+        }
+
+        std::size_t i = 0;
+
+        for (; i + 4 <= count; i += 4)
+        {
+            __m256d cx = _mm256_loadu_pd(centerX + i);
+            __m256d cy = _mm256_loadu_pd(centerY + i);
+            __m256d cz = _mm256_loadu_pd(centerZ + i);
+            __m256d ex = _mm256_loadu_pd(extentX + i);
+            __m256d ey = _mm256_loadu_pd(extentY + i);
+            __m256d ez = _mm256_loadu_pd(extentZ + i);
+
+            __m256d inside = _mm256_castsi256_pd(_mm256_set1_epi64x(-1));
+
+            for (int p = 0; p < 6; p++)
+            {
+                const double* plane = planes + p * 4;
+                const double* absNormal = absNormals + p * 3;
+
+                __m256d dist = madd(_mm256_set1_pd(plane[0]), cx, _mm256_set1_pd(plane[3]));
+                dist = madd(_mm256_set1_pd(plane[1]), cy, dist);
+                dist = madd(_mm256_set1_pd(plane[2]), cz, dist);
+
+                __m256d radius = _mm256_mul_pd(_mm256_set1_pd(absNormal[0]), ex);
+                radius = madd(_mm256_set1_pd(absNormal[1]), ey, radius);
+                radius = madd(_mm256_set1_pd(absNormal[2]), ez, radius);
+
+                inside = _mm256_and_pd(inside, _mm256_cmp_pd(dist, _mm256_sub_pd(_mm256_setzero_pd(), radius), _CMP_NLT_UQ));
+            }
+
+            mask[i >> 6] |= static_cast<std::uint64_t>(_mm256_movemask_pd(inside)) << (i & 63);
+        }
+
+        return i;
+    }
+
+
+    // The double versions of the structure-of-arrays kernels, 4 vectors per step
+
+    inline std::size_t soaDotProduct(const double* const* a, const double* const* b, std::size_t dimensions, double* out, std::size_t count)
+    {
+        std::size_t i = 0;
+
+        for (; i + 4 <= count; i += 4)
+        {
+            __m256d dot = _mm256_mul_pd(_mm256_loadu_pd(a[0] + i), _mm256_loadu_pd(b[0] + i));
+            for (std::size_t c = 1; c < dimensions; c++)
+            {
+                dot = madd(_mm256_loadu_pd(a[c] + i), _mm256_loadu_pd(b[c] + i), dot);
+            }
+
+            _mm256_storeu_pd(out + i, dot);
+        }
+
+        return i;
+    }
+
+    inline std::size_t soaLengths(const double* const* components, std::size_t dimensions, double* out, std::size_t count)
+    {
+        std::size_t i = soaDotProduct(components, components, dimensions, out, count);
+
+        for (std::size_t j = 0; j < i; j += 4)
+        {
+            _mm256_storeu_pd(out + j, _mm256_sqrt_pd(_mm256_loadu_pd(out + j)));
+        }
+
+        return i;
+    }
+
+    inline std::size_t soaNormalize(double* const* components, std::size_t dimensions, std::size_t count)
+    {
+        std::size_t i = 0;
+
+        for (; i + 4 <= count; i += 4)
+        {
+            __m256d lengthSq = _mm256_setzero_pd();
+            for (std::size_t c = 0; c < dimensions; c++)
+            {
+                __m256d v = _mm256_loadu_pd(components[c] + i);
+                lengthSq = madd(v, v, lengthSq);
+            }
+
+            __m256d one = _mm256_set1_pd(1.0);
+            __m256d isZero = _mm256_cmp_pd(lengthSq, _mm256_setzero_pd(), _CMP_LE_OQ);
+            __m256d invLength = _mm256_div_pd(one, _mm256_sqrt_pd(lengthSq));
+            invLength = _mm256_blendv_pd(invLength, one, isZero);
+
+            for (std::size_t c = 0; c < dimensions; c++)
+            {
+                _mm256_storeu_pd(components[c] + i, _mm256_mul_pd(_mm256_loadu_pd(components[c] + i), invLength));
+            }
+        }
+
+        return i;
+    }
+
+    inline std::size_t soaCrossProduct(const double* const* a, const double* const* b, double* const* out, std::size_t count)
+    {
+        std::size_t i = 0;
+
+        for (; i + 4 <= count; i += 4)
+        {
+            __m256d ax = _mm256_loadu_pd(a[0] + i), ay = _mm256_loadu_pd(a[1] + i), az = _mm256_loadu_pd(a[2] + i);
+            __m256d bx = _mm256_loadu_pd(b[0] + i), by = _mm256_loadu_pd(b[1] + i), bz = _mm256_loadu_pd(b[2] + i);
+
+            _mm256_storeu_pd(out[0] + i, _mm256_sub_pd(_mm256_mul_pd(ay, bz), _mm256_mul_pd(az, by)));
+            _mm256_storeu_pd(out[1] + i, _mm256_sub_pd(_mm256_mul_pd(az, bx), _mm256_mul_pd(ax, bz)));
+            _mm256_storeu_pd(out[2] + i, _mm256_sub_pd(_mm256_mul_pd(ax, by), _mm256_mul_pd(ay, bx)));
+        }
+
+        return i;
+    }
+
+    inline std::size_t soaLerp(const double* a, const double* b, double t, double* out, std::size_t count)
+    {
+        std::size_t i = 0;
+
+        __m256d t4 = _mm256_set1_pd(t);
+        for (; i + 4 <= count; i += 4)
+        {
+            __m256d start = _mm256_loadu_pd(a + i);
+            _mm256_storeu_pd(out + i, madd(_mm256_sub_pd(_mm256_loadu_pd(b + i), start), t4, start));
+        }
+
+        return i;
+    }
+
+    inline std::size_t soaMinMax(const double* a, const double* b, double* out, std::size_t count, bool max)
+    {
+        std::size_t i = 0;
+
+        for (; i + 4 <= count; i += 4)
+        {
+            __m256d va = _mm256_loadu_pd(a + i);
+            __m256d vb = _mm256_loadu_pd(b + i);
+            _mm256_storeu_pd(out + i, max ? _mm256_max_pd(va, vb) : _mm256_min_pd(va, vb));
+        }
+
+        return i;
+    }
+
+    inline std::size_t soaTransform(const double* mat, const double* const* in, std::size_t inDimensions, double w, 
+                                    double* const* out, std::size_t outDimensions, bool perspectiveDivide, std::size_t count)
+    {
+        std::size_t rows = perspectiveDivide ? 4 : outDimensions;
+
+        std::size_t i = 0;
+
+        for (; i + 4 <= count; i += 4)
+        {
+            __m256d x = _mm256_loadu_pd(in[0] + i);
+            __m256d y = _mm256_loadu_pd(in[1] + i);
+            __m256d z = _mm256_loadu_pd(in[2] + i);
+            __m256d vw = inDimensions == 4 ? _mm256_loadu_pd(in[3] + i) : _mm256_set1_pd(w);
+
+            __m256d res[4];
+            for (std::size_t r = 0; r < rows; r++)
+            {
+                res[r] = _mm256_mul_pd(_mm256_set1_pd(mat[r]), x);
+                res[r] = madd(_mm256_set1_pd(mat[4 + r]), y, res[r]);
+                res[r] = madd(_mm256_set1_pd(mat[8 + r]), z, res[r]);
+                res[r] = madd(_mm256_set1_pd(mat[12 + r]), vw, res[r]);
+            }
+
+            if (perspectiveDivide)
+            {
+                __m256d invW = _mm256_div_pd(_mm256_set1_pd(1.0), res[3]);
+                for (std::size_t r = 0; r < 3; r++) res[r] = _mm256_mul_pd(res[r], invW);
+            }
+
+            for (std::size_t r = 0; r < outDimensions; r++)
+            {
+                _mm256_storeu_pd(out[r] + i, res[r]);
+            }
+        }
+
+        return i;
+    }
+
+    #endif
+
+    // The registers behind the lane types (lanes<float, 4>, lanes<double, 4>...), and their operations, one overload per register. 
+    // The comparisons return masks in the same register type, all bits set in the lanes where they are true
+    struct noLaneRegister {};
+
+    template<typename T, std::size_t W>
+    struct laneRegister { using type = noLaneRegister; };
+
+    template<typename T, std::size_t W>
+    typename laneRegister<T, W>::type laneSet(T value) = delete;
+    template<typename T, std::size_t W>
+    typename laneRegister<T, W>::type laneLoad(const T* ptr) = delete;
+
+    // Like the kernels at the top, declared for noLaneRegister so that the names exist even without SIMD
+    void laneStore(float* ptr, noLaneRegister a) = delete;
+    noLaneRegister laneAdd(noLaneRegister a, noLaneRegister b) = delete;
+    noLaneRegister laneSub(noLaneRegister a, noLaneRegister b) = delete;
+    noLaneRegister laneMul(noLaneRegister a, noLaneRegister b) = delete;
+    noLaneRegister laneDiv(noLaneRegister a, noLaneRegister b) = delete;
+    noLaneRegister laneSqrt(noLaneRegister a) = delete;
+    noLaneRegister laneMin(noLaneRegister a, noLaneRegister b) = delete;
+    noLaneRegister laneMax(noLaneRegister a, noLaneRegister b) = delete;
+    noLaneRegister laneAnd(noLaneRegister a, noLaneRegister b) = delete;
+    noLaneRegister laneOr(noLaneRegister a, noLaneRegister b) = delete;
+    noLaneRegister laneXor(noLaneRegister a, noLaneRegister b) = delete;
+    noLaneRegister laneAndNot(noLaneRegister a, noLaneRegister b) = delete;
+    noLaneRegister laneCmpLt(noLaneRegister a, noLaneRegister b) = delete;
+    noLaneRegister laneCmpLe(noLaneRegister a, noLaneRegister b) = delete;
+    noLaneRegister laneCmpEq(noLaneRegister a, noLaneRegister b) = delete;
+    noLaneRegister laneCmpNeq(noLaneRegister a, noLaneRegister b) = delete;
+    int laneMoveMask(noLaneRegister a) = delete;
+    noLaneRegister laneSelect(noLaneRegister mask, noLaneRegister a, noLaneRegister b) = delete;
+    noLaneRegister laneRsqrtFast(noLaneRegister a) = delete;
+    double laneSum(noLaneRegister a) = delete;
+    double laneSum3(noLaneRegister a) = delete;
+    noLaneRegister crossProduct(noLaneRegister a, noLaneRegister b) = delete;
+    void laneTranspose4(noLaneRegister& a, noLaneRegister& b, noLaneRegister& c, noLaneRegister& d) = delete;
+    noLaneRegister laneRound(noLaneRegister a) = delete;
+    noLaneRegister lanePow2(noLaneRegister n) = delete;
+    noLaneRegister laneExponent(noLaneRegister a) = delete;
+
+    #if defined(GLMATH_SIMD_SSE2)
+
+    template<> struct laneRegister<float, 4>  { using type = __m128; };
+    template<> struct laneRegister<double, 2> { using type = __m128d; };
+
+    template<> inline __m128 laneSet<float, 4>(float value)         { return _mm_set1_ps(value); }
+    template<> inline __m128 laneLoad<float, 4>(const float* ptr)   { return _mm_loadu_ps(ptr); }
+    inline void laneStore(float* ptr, __m128 a)                     { _mm_storeu_ps(ptr, a); }
+
+    inline __m128 laneAdd(__m128 a, __m128 b)       { return _mm_add_ps(a, b); }
+    inline __m128 laneSub(__m128 a, __m128 b)       { return _mm_sub_ps(a, b); }
+    inline __m128 laneMul(__m128 a, __m128 b)       { return _mm_mul_ps(a, b); }
+    inline __m128 laneDiv(__m128 a, __m128 b)       { return _mm_div_ps(a, b); }
+    inline __m128 laneSqrt(__m128 a)                { return _mm_sqrt_ps(a); }
+    inline __m128 laneMin(__m128 a, __m128 b)       { return _mm_min_ps(a, b); }
+    inline __m128 laneMax(__m128 a, __m128 b)       { return _mm_max_ps(a, b); }
+    inline __m128 laneAnd(__m128 a, __m128 b)       { return _mm_and_ps(a, b); }
+    inline __m128 laneOr(__m128 a, __m128 b)        { return _mm_or_ps(a, b); }
+    inline __m128 laneXor(__m128 a, __m128 b)       { return _mm_xor_ps(a, b); }
+    inline __m128 laneAndNot(__m128 a, __m128 b)    { return _mm_andnot_ps(a, b); }
+    inline __m128 laneCmpLt(__m128 a, __m128 b)     { return _mm_cmplt_ps(a, b); }
+    inline __m128 laneCmpLe(__m128 a, __m128 b)     { return _mm_cmple_ps(a, b); }
+    inline __m128 laneCmpEq(__m128 a, __m128 b)     { return _mm_cmpeq_ps(a, b); }
+    inline __m128 laneCmpNeq(__m128 a, __m128 b)    { return _mm_cmpneq_ps(a, b); }
+    inline int laneMoveMask(__m128 a)               { return _mm_movemask_ps(a); }
+    // mask ? a : b
+    inline __m128 laneSelect(__m128 mask, __m128 a, __m128 b) { return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b)); }
+    inline __m128 laneRsqrtFast(__m128 a)           { return rsqrtNewton(a); }
+    // The 4 registers as the rows of a 4x4 matrix, transposed in place
+    inline void laneTranspose4(__m128& a, __m128& b, __m128& c, __m128& d) { _MM_TRANSPOSE4_PS(a, b, c, d); }
+
+    // The sum of the 4 lanes, and of the 3 first ones
+    inline float laneSum(__m128 a)
+    {
+        __m128 sum = _mm_add_ps(a, _mm_movehl_ps(a, a));
+        return _mm_cvtss_f32(_mm_add_ss(sum, _mm_shuffle_ps(sum, sum, _MM_SHUFFLE(1, 1, 1, 1))));
+    }
+    inline float laneSum3(__m128 a)
+    {
+        __m128 sum = _mm_add_ss(a, _mm_shuffle_ps(a, a, _MM_SHUFFLE(1, 1, 1, 1)));
+        return _mm_cvtss_f32(_mm_add_ss(sum, _mm_movehl_ps(a, a)));
+    }
+
+    // The building blocks of glMath::fast : the nearest integer (ties to even, for |a| < 2^31), 
+    // 2^n for an integral n in the normal range [-126, 127], built from its exponent bits, 
+    // and the unbiased exponent of a positive normal value, so floor(log2(a))
+    inline __m128 laneRound(__m128 a)               { return _mm_cvtepi32_ps(_mm_cvtps_epi32(a)); }
+    inline __m128 lanePow2(__m128 n)                { return _mm_castsi128_ps(_mm_slli_epi32(_mm_add_epi32(_mm_cvtps_epi32(n), _mm_set1_epi32(127)), 23)); }
+    inline __m128 laneExponent(__m128 a)            { return _mm_cvtepi32_ps(_mm_sub_epi32(_mm_srli_epi32(_mm_castps_si128(a), 23), _mm_set1_epi32(127))); }
+
+    template<> inline __m128d laneSet<double, 2>(double value)      { return _mm_set1_pd(value); }
+    template<> inline __m128d laneLoad<double, 2>(const double* ptr) { return _mm_loadu_pd(ptr); }
+    inline void laneStore(double* ptr, __m128d a)                   { _mm_storeu_pd(ptr, a); }
+
+    inline __m128d laneAdd(__m128d a, __m128d b)    { return _mm_add_pd(a, b); }
+    inline __m128d laneSub(__m128d a, __m128d b)    { return _mm_sub_pd(a, b); }
+    inline __m128d laneMul(__m128d a, __m128d b)    { return _mm_mul_pd(a, b); }
+    inline __m128d laneDiv(__m128d a, __m128d b)    { return _mm_div_pd(a, b); }
+    inline __m128d laneSqrt(__m128d a)              { return _mm_sqrt_pd(a); }
+    inline __m128d laneMin(__m128d a, __m128d b)    { return _mm_min_pd(a, b); }
+    inline __m128d laneMax(__m128d a, __m128d b)    { return _mm_max_pd(a, b); }
+    inline __m128d laneAnd(__m128d a, __m128d b)    { return _mm_and_pd(a, b); }
+    inline __m128d laneOr(__m128d a, __m128d b)     { return _mm_or_pd(a, b); }
+    inline __m128d laneXor(__m128d a, __m128d b)    { return _mm_xor_pd(a, b); }
+    inline __m128d laneAndNot(__m128d a, __m128d b) { return _mm_andnot_pd(a, b); }
+    inline __m128d laneCmpLt(__m128d a, __m128d b)  { return _mm_cmplt_pd(a, b); }
+    inline __m128d laneCmpLe(__m128d a, __m128d b)  { return _mm_cmple_pd(a, b); }
+    inline __m128d laneCmpEq(__m128d a, __m128d b)  { return _mm_cmpeq_pd(a, b); }
+    inline __m128d laneCmpNeq(__m128d a, __m128d b) { return _mm_cmpneq_pd(a, b); }
+    inline int laneMoveMask(__m128d a)              { return _mm_movemask_pd(a); }
+    inline __m128d laneSelect(__m128d mask, __m128d a, __m128d b) { return _mm_or_pd(_mm_and_pd(mask, a), _mm_andnot_pd(mask, b)); }
+
+    // The same with doubles, n being in [-1022, 1023]. The exponents go through 32 bits integers, SSE2 has no 64 bits conversion
+    inline __m128d laneRound(__m128d a)             { return _mm_cvtepi32_pd(_mm_cvtpd_epi32(a)); }
+    inline __m128d lanePow2(__m128d n)
+    {
+        __m128i biased = _mm_add_epi32(_mm_cvtpd_epi32(n), _mm_set1_epi32(1023));
+        return _mm_castsi128_pd(_mm_slli_epi64(_mm_unpacklo_epi32(biased, _mm_setzero_si128()), 52));
+    }
+    inline __m128d laneExponent(__m128d a)
+    {
+        __m128i biased = _mm_shuffle_epi32(_mm_srli_epi64(_mm_castpd_si128(a), 52), _MM_SHUFFLE(3, 1, 2, 0));
+        return _mm_cvtepi32_pd(_mm_sub_epi32(biased, _mm_set1_epi32(1023)));
+    }
+
+    #endif
+
+    #if defined(GLMATH_SIMD_AVX)
+
+    template<> struct laneRegister<float, 8>  { using type = __m256; };
+    template<> struct laneRegister<double, 4> { using type = __m256d; };
+
+    template<> inline __m256 laneSet<float, 8>(float value)         { return _mm256_set1_ps(value); }
+    template<> inline __m256 laneLoad<float, 8>(const float* ptr)   { return _mm256_loadu_ps(ptr); }
+    inline void laneStore(float* ptr, __m256 a)                     { _mm256_storeu_ps(ptr, a); }
+
+    inline __m256 laneAdd(__m256 a, __m256 b)       { return _mm256_add_ps(a, b); }
+    inline __m256 laneSub(__m256 a, __m256 b)       { return _mm256_sub_ps(a, b); }
+    inline __m256 laneMul(__m256 a, __m256 b)       { return _mm256_mul_ps(a, b); }
+    inline __m256 laneDiv(__m256 a, __m256 b)       { return _mm256_div_ps(a, b); }
+    inline __m256 laneSqrt(__m256 a)                { return _mm256_sqrt_ps(a); }
+    inline __m256 laneMin(__m256 a, __m256 b)       { return _mm256_min_ps(a, b); }
+    inline __m256 laneMax(__m256 a, __m256 b)       { return _mm256_max_ps(a, b); }
+    inline __m256 laneAnd(__m256 a, __m256 b)       { return _mm256_and_ps(a, b); }
+    inline __m256 laneOr(__m256 a, __m256 b)        { return _mm256_or_ps(a, b); }
+    inline __m256 laneXor(__m256 a, __m256 b)       { return _mm256_xor_ps(a, b); }
+    inline __m256 laneAndNot(__m256 a, __m256 b)    { return _mm256_andnot_ps(a, b); }
+    inline __m256 laneCmpLt(__m256 a, __m256 b)     { return _mm256_cmp_ps(a, b, _CMP_LT_OQ); }
+    inline __m256 laneCmpLe(__m256 a, __m256 b)     { return _mm256_cmp_ps(a, b, _CMP_LE_OQ); }
+    inline __m256 laneCmpEq(__m256 a, __m256 b)     { return _mm256_cmp_ps(a, b, _CMP_EQ_OQ); }
+    inline __m256 laneCmpNeq(__m256 a, __m256 b)    { return _mm256_cmp_ps(a, b, _CMP_NEQ_UQ); }
+    inline int laneMoveMask(__m256 a)               { return _mm256_movemask_ps(a); }
+    inline __m256 laneSelect(__m256 mask, __m256 a, __m256 b) { return _mm256_blendv_ps(b, a, mask); }
+    inline __m256 laneRsqrtFast(__m256 a)           { return rsqrtNewton(a); }
+
+    // AVX has no 256 bits integer operations before AVX2, so the exponent bits are shifted in two halves
+    inline __m256 laneRound(__m256 a)               { return _mm256_round_ps(a, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC); }
+    inline __m256 lanePow2(__m256 n)
+    {
+        __m256i biased = _mm256_cvtps_epi32(n);
+
+        #if defined(__AVX2__)
+        return _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_add_epi32(biased, _mm256_set1_epi32(127)), 23));
+        #else
+        __m128i low = _mm_slli_epi32(_mm_add_epi32(_mm256_castsi256_si128(biased), _mm_set1_epi32(127)), 23);
+        __m128i high = _mm_slli_epi32(_mm_add_epi32(_mm256_extractf128_si256(biased, 1), _mm_set1_epi32(127)), 23);
+        return _mm256_castsi256_ps(_mm256_insertf128_si256(_mm256_castsi128_si256(low), high, 1));
+        #endif
+    }
+    inline __m256 laneExponent(__m256 a)
+    {
+        __m256i bits = _mm256_castps_si256(a);
+
+        #if defined(__AVX2__)
+        return _mm256_cvtepi32_ps(_mm256_sub_epi32(_mm256_srli_epi32(bits, 23), _mm256_set1_epi32(127)));
+        #else
+        __m128i low = _mm_sub_epi32(_mm_srli_epi32(_mm256_castsi256_si128(bits), 23), _mm_set1_epi32(127));
+        __m128i high = _mm_sub_epi32(_mm_srli_epi32(_mm256_extractf128_si256(bits, 1), 23), _mm_set1_epi32(127));
+        return _mm256_cvtepi32_ps(_mm256_insertf128_si256(_mm256_castsi128_si256(low), high, 1));
+        #endif
+    }
+
+    template<> inline __m256d laneSet<double, 4>(double value)      { return _mm256_set1_pd(value); }
+    template<> inline __m256d laneLoad<double, 4>(const double* ptr) { return _mm256_loadu_pd(ptr); }
+    inline void laneStore(double* ptr, __m256d a)                   { _mm256_storeu_pd(ptr, a); }
+
+    inline __m256d laneAdd(__m256d a, __m256d b)    { return _mm256_add_pd(a, b); }
+    inline __m256d laneSub(__m256d a, __m256d b)    { return _mm256_sub_pd(a, b); }
+    inline __m256d laneMul(__m256d a, __m256d b)    { return _mm256_mul_pd(a, b); }
+    inline __m256d laneDiv(__m256d a, __m256d b)    { return _mm256_div_pd(a, b); }
+    inline __m256d laneSqrt(__m256d a)              { return _mm256_sqrt_pd(a); }
+    inline __m256d laneMin(__m256d a, __m256d b)    { return _mm256_min_pd(a, b); }
+    inline __m256d laneMax(__m256d a, __m256d b)    { return _mm256_max_pd(a, b); }
+    inline __m256d laneAnd(__m256d a, __m256d b)    { return _mm256_and_pd(a, b); }
+    inline __m256d laneOr(__m256d a, __m256d b)     { return _mm256_or_pd(a, b); }
+    inline __m256d laneXor(__m256d a, __m256d b)    { return _mm256_xor_pd(a, b); }
+    inline __m256d laneAndNot(__m256d a, __m256d b) { return _mm256_andnot_pd(a, b); }
+    inline __m256d laneCmpLt(__m256d a, __m256d b)  { return _mm256_cmp_pd(a, b, _CMP_LT_OQ); }
+    inline __m256d laneCmpLe(__m256d a, __m256d b)  { return _mm256_cmp_pd(a, b, _CMP_LE_OQ); }
+    inline __m256d laneCmpEq(__m256d a, __m256d b)  { return _mm256_cmp_pd(a, b, _CMP_EQ_OQ); }
+    inline __m256d laneCmpNeq(__m256d a, __m256d b) { return _mm256_cmp_pd(a, b, _CMP_NEQ_UQ); }
+    inline int laneMoveMask(__m256d a)              { return _mm256_movemask_pd(a); }
+    inline __m256d laneSelect(__m256d mask, __m256d a, __m256d b) { return _mm256_blendv_pd(b, a, mask); }
+    // The 4 registers as the rows of a 4x4 matrix, transposed in place
+    inline void laneTranspose4(__m256d& a, __m256d& b, __m256d& c, __m256d& d)
+    {
+        __m256d ab02 = _mm256_unpacklo_pd(a, b); // (a0 b0 a2 b2)
+        __m256d ab13 = _mm256_unpackhi_pd(a, b); // (a1 b1 a3 b3)
+        __m256d cd02 = _mm256_unpacklo_pd(c, d);
+        __m256d cd13 = _mm256_unpackhi_pd(c, d);
+
+        a = _mm256_permute2f128_pd(ab02, cd02, 0x20);
+        b = _mm256_permute2f128_pd(ab13, cd13, 0x20);
+        c = _mm256_permute2f128_pd(ab02, cd02, 0x31);
+        d = _mm256_permute2f128_pd(ab13, cd13, 0x31);
+    }
+
+    inline __m256d laneRound(__m256d a)             { return _mm256_round_pd(a, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC); }
+    inline __m256d lanePow2(__m256d n)
+    {
+        __m128i biased = _mm_add_epi32(_mm256_cvtpd_epi32(n), _mm_set1_epi32(1023));
+
+        __m128i low = _mm_slli_epi64(_mm_unpacklo_epi32(biased, _mm_setzero_si128()), 52);
+        __m128i high = _mm_slli_epi64(_mm_unpackhi_epi32(biased, _mm_setzero_si128()), 52);
+        return _mm256_castsi256_pd(_mm256_insertf128_si256(_mm256_castsi128_si256(low), high, 1));
+    }
+    inline __m256d laneExponent(__m256d a)
+    {
+        __m256i bits = _mm256_castpd_si256(a);
+
+        __m128i low = _mm_shuffle_epi32(_mm_srli_epi64(_mm256_castsi256_si128(bits), 52), _MM_SHUFFLE(3, 1, 2, 0));
+        __m128i high = _mm_shuffle_epi32(_mm_srli_epi64(_mm256_extractf128_si256(bits, 1), 52), _MM_SHUFFLE(3, 1, 2, 0));
+        return _mm256_cvtepi32_pd(_mm_sub_epi32(_mm_unpacklo_epi64(low, high), _mm_set1_epi32(1023)));
+    }
+
+    // The sum of the 4 lanes, and of the 3 first ones
+    inline double laneSum(__m256d a)
+    {
+        __m128d sum = _mm_add_pd(_mm256_castpd256_pd128(a), _mm256_extractf128_pd(a, 1));
+        return _mm_cvtsd_f64(_mm_add_sd(sum, _mm_unpackhi_pd(sum, sum)));
+    }
+    inline double laneSum3(__m256d a)
+    {
+        __m128d low = _mm256_castpd256_pd128(a);
+        __m128d sum = _mm_add_sd(low, _mm_unpackhi_pd(low, low));
+        return _mm_cvtsd_f64(_mm_add_sd(sum, _mm256_extractf128_pd(a, 1)));
+    }
+
+    // (x, y, z, w) -> (y, z, x, w), to compute cross products with a whole vector in one register like for __m128
+    inline __m256d swizzleYZX(__m256d a)
+    {
+        #if defined(__AVX2__)
+        return _mm256_permute4x64_pd(a, _MM_SHUFFLE(3, 0, 2, 1));
+        #else
+        __m256d zwxy = _mm256_permute2f128_pd(a, a, 0x1);
+        __m256d yz = _mm256_shuffle_pd(a, zwxy, 0x1);   // (y, z, w, x)
+        __m256d xw = _mm256_blend_pd(zwxy, a, 0x8);     // (z, w, x, w)
+        return _mm256_blend_pd(yz, xw, 0xC);
+        #endif
+    }
+
+    // The cross product of the xyz lanes of a and b, the w lane stays 0 if it is 0 in a and b
+    inline __m256d crossProduct(__m256d a, __m256d b)
+    {
+        __m256d res = _mm256_sub_pd(_mm256_mul_pd(a, swizzleYZX(b)), _mm256_mul_pd(swizzleYZX(a), b));
+        return swizzleYZX(res);
+    }
+
+    #endif
+
+    // The vec4 dot products, with a whole vec4 in one register (__m256d for vec4<double>), multiplied at once
+    // then added horizontally, the *3 versions ignoring w. See hasVec4DotKernel for the types they are used for
+    template<typename T>
+    inline T vec4Dot(const T* a, const T* b)                    { return laneSum(laneMul(laneLoad<T, 4>(a), laneLoad<T, 4>(b))); }
+    template<typename T>
+    inline T vec4Dot3(const T* a, const T* b)                   { return laneSum3(laneMul(laneLoad<T, 4>(a), laneLoad<T, 4>(b))); }
+
+    template<typename T>
+    inline T vec4DistanceSquared(const T* a, const T* b)
+    {
+        auto diff = laneSub(laneLoad<T, 4>(b), laneLoad<T, 4>(a));
+        return laneSum(laneMul(diff, diff));
+    }
+    template<typename T>
+    inline T vec4DistanceSquared3(const T* a, const T* b)
+    {
+        auto diff = laneSub(laneLoad<T, 4>(b), laneLoad<T, 4>(a));
+        return laneSum3(laneMul(diff, diff));
+    }
+
+    // The vec3a operations, with a whole vec3a in one register (__m128 for float, __m256d for double).
+    // The padding lane is 0 in the inputs and every kernel keeps it at 0 in out. See hasVec3aKernel
+    template<typename T>
+    inline void vec3aAdd(const T* a, const T* b, T* out)        { laneStore(out, laneAdd(laneLoad<T, 4>(a), laneLoad<T, 4>(b))); }
+    template<typename T>
+    inline void vec3aSub(const T* a, const T* b, T* out)        { laneStore(out, laneSub(laneLoad<T, 4>(a), laneLoad<T, 4>(b))); }
+    template<typename T>
+    inline void vec3aMul(const T* a, const T* b, T* out)        { laneStore(out, laneMul(laneLoad<T, 4>(a), laneLoad<T, 4>(b))); }
+    template<typename T>
+    inline void vec3aMin(const T* a, const T* b, T* out)        { laneStore(out, laneMin(laneLoad<T, 4>(a), laneLoad<T, 4>(b))); }
+    template<typename T>
+    inline void vec3aMax(const T* a, const T* b, T* out)        { laneStore(out, laneMax(laneLoad<T, 4>(a), laneLoad<T, 4>(b))); }
+    template<typename T>
+    inline void vec3aScale(const T* a, T scalar, T* out)        { laneStore(out, laneMul(laneLoad<T, 4>(a), laneSet<T, 4>(scalar))); }
+    template<typename T>
+    inline void vec3aNegate(const T* a, T* out)                 { laneStore(out, laneSub(laneSet<T, 4>(static_cast<T>(0.0)), laneLoad<T, 4>(a))); }
+    template<typename T>
+    inline void vec3aCross(const T* a, const T* b, T* out)      { laneStore(out, crossProduct(laneLoad<T, 4>(a), laneLoad<T, 4>(b))); }
+
+    // a + scalar, the scalar being added to x, y and z only
+    template<typename T>
+    inline void vec3aAddScalar(const T* a, T scalar, T* out)
+    {
+        const T scalars[4] = { scalar, scalar, scalar, static_cast<T>(0.0) };
+        laneStore(out, laneAdd(laneLoad<T, 4>(a), laneLoad<T, 4>(scalars)));
+    }
+
+    // a + (b - a) * t
+    template<typename T>
+    inline void vec3aLerp(const T* a, const T* b, T t, T* out)
+    {
+        auto start = laneLoad<T, 4>(a);
+        laneStore(out, laneAdd(start, laneMul(laneSub(laneLoad<T, 4>(b), start), laneSet<T, 4>(t))));
+    }
+
+    // Transforms vec3a by a column-major 4x4 matrix, one vector per register. With isPoint, w is 1, else it is 0.
+    // The w row of the matrix is cleared so that the padding of the results stays 0, and with perspectiveDivide
+    // it is computed on its own. Handles every vector, and returns count. in and out can be the same array
+    template<typename T>
+    inline std::size_t mat4TransformVec3a(const T* mat, const T* in, T* out, std::size_t count, bool isPoint, bool perspectiveDivide)
+    {
+        const T wLane[4] = { static_cast<T>(0.0), static_cast<T>(0.0), static_cast<T>(0.0), static_cast<T>(1.0) };
+
+        auto zero = laneSet<T, 4>(static_cast<T>(0.0));
+        auto xyzMask = laneCmpEq(laneLoad<T, 4>(wLane), zero);
+
+        auto c0 = laneAnd(laneLoad<T, 4>(mat + 0), xyzMask);
+        auto c1 = laneAnd(laneLoad<T, 4>(mat + 4), xyzMask);
+        auto c2 = laneAnd(laneLoad<T, 4>(mat + 8), xyzMask);
+        auto c3 = isPoint ? laneAnd(laneLoad<T, 4>(mat + 12), xyzMask) : zero;
+
+        T w3 = isPoint ? mat[15] : static_cast<T>(0.0);
+
+        for (std::size_t i = 0; i < count; i++)
+        {
+            const T* src = in + i * 4;
+
+            auto res = laneAdd(laneMul(c0, laneSet<T, 4>(src[0])), laneMul(c1, laneSet<T, 4>(src[1])));
+            res = laneAdd(res, laneAdd(laneMul(c2, laneSet<T, 4>(src[2])), c3));
+
+            if (perspectiveDivide)
+            {
+                T w = mat[3] * src[0] + mat[7] * src[1] + mat[11] * src[2] + w3;
+                res = laneMul(res, laneSet<T, 4>(static_cast<T>(1.0) / w));
+            }
+
+            laneStore(out + i * 4, res);
+        }
+
+        return count;
+    }
+
+    // Transposes a, b, c and d, then stores them at dst, dst + stride, dst + 2 * stride and dst + 3 * stride
+    template<typename T, typename R>
+    inline void storeTransposed4(T* dst, std::size_t stride, R a, R b, R c, R d)
+    {
+        laneTranspose4(a, b, c, d);
+
+        laneStore(dst, a);
+        laneStore(dst + stride, b);
+        laneStore(dst + stride * 2, c);
+        laneStore(dst + stride * 3, d);
+    }
+
+    // Converts quaternions stored as structure-of-arrays (quat[0] the w, quat[1] the x...) to rotation matrices, 4 per step :
+    // each register holds one entry of 4 matrices, then the registers are transposed 4 by 4 so that each one holds
+    // a row or a column of one matrix, ready to be stored. translation and scale are x, y, z arrays too, and can be nullptr
+    // (no translation, a scale of 1), the columns of the rotation being scaled like translate * rotation * scale.
+    // outSize is the layout of out : 16 for column-major mat4, 12 for the rows of mat3x4, 9 for column-major mat3.
+    // Only handles count rounded down to a multiple of 4, and returns that number, the caller does the tail
+    template<typename T>
+    inline std::size_t quatToMatrices(const T* const* quat, const T* const* translation, const T* const* scale, 
+                                      T* out, std::size_t count, std::size_t outSize)
+    {
+        using reg = decltype(laneSet<T, 4>(static_cast<T>(0.0)));
+
+        reg zero = laneSet<T, 4>(static_cast<T>(0.0));
+        reg one = laneSet<T, 4>(static_cast<T>(1.0));
+
+        std::size_t blocks = count / 4;
+
+        for (std::size_t block = 0; block < blocks; block++)
+        {
+            std::size_t i = block * 4;
+
+            reg w = laneLoad<T, 4>(quat[0] + i);
+            reg x = laneLoad<T, 4>(quat[1] + i);
+            reg y = laneLoad<T, 4>(quat[2] + i);
+            reg z = laneLoad<T, 4>(quat[3] + i);
+
+            reg x2 = laneAdd(x, x);
+            reg y2 = laneAdd(y, y);
+            reg z2 = laneAdd(z, z);
+
+            reg xx = laneMul(x, x2); reg yy = laneMul(y, y2); reg zz = laneMul(z, z2);
+            reg xy = laneMul(x, y2); reg xz = laneMul(x, z2); reg yz = laneMul(y, z2);
+            reg wx = laneMul(w, x2); reg wy = laneMul(w, y2); reg wz = laneMul(w, z2);
+
+            reg m00 = laneSub(one, laneAdd(yy, zz)); reg m01 = laneSub(xy, wz);                reg m02 = laneAdd(xz, wy);
+            reg m10 = laneAdd(xy, wz);               reg m11 = laneSub(one, laneAdd(xx, zz)); reg m12 = laneSub(yz, wx);
+            reg m20 = laneSub(xz, wy);               reg m21 = laneAdd(yz, wx);               reg m22 = laneSub(one, laneAdd(xx, yy));
+
+            if (scale)
+            {
+                reg sx = laneLoad<T, 4>(scale[0] + i);
+                reg sy = laneLoad<T, 4>(scale[1] + i);
+                reg sz = laneLoad<T, 4>(scale[2] + i);
+
+                m00 = laneMul(m00, sx); m01 = laneMul(m01, sy); m02 = laneMul(m02, sz);
+                m10 = laneMul(m10, sx); m11 = laneMul(m11, sy); m12 = laneMul(m12, sz);
+                m20 = laneMul(m20, sx); m21 = laneMul(m21, sy); m22 = laneMul(m22, sz);
+            }
+
+            reg tx = translation ? laneLoad<T, 4>(translation[0] + i) : zero;
+            reg ty = translation ? laneLoad<T, 4>(translation[1] + i) : zero;
+            reg tz = translation ? laneLoad<T, 4>(translation[2] + i) : zero;
+
+            T* dst = out + i * outSize;
+
+            if (outSize == 16)
+            {
+                storeTransposed4(dst + 0,  16, m00, m10, m20, zero);
+                storeTransposed4(dst + 4,  16, m01, m11, m21, zero);
+                storeTransposed4(dst + 8,  16, m02, m12, m22, zero);
+                storeTransposed4(dst + 12, 16, tx, ty, tz, one);
+            }
+            else if (outSize == 12)
+            {
+                storeTransposed4(dst + 0, 12, m00, m01, m02, tx);
+                storeTransposed4(dst + 4, 12, m10, m11, m12, ty);
+                storeTransposed4(dst + 8, 12, m20, m21, m22, tz);
+            }
+            else
+            {
+                // The 4th value of the 2 first columns spills on the next column of the same matrix, written right after.
+                // The last column would spill on the next matrix, or past the end, so it goes through a copy
+                storeTransposed4(dst + 0, 9, m00, m10, m20, zero);
+                storeTransposed4(dst + 3, 9, m01, m11, m21, zero);
+
+                reg c2 = zero;
+                laneTranspose4(m02, m12, m22, c2);
+
+                T last[4][4];
+                laneStore(last[0], m02); laneStore(last[1], m12); laneStore(last[2], m22); laneStore(last[3], c2);
+
+                for (std::size_t k = 0; k < 4; k++)
+                {
+                    dst[k * 9 + 6] = last[k][0]; dst[k * 9 + 7] = last[k][1]; dst[k * 9 + 8] = last[k][2];
+                }
+            }
+        }
+
+        return blocks * 4;
+    }
+
+    // True if mat4<F> products have a vectorized kernel in this build
+    template<FloatingNumber F>
+    inline constexpr bool hasMat4Kernel =
+    #if defined(GLMATH_SIMD_SSE2)
+        std::is_same_v<F, float> ||
+    #endif
+    #if defined(GLMATH_SIMD_AVX)
+        std::is_same_v<F, double> ||
+    #endif
+        false;
+
+    // True if spans of vec3<F> can be transformed by a vectorized kernel in this build
+    template<FloatingNumber F>
+    inline constexpr bool hasVec3TransformKernel =
+    #if defined(GLMATH_SIMD_SSE2)
+        std::is_same_v<F, float> ||
+    #endif
+        false;
+
+    // True if spans of vec3<F> can be rotated by a quaternion with a vectorized kernel in this build
+    template<FloatingNumber F>
+    inline constexpr bool hasQuatRotateKernel = hasVec3TransformKernel<F>;
+
+    // True if spans of quat<F> are packed to and unpacked from packedQuat by a vectorized kernel in this build
+    template<FloatingNumber F>
+    inline constexpr bool hasPackedQuatKernel = hasVec3TransformKernel<F>;
+
+    // True if spans of vec4<F> can be transformed by a vectorized kernel in this build
+    template<FloatingNumber F>
+    inline constexpr bool hasVec4TransformKernel = hasMat4Kernel<F>;
+
+    // True if mat4<F> inverses have a vectorized kernel in this build
+    template<FloatingNumber F>
+    inline constexpr bool hasMat4InverseKernel =
+    #if defined(GLMATH_SIMD_SSE2)
+        std::is_same_v<F, float> ||
+    #endif
+        false;
+
+    // True if frustum<F> tests spans of spheres and boxes with a vectorized kernel in this build
+    template<FloatingNumber F>
+    inline constexpr bool hasFrustumKernel = hasMat4Kernel<F>;
+
+    // True if mat3x4<F> products, packs and unpacks have a vectorized kernel in this build
+    template<FloatingNumber F>
+    inline constexpr bool hasMat3x4Kernel = hasMat4Kernel<F>;
+
+    // True if mat3a<F> products have a vectorized kernel in this build
+    template<FloatingNumber F>
+    inline constexpr bool hasMat3aKernel = hasMat4Kernel<F>;
+
+    // True if mat3a<F> inverses, transposes and normal matrices have a vectorized kernel in this build
+    template<FloatingNumber F>
+    inline constexpr bool hasMat3aInverseKernel = hasMat4InverseKernel<F>;
+
+    // True if the vector streams (vec2Stream, vec3Stream, vec4Stream) of F have vectorized kernels in this build
+    template<FloatingNumber F>
+    inline constexpr bool hasStreamKernel = hasMat4Kernel<F>;
+
+    // True if 1 / sqrt(x) has a fast estimate (rsqrtps and a Newton-Raphson step) in this build, 
+    // there is none for doubles before AVX-512 so they keep the exact path
+    template<FloatingNumber F>
+    inline constexpr bool hasRsqrtKernel =
+    #if defined(GLMATH_SIMD_SSE2)
+        std::is_same_v<F, float> ||
+    #endif
+        false;
+
+    // True if lanes<T, W> are backed by a SIMD register in this build, else they are plain arrays
+    template<typename T, std::size_t W>
+    inline constexpr bool hasLaneRegister = !std::is_same_v<typename laneRegister<T, W>::type, noLaneRegister>;
+
+    // True if the vec4<F> dot products, lengths and distances have a vectorized kernel in this build :
+    // vec4<float> with SSE2, vec4<double> with AVX (see bench/Vec4Bench.cpp). The component-wise operators have none,
+    // the compilers vectorizing them as well, and merging several vec4 in a loop
+    template<FloatingNumber F>
+    inline constexpr bool hasVec4DotKernel =
+    #if defined(GLMATH_SIMD_SSE2)
+        std::is_same_v<F, float> ||
+    #endif
+    #if defined(GLMATH_SIMD_AVX)
+        std::is_same_v<F, double> ||
+    #endif
+        false;
+
+    // True if vec3a<F> has a vectorized kernel in this build, so if a whole vec3a fits in one register :
+    // vec3a<float> with SSE2, vec3a<double> with AVX
+    template<FloatingNumber F>
+    inline constexpr bool hasVec3aKernel = (std::is_same_v<F, float> || std::is_same_v<F, double>) && hasLaneRegister<F, 4>;
+
+    // True if quaternions stored as structure-of-arrays are converted to matrices by a vectorized kernel in this build,
+    // which also needs a whole row or column in one register
+    template<FloatingNumber F>
+    inline constexpr bool hasQuatToMatKernel = hasVec3aKernel<F>;
+
+    // The number of lanes of the widest register of this build for T : 8 floats or 4 doubles with AVX, 4 floats or 2 doubles with SSE2,
+    // and without SIMD 4 floats or 2 doubles as plain arrays. It's the lane type the batched functions (glMath::fast...) use
+    template<typename T>
+    inline constexpr std::size_t widestLaneWidth = 
+    #if defined(GLMATH_SIMD_AVX)
+        32 / sizeof(T);
+    #else
+        16 / sizeof(T);
+    #endif
+}
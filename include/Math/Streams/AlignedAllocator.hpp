@@ -0,0 +1,38 @@
+#pragma once
+
+#include <cstddef>
+#include <new>
+
+namespace glMath
+{
+    /// @brief A std::allocator replacement whose allocations start on an Alignment-byte boundary, 
+    /// so that std::vector can be used for arrays that are loaded with full-width SIMD loads
+    /// @tparam T The type of the values allocated
+    /// @tparam Alignment The alignment of every allocation, in bytes, 64 by default (a cache line, and an AVX-512 register)
+    template<typename T, std::size_t Alignment = 64>
+    struct alignedAllocator
+    {
+    public:
+        using value_type = T;
+
+        template<typename U>
+        struct rebind { using other = alignedAllocator<U, Alignment>; };
+
+    public:
+        alignedAllocator() noexcept = default;
+        template<typename U>
+        alignedAllocator(const alignedAllocator<U, Alignment>&) noexcept {};
+
+        inline T* allocate(std::size_t count)
+        {
+            return static_cast<T*>(::operator new(count * sizeof(T), std::align_val_t(Alignment)));
+        }
+        inline void deallocate(T* ptr, std::size_t) noexcept
+        {
+            ::operator delete(ptr, std::align_val_t(Alignment));
+        }
+
+        template<typename U>
+        inline bool operator==(const alignedAllocator<U, Alignment>&) const noexcept { return true; };
+    };
+}
@@ -0,0 +1,136 @@
+#pragma once
+
+#include <concepts>
+#include <cstddef>
+#include <span>
+#include <vector>
+
+#include "Math\Concepts.hpp"
+#include "Math\FastMath\FastMath.hpp"
+#include "Math\Lanes\Lanes.hpp"
+#include "Math\Quaternions\Quaternion.hpp"
+#include "Math\Matrices\Matrix3x3.hpp"
+#include "Math\Matrices\Matrix3x4.hpp"
+#include "Math\Matrices\Matrix4x4.hpp"
+#include "Math\Streams\AlignedAllocator.hpp"
+#include "Math\Streams\VectorStream.hpp"
+
+namespace glMath
+{
+    /// @brief A container of quaternions stored as structure-of-arrays, like vecStream : one aligned array per component,
+    /// all the w, then all the x, y and z. It's what batched code like animation sampling writes,
+    /// and it converts all of its rotations to matrices at once, with SIMD kernels (4 per step) when the build has them
+    //
+    // quat array   : w0 x0 y0 z0 w1 x1 y1 z1 ...
+    // quatStream   : w0 w1 ... | x0 x1 ... | y0 y1 ... | z0 z1 ...
+    //
+    /// @tparam F The type of the values stored in the quaternions, a FloatingNumber, so a float or a double
+    template<FloatingNumber F>
+    struct quatStream
+    {
+    public:
+        using componentArray = std::vector<F, alignedAllocator<F>>;
+
+    private:
+        componentArray components[4];
+
+    public:
+        quatStream() = default;
+        /// @brief A stream of count identity quaternions
+        explicit quatStream(std::size_t count);
+        /// @brief A stream holding a copy of quats, converted to structure-of-arrays
+        explicit quatStream(std::span<const quat<F>> quats);
+
+        /// @brief Reserves the memory for count quaternions, to avoid reallocations while adding them
+        void reserve(std::size_t count);
+        /// @brief Resizes the stream, the new quaternions being the identity
+        void resize(std::size_t count);
+        /// @brief Removes every quaternion
+        void clear();
+
+        inline std::size_t size() const { return components[0].size(); };
+        inline bool isEmpty() const { return components[0].empty(); };
+
+        void pushBack(const quat<F>& rot);
+
+        /// @brief A function to gather the quaternion at a certain index from the component arrays
+        quat<F> get(std::size_t index) const;
+        /// @brief A function to scatter a quaternion into the component arrays, at a certain index
+        void set(std::size_t index, const quat<F>& rot);
+
+        /// @brief A view of one of the component arrays, without copying anything, aligned on 64 bytes
+        /// @param component The index of the component, in the order of quat : 0 for w, 1 for x, 2 for y, 3 for z
+        inline std::span<F> component(std::size_t component) { return components[component]; };
+        inline std::span<const F> component(std::size_t component) const { return components[component]; };
+
+        inline std::span<F> ws() { return components[0]; };
+        inline std::span<const F> ws() const { return components[0]; };
+        inline std::span<F> xs() { return components[1]; };
+        inline std::span<const F> xs() const { return components[1]; };
+        inline std::span<F> ys() { return components[2]; };
+        inline std::span<const F> ys() const { return components[2]; };
+        inline std::span<F> zs() { return components[3]; };
+        inline std::span<const F> zs() const { return components[3]; };
+
+        /// @brief A function to replace the content of the stream by quats, converting them to structure-of-arrays.
+        /// The stream is resized to quats.size()
+        void load(std::span<const quat<F>> quats);
+        /// @brief A function to convert the stream back to an array of quaternions
+        /// @param quats Where the quaternions are written, at least as big as the stream
+        void store(std::span<quat<F>> quats) const;
+
+        /// @brief A function to normalize every quaternion, in place. The quaternions of length 0 are left untouched
+        void normalize();
+
+        /// @brief A function to interpolate linearly between the quaternions of start and end, two by two, on the shortest path,
+        /// then normalize the results (nlerp). With SIMD, 4 or 8 quaternions are interpolated per step
+        /// @param t The interpolation factor of each pair, as big as start at least, not clamped
+        /// @param results Where the quaternions are written, resized to the size of start. It can be start or end
+        static void nlerp(const quatStream& start, const quatStream& end, std::span<const F> t, quatStream& results);
+        /// @brief Like nlerp(start, end, t, results), with the same factor for every pair
+        static void nlerp(const quatStream& start, const quatStream& end, F t, quatStream& results);
+        /// @brief Like nlerp(), with quat::slerpUnclamped() computed on 4 or 8 quaternions at once, 
+        /// P being exactMath or fastMath for the precision of the angles, or polynomialMath for weights without angles
+        /// (fast::slerpWeights()), the quaternions of start and end having to be normalized then. With polynomialMath, when the CPU's level
+        /// isn't the build's, the kernel of dispatch::runtimeKernels() is used, within a few ulps
+        template<MathPolicy P = exactMath>
+        static void slerp(const quatStream& start, const quatStream& end, std::span<const F> t, quatStream& results);
+
+
+        /// @brief A function to convert every quaternion to a rotation matrix, like quat::toMat4(),
+        /// straight from the stream (the matrices are written as they are computed, without going through a mat3)
+        /// @param results Where the matrices are written, at least as big as the stream
+        void toMat4(std::span<mat4<F>> results) const;
+        /// @brief Like toMat4(results), with the translations in the last column, so translate * rotation
+        /// @param translations As big as the stream at least
+        void toMat4(const vec3Stream<F>& translations, std::span<mat4<F>> results) const;
+        /// @brief Like toMat4(results), for whole transforms : translate * rotation * scale, like transformHierarchy::composeTRS()
+        /// @param translations As big as the stream at least, like scales
+        void toMat4(const vec3Stream<F>& translations, const vec3Stream<F>& scales, std::span<mat4<F>> results) const;
+
+        /// @brief Like toMat4(), to the 3x4 matrices uploaded as bone palettes, the translations being 0
+        void toMat3x4(std::span<mat3x4<F>> results) const;
+        void toMat3x4(const vec3Stream<F>& translations, std::span<mat3x4<F>> results) const;
+        void toMat3x4(const vec3Stream<F>& translations, const vec3Stream<F>& scales, std::span<mat3x4<F>> results) const;
+
+        /// @brief Like toMat4(), to rotation matrices, like quat::toMat3()
+        void toMat3(std::span<mat3<F>> results) const;
+        /// @brief Like toMat3(results), with the columns scaled, so rotation * scale
+        void toMat3(const vec3Stream<F>& scales, std::span<mat3<F>> results) const;
+
+    private:
+        // The quaternions i to i + L::width - 1 as one quaternion of lanes, and back
+        template<LaneNumber L>
+        quat<L> loadPacket(std::size_t index) const;
+        template<LaneNumber L>
+        void storePacket(std::size_t index, const quat<L>& packet);
+
+        // nlerp, with t[i] as the factor of the pair i, or t[0] for all of them if uniformT
+        static void nlerp(const quatStream& start, const quatStream& end, const F* t, bool uniformT, quatStream& results);
+
+        // The conversions, translations and scales being optional, to outSize values per matrix (see simd::quatToMatrices)
+        void toMatrices(const vec3Stream<F>* translations, const vec3Stream<F>* scales, F* out, std::size_t outSize) const;
+    };
+}
+
+#include "Math\Streams\QuaternionStream.inl"
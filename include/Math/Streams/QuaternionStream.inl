@@ -0,0 +1,372 @@
+#include <concepts>
+#include <cassert>
+#include <cmath>
+#include <type_traits>
+
+#include "Math\MathInternal.hpp"
+#include "Math\SimdInternal.hpp"
+#include "Math\Dispatch\DispatchKernels.hpp"
+
+namespace glMath
+{
+    #pragma region Storage
+
+    template<FloatingNumber F>
+    inline quatStream<F>::quatStream(std::size_t count)
+    {
+        resize(count);
+    }
+
+    template<FloatingNumber F>
+    inline quatStream<F>::quatStream(std::span<const quat<F>> quats)
+    {
+        load(quats);
+    }
+
+    template<FloatingNumber F>
+    inline void quatStream<F>::reserve(std::size_t count)
+    {
+        for (componentArray& comp : components) comp.reserve(count);
+    }
+
+    template<FloatingNumber F>
+    inline void quatStream<F>::resize(std::size_t count)
+    {
+        components[0].resize(count, static_cast<F>(1.0));
+        for (std::size_t c = 1; c < 4; c++) components[c].resize(count, static_cast<F>(0.0));
+    }
+
+    template<FloatingNumber F>
+    inline void quatStream<F>::clear()
+    {
+        for (componentArray& comp : components) comp.clear();
+    }
+
+    template<FloatingNumber F>
+    inline void quatStream<F>::pushBack(const quat<F>& rot)
+    {
+        for (std::size_t c = 0; c < 4; c++) components[c].push_back(rot.data[c]);
+    }
+
+    template<FloatingNumber F>
+    inline quat<F> quatStream<F>::get(std::size_t index) const
+    {
+        return quat<F>(components[0][index], components[1][index], components[2][index], components[3][index]);
+    }
+
+    template<FloatingNumber F>
+    inline void quatStream<F>::set(std::size_t index, const quat<F>& rot)
+    {
+        for (std::size_t c = 0; c < 4; c++) components[c][index] = rot.data[c];
+    }
+
+    template<FloatingNumber F>
+    inline void quatStream<F>::load(std::span<const quat<F>> quats)
+    {
+        resize(quats.size());
+
+        // One component at a time, so every write goes to the same array
+        for (std::size_t c = 0; c < 4; c++)
+        {
+            F* dst = components[c].data();
+
+            for (std::size_t i = 0; i < quats.size(); i++)
+            {
+                dst[i] = quats[i].data[c];
+            }
+        }
+    }
+
+    template<FloatingNumber F>
+    inline void quatStream<F>::store(std::span<quat<F>> quats) const
+    {
+        assert(quats.size() >= size());
+
+        for (std::size_t c = 0; c < 4; c++)
+        {
+            const F* src = components[c].data();
+
+            for (std::size_t i = 0; i < size(); i++)
+            {
+                quats[i].data[c] = src[i];
+            }
+        }
+    }
+
+    #pragma endregion
+
+    #pragma region BatchedMethods
+
+    template<FloatingNumber F>
+    inline void quatStream<F>::normalize()
+    {
+        std::size_t count = size();
+
+        F* ptrs[4] = { components[0].data(), components[1].data(), components[2].data(), components[3].data() };
+
+        std::size_t i = 0;
+
+        if constexpr (simd::hasStreamKernel<F>)
+        {
+            i = simd::soaNormalize(ptrs, 4, count);
+        }
+
+        for (; i < count; i++)
+        {
+            F lengthSq = ptrs[0][i] * ptrs[0][i] + ptrs[1][i] * ptrs[1][i] + ptrs[2][i] * ptrs[2][i] + ptrs[3][i] * ptrs[3][i];
+
+            if (lengthSq > static_cast<F>(0.0))
+            {
+                F inverseLength = static_cast<F>(1.0) / std::sqrt(lengthSq);
+                for (std::size_t c = 0; c < 4; c++) ptrs[c][i] *= inverseLength;
+            }
+        }
+    }
+
+
+    template<FloatingNumber F>
+    inline void quatStream<F>::nlerp(const quatStream<F>& start, const quatStream<F>& end, std::span<const F> t, quatStream<F>& results)
+    {
+        assert(t.size() >= start.size());
+        quatStream<F>::nlerp(start, end, t.data(), false, results);
+    }
+
+    template<FloatingNumber F>
+    inline void quatStream<F>::nlerp(const quatStream<F>& start, const quatStream<F>& end, F t, quatStream<F>& results)
+    {
+        quatStream<F>::nlerp(start, end, &t, true, results);
+    }
+
+    template<FloatingNumber F> template<MathPolicy P>
+    inline void quatStream<F>::slerp(const quatStream<F>& start, const quatStream<F>& end, std::span<const F> t, quatStream<F>& results)
+    {
+        using L = lanes<F, simd::widestLaneWidth<F>>;
+
+        std::size_t count = start.size();
+
+        assert(end.size() >= count && t.size() >= count);
+
+        results.resize(count);
+
+        // The kernels of the CPU's level (or of a forced one), when it isn't the build's
+        if constexpr (std::is_same_v<P, polynomialMath>)
+        {
+            if (const dispatch::batchKernels<F>* runtime = dispatch::runtimeKernels<F>())
+            {
+                const F* starts[4] = { start.components[0].data(), start.components[1].data(), start.components[2].data(), start.components[3].data() };
+                const F* ends[4] = { end.components[0].data(), end.components[1].data(), end.components[2].data(), end.components[3].data() };
+                F* out[4] = { results.components[0].data(), results.components[1].data(), results.components[2].data(), results.components[3].data() };
+
+                runtime->soaQuatSlerp(starts, ends, t.data(), out, count);
+                return;
+            }
+        }
+
+        std::size_t laneCount = simd::hasLaneRegister<F, L::width> ? count - count % L::width : 0;
+        std::size_t i = 0;
+
+        for (; i < laneCount; i += L::width)
+        {
+            quat<L> res = quat<L>::template slerpUnclamped<P>(start.template loadPacket<L>(i), end.template loadPacket<L>(i), L::load(t.data() + i));
+            results.template storePacket<L>(i, res);
+        }
+
+        for (; i < count; i++)
+        {
+            results.set(i, quat<F>::template slerpUnclamped<P>(start.get(i), end.get(i), t[i]));
+        }
+    }
+
+
+    template<FloatingNumber F>
+    inline void quatStream<F>::toMat4(std::span<mat4<F>> results) const
+    {
+        assert(results.size() >= size());
+        toMatrices(nullptr, nullptr, reinterpret_cast<F*>(results.data()), 16);
+    }
+
+    template<FloatingNumber F>
+    inline void quatStream<F>::toMat4(const vec3Stream<F>& translations, std::span<mat4<F>> results) const
+    {
+        assert(results.size() >= size());
+        toMatrices(&translations, nullptr, reinterpret_cast<F*>(results.data()), 16);
+    }
+
+    template<FloatingNumber F>
+    inline void quatStream<F>::toMat4(const vec3Stream<F>& translations, const vec3Stream<F>& scales, std::span<mat4<F>> results) const
+    {
+        assert(results.size() >= size());
+        toMatrices(&translations, &scales, reinterpret_cast<F*>(results.data()), 16);
+    }
+
+    template<FloatingNumber F>
+    inline void quatStream<F>::toMat3x4(std::span<mat3x4<F>> results) const
+    {
+        assert(results.size() >= size());
+        toMatrices(nullptr, nullptr, reinterpret_cast<F*>(results.data()), 12);
+    }
+
+    template<FloatingNumber F>
+    inline void quatStream<F>::toMat3x4(const vec3Stream<F>& translations, std::span<mat3x4<F>> results) const
+    {
+        assert(results.size() >= size());
+        toMatrices(&translations, nullptr, reinterpret_cast<F*>(results.data()), 12);
+    }
+
+    template<FloatingNumber F>
+    inline void quatStream<F>::toMat3x4(const vec3Stream<F>& translations, const vec3Stream<F>& scales, std::span<mat3x4<F>> results) const
+    {
+        assert(results.size() >= size());
+        toMatrices(&translations, &scales, reinterpret_cast<F*>(results.data()), 12);
+    }
+
+    template<FloatingNumber F>
+    inline void quatStream<F>::toMat3(std::span<mat3<F>> results) const
+    {
+        assert(results.size() >= size());
+        toMatrices(nullptr, nullptr, reinterpret_cast<F*>(results.data()), 9);
+    }
+
+    template<FloatingNumber F>
+    inline void quatStream<F>::toMat3(const vec3Stream<F>& scales, std::span<mat3<F>> results) const
+    {
+        assert(results.size() >= size());
+        toMatrices(nullptr, &scales, reinterpret_cast<F*>(results.data()), 9);
+    }
+
+    #pragma endregion
+
+    #pragma region Internal
+
+    template<FloatingNumber F>
+    inline void quatStream<F>::nlerp(const quatStream<F>& start, const quatStream<F>& end, const F* t, bool uniformT, quatStream<F>& results)
+    {
+        using L = lanes<F, simd::widestLaneWidth<F>>;
+
+        std::size_t count = start.size();
+
+        assert(end.size() >= count);
+
+        results.resize(count);
+
+        std::size_t laneCount = simd::hasLaneRegister<F, L::width> ? count - count % L::width : 0;
+        std::size_t i = 0;
+
+        for (; i < laneCount; i += L::width)
+        {
+            quat<L> s = start.template loadPacket<L>(i);
+            quat<L> e = end.template loadPacket<L>(i);
+            L tL = uniformT ? L(t[0]) : L::load(t + i);
+
+            // The shortest path, lane by lane
+            L wB = glMath::select(quat<L>::dotProduct(s, e) < static_cast<L>(0.0), -tL, tL);
+
+            results.template storePacket<L>(i, (s * (static_cast<L>(1.0) - tL) + e * wB).normalize());
+        }
+
+        for (; i < count; i++)
+        {
+            quat<F> s = start.get(i);
+            quat<F> e = end.get(i);
+            F tI = uniformT ? t[0] : t[i];
+
+            F wB = quat<F>::dotProduct(s, e) < static_cast<F>(0.0) ? -tI : tI;
+
+            results.set(i, (s * (static_cast<F>(1.0) - tI) + e * wB).normalize());
+        }
+    }
+
+    template<FloatingNumber F> template<LaneNumber L>
+    inline quat<L> quatStream<F>::loadPacket(std::size_t index) const
+    {
+        return quat<L>(L::load(components[0].data() + index), L::load(components[1].data() + index), 
+                       L::load(components[2].data() + index), L::load(components[3].data() + index));
+    }
+
+    template<FloatingNumber F> template<LaneNumber L>
+    inline void quatStream<F>::storePacket(std::size_t index, const quat<L>& packet)
+    {
+        for (std::size_t c = 0; c < 4; c++) packet.data[c].store(components[c].data() + index);
+    }
+
+    template<FloatingNumber F>
+    inline void quatStream<F>::toMatrices(const vec3Stream<F>* translations, const vec3Stream<F>* scales, F* out, std::size_t outSize) const
+    {
+        std::size_t count = size();
+
+        assert(!translations || translations->size() >= count);
+        assert(!scales || scales->size() >= count);
+
+        const F* quatPtrs[4] = { components[0].data(), components[1].data(), components[2].data(), components[3].data() };
+        const F* translationPtrs[3] = {};
+        const F* scalePtrs[3] = {};
+
+        for (std::size_t c = 0; c < 3; c++)
+        {
+            if (translations) translationPtrs[c] = translations->component(c).data();
+            if (scales) scalePtrs[c] = scales->component(c).data();
+        }
+
+        std::size_t i = 0;
+
+        if constexpr (simd::hasQuatToMatKernel<F>)
+        {
+            i = simd::quatToMatrices(quatPtrs, translations ? translationPtrs : nullptr, scales ? scalePtrs : nullptr, out, count, outSize);
+        }
+
+        // The tail (or everything, without SIMD), with the formulas of quat::toMat4() and transformHierarchy::composeTRS()
+        F f0 = static_cast<F>(0.0);
+        F f1 = static_cast<F>(1.0);
+
+        for (; i < count; i++)
+        {
+            F w = quatPtrs[0][i], x = quatPtrs[1][i], y = quatPtrs[2][i], z = quatPtrs[3][i];
+
+            F x2 = x + x, y2 = y + y, z2 = z + z;
+            F xx = x * x2, yy = y * y2, zz = z * z2;
+            F xy = x * y2, xz = x * z2, yz = y * z2;
+            F wx = w * x2, wy = w * y2, wz = w * z2;
+
+            F m00 = f1 - (yy + zz), m01 = xy - wz,        m02 = xz + wy;
+            F m10 = xy + wz,        m11 = f1 - (xx + zz), m12 = yz - wx;
+            F m20 = xz - wy,        m21 = yz + wx,        m22 = f1 - (xx + yy);
+
+            if (scales)
+            {
+                F sx = scalePtrs[0][i], sy = scalePtrs[1][i], sz = scalePtrs[2][i];
+
+                m00 *= sx; m01 *= sy; m02 *= sz;
+                m10 *= sx; m11 *= sy; m12 *= sz;
+                m20 *= sx; m21 *= sy; m22 *= sz;
+            }
+
+            F tx = translations ? translationPtrs[0][i] : f0;
+            F ty = translations ? translationPtrs[1][i] : f0;
+            F tz = translations ? translationPtrs[2][i] : f0;
+
+            F* dst = out + i * outSize;
+
+            if (outSize == 16)
+            {
+                dst[0]  = m00; dst[1]  = m10; dst[2]  = m20; dst[3]  = f0;
+                dst[4]  = m01; dst[5]  = m11; dst[6]  = m21; dst[7]  = f0;
+                dst[8]  = m02; dst[9]  = m12; dst[10] = m22; dst[11] = f0;
+                dst[12] = tx;  dst[13] = ty;  dst[14] = tz;  dst[15] = f1;
+            }
+            else if (outSize == 12)
+            {
+                dst[0] = m00; dst[1] = m01; dst[2]  = m02; dst[3]  = tx;
+                dst[4] = m10; dst[5] = m11; dst[6]  = m12; dst[7]  = ty;
+                dst[8] = m20; dst[9] = m21; dst[10] = m22; dst[11] = tz;
+            }
+            else
+            {
+                dst[0] = m00; dst[1] = m10; dst[2] = m20;
+                dst[3] = m01; dst[4] = m11; dst[5] = m21;
+                dst[6] = m02; dst[7] = m12; dst[8] = m22;
+            }
+        }
+    }
+
+    #pragma endregion
+}
@@ -0,0 +1,145 @@
+#pragma once
+
+#include <concepts>
+#include <cstddef>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+#include "Math\Concepts.hpp"
+#include "Math\Vectors\Vector2.hpp"
+#include "Math\Vectors\Vector3.hpp"
+#include "Math\Vectors\Vector4.hpp"
+#include "Math\Matrices\Matrix4x4.hpp"
+#include "Math\Streams\AlignedAllocator.hpp"
+
+namespace glMath
+{
+    /// @brief A container of vectors stored as structure-of-arrays : one aligned array per component (all the x, then all the y...),
+    /// instead of one array of vec2, vec3 or vec4. Every batched function works on whole arrays at once,
+    /// with SIMD kernels (8 or 4 vectors per step) when the build has them
+    //
+    // vec3 array   : x0 y0 z0 x1 y1 z1 x2 y2 z2 ...
+    // vec3Stream   : x0 x1 x2 ... | y0 y1 y2 ... | z0 z1 z2 ...
+    //
+    /// @tparam F The type of the values stored in the vectors, a FloatingNumber, so a float or a double
+    /// @tparam N The number of components of the vectors, 2, 3 or 4
+    template<FloatingNumber F, std::size_t N>
+    struct vecStream
+    {
+        static_assert(N >= 2 && N <= 4, "glMath::vecStream : the vectors must have 2, 3 or 4 components");
+
+    public:
+        /// @brief The vector type the stream stores, vec2<F>, vec3<F> or vec4<F>
+        using vecType = std::conditional_t<N == 2, vec2<F>, std::conditional_t<N == 3, vec3<F>, vec4<F>>>;
+        using componentArray = std::vector<F, alignedAllocator<F>>;
+
+        static constexpr std::size_t dimensions = N;
+
+    private:
+        componentArray components[N];
+
+    public:
+        vecStream() = default;
+        /// @brief A stream of count zero vectors
+        explicit vecStream(std::size_t count);
+        /// @brief A stream holding a copy of vectors, converted to structure-of-arrays
+        explicit vecStream(std::span<const vecType> vectors);
+
+        /// @brief Reserves the memory for count vectors, to avoid reallocations while adding them
+        void reserve(std::size_t count);
+        /// @brief Resizes the stream, the new vectors being zero
+        void resize(std::size_t count);
+        /// @brief Removes every vector
+        void clear();
+
+        inline std::size_t size() const { return components[0].size(); };
+        inline bool isEmpty() const { return components[0].empty(); };
+
+        void pushBack(const vecType& vec);
+
+        /// @brief A function to gather the vector at a certain index from the component arrays
+        vecType get(std::size_t index) const;
+        /// @brief A function to scatter a vector into the component arrays, at a certain index
+        void set(std::size_t index, const vecType& vec);
+
+        /// @brief A view of one of the component arrays, without copying anything.
+        /// Its data is aligned on 64 bytes, and can be written to, or passed to the functions taking structure-of-arrays spans (frustum::testSpheres...)
+        /// @param component The index of the component, 0 for x, 1 for y...
+        inline std::span<F> component(std::size_t component) { return components[component]; };
+        inline std::span<const F> component(std::size_t component) const { return components[component]; };
+
+        inline std::span<F> xs() { return components[0]; };
+        inline std::span<const F> xs() const { return components[0]; };
+        inline std::span<F> ys() { return components[1]; };
+        inline std::span<const F> ys() const { return components[1]; };
+        inline std::span<F> zs() requires (N >= 3) { return components[2]; };
+        inline std::span<const F> zs() const requires (N >= 3) { return components[2]; };
+        inline std::span<F> ws() requires (N == 4) { return components[3]; };
+        inline std::span<const F> ws() const requires (N == 4) { return components[3]; };
+
+        /// @brief A function to replace the content of the stream by vectors, converting them to structure-of-arrays.
+        /// The stream is resized to vectors.size()
+        void load(std::span<const vecType> vectors);
+        /// @brief A function to convert the stream back to an array of vectors
+        /// @param vectors Where the vectors are written, at least as big as the stream
+        void store(std::span<vecType> vectors) const;
+
+
+        /// @brief A function to compute the dot products of the vectors of a and b, two by two
+        /// @param results Where the dot products are written, at least as big as a
+        static void dotProduct(const vecStream& a, const vecStream& b, std::span<F> results);
+        /// @brief A function to compute the cross products of the vectors of a and b, two by two
+        /// @param results Where the cross products are written, resized to the size of a. It can be a or b
+        static void crossProduct(const vecStream& a, const vecStream& b, vecStream& results) requires (N == 3);
+
+        /// @brief A function to compute the length of every vector
+        /// @param results Where the lengths are written, at least as big as the stream
+        void lengths(std::span<F> results) const;
+        /// @brief A function to normalize every vector, in place. Like vec3::normalize(), the vectors of length 0 are left untouched.
+        /// When the CPU's level isn't the build's, the kernel of dispatch::runtimeKernels() is used, within 2 ulps of the square root and division
+        void normalize();
+        /// @brief Like normalize(), with a fast 1 / sqrt (the hardware estimate and one Newton-Raphson step) instead of a square root and a division.
+        /// With floats the lengths are within 5e-7 of 1, and the vectors whose squared length is 0 or denormal are left untouched. Doubles use normalize()
+        void normalizeFast();
+
+        /// @brief A function to interpolate between the vectors of start and end, two by two, t being clamped between 0 and 1
+        /// @param results Where the vectors are written, resized to the size of start. It can be start or end
+        static void lerp(const vecStream& start, const vecStream& end, F t, vecStream& results);
+        static void lerpUnclamped(const vecStream& start, const vecStream& end, F t, vecStream& results);
+
+        /// @brief A function to get the component-wise minimum of the vectors of a and b, two by two
+        /// @param results Where the vectors are written, resized to the size of a. It can be a or b
+        static void min(const vecStream& a, const vecStream& b, vecStream& results);
+        /// @brief A function to get the component-wise maximum of the vectors of a and b, two by two
+        /// @param results Where the vectors are written, resized to the size of a. It can be a or b
+        static void max(const vecStream& a, const vecStream& b, vecStream& results);
+
+        /// @brief A function to transform every vector as a point (w = 1) by a matrix
+        /// @param results Where the points are written, resized to the size of the stream. It can be the stream itself
+        /// @param perspectiveDivide If true, the points are divided by their transformed w, as needed with a projection matrix
+        void transformPoints(const mat4<F>& mat, vecStream& results, bool perspectiveDivide = false) const requires (N == 3);
+        /// @brief A function to transform every vector as a direction (w = 0) by a matrix, so without the translation
+        /// @param results Where the directions are written, resized to the size of the stream. It can be the stream itself
+        void transformDirections(const mat4<F>& mat, vecStream& results) const requires (N == 3);
+        /// @brief A function to transform every vector by a matrix
+        /// @param results Where the vectors are written, resized to the size of the stream. It can be the stream itself
+        void transform(const mat4<F>& mat, vecStream& results) const requires (N == 4);
+
+    private:
+        // The data pointers of the component arrays, as the kernels take them
+        inline void pointers(const F* (&ptrs)[N]) const { for (std::size_t c = 0; c < N; c++) ptrs[c] = components[c].data(); };
+        inline void pointers(F* (&ptrs)[N]) { for (std::size_t c = 0; c < N; c++) ptrs[c] = components[c].data(); };
+
+        void transformRows(const mat4<F>& mat, F w, bool perspectiveDivide, vecStream& results) const;
+    };
+
+    template<FloatingNumber F>
+    using vec2Stream = vecStream<F, 2>;
+    template<FloatingNumber F>
+    using vec3Stream = vecStream<F, 3>;
+    template<FloatingNumber F>
+    using vec4Stream = vecStream<F, 4>;
+}
+
+#include "Math\Streams\VectorStream.inl"
@@ -0,0 +1,411 @@
+#include <concepts>
+#include <cassert>
+#include <limits>
+
+#include "Math\MathInternal.hpp"
+#include "Math\SimdInternal.hpp"
+#include "Math\Dispatch\DispatchKernels.hpp"
+
+namespace glMath
+{
+    #pragma region Storage
+
+    template<FloatingNumber F, std::size_t N>
+    inline vecStream<F, N>::vecStream(std::size_t count)
+    {
+        resize(count);
+    }
+
+    template<FloatingNumber F, std::size_t N>
+    inline vecStream<F, N>::vecStream(std::span<const vecType> vectors)
+    {
+        load(vectors);
+    }
+
+    template<FloatingNumber F, std::size_t N>
+    inline void vecStream<F, N>::reserve(std::size_t count)
+    {
+        for (componentArray& comp : components) comp.reserve(count);
+    }
+
+    template<FloatingNumber F, std::size_t N>
+    inline void vecStream<F, N>::resize(std::size_t count)
+    {
+        for (componentArray& comp : components) comp.resize(count, static_cast<F>(0.0));
+    }
+
+    template<FloatingNumber F, std::size_t N>
+    inline void vecStream<F, N>::clear()
+    {
+        for (componentArray& comp : components) comp.clear();
+    }
+
+    template<FloatingNumber F, std::size_t N>
+    inline void vecStream<F, N>::pushBack(const vecType& vec)
+    {
+        for (std::size_t c = 0; c < N; c++) components[c].push_back(vec.data[c]);
+    }
+
+    template<FloatingNumber F, std::size_t N>
+    inline typename vecStream<F, N>::vecType vecStream<F, N>::get(std::size_t index) const
+    {
+        vecType res;
+        for (std::size_t c = 0; c < N; c++) res.data[c] = components[c][index];
+
+        return res;
+    }
+
+    template<FloatingNumber F, std::size_t N>
+    inline void vecStream<F, N>::set(std::size_t index, const vecType& vec)
+    {
+        for (std::size_t c = 0; c < N; c++) components[c][index] = vec.data[c];
+    }
+
+    template<FloatingNumber F, std::size_t N>
+    inline void vecStream<F, N>::load(std::span<const vecType> vectors)
+    {
+        resize(vectors.size());
+
+        // One component at a time, so every write goes to the same array
+        for (std::size_t c = 0; c < N; c++)
+        {
+            F* dst = components[c].data();
+
+            for (std::size_t i = 0; i < vectors.size(); i++)
+            {
+                dst[i] = vectors[i].data[c];
+            }
+        }
+    }
+
+    template<FloatingNumber F, std::size_t N>
+    inline void vecStream<F, N>::store(std::span<vecType> vectors) const
+    {
+        assert(vectors.size() >= size());
+
+        for (std::size_t c = 0; c < N; c++)
+        {
+            const F* src = components[c].data();
+
+            for (std::size_t i = 0; i < size(); i++)
+            {
+                vectors[i].data[c] = src[i];
+            }
+        }
+    }
+
+    #pragma endregion
+
+    #pragma region BatchedMethods
+
+    template<FloatingNumber F, std::size_t N>
+    inline void vecStream<F, N>::dotProduct(const vecStream<F, N>& a, const vecStream<F, N>& b, std::span<F> results)
+    {
+        std::size_t count = a.size();
+
+        assert(b.size() >= count && results.size() >= count);
+
+        const F* aPtrs[N];
+        const F* bPtrs[N];
+        a.pointers(aPtrs);
+        b.pointers(bPtrs);
+
+        std::size_t i = 0;
+
+        if constexpr (simd::hasStreamKernel<F>)
+        {
+            i = simd::soaDotProduct(aPtrs, bPtrs, N, results.data(), count);
+        }
+
+        // The tail (or everything, without SIMD)
+        for (; i < count; i++)
+        {
+            F dot = static_cast<F>(0.0);
+            for (std::size_t c = 0; c < N; c++) dot += aPtrs[c][i] * bPtrs[c][i];
+
+            results[i] = dot;
+        }
+    }
+
+    template<FloatingNumber F, std::size_t N>
+    inline void vecStream<F, N>::crossProduct(const vecStream<F, N>& a, const vecStream<F, N>& b, vecStream<F, N>& results) requires (N == 3)
+    {
+        std::size_t count = a.size();
+
+        assert(b.size() >= count);
+
+        results.resize(count);
+
+        const F* aPtrs[3];
+        const F* bPtrs[3];
+        F* outPtrs[3];
+        a.pointers(aPtrs);
+        b.pointers(bPtrs);
+        results.pointers(outPtrs);
+
+        std::size_t i = 0;
+
+        if constexpr (simd::hasStreamKernel<F>)
+        {
+            i = simd::soaCrossProduct(aPtrs, bPtrs, outPtrs, count);
+        }
+
+        for (; i < count; i++)
+        {
+            vec3<F> cross = vec3<F>::crossProduct(vec3<F>(aPtrs[0][i], aPtrs[1][i], aPtrs[2][i]),
+                                                  vec3<F>(bPtrs[0][i], bPtrs[1][i], bPtrs[2][i]));
+
+            outPtrs[0][i] = cross.x;
+            outPtrs[1][i] = cross.y;
+            outPtrs[2][i] = cross.z;
+        }
+    }
+
+    template<FloatingNumber F, std::size_t N>
+    inline void vecStream<F, N>::lengths(std::span<F> results) const
+    {
+        std::size_t count = size();
+
+        assert(results.size() >= count);
+
+        const F* ptrs[N];
+        pointers(ptrs);
+
+        std::size_t i = 0;
+
+        if constexpr (simd::hasStreamKernel<F>)
+        {
+            i = simd::soaLengths(ptrs, N, results.data(), count);
+        }
+
+        for (; i < count; i++)
+        {
+            F lengthSq = static_cast<F>(0.0);
+            for (std::size_t c = 0; c < N; c++) lengthSq += ptrs[c][i] * ptrs[c][i];
+
+            results[i] = std::sqrt(lengthSq);
+        }
+    }
+
+    template<FloatingNumber F, std::size_t N>
+    inline void vecStream<F, N>::normalize()
+    {
+        std::size_t count = size();
+
+        F* ptrs[N];
+        pointers(ptrs);
+
+        // The kernels of the CPU's level (or of a forced one), when it isn't the build's
+        if (const dispatch::batchKernels<F>* runtime = dispatch::runtimeKernels<F>())
+        {
+            runtime->soaNormalize[N - 2](ptrs, count);
+            return;
+        }
+
+        std::size_t i = 0;
+
+        if constexpr (simd::hasStreamKernel<F>)
+        {
+            i = simd::soaNormalize(ptrs, N, count);
+        }
+
+        for (; i < count; i++)
+        {
+            F lengthSq = static_cast<F>(0.0);
+            for (std::size_t c = 0; c < N; c++) lengthSq += ptrs[c][i] * ptrs[c][i];
+
+            if (lengthSq > static_cast<F>(0.0))
+            {
+                F inverseLength = static_cast<F>(1.0) / std::sqrt(lengthSq);
+                for (std::size_t c = 0; c < N; c++) ptrs[c][i] *= inverseLength;
+            }
+        }
+    }
+
+    template<FloatingNumber F, std::size_t N>
+    inline void vecStream<F, N>::normalizeFast()
+    {
+        if constexpr (!simd::hasRsqrtKernel<F>)
+        {
+            normalize();
+        }
+        else
+        {
+            std::size_t count = size();
+
+            F* ptrs[N];
+            pointers(ptrs);
+
+            std::size_t i = simd::soaNormalizeFast(ptrs, N, count);
+
+            for (; i < count; i++)
+            {
+                F lengthSq = static_cast<F>(0.0);
+                for (std::size_t c = 0; c < N; c++) lengthSq += ptrs[c][i] * ptrs[c][i];
+
+                if (lengthSq >= std::numeric_limits<F>::min())
+                {
+                    F inverseLength = glMath::rsqrtFast(lengthSq);
+                    for (std::size_t c = 0; c < N; c++) ptrs[c][i] *= inverseLength;
+                }
+            }
+        }
+    }
+
+    template<FloatingNumber F, std::size_t N>
+    inline void vecStream<F, N>::lerp(const vecStream<F, N>& start, const vecStream<F, N>& end, F t, vecStream<F, N>& results)
+    {
+        vecStream<F, N>::lerpUnclamped(start, end, glMath::clamp01(t), results);
+    }
+
+    template<FloatingNumber F, std::size_t N>
+    inline void vecStream<F, N>::lerpUnclamped(const vecStream<F, N>& start, const vecStream<F, N>& end, F t, vecStream<F, N>& results)
+    {
+        std::size_t count = start.size();
+
+        assert(end.size() >= count);
+
+        results.resize(count);
+
+        // Each component is interpolated on its own, so the component arrays are processed one after the other
+        for (std::size_t c = 0; c < N; c++)
+        {
+            const F* a = start.components[c].data();
+            const F* b = end.components[c].data();
+            F* out = results.components[c].data();
+
+            std::size_t i = 0;
+
+            if constexpr (simd::hasStreamKernel<F>)
+            {
+                i = simd::soaLerp(a, b, t, out, count);
+            }
+
+            for (; i < count; i++)
+            {
+                out[i] = a[i] + (b[i] - a[i]) * t;
+            }
+        }
+    }
+
+    template<FloatingNumber F, std::size_t N>
+    inline void vecStream<F, N>::min(const vecStream<F, N>& a, const vecStream<F, N>& b, vecStream<F, N>& results)
+    {
+        std::size_t count = a.size();
+
+        assert(b.size() >= count);
+
+        results.resize(count);
+
+        for (std::size_t c = 0; c < N; c++)
+        {
+            const F* compA = a.components[c].data();
+            const F* compB = b.components[c].data();
+            F* out = results.components[c].data();
+
+            std::size_t i = 0;
+
+            if constexpr (simd::hasStreamKernel<F>)
+            {
+                i = simd::soaMinMax(compA, compB, out, count, false);
+            }
+
+            for (; i < count; i++)
+            {
+                out[i] = glMath::min(compA[i], compB[i]);
+            }
+        }
+    }
+
+    template<FloatingNumber F, std::size_t N>
+    inline void vecStream<F, N>::max(const vecStream<F, N>& a, const vecStream<F, N>& b, vecStream<F, N>& results)
+    {
+        std::size_t count = a.size();
+
+        assert(b.size() >= count);
+
+        results.resize(count);
+
+        for (std::size_t c = 0; c < N; c++)
+        {
+            const F* compA = a.components[c].data();
+            const F* compB = b.components[c].data();
+            F* out = results.components[c].data();
+
+            std::size_t i = 0;
+
+            if constexpr (simd::hasStreamKernel<F>)
+            {
+                i = simd::soaMinMax(compA, compB, out, count, true);
+            }
+
+            for (; i < count; i++)
+            {
+                out[i] = glMath::max(compA[i], compB[i]);
+            }
+        }
+    }
+
+    #pragma endregion
+
+    #pragma region Transforms
+
+    template<FloatingNumber F, std::size_t N>
+    inline void vecStream<F, N>::transformPoints(const mat4<F>& mat, vecStream<F, N>& results, bool perspectiveDivide) const requires (N == 3)
+    {
+        transformRows(mat, static_cast<F>(1.0), perspectiveDivide, results);
+    }
+
+    template<FloatingNumber F, std::size_t N>
+    inline void vecStream<F, N>::transformDirections(const mat4<F>& mat, vecStream<F, N>& results) const requires (N == 3)
+    {
+        transformRows(mat, static_cast<F>(0.0), false, results);
+    }
+
+    template<FloatingNumber F, std::size_t N>
+    inline void vecStream<F, N>::transform(const mat4<F>& mat, vecStream<F, N>& results) const requires (N == 4)
+    {
+        transformRows(mat, static_cast<F>(0.0), false, results);
+    }
+
+    template<FloatingNumber F, std::size_t N>
+    inline void vecStream<F, N>::transformRows(const mat4<F>& mat, F w, bool perspectiveDivide, vecStream<F, N>& results) const
+    {
+        std::size_t count = size();
+
+        results.resize(count);
+
+        const F* in[N];
+        F* out[N];
+        pointers(in);
+        results.pointers(out);
+
+        std::size_t i = 0;
+
+        if constexpr (simd::hasStreamKernel<F>)
+        {
+            i = simd::soaTransform(&mat.columns[0][0], in, N, w, out, N, perspectiveDivide, count);
+        }
+
+        for (; i < count; i++)
+        {
+            F vec[4] = { in[0][i], in[1][i], in[2][i], N == 4 ? in[N - 1][i] : w };
+
+            F res[4];
+            for (int r = 0; r < 4; r++)
+            {
+                res[r] = mat.columns[0][r] * vec[0] + mat.columns[1][r] * vec[1] + mat.columns[2][r] * vec[2] + mat.columns[3][r] * vec[3];
+            }
+
+            if (perspectiveDivide)
+            {
+                F invW = static_cast<F>(1.0) / res[3];
+                for (int r = 0; r < 3; r++) res[r] *= invW;
+            }
+
+            for (std::size_t c = 0; c < N; c++) out[c][i] = res[c];
+        }
+    }
+
+    #pragma endregion
+}
@@ -0,0 +1,105 @@
+#pragma once
+
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <vector>
+
+#include "Math\Concepts.hpp"
+#include "Math\Vectors\Vector3.hpp"
+#include "Math\Quaternions\Quaternion.hpp"
+#include "Math\Matrices\Matrix4x4.hpp"
+
+namespace glMath
+{
+    /// @brief A container of parent-relative transforms (translation, rotation, scale), used to compute their world matrices. 
+    /// The local transforms are stored as structure-of-arrays, and the nodes are always kept parent-before-child, 
+    /// so updateWorldMats() is a single forward pass that only recomputes the dirty nodes and their subtrees
+    /// @tparam F The type of the values stored in the transforms, a FloatingNumber, so a float or a double
+    template<FloatingNumber F>
+    struct transformHierarchy
+    {
+    public:
+        /// @brief The parent index of the root nodes
+        static constexpr std::size_t noParent = std::numeric_limits<std::size_t>::max();
+
+    private:
+        std::vector<vec3<F>> localPositions;
+        std::vector<quat<F>> localRotations;
+        std::vector<vec3<F>> localScales;
+
+        std::vector<std::size_t> parents;
+        std::vector<std::uint8_t> dirty;
+
+        std::vector<mat4<F>> localMats;
+        std::vector<mat4<F>> worldMats;
+
+        // Every node before this one is clean, so the update can start here
+        std::size_t firstDirty = 0;
+
+    public:
+        transformHierarchy() = default;
+
+        /// @brief Reserves the memory for nodeCount nodes, to avoid reallocations while adding them
+        void reserve(std::size_t nodeCount);
+        /// @brief Removes every node
+        void clear();
+
+        inline std::size_t size() const { return parents.size(); };
+        inline bool isEmpty() const { return parents.empty(); };
+
+        /// @brief A function to add a node to the hierarchy
+        /// @param parent The index of the parent, which must already be in the hierarchy, or noParent for a root. 
+        /// This is what keeps the nodes parent-before-child
+        /// @param position The position of the node, relative to its parent
+        /// @param rotation The rotation of the node, relative to its parent, must be normalized
+        /// @param scale The scale of the node, relative to its parent
+        /// @return The index of the new node
+        std::size_t addNode(std::size_t parent = noParent, 
+                            const vec3<F>& position = vec3<F>(0.0, 0.0, 0.0), 
+                            const quat<F>& rotation = quat<F>::identity(), 
+                            const vec3<F>& scale = vec3<F>(1.0, 1.0, 1.0));
+
+        inline std::size_t getParent(std::size_t node) const { return parents[node]; };
+        /// @brief A function to move a node, and its subtree, under another parent. Its local transform is kept, 
+        /// so its world matrix changes : it is marked dirty
+        /// @param parent The index of the new parent, which must come before the node, or noParent to make it a root.
+        /// This keeps the nodes parent-before-child, and a node can't become a child of its own subtree
+        void setParent(std::size_t node, std::size_t parent);
+
+        inline const vec3<F>& getLocalPosition(std::size_t node) const { return localPositions[node]; };
+        inline const quat<F>& getLocalRotation(std::size_t node) const { return localRotations[node]; };
+        inline const vec3<F>& getLocalScale(std::size_t node) const { return localScales[node]; };
+
+        /// @brief The setters mark the node dirty, its world matrix and the ones of its subtree are recomputed by the next updateWorldMats()
+        void setLocalPosition(std::size_t node, const vec3<F>& position);
+        void setLocalRotation(std::size_t node, const quat<F>& rotation);
+        void setLocalScale(std::size_t node, const vec3<F>& scale);
+        void setLocalTransform(std::size_t node, const vec3<F>& position, const quat<F>& rotation, const vec3<F>& scale);
+
+        /// @brief Marks a node dirty, without changing it
+        void markDirty(std::size_t node);
+        inline bool isDirty(std::size_t node) const { return dirty[node] != 0; };
+
+        /// @brief A function to recompute the local and world matrices of every dirty node and of their subtrees. 
+        /// The other nodes are left untouched
+        void updateWorldMats();
+
+        /// @brief The world matrix of a node, as computed by the last updateWorldMats()
+        inline const mat4<F>& getWorldMat(std::size_t node) const { return worldMats[node]; };
+        /// @brief The local matrix of a node, as computed by the last updateWorldMats()
+        inline const mat4<F>& getLocalMat(std::size_t node) const { return localMats[node]; };
+
+        /// @brief Every world matrix, in node order, ready to be uploaded as it is
+        inline std::span<const mat4<F>> getWorldMats() const { return worldMats; };
+
+        /// @brief A function to make the local matrix of a translation, a rotation and a scale, so translate * fromQuat * scale, 
+        /// without any matrix multiplication
+        /// @param rotation Must be normalized
+        static mat4<F> composeTRS(const vec3<F>& position, const quat<F>& rotation, const vec3<F>& scale);
+    };
+}
+
+#include "Math\Transforms\TransformHierarchy.inl"
@@ -0,0 +1,184 @@
+#include <concepts>
+#include <algorithm>
+#include <cassert>
+
+#include "Math\MathInternal.hpp"
+
+namespace glMath
+{
+
+    #pragma region Nodes
+
+    template<FloatingNumber F>
+    inline void transformHierarchy<F>::reserve(std::size_t nodeCount)
+    {
+        localPositions.reserve(nodeCount);
+        localRotations.reserve(nodeCount);
+        localScales.reserve(nodeCount);
+
+        parents.reserve(nodeCount);
+        dirty.reserve(nodeCount);
+
+        localMats.reserve(nodeCount);
+        worldMats.reserve(nodeCount);
+    }
+
+    template<FloatingNumber F>
+    inline void transformHierarchy<F>::clear()
+    {
+        localPositions.clear();
+        localRotations.clear();
+        localScales.clear();
+
+        parents.clear();
+        dirty.clear();
+
+        localMats.clear();
+        worldMats.clear();
+
+        firstDirty = 0;
+    }
+
+    template<FloatingNumber F>
+    inline std::size_t transformHierarchy<F>::addNode(std::size_t parent, const vec3<F>& position, const quat<F>& rotation, const vec3<F>& scale)
+    {
+        std::size_t node = parents.size();
+
+        // The parent has to come before the child, or the single-pass update breaks
+        assert(parent == noParent || parent < node);
+
+        localPositions.push_back(position);
+        localRotations.push_back(rotation);
+        localScales.push_back(scale);
+
+        parents.push_back(parent);
+        dirty.push_back(1);
+
+        localMats.push_back(mat4<F>::identity());
+        worldMats.push_back(mat4<F>::identity());
+
+        firstDirty = std::min(firstDirty, node);
+
+        return node;
+    }
+
+    template<FloatingNumber F>
+    inline void transformHierarchy<F>::setParent(std::size_t node, std::size_t parent)
+    {
+        // Same rule as addNode(), the subtree of the node only has nodes after it
+        assert(parent == noParent || parent < node);
+
+        parents[node] = parent;
+        markDirty(node);
+    }
+
+    #pragma endregion
+
+    #pragma region Setters
+
+    template<FloatingNumber F>
+    inline void transformHierarchy<F>::markDirty(std::size_t node)
+    {
+        dirty[node] = 1;
+        firstDirty = std::min(firstDirty, node);
+    }
+
+    template<FloatingNumber F>
+    inline void transformHierarchy<F>::setLocalPosition(std::size_t node, const vec3<F>& position)
+    {
+        localPositions[node] = position;
+        markDirty(node);
+    }
+
+    template<FloatingNumber F>
+    inline void transformHierarchy<F>::setLocalRotation(std::size_t node, const quat<F>& rotation)
+    {
+        localRotations[node] = rotation;
+        markDirty(node);
+    }
+
+    template<FloatingNumber F>
+    inline void transformHierarchy<F>::setLocalScale(std::size_t node, const vec3<F>& scale)
+    {
+        localScales[node] = scale;
+        markDirty(node);
+    }
+
+    template<FloatingNumber F>
+    inline void transformHierarchy<F>::setLocalTransform(std::size_t node, const vec3<F>& position, const quat<F>& rotation, const vec3<F>& scale)
+    {
+        localPositions[node] = position;
+        localRotations[node] = rotation;
+        localScales[node] = scale;
+        markDirty(node);
+    }
+
+    #pragma endregion
+
+    #pragma region Update
+
+    template<FloatingNumber F>
+    inline mat4<F> transformHierarchy<F>::composeTRS(const vec3<F>& position, const quat<F>& rotation, const vec3<F>& scale)
+    {
+        F xx = rotation.x * rotation.x;
+        F yy = rotation.y * rotation.y;
+        F zz = rotation.z * rotation.z;
+        F xy = rotation.x * rotation.y;
+        F wz = rotation.w * rotation.z;
+        F wy = rotation.w * rotation.y;
+        F wx = rotation.w * rotation.x;
+        F xz = rotation.x * rotation.z;
+        F yz = rotation.y * rotation.z;
+
+        F f0 = static_cast<F>(0.0);
+        F f1 = static_cast<F>(1.0);
+        F f2 = static_cast<F>(2.0);
+
+        // The columns of the rotation, each one scaled by its axis
+        return mat4<F>((f1 - f2 * (yy + zz)) * scale.x, f2 * (xy - wz) * scale.y       , f2 * (xz + wy) * scale.z       , position.x,
+                       f2 * (xy + wz) * scale.x       , (f1 - f2 * (xx + zz)) * scale.y, f2 * (yz - wx) * scale.z       , position.y,
+                       f2 * (xz - wy) * scale.x       , f2 * (yz + wx) * scale.y       , (f1 - f2 * (xx + yy)) * scale.z, position.z,
+                       f0                             , f0                             , f0                             , f1);
+    }
+
+    template<FloatingNumber F>
+    inline void transformHierarchy<F>::updateWorldMats()
+    {
+        std::size_t count = parents.size();
+
+        if (firstDirty >= count) return;
+
+        // The parents come before their children, so a dirty parent has always been seen (and its world matrix recomputed) 
+        // by the time its children are reached
+        for (std::size_t i = firstDirty; i < count; i++)
+        {
+            std::size_t parent = parents[i];
+
+            if (parent != noParent && dirty[parent])
+            {
+                dirty[i] = 1;
+            }
+
+            if (!dirty[i]) continue;
+
+            localMats[i] = composeTRS(localPositions[i], localRotations[i], localScales[i]);
+
+            if (parent == noParent)
+            {
+                worldMats[i] = localMats[i];
+            }
+            else
+            {
+                worldMats[i] = worldMats[parent] * localMats[i];
+            }
+        }
+
+        // The flags are cleared afterwards, the children of a node aren't always right after it
+        std::fill(dirty.begin() + firstDirty, dirty.end(), static_cast<std::uint8_t>(0));
+
+        firstDirty = count;
+    }
+
+    #pragma endregion
+
+}
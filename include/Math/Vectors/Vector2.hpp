@@ -60,8 +60,18 @@ namespace glMath
         * vec2<float> pos = vec2<float>::fromAngle(90.0f);
         * std::cout << pos.y; // 1
         * ```
+        * @tparam P The precision of the sine and cosine, exactMath or fastMath (glMath::fast's approximations)
         */
+        template<MathPolicy P = exactMath>
         inline static vec2<F> fromAngle(F angleInDeg) noexcept;
+        /*
+        * @brief Creates a vec2 from the precomputed sine and cosine of an angle (glMath::sincos), rotating anti-clockwise.
+        * ```cpp
+        * vec2<float> pos = vec2<float>::fromAngle(glMath::sincos(glMath::halfPi<float>()));
+        * std::cout << pos.y; // 1
+        * ```
+        */
+        inline static constexpr vec2<F> fromAngle(const sinCos<F>& angle) noexcept;
         /**
         * @brief Returns a number as the type of the vec2, corresponding to the angle between ``a`` and ``b``.
         * @attention The angle returned is in RADIANS.
@@ -249,6 +259,22 @@ namespace glMath
          * ```
          */
         inline static vec2 normalized(const vec2& vec) noexcept;
+        /**
+         * @brief Like normalize(), but with a fast ``1 / sqrt`` (the hardware estimate refined by one Newton-Raphson step) 
+         * instead of a square root and a division. The ``length`` ends up within ``5e-7`` of ``1`` with floats, doubles being exact.
+         * @attention If its squared ``length`` is ``0`` or denormal, it returns the vector unmodified.
+         * 
+         * ```cpp
+         * vec2<float> dir(2.0f, 1.0f);
+         * dir.normalizeFast();
+         * std::cout << dir.x; // 0.894
+         * ```
+         */
+        inline vec2& normalizeFast() noexcept;
+        /**
+         * @brief Returns a new vec2 of the same type, normalized with normalizeFast().
+         */
+        inline static vec2 normalizedFast(const vec2& vec) noexcept;
         
 
         /**
@@ -303,7 +329,11 @@ namespace glMath
 
         inline static constexpr vec2 lerp(const vec2& start, const vec2& end, F t) noexcept;
         inline static constexpr vec2 lerpUnclamped(const vec2& start, const vec2& end, F t) noexcept;
+        // P being exactMath or fastMath, for the precision of the acos and sines, or polynomialMath,
+        // whose weights are a polynomial (fast::slerpWeights()), start and end having to be normalized
+        template<MathPolicy P = exactMath>
         inline static constexpr vec2 slerp(const vec2& start, const vec2& end, F t) noexcept;
+        template<MathPolicy P = exactMath>
         inline static constexpr vec2 slerpUnclamped(const vec2& start, const vec2& end, F t) noexcept;
         
  
@@ -38,18 +38,16 @@ namespace glMath
     #pragma region StaticConstructors
 
     template <FloatingNumber F>
+    template <MathPolicy P>
     inline vec2<F> vec2<F>::fromAngle(F angleInDeg) noexcept
     {
-        F radAng = angleInDeg * glMath::degToRad<F>();
+        return vec2<F>::fromAngle(P::sincos(angleInDeg * glMath::degToRad<F>()));
+    }
 
-        if constexpr (std::is_same_v<F, float>)
-        {
-            return vec2<float>(std::cosf(radAng), std::sinf(radAng));
-        }
-        else
-        {
-            return vec2<double>(std::cos(radAng), std::sin(radAng));
-        }
+    template <FloatingNumber F>
+    inline constexpr vec2<F> vec2<F>::fromAngle(const sinCos<F>& angle) noexcept
+    {
+        return vec2<F>(angle.cos, angle.sin);
     }
     
     
@@ -100,6 +98,21 @@ namespace glMath
         return copy.normalize();
     }
 
+    template<FloatingNumber F>
+    inline vec2<F>& vec2<F>::normalizeFast() noexcept
+    {
+        F lengthSq = this->lengthSquared();
+
+        if (lengthSq >= std::numeric_limits<F>::min())
+        {
+            F inverseLength = glMath::rsqrtFast(lengthSq);
+            x *= inverseLength;
+            y *= inverseLength;
+        }
+
+        return *this;
+    }
+
     #pragma endregion Normalizing
 
     #pragma region MemberMethods
@@ -290,6 +303,14 @@ namespace glMath
         return vec.getNormalizedVec();
     }
 
+    template<FloatingNumber F>
+    inline vec2<F> vec2<F>::normalizedFast(const vec2<F>& vec) noexcept
+    {
+        vec2 copy = vec;
+
+        return copy.normalizeFast();
+    }
+
 
     template<FloatingNumber F>
     inline F vec2<F>::length(const vec2<F>& vec) noexcept
@@ -366,42 +387,40 @@ namespace glMath
 
 
     template<FloatingNumber F>
+    template<MathPolicy P>
     inline constexpr vec2<F> vec2<F>::slerp(const vec2<F>& start, const vec2<F>& end, F t) noexcept
     {
         t = glMath::clamp01(t);
-        return vec2<F>::slerpUnclamped(start, end, t);
+        return vec2<F>::slerpUnclamped<P>(start, end, t);
     }
     template<FloatingNumber F>
+    template<MathPolicy P>
     inline constexpr vec2<F> vec2<F>::slerpUnclamped(const vec2<F>& start, const vec2<F>& end, F t) noexcept
     {
         F dot = vec2<F>::dotProduct(start, end);
 
-        if (dot > static_cast<F>(0.9995))
+        if constexpr (std::is_same_v<P, polynomialMath>)
         {
-            return vec2<F>::lerpUnclamped(start, end, t);
+            lerpWeights<F> weights = P::slerpWeights(dot, t);
+            return (start * weights.start) + (end * weights.end);
         }
 
-        if constexpr (std::is_same_v<F, float>)
-        {
-            F ang = std::acosf(dot);
-            F sinAng = std::sinf(ang);
-    
-            F wA = std::sinf((1.0f - t) * ang) / sinAng;
-            F wB = std::sinf(t * ang) / sinAng;
-    
-            return (start * wA) + (end * wB);
-        }
-        else
+        if (dot > static_cast<F>(0.9995))
         {
-            F ang = std::acos(dot);
-            F sinAng = std::sin(ang);
-    
-            F wA = std::sin((1.0 - t) * ang) / sinAng;
-            F wB = std::sin(t * ang) / sinAng;
-    
-            return (start * wA) + (end * wB);
+            return vec2<F>::lerpUnclamped(start, end, t);
         }
 
+        // sin(ang) and cos(ang) are known from the dot product, so one sincos gives the two weights :
+        // sin((1 - t) * ang) / sin(ang) = cos(t * ang) - cos(ang) * sin(t * ang) / sin(ang)
+        F ang = P::acos(dot);
+        F sinAng = glMath::sqrt(static_cast<F>(1.0) - dot * dot);
+
+        sinCos<F> tAng = P::sincos(t * ang);
+
+        F wB = tAng.sin / sinAng;
+        F wA = tAng.cos - dot * wB;
+
+        return (start * wA) + (end * wB);
     }
 
 
@@ -521,8 +540,8 @@ namespace glMath
     template<FloatingNumber F>
     inline constexpr bool operator==(const vec2<F>& a, const vec2<F>& b) noexcept
     {
-        return static_cast<F>( std::abs(b.x - a.x) ) < glMath::epsilon<F>() &&
-               static_cast<F>( std::abs(b.y - a.y) ) < glMath::epsilon<F>();
+        return glMath::abs(b.x - a.x) < glMath::epsilon<F>() &&
+               glMath::abs(b.y - a.y) < glMath::epsilon<F>();
     }
 
     template<FloatingNumber F>
@@ -24,30 +24,30 @@ namespace glMath
 
     public:
         // Constructor that returns a vec3 with x being 0.0, y being 0.0, z being 0.0
-        vec3();
+        inline constexpr vec3() noexcept;
         // Constructor that returns a vec3 with x being scalar, y being scalar, z being scalar
-        vec3(F scalar);
+        inline constexpr vec3(F scalar) noexcept;
         // Constructor that returns a vec3 with x being vx, y being vy and z being vz 
-        vec3(F vx, F vy);
+        inline constexpr vec3(F vx, F vy) noexcept;
         // Constructor that returns a vec3 with x being vx, y being vy and z being 0.0 
-        vec3(F vx, F vy, F vz);
+        inline constexpr vec3(F vx, F vy, F vz) noexcept;
         // Constructor that returns a vec3 with x being vec.x, y being vec.y and z being vec.z
-        vec3(const vec3& vec);
+        inline constexpr vec3(const vec3& vec) noexcept;
 
         // Constructor that returns a vec3 with x being vec.x, y being vec.y and z being 0.0
-        vec3(const vec2<F>& xy);
+        inline constexpr vec3(const vec2<F>& xy) noexcept;
         // Constructor that returns a vec3 with x being vec.x, y being vec.y and z being vz
-        vec3(const vec2<F>& xy, F vz);
+        inline constexpr vec3(const vec2<F>& xy, F vz) noexcept;
 
 
-        inline static vec3 zero()     { return vec3(0.0, 0.0, 0.0); };
-        inline static vec3 one()      { return vec3(1.0, 1.0, 1.0); };
-        inline static vec3 right()    { return vec3(1.0, 0.0, 0.0); };
-        inline static vec3 left()     { return vec3(-1.0, 0.0, 0.0); };
-        inline static vec3 up()       { return vec3(0.0, 1.0, 0.0); };
-        inline static vec3 down()     { return vec3(0.0, -1.0, 0.0); };
-        inline static vec3 forward()  { return vec3(0.0, 0.0, 1.0); };
-        inline static vec3 backward() { return vec3(0.0, 0.0, -1.0); };
+        inline static constexpr vec3 zero() noexcept     { return vec3(0.0, 0.0, 0.0); };
+        inline static constexpr vec3 one() noexcept      { return vec3(1.0, 1.0, 1.0); };
+        inline static constexpr vec3 right() noexcept    { return vec3(1.0, 0.0, 0.0); };
+        inline static constexpr vec3 left() noexcept     { return vec3(-1.0, 0.0, 0.0); };
+        inline static constexpr vec3 up() noexcept       { return vec3(0.0, 1.0, 0.0); };
+        inline static constexpr vec3 down() noexcept     { return vec3(0.0, -1.0, 0.0); };
+        inline static constexpr vec3 forward() noexcept  { return vec3(0.0, 0.0, 1.0); };
+        inline static constexpr vec3 backward() noexcept { return vec3(0.0, 0.0, -1.0); };
      
 
         static vec3 fromQuat(const quat<F>& angle);
@@ -56,85 +56,94 @@ namespace glMath
         template<FloatingNumber type>
         vec3<type> as() const;
 
-        vec3 xxx() const { return vec3(x, x, x); };
-        vec3 yyy() const { return vec3(y, y, y); };
-        vec3 zzz() const { return vec3(z, z, z); };
-        vec3 zyx() const { return vec3(z, y, x); };
+        inline constexpr vec3 xxx() const noexcept { return vec3(x, x, x); };
+        inline constexpr vec3 yyy() const noexcept { return vec3(y, y, y); };
+        inline constexpr vec3 zzz() const noexcept { return vec3(z, z, z); };
+        inline constexpr vec3 zyx() const noexcept { return vec3(z, y, x); };
 
 
         const F* valuePtr() const;
 
         F length() const;
-        F lengthSquared() const;
+        inline constexpr F lengthSquared() const noexcept;
 
-        F dotProduct(const vec3& other) const;
-        vec3<F> crossProduct(const vec3<F>& other) const;
+        inline constexpr F dotProduct(const vec3& other) const noexcept;
+        inline constexpr vec3<F> crossProduct(const vec3<F>& other) const noexcept;
 
         F distance(const vec3& other) const;
-        F distanceSquared(const vec3& other) const;
+        inline constexpr F distanceSquared(const vec3& other) const noexcept;
 
         static F length(const vec3& vec);
-        static F lengthSquared(const vec3& vec)  ;
+        inline static constexpr F lengthSquared(const vec3& vec) noexcept;
 
-        static F dotProduct(const vec3& vec1, const vec3& vec2);
+        inline static constexpr F dotProduct(const vec3& vec1, const vec3& vec2) noexcept;
 
-        static vec3 crossProduct(const vec3& a, const vec3& b);
+        inline static constexpr vec3 crossProduct(const vec3& a, const vec3& b) noexcept;
 
         static F distance(const vec3& vec1, const vec3& vec2);
-        static F distanceSquared(const vec3& vec1, const vec3& vec2);
+        inline static constexpr F distanceSquared(const vec3& vec1, const vec3& vec2) noexcept;
 
         vec3& normalize();
         vec3 getNormalizedVec() const;
         static vec3 normalized(const vec3& vec);
 
-        vec3 min(const vec3& other) const;
-        static vec3 min(const vec3& a, const vec3& b);
+        // Like normalize(), with a fast 1 / sqrt (the hardware estimate and one Newton-Raphson step) instead of a square root and a division.
+        // With floats the length is within 5e-7 of 1, doubles are exact. The vectors whose squared length is 0 or denormal are left untouched
+        vec3& normalizeFast();
+        static vec3 normalizedFast(const vec3& vec);
 
-        vec3 max(const vec3& other) const;
-        static vec3 max(const vec3& a, const vec3& b);
+        inline constexpr vec3 min(const vec3& other) const noexcept;
+        inline static constexpr vec3 min(const vec3& a, const vec3& b) noexcept;
 
-        static vec3 lerp(const vec3& start, const vec3& end, F t);
-        static vec3 lerpUnclamped(const vec3& start, const vec3& end, F t);
+        inline constexpr vec3 max(const vec3& other) const noexcept;
+        inline static constexpr vec3 max(const vec3& a, const vec3& b) noexcept;
 
+        inline static constexpr vec3 lerp(const vec3& start, const vec3& end, F t) noexcept;
+        inline static constexpr vec3 lerpUnclamped(const vec3& start, const vec3& end, F t) noexcept;
+
+        // P being exactMath or fastMath, for the precision of the acos and sines, or polynomialMath,
+        // whose weights are a polynomial (fast::slerpWeights()), start and end having to be normalized
+        template<MathPolicy P = exactMath>
         static vec3 slerp(const vec3& start, const vec3& end, F t);
+        template<MathPolicy P = exactMath>
         static vec3 slerpUnclamped(const vec3& start, const vec3& end, F t);
 
 
-        vec3& operator+=(const vec3& other);
-        vec3& operator+=(F scalar);
-        vec3& operator-=(const vec3& other);
-        vec3& operator-=(F scalar);
-        vec3& operator*=(const vec3& other);
-        vec3& operator*=(F scalar);
-        vec3& operator/=(F scalar);
+        inline constexpr vec3& operator+=(const vec3& other) noexcept;
+        inline constexpr vec3& operator+=(F scalar) noexcept;
+        inline constexpr vec3& operator-=(const vec3& other) noexcept;
+        inline constexpr vec3& operator-=(F scalar) noexcept;
+        inline constexpr vec3& operator*=(const vec3& other) noexcept;
+        inline constexpr vec3& operator*=(F scalar) noexcept;
+        inline constexpr vec3& operator/=(F scalar) noexcept;
 
-        vec3 operator-() const;
+        inline constexpr vec3 operator-() const noexcept;
     };
 
     template<FloatingNumber F>
-    inline vec3<F> operator+(const vec3<F>& a, const vec3<F>& b);
+    inline constexpr vec3<F> operator+(const vec3<F>& a, const vec3<F>& b) noexcept;
     template<FloatingNumber F>
-    inline vec3<F> operator+(const vec3<F>& a, F scalar);
+    inline constexpr vec3<F> operator+(const vec3<F>& a, F scalar) noexcept;
 
     template<FloatingNumber F>
-    inline vec3<F> operator-(const vec3<F>& a, const vec3<F>& b);
+    inline constexpr vec3<F> operator-(const vec3<F>& a, const vec3<F>& b) noexcept;
     template<FloatingNumber F>
-    inline vec3<F> operator-(const vec3<F>& a, F scalar);
+    inline constexpr vec3<F> operator-(const vec3<F>& a, F scalar) noexcept;
 
     template<FloatingNumber F>
-    inline vec3<F> operator*(const vec3<F>& a, const vec3<F>& b);
+    inline constexpr vec3<F> operator*(const vec3<F>& a, const vec3<F>& b) noexcept;
     template<FloatingNumber F>
-    inline vec3<F> operator*(const vec3<F>& vec, F scalar);
+    inline constexpr vec3<F> operator*(const vec3<F>& vec, F scalar) noexcept;
     template<FloatingNumber F>
-    inline vec3<F> operator*(F scalar, const vec3<F>& vec);
+    inline constexpr vec3<F> operator*(F scalar, const vec3<F>& vec) noexcept;
     
     template<FloatingNumber F>
-    inline vec3<F> operator/(const vec3<F>& vec, F scalar);
+    inline constexpr vec3<F> operator/(const vec3<F>& vec, F scalar) noexcept;
 
     template<FloatingNumber F>
-    inline bool operator==(const vec3<F>& a, const vec3<F>& b);
+    inline constexpr bool operator==(const vec3<F>& a, const vec3<F>& b) noexcept;
     template<FloatingNumber F>
-    inline bool operator!=(const vec3<F>& a, const vec3<F>& b);
+    inline constexpr bool operator!=(const vec3<F>& a, const vec3<F>& b) noexcept;
 }
 
 #include "Math\Vectors\Vector3.inl"
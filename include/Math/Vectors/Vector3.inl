@@ -13,38 +13,38 @@ namespace glMath
     #pragma region Constructors
 
     template<FloatingNumber F>
-    inline vec3<F>::vec3() 
+    inline constexpr vec3<F>::vec3() noexcept 
         : x(static_cast<F>(0.0)), y(static_cast<F>(0.0)), z(static_cast<F>(0.0))
     {}
 
     template<FloatingNumber F>
-    inline vec3<F>::vec3(F scalar)
+    inline constexpr vec3<F>::vec3(F scalar) noexcept
         : x(scalar), y(scalar), z(scalar) 
     {}
 
     template<FloatingNumber F>
-    inline vec3<F>::vec3(F vx, F vy)
+    inline constexpr vec3<F>::vec3(F vx, F vy) noexcept
         : x(vx), y(vy), z(static_cast<F>(0.0))
     {}
 
     template<FloatingNumber F>
-    inline vec3<F>::vec3(F vx, F vy, F vz)
+    inline constexpr vec3<F>::vec3(F vx, F vy, F vz) noexcept
         : x(vx), y(vy), z(vz)
     {}
 
     template<FloatingNumber F>
-    inline vec3<F>::vec3(const vec3<F>& vec)
+    inline constexpr vec3<F>::vec3(const vec3<F>& vec) noexcept
         : x(vec.x), y(vec.y), z(vec.z)
     {}
 
 
     template<FloatingNumber F>
-    inline vec3<F>::vec3(const vec2<F>& vec)
+    inline constexpr vec3<F>::vec3(const vec2<F>& vec) noexcept
         : x(vec.x), y(vec.y), z(static_cast<F>(0.0))
     {}
 
     template<FloatingNumber F>
-    inline vec3<F>::vec3(const vec2<F>& vec, F vz)
+    inline constexpr vec3<F>::vec3(const vec2<F>& vec, F vz) noexcept
         : x(vec.x), y(vec.y), z(vz)
     {}
     
@@ -116,16 +116,30 @@ namespace glMath
     {
         F l = this->length();
 
-        if (l > static_cast<F>(0.0))
+        if constexpr (LaneNumber<F>)
         {
-            F inverseLength = static_cast<F>(1.0 / l);
+            // The lanes of length 0 are multiplied by 1, so left untouched
+            F inverseLength = glMath::select(l > static_cast<F>(0.0), static_cast<F>(1.0) / l, static_cast<F>(1.0));
 
             x *= inverseLength;
             y *= inverseLength;
             z *= inverseLength;
+
+            return *this;
         }
+        else
+        {
+            if (l > static_cast<F>(0.0))
+            {
+                F inverseLength = static_cast<F>(1.0 / l);
 
-        return *this;
+                x *= inverseLength;
+                y *= inverseLength;
+                z *= inverseLength;
+            }
+
+            return *this;
+        }
     }
 
     template<FloatingNumber F>
@@ -136,6 +150,37 @@ namespace glMath
         return copy.normalize();
     }
 
+    template<FloatingNumber F>
+    inline vec3<F>& vec3<F>::normalizeFast()
+    {
+        F lengthSq = this->lengthSquared();
+
+        if constexpr (LaneNumber<F>)
+        {
+            F minLengthSq = static_cast<F>(std::numeric_limits<typename F::valueType>::min());
+            F inverseLength = glMath::select(lengthSq >= minLengthSq, glMath::rsqrtFast(lengthSq), static_cast<F>(1.0));
+
+            x *= inverseLength;
+            y *= inverseLength;
+            z *= inverseLength;
+
+            return *this;
+        }
+        else
+        {
+            if (lengthSq >= std::numeric_limits<F>::min())
+            {
+                F inverseLength = glMath::rsqrtFast(lengthSq);
+
+                x *= inverseLength;
+                y *= inverseLength;
+                z *= inverseLength;
+            }
+
+            return *this;
+        }
+    }
+
     #pragma endregion Normalizing
 
     #pragma region MemberMethods
@@ -149,11 +194,11 @@ namespace glMath
     template<FloatingNumber F>
     inline F vec3<F>::length() const
     {
-        return std::sqrt( (x * x) + (y * y) + (z * z) );
+        return glMath::sqrt( (x * x) + (y * y) + (z * z) );
     }
 
     template<FloatingNumber F>
-    inline F vec3<F>::lengthSquared() const
+    inline constexpr F vec3<F>::lengthSquared() const noexcept
     {
         return  (x * x) + (y * y) + (z * z);
     }
@@ -161,23 +206,23 @@ namespace glMath
     template<FloatingNumber F>
     inline F vec3<F>::distance(const vec3<F>& other) const
     {
-        return std::sqrt( (other.x - x) * (other.x - x) + (other.y - y) * (other.y - y) +(other.z - z) * (other.z - z) );
+        return glMath::sqrt( (other.x - x) * (other.x - x) + (other.y - y) * (other.y - y) +(other.z - z) * (other.z - z) );
     }
 
     template<FloatingNumber F>
-    inline F vec3<F>::distanceSquared(const vec3<F>& other) const
+    inline constexpr F vec3<F>::distanceSquared(const vec3<F>& other) const noexcept
     {
-        return std::sqrt( (other.x - x) * (other.x - x) + (other.y - y) * (other.y - y) +(other.z - z) * (other.z - z) );
+        return (other.x - x) * (other.x - x) + (other.y - y) * (other.y - y) + (other.z - z) * (other.z - z);
     }
 
     template<FloatingNumber F>
-    inline F vec3<F>::dotProduct(const vec3<F>& other) const
+    inline constexpr F vec3<F>::dotProduct(const vec3<F>& other) const noexcept
     {
         return  (x * other.x) + (y * other.y) + (z * other.z);
     }
 
     template<FloatingNumber F>
-    inline vec3<F> vec3<F>::crossProduct(const vec3<F>& other) const
+    inline constexpr vec3<F> vec3<F>::crossProduct(const vec3<F>& other) const noexcept
     {
         return vec3<F>(
             y * other.z - z * other.y,
@@ -188,12 +233,12 @@ namespace glMath
 
 
     template<FloatingNumber F>
-    inline vec3<F> vec3<F>::min(const vec3<F>& other) const
+    inline constexpr vec3<F> vec3<F>::min(const vec3<F>& other) const noexcept
     {
         return vec3<F>(glMath::min(x, other.x), glMath::min(y, other.y), glMath::min(z, other.z));
     }
     template<FloatingNumber F>
-    inline vec3<F> vec3<F>::max(const vec3<F>& other) const
+    inline constexpr vec3<F> vec3<F>::max(const vec3<F>& other) const noexcept
     {
         return vec3<F>(glMath::max(x, other.x), glMath::max(y, other.y), glMath::max(z, other.z));
     }
@@ -208,14 +253,22 @@ namespace glMath
         return vec.getNormalizedVec();
     }
 
+    template<FloatingNumber F>
+    inline vec3<F> vec3<F>::normalizedFast(const vec3<F>& vec)
+    {
+        vec3 copy = vec;
+
+        return copy.normalizeFast();
+    }
+
     template<FloatingNumber F>
     inline F vec3<F>::length(const vec3<F>& vec) 
     {
-        return std::sqrt( (vec.x * vec.x) + (vec.y * vec.y) + (vec.z * vec.z) );
+        return glMath::sqrt( (vec.x * vec.x) + (vec.y * vec.y) + (vec.z * vec.z) );
     }
 
     template<FloatingNumber F>
-    inline F vec3<F>::lengthSquared(const vec3<F>& vec) 
+    inline constexpr F vec3<F>::lengthSquared(const vec3<F>& vec) noexcept 
     {
         return  (vec.x * vec.x) + (vec.y * vec.y) + (vec.z * vec.z);
     }
@@ -223,23 +276,23 @@ namespace glMath
     template<FloatingNumber F>
     inline F vec3<F>::distance(const vec3<F>& a, const vec3<F>& b) 
     {
-        return std::sqrt( (b.x - a.x) * (b.x - a.x) + (b.y - a.y) * (b.y - a.y) +(b.z - a.z) * (b.z - a.z) );
+        return glMath::sqrt( (b.x - a.x) * (b.x - a.x) + (b.y - a.y) * (b.y - a.y) +(b.z - a.z) * (b.z - a.z) );
     }
 
     template<FloatingNumber F>
-    inline F vec3<F>::distanceSquared(const vec3<F>& a, const vec3<F>& b) 
+    inline constexpr F vec3<F>::distanceSquared(const vec3<F>& a, const vec3<F>& b) noexcept 
     {
-        return std::sqrt( (b.x - a.x) * (b.x - a.x) + (b.y - a.y) * (b.y - a.y) +(b.z - a.z) * (b.z - a.z) );
+        return (b.x - a.x) * (b.x - a.x) + (b.y - a.y) * (b.y - a.y) + (b.z - a.z) * (b.z - a.z);
     }
 
     template<FloatingNumber F>
-    inline F vec3<F>::dotProduct(const vec3<F>& a, const vec3<F>& b) 
+    inline constexpr F vec3<F>::dotProduct(const vec3<F>& a, const vec3<F>& b) noexcept 
     {
         return (a.x * b.x) + (a.y * b.y) + (a.z * b.z);
     }
 
     template<FloatingNumber F>
-    inline vec3<F> vec3<F>::crossProduct(const vec3<F>& a, const vec3<F>& b) 
+    inline constexpr vec3<F> vec3<F>::crossProduct(const vec3<F>& a, const vec3<F>& b) noexcept 
     {
         F vx = a.y * b.z - a.z * b.y;
         F vy = a.z * b.x - a.x * b.z;
@@ -250,52 +303,78 @@ namespace glMath
 
     
     template<FloatingNumber F>
-    inline vec3<F> vec3<F>::min(const vec3<F>& a, const vec3<F>& b)
+    inline constexpr vec3<F> vec3<F>::min(const vec3<F>& a, const vec3<F>& b) noexcept
     {
         return vec3<F>(glMath::min(a.x, b.x), glMath::min(a.y, b.y), glMath::min(a.z, b.z));
     }
     template<FloatingNumber F>
-    inline vec3<F> vec3<F>::max(const vec3<F>& a, const vec3<F>& b)
+    inline constexpr vec3<F> vec3<F>::max(const vec3<F>& a, const vec3<F>& b) noexcept
     {
         return vec3<F>(glMath::max(a.x, b.x), glMath::max(a.y, b.y), glMath::max(a.z, b.z));
     }
 
 
     template<FloatingNumber F>
-    inline vec3<F> vec3<F>::lerp(const vec3<F>& start, const vec3<F>& end, F t)
+    inline constexpr vec3<F> vec3<F>::lerp(const vec3<F>& start, const vec3<F>& end, F t) noexcept
     {
         t = glMath::clamp01(t);
         return vec3(start.x + (end.x - start.x) * t, start.y + (end.y - start.y) * t, start.z + (end.z - start.z) * t);
     }
     template<FloatingNumber F>
-    inline vec3<F> vec3<F>::lerpUnclamped(const vec3<F>& start, const vec3<F>& end, F t)
+    inline constexpr vec3<F> vec3<F>::lerpUnclamped(const vec3<F>& start, const vec3<F>& end, F t) noexcept
     {
         return vec3(start.x + (end.x - start.x) * t, start.y + (end.y - start.y) * t, start.z + (end.z - start.z) * t);
     }
 
     template<FloatingNumber F>
+    template<MathPolicy P>
     inline vec3<F> vec3<F>::slerp(const vec3<F>& start, const vec3<F>& end, F t)
     {
         t = glMath::clamp01(t);
-        return vec3<F>::slerpUnclamped(start, end, t);
+        return vec3<F>::slerpUnclamped<P>(start, end, t);
     }
     template<FloatingNumber F>
+    template<MathPolicy P>
     inline vec3<F> vec3<F>::slerpUnclamped(const vec3<F>& start, const vec3<F>& end, F t)
     {
         F dot = vec3<F>::dotProduct(start, end);
 
-        if (dot > static_cast<F>(0.9995))
+        if constexpr (std::is_same_v<P, polynomialMath>)
+        {
+            lerpWeights<F> weights = P::slerpWeights(dot, t);
+            return (start * weights.start) + (end * weights.end);
+        }
+
+        if constexpr (LaneNumber<F>)
         {
-            return vec3<F>::lerpUnclamped(start, end, t);
+            // Every lane takes both paths, and the lanes where the vectors are almost parallel keep the weights of the lerp
+            F f1 = static_cast<F>(1.0);
+
+            F ang = P::acos(glMath::clamp(dot, -f1, f1));
+            F sinAng = P::sin(ang);
+
+            auto nearlyParallel = dot > static_cast<F>(0.9995);
+
+            F wA = glMath::select(nearlyParallel, f1 - t, P::sin((f1 - t) * ang) / sinAng);
+            F wB = glMath::select(nearlyParallel, t, P::sin(t * ang) / sinAng);
+
+            return (start * wA) + (end * wB);
         }
+        else
+        {
+            if (dot > static_cast<F>(0.9995))
+            {
+                return vec3<F>::lerpUnclamped(start, end, t);
+            }
 
-        F ang = std::acos(dot);
-        F sinAng = std::sin(ang);
+            F ang = P::acos(dot);
+            F sinAng = P::sin(ang);
 
-        F wA = std::sin((static_cast<F>(1.0) - t) * ang) / sinAng;
-        F wB = std::sin(t * ang) / sinAng;
+            F wA = P::sin((static_cast<F>(1.0) - t) * ang) / sinAng;
+            F wB = P::sin(t * ang) / sinAng;
 
-        return (start * wA) + (end * wB);
+            return (start * wA) + (end * wB);
+        }
     }
 
     #pragma endregion StaticMethods
@@ -303,7 +382,7 @@ namespace glMath
     #pragma region ReferenceOperators
 
     template<FloatingNumber F>
-    inline vec3<F>& vec3<F>::operator+=(const vec3<F>& other)
+    inline constexpr vec3<F>& vec3<F>::operator+=(const vec3<F>& other) noexcept
     {
         this->x += other.x;
         this->y += other.y;
@@ -312,7 +391,7 @@ namespace glMath
         return *this;
     }
     template<FloatingNumber F>
-    inline vec3<F>& vec3<F>::operator+=(F scalar)
+    inline constexpr vec3<F>& vec3<F>::operator+=(F scalar) noexcept
     {
         this->x += scalar;
         this->y += scalar;
@@ -322,7 +401,7 @@ namespace glMath
     }
 
     template<FloatingNumber F>
-    inline vec3<F>& vec3<F>::operator-=(const vec3<F>& other)
+    inline constexpr vec3<F>& vec3<F>::operator-=(const vec3<F>& other) noexcept
     {
         this->x -= other.x;
         this->y -= other.y;
@@ -331,7 +410,7 @@ namespace glMath
         return *this;
     }
     template<FloatingNumber F>
-    inline vec3<F>& vec3<F>::operator-=(F scalar)
+    inline constexpr vec3<F>& vec3<F>::operator-=(F scalar) noexcept
     {
         this->x -= scalar;
         this->y -= scalar;
@@ -341,7 +420,7 @@ namespace glMath
     }
 
     template<FloatingNumber F>
-    inline vec3<F>& vec3<F>::operator*=(const vec3<F>& other)
+    inline constexpr vec3<F>& vec3<F>::operator*=(const vec3<F>& other) noexcept
     {
         this->x *= other.x;
         this->y *= other.y;
@@ -350,7 +429,7 @@ namespace glMath
         return *this;
     }
     template<FloatingNumber F>
-    inline vec3<F>& vec3<F>::operator*=(F scalar)
+    inline constexpr vec3<F>& vec3<F>::operator*=(F scalar) noexcept
     {
         this->x *= scalar;
         this->y *= scalar;
@@ -360,18 +439,26 @@ namespace glMath
     }
 
     template<FloatingNumber F>
-    inline vec3<F>& vec3<F>::operator/=(F scalar)
+    inline constexpr vec3<F>& vec3<F>::operator/=(F scalar) noexcept
     {
-        if (scalar != static_cast<F>(0.0))
+        if constexpr (LaneNumber<F>)
         {
-            scalar = static_cast<F>(1.0) / scalar;
+            *this = *this / scalar;
+            return *this;
+        }
+        else
+        {
+            if (scalar != static_cast<F>(0.0))
+            {
+                scalar = static_cast<F>(1.0) / scalar;
 
-            this->x *= scalar;
-            this->y *= scalar;
-            this->z *= scalar;
-        } 
+                this->x *= scalar;
+                this->y *= scalar;
+                this->z *= scalar;
+            } 
 
-        return *this;
+            return *this;
+        }
     }
 
     #pragma endregion ReferenceOperators
@@ -379,70 +466,80 @@ namespace glMath
     #pragma region ArithmeticOperators
 
     template<FloatingNumber F>
-    inline vec3<F> operator+(const vec3<F>& a, const vec3<F>& b)
+    inline constexpr vec3<F> operator+(const vec3<F>& a, const vec3<F>& b) noexcept
     {
         return vec3(a.x + b.x, a.y + b.y, a.z + b.z);
     }
     template<FloatingNumber F>
-    inline vec3<F> operator+(const vec3<F>& a, F scalar)
+    inline constexpr vec3<F> operator+(const vec3<F>& a, F scalar) noexcept
     {
         return vec3(a.x + scalar, a.y + scalar, a.z + scalar);
     }
 
     template<FloatingNumber F>
-    inline vec3<F> operator-(const vec3<F>& a, const vec3<F>& b)
+    inline constexpr vec3<F> operator-(const vec3<F>& a, const vec3<F>& b) noexcept
     {
         return vec3(a.x - b.x, a.y - b.y, a.z - b.z);
     }
     template<FloatingNumber F>
-    inline vec3<F> operator-(const vec3<F>& a, F scalar)
+    inline constexpr vec3<F> operator-(const vec3<F>& a, F scalar) noexcept
     {
         return vec3(a.x - scalar, a.y - scalar, a.z - scalar);
     }
 
 
     template <FloatingNumber F>
-    inline vec3<F> vec3<F>::operator-() const
+    inline constexpr vec3<F> vec3<F>::operator-() const noexcept
     {
         return vec3(-x, -y, -z);
     }
 
 
     template<FloatingNumber F>
-    inline vec3<F> operator*(const vec3<F>& a, const vec3<F>& b)
+    inline constexpr vec3<F> operator*(const vec3<F>& a, const vec3<F>& b) noexcept
     {
         return vec3(a.x * b.x, a.y * b.y, a.z * b.z);
     }
     template<FloatingNumber F>
-    inline vec3<F> operator*(const vec3<F>& vec, F scalar)
+    inline constexpr vec3<F> operator*(const vec3<F>& vec, F scalar) noexcept
     {
         return vec3(vec.x * scalar, vec.y * scalar, vec.z * scalar);
     }
     template<FloatingNumber F>
-    inline vec3<F> operator*(F scalar, const vec3<F>& vec)
+    inline constexpr vec3<F> operator*(F scalar, const vec3<F>& vec) noexcept
     {
         return vec3(vec.x * scalar, vec.y * scalar, vec.z * scalar);
     }
     template<FloatingNumber F>
-    inline vec3<F> operator/(const vec3<F>& vec, F scalar)
+    inline constexpr vec3<F> operator/(const vec3<F>& vec, F scalar) noexcept
     {
-        if (scalar == static_cast<F>(0.0)) return vec;
+        if constexpr (LaneNumber<F>)
+        {
+            // The lanes divided by 0 are multiplied by 1 instead
+            F invScalar = glMath::select(scalar == static_cast<F>(0.0), static_cast<F>(1.0), static_cast<F>(1.0) / scalar);
 
-        scalar = static_cast<F>(1.0) / scalar;
+            return vec3(vec.x * invScalar, vec.y * invScalar, vec.z * invScalar);
+        }
+        else
+        {
+            if (scalar == static_cast<F>(0.0)) return vec;
 
-        return vec3(vec.x * scalar, vec.y * scalar, vec.z * scalar);
+            scalar = static_cast<F>(1.0) / scalar;
+
+            return vec3(vec.x * scalar, vec.y * scalar, vec.z * scalar);
+        }
     }
 
     template<FloatingNumber F>
-    inline bool operator==(const vec3<F>& a, const vec3<F>& b)
+    inline constexpr bool operator==(const vec3<F>& a, const vec3<F>& b) noexcept
     {
-        return static_cast<F>(std::abs(a.x - b.x)) < glMath::epsilon<F>() && 
-               static_cast<F>(std::abs(a.y - b.y)) < glMath::epsilon<F>() &&
-               static_cast<F>(std::abs(a.z - b.z)) < glMath::epsilon<F>();
+        return glMath::abs(a.x - b.x) < glMath::epsilon<F>() && 
+               glMath::abs(a.y - b.y) < glMath::epsilon<F>() &&
+               glMath::abs(a.z - b.z) < glMath::epsilon<F>();
     }
 
     template<FloatingNumber F>
-    inline bool operator!=(const vec3<F>& a, const vec3<F>& b)
+    inline constexpr bool operator!=(const vec3<F>& a, const vec3<F>& b) noexcept
     {
         return !(a == b);
     }
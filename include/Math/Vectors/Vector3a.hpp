@@ -0,0 +1,153 @@
+#pragma once
+
+#include "Math\Concepts.hpp"
+#include "Math\Vectors\Vector3.hpp"
+#include "Math\Vectors\Vector4.hpp"
+
+namespace glMath
+{
+    template<FloatingNumber F>
+    struct quat;
+
+    /// @brief A vec3 padded to the size of a vec4 and aligned like it, the 4th value being kept at 0.
+    /// Unlike vec3, the whole vector is one full-width SIMD load (SSE for float, AVX for double), so its functions
+    /// are computed in one register, and arrays of vec3a can be transformed by mat4 and quat without being repacked.
+    /// It converts implicitly from and to vec3 and vec4, so it can be used where they are expected
+    //
+    // ( x y z 0 ) <- padding, always 0
+    //
+    /// @tparam F The type of the values stored in the vector, a FloatingNumber, so a float or a double
+    template<FloatingNumber F>
+    struct alignas(sizeof(F) * 4) vec3a
+    {
+    public:
+        union
+        {
+            struct { F x, y, z, padding; };
+            struct { F r, g, b; };
+            F data[4];
+        };
+
+    public:
+        // Constructor that returns a vec3a with x being 0.0, y being 0.0, z being 0.0
+        inline constexpr vec3a() noexcept;
+        // Constructor that returns a vec3a with x being scalar, y being scalar, z being scalar
+        inline constexpr vec3a(F scalar) noexcept;
+        // Constructor that returns a vec3a with x being vx, y being vy and z being vz
+        inline constexpr vec3a(F vx, F vy, F vz) noexcept;
+
+        // Constructor that returns a vec3a with x being vec.x, y being vec.y and z being vec.z
+        inline constexpr vec3a(const vec3<F>& vec) noexcept;
+        // Constructor that returns a vec3a with x being vec.x, y being vec.y and z being vec.z, vec.w being dropped
+        inline constexpr vec3a(const vec4<F>& vec) noexcept;
+
+        // The vec3 with the same x, y and z
+        inline constexpr operator vec3<F>() const noexcept;
+        // The vec4 with the same x, y and z, and w being 0.0, so a direction
+        inline constexpr operator vec4<F>() const noexcept;
+
+
+        inline static constexpr vec3a zero() noexcept     { return vec3a(0.0, 0.0, 0.0); };
+        inline static constexpr vec3a one() noexcept      { return vec3a(1.0, 1.0, 1.0); };
+        inline static constexpr vec3a right() noexcept    { return vec3a(1.0, 0.0, 0.0); };
+        inline static constexpr vec3a left() noexcept     { return vec3a(-1.0, 0.0, 0.0); };
+        inline static constexpr vec3a up() noexcept       { return vec3a(0.0, 1.0, 0.0); };
+        inline static constexpr vec3a down() noexcept     { return vec3a(0.0, -1.0, 0.0); };
+        inline static constexpr vec3a forward() noexcept  { return vec3a(0.0, 0.0, 1.0); };
+        inline static constexpr vec3a backward() noexcept { return vec3a(0.0, 0.0, -1.0); };
+
+
+        // Like vec3::fromQuat(), the Euler angles of the quaternion in degrees
+        static vec3a fromQuat(const quat<F>& angle);
+
+
+        inline constexpr vec3a xxx() const noexcept { return vec3a(x, x, x); };
+        inline constexpr vec3a yyy() const noexcept { return vec3a(y, y, y); };
+        inline constexpr vec3a zzz() const noexcept { return vec3a(z, z, z); };
+        inline constexpr vec3a zyx() const noexcept { return vec3a(z, y, x); };
+
+
+        const F* valuePtr() const;
+
+        F length() const;
+        inline constexpr F lengthSquared() const noexcept;
+
+        inline constexpr F dotProduct(const vec3a& other) const noexcept;
+        inline constexpr vec3a crossProduct(const vec3a& other) const noexcept;
+
+        F distance(const vec3a& other) const;
+        inline constexpr F distanceSquared(const vec3a& other) const noexcept;
+
+        static F length(const vec3a& vec);
+        inline static constexpr F lengthSquared(const vec3a& vec) noexcept;
+
+        inline static constexpr F dotProduct(const vec3a& a, const vec3a& b) noexcept;
+
+        inline static constexpr vec3a crossProduct(const vec3a& a, const vec3a& b) noexcept;
+
+        static F distance(const vec3a& a, const vec3a& b);
+        inline static constexpr F distanceSquared(const vec3a& a, const vec3a& b) noexcept;
+
+        vec3a& normalize();
+        vec3a getNormalizedVec() const;
+        static vec3a normalized(const vec3a& vec);
+
+        // Like vec3::normalizeFast(), with a fast 1 / sqrt instead of a square root and a division
+        vec3a& normalizeFast();
+        static vec3a normalizedFast(const vec3a& vec);
+
+        inline constexpr vec3a min(const vec3a& other) const noexcept;
+        inline static constexpr vec3a min(const vec3a& a, const vec3a& b) noexcept;
+
+        inline constexpr vec3a max(const vec3a& other) const noexcept;
+        inline static constexpr vec3a max(const vec3a& a, const vec3a& b) noexcept;
+
+        inline static constexpr vec3a lerp(const vec3a& start, const vec3a& end, F t) noexcept;
+        inline static constexpr vec3a lerpUnclamped(const vec3a& start, const vec3a& end, F t) noexcept;
+
+        // P being exactMath or fastMath, for the precision of the acos and sines, or polynomialMath,
+        // whose weights are a polynomial (fast::slerpWeights()), start and end having to be normalized
+        template<MathPolicy P = exactMath>
+        static vec3a slerp(const vec3a& start, const vec3a& end, F t);
+        template<MathPolicy P = exactMath>
+        static vec3a slerpUnclamped(const vec3a& start, const vec3a& end, F t);
+
+
+        inline constexpr vec3a& operator+=(const vec3a& other) noexcept;
+        inline constexpr vec3a& operator+=(F scalar) noexcept;
+        inline constexpr vec3a& operator-=(const vec3a& other) noexcept;
+        inline constexpr vec3a& operator-=(F scalar) noexcept;
+        inline constexpr vec3a& operator*=(const vec3a& other) noexcept;
+        inline constexpr vec3a& operator*=(F scalar) noexcept;
+        inline constexpr vec3a& operator/=(F scalar) noexcept;
+
+        inline constexpr vec3a operator-() const noexcept;
+    };
+
+    template<FloatingNumber F>
+    inline constexpr vec3a<F> operator+(const vec3a<F>& a, const vec3a<F>& b) noexcept;
+    template<FloatingNumber F>
+    inline constexpr vec3a<F> operator+(const vec3a<F>& a, F scalar) noexcept;
+
+    template<FloatingNumber F>
+    inline constexpr vec3a<F> operator-(const vec3a<F>& a, const vec3a<F>& b) noexcept;
+    template<FloatingNumber F>
+    inline constexpr vec3a<F> operator-(const vec3a<F>& a, F scalar) noexcept;
+
+    template<FloatingNumber F>
+    inline constexpr vec3a<F> operator*(const vec3a<F>& a, const vec3a<F>& b) noexcept;
+    template<FloatingNumber F>
+    inline constexpr vec3a<F> operator*(const vec3a<F>& vec, F scalar) noexcept;
+    template<FloatingNumber F>
+    inline constexpr vec3a<F> operator*(F scalar, const vec3a<F>& vec) noexcept;
+
+    template<FloatingNumber F>
+    inline constexpr vec3a<F> operator/(const vec3a<F>& vec, F scalar) noexcept;
+
+    template<FloatingNumber F>
+    inline constexpr bool operator==(const vec3a<F>& a, const vec3a<F>& b) noexcept;
+    template<FloatingNumber F>
+    inline constexpr bool operator!=(const vec3a<F>& a, const vec3a<F>& b) noexcept;
+}
+
+#include "Math\Vectors\Vector3a.inl"
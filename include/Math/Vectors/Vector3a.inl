@@ -0,0 +1,516 @@
+#include <concepts>
+#include <cmath>
+#include <limits>
+#include <type_traits>
+
+#include "Math\MathInternal.hpp"
+#include "Math\SimdInternal.hpp"
+
+namespace glMath
+{
+
+    #pragma region Constructors
+
+    template<FloatingNumber F>
+    inline constexpr vec3a<F>::vec3a() noexcept
+        : x(static_cast<F>(0.0)), y(static_cast<F>(0.0)), z(static_cast<F>(0.0)), padding(static_cast<F>(0.0))
+    {}
+
+    template<FloatingNumber F>
+    inline constexpr vec3a<F>::vec3a(F scalar) noexcept
+        : x(scalar), y(scalar), z(scalar), padding(static_cast<F>(0.0))
+    {}
+
+    template<FloatingNumber F>
+    inline constexpr vec3a<F>::vec3a(F vx, F vy, F vz) noexcept
+        : x(vx), y(vy), z(vz), padding(static_cast<F>(0.0))
+    {}
+
+
+    template<FloatingNumber F>
+    inline constexpr vec3a<F>::vec3a(const vec3<F>& vec) noexcept
+        : x(vec.x), y(vec.y), z(vec.z), padding(static_cast<F>(0.0))
+    {}
+
+    template<FloatingNumber F>
+    inline constexpr vec3a<F>::vec3a(const vec4<F>& vec) noexcept
+        : x(vec.x), y(vec.y), z(vec.z), padding(static_cast<F>(0.0))
+    {}
+
+    #pragma endregion Constructors
+
+    #pragma region StaticConstructors
+
+    template<FloatingNumber F>
+    inline vec3a<F> vec3a<F>::fromQuat(const quat<F>& angle)
+    {
+        return vec3a<F>(vec3<F>::fromQuat(angle));
+    }
+
+    #pragma endregion StaticConstructors
+
+    #pragma region Casting
+
+    template<FloatingNumber F>
+    inline constexpr vec3a<F>::operator vec3<F>() const noexcept
+    {
+        return vec3<F>(x, y, z);
+    }
+
+    template<FloatingNumber F>
+    inline constexpr vec3a<F>::operator vec4<F>() const noexcept
+    {
+        return vec4<F>(x, y, z, static_cast<F>(0.0));
+    }
+
+    #pragma endregion Casting
+
+    #pragma region Normalizing
+
+    template<FloatingNumber F>
+    inline vec3a<F>& vec3a<F>::normalize()
+    {
+        F l = this->length();
+
+        if (l > static_cast<F>(0.0))
+        {
+            *this *= static_cast<F>(1.0) / l;
+        }
+
+        return *this;
+    }
+
+    template<FloatingNumber F>
+    inline vec3a<F> vec3a<F>::getNormalizedVec() const
+    {
+        vec3a copy = *this;
+
+        return copy.normalize();
+    }
+
+    template<FloatingNumber F>
+    inline vec3a<F>& vec3a<F>::normalizeFast()
+    {
+        F lengthSq = this->lengthSquared();
+
+        if (lengthSq >= std::numeric_limits<F>::min())
+        {
+            *this *= glMath::rsqrtFast(lengthSq);
+        }
+
+        return *this;
+    }
+
+    #pragma endregion Normalizing
+
+    #pragma region MemberMethods
+
+    template<FloatingNumber F>
+    const F* vec3a<F>::valuePtr() const
+    {
+        return &data[0];
+    }
+
+    template<FloatingNumber F>
+    inline F vec3a<F>::length() const
+    {
+        return glMath::sqrt(this->lengthSquared());
+    }
+
+    template<FloatingNumber F>
+    inline constexpr F vec3a<F>::lengthSquared() const noexcept
+    {
+        return this->dotProduct(*this);
+    }
+
+    template<FloatingNumber F>
+    inline F vec3a<F>::distance(const vec3a<F>& other) const
+    {
+        return glMath::sqrt(this->distanceSquared(other));
+    }
+
+    template<FloatingNumber F>
+    inline constexpr F vec3a<F>::distanceSquared(const vec3a<F>& other) const noexcept
+    {
+        if constexpr (simd::hasVec3aKernel<F>)
+        {
+            if (!std::is_constant_evaluated())
+            {
+                return simd::vec4DistanceSquared3(data, other.data);
+            }
+        }
+
+        return (other.x - x) * (other.x - x) + (other.y - y) * (other.y - y) + (other.z - z) * (other.z - z);
+    }
+
+    template<FloatingNumber F>
+    inline constexpr F vec3a<F>::dotProduct(const vec3a<F>& other) const noexcept
+    {
+        if constexpr (simd::hasVec3aKernel<F>)
+        {
+            if (!std::is_constant_evaluated())
+            {
+                return simd::vec4Dot3(data, other.data);
+            }
+        }
+
+        return (x * other.x) + (y * other.y) + (z * other.z);
+    }
+
+    template<FloatingNumber F>
+    inline constexpr vec3a<F> vec3a<F>::crossProduct(const vec3a<F>& other) const noexcept
+    {
+        if constexpr (simd::hasVec3aKernel<F>)
+        {
+            if (!std::is_constant_evaluated())
+            {
+                vec3a<F> res;
+                simd::vec3aCross(data, other.data, res.data);
+                return res;
+            }
+        }
+
+        return vec3a<F>(
+            y * other.z - z * other.y,
+            z * other.x - x * other.z,
+            x * other.y - y * other.x
+        );
+    }
+
+
+    template<FloatingNumber F>
+    inline constexpr vec3a<F> vec3a<F>::min(const vec3a<F>& other) const noexcept
+    {
+        if constexpr (simd::hasVec3aKernel<F>)
+        {
+            if (!std::is_constant_evaluated())
+            {
+                vec3a<F> res;
+                simd::vec3aMin(data, other.data, res.data);
+                return res;
+            }
+        }
+
+        return vec3a<F>(glMath::min(x, other.x), glMath::min(y, other.y), glMath::min(z, other.z));
+    }
+    template<FloatingNumber F>
+    inline constexpr vec3a<F> vec3a<F>::max(const vec3a<F>& other) const noexcept
+    {
+        if constexpr (simd::hasVec3aKernel<F>)
+        {
+            if (!std::is_constant_evaluated())
+            {
+                vec3a<F> res;
+                simd::vec3aMax(data, other.data, res.data);
+                return res;
+            }
+        }
+
+        return vec3a<F>(glMath::max(x, other.x), glMath::max(y, other.y), glMath::max(z, other.z));
+    }
+
+    #pragma endregion MemberMethods
+
+    #pragma region StaticMethods
+
+    template<FloatingNumber F>
+    inline vec3a<F> vec3a<F>::normalized(const vec3a<F>& vec)
+    {
+        return vec.getNormalizedVec();
+    }
+
+    template<FloatingNumber F>
+    inline vec3a<F> vec3a<F>::normalizedFast(const vec3a<F>& vec)
+    {
+        vec3a copy = vec;
+
+        return copy.normalizeFast();
+    }
+
+    template<FloatingNumber F>
+    inline F vec3a<F>::length(const vec3a<F>& vec)
+    {
+        return vec.length();
+    }
+
+    template<FloatingNumber F>
+    inline constexpr F vec3a<F>::lengthSquared(const vec3a<F>& vec) noexcept
+    {
+        return vec.lengthSquared();
+    }
+
+    template<FloatingNumber F>
+    inline F vec3a<F>::distance(const vec3a<F>& a, const vec3a<F>& b)
+    {
+        return a.distance(b);
+    }
+
+    template<FloatingNumber F>
+    inline constexpr F vec3a<F>::distanceSquared(const vec3a<F>& a, const vec3a<F>& b) noexcept
+    {
+        return a.distanceSquared(b);
+    }
+
+    template<FloatingNumber F>
+    inline constexpr F vec3a<F>::dotProduct(const vec3a<F>& a, const vec3a<F>& b) noexcept
+    {
+        return a.dotProduct(b);
+    }
+
+    template<FloatingNumber F>
+    inline constexpr vec3a<F> vec3a<F>::crossProduct(const vec3a<F>& a, const vec3a<F>& b) noexcept
+    {
+        return a.crossProduct(b);
+    }
+
+
+    template<FloatingNumber F>
+    inline constexpr vec3a<F> vec3a<F>::min(const vec3a<F>& a, const vec3a<F>& b) noexcept
+    {
+        return a.min(b);
+    }
+    template<FloatingNumber F>
+    inline constexpr vec3a<F> vec3a<F>::max(const vec3a<F>& a, const vec3a<F>& b) noexcept
+    {
+        return a.max(b);
+    }
+
+
+    template<FloatingNumber F>
+    inline constexpr vec3a<F> vec3a<F>::lerp(const vec3a<F>& start, const vec3a<F>& end, F t) noexcept
+    {
+        return vec3a<F>::lerpUnclamped(start, end, glMath::clamp01(t));
+    }
+    template<FloatingNumber F>
+    inline constexpr vec3a<F> vec3a<F>::lerpUnclamped(const vec3a<F>& start, const vec3a<F>& end, F t) noexcept
+    {
+        if constexpr (simd::hasVec3aKernel<F>)
+        {
+            if (!std::is_constant_evaluated())
+            {
+                vec3a<F> res;
+                simd::vec3aLerp(start.data, end.data, t, res.data);
+                return res;
+            }
+        }
+
+        return vec3a(start.x + (end.x - start.x) * t, start.y + (end.y - start.y) * t, start.z + (end.z - start.z) * t);
+    }
+
+    template<FloatingNumber F>
+    template<MathPolicy P>
+    inline vec3a<F> vec3a<F>::slerp(const vec3a<F>& start, const vec3a<F>& end, F t)
+    {
+        t = glMath::clamp01(t);
+        return vec3a<F>::slerpUnclamped<P>(start, end, t);
+    }
+    template<FloatingNumber F>
+    template<MathPolicy P>
+    inline vec3a<F> vec3a<F>::slerpUnclamped(const vec3a<F>& start, const vec3a<F>& end, F t)
+    {
+        F dot = vec3a<F>::dotProduct(start, end);
+
+        if constexpr (std::is_same_v<P, polynomialMath>)
+        {
+            lerpWeights<F> weights = P::slerpWeights(dot, t);
+            return (start * weights.start) + (end * weights.end);
+        }
+
+        if (dot > static_cast<F>(0.9995))
+        {
+            return vec3a<F>::lerpUnclamped(start, end, t);
+        }
+
+        F ang = P::acos(dot);
+        F sinAng = P::sin(ang);
+
+        F wA = P::sin((static_cast<F>(1.0) - t) * ang) / sinAng;
+        F wB = P::sin(t * ang) / sinAng;
+
+        return (start * wA) + (end * wB);
+    }
+
+    #pragma endregion StaticMethods
+
+    #pragma region ReferenceOperators
+
+    template<FloatingNumber F>
+    inline constexpr vec3a<F>& vec3a<F>::operator+=(const vec3a<F>& other) noexcept
+    {
+        *this = *this + other;
+        return *this;
+    }
+    template<FloatingNumber F>
+    inline constexpr vec3a<F>& vec3a<F>::operator+=(F scalar) noexcept
+    {
+        *this = *this + scalar;
+        return *this;
+    }
+
+    template<FloatingNumber F>
+    inline constexpr vec3a<F>& vec3a<F>::operator-=(const vec3a<F>& other) noexcept
+    {
+        *this = *this - other;
+        return *this;
+    }
+    template<FloatingNumber F>
+    inline constexpr vec3a<F>& vec3a<F>::operator-=(F scalar) noexcept
+    {
+        *this = *this - scalar;
+        return *this;
+    }
+
+    template<FloatingNumber F>
+    inline constexpr vec3a<F>& vec3a<F>::operator*=(const vec3a<F>& other) noexcept
+    {
+        *this = *this * other;
+        return *this;
+    }
+    template<FloatingNumber F>
+    inline constexpr vec3a<F>& vec3a<F>::operator*=(F scalar) noexcept
+    {
+        *this = *this * scalar;
+        return *this;
+    }
+
+    template<FloatingNumber F>
+    inline constexpr vec3a<F>& vec3a<F>::operator/=(F scalar) noexcept
+    {
+        *this = *this / scalar;
+        return *this;
+    }
+
+    #pragma endregion ReferenceOperators
+
+    #pragma region ArithmeticOperators
+
+    template<FloatingNumber F>
+    inline constexpr vec3a<F> operator+(const vec3a<F>& a, const vec3a<F>& b) noexcept
+    {
+        if constexpr (simd::hasVec3aKernel<F>)
+        {
+            if (!std::is_constant_evaluated())
+            {
+                vec3a<F> res;
+                simd::vec3aAdd(a.data, b.data, res.data);
+                return res;
+            }
+        }
+
+        return vec3a(a.x + b.x, a.y + b.y, a.z + b.z);
+    }
+    template<FloatingNumber F>
+    inline constexpr vec3a<F> operator+(const vec3a<F>& a, F scalar) noexcept
+    {
+        if constexpr (simd::hasVec3aKernel<F>)
+        {
+            if (!std::is_constant_evaluated())
+            {
+                vec3a<F> res;
+                simd::vec3aAddScalar(a.data, scalar, res.data);
+                return res;
+            }
+        }
+
+        return vec3a(a.x + scalar, a.y + scalar, a.z + scalar);
+    }
+
+    template<FloatingNumber F>
+    inline constexpr vec3a<F> operator-(const vec3a<F>& a, const vec3a<F>& b) noexcept
+    {
+        if constexpr (simd::hasVec3aKernel<F>)
+        {
+            if (!std::is_constant_evaluated())
+            {
+                vec3a<F> res;
+                simd::vec3aSub(a.data, b.data, res.data);
+                return res;
+            }
+        }
+
+        return vec3a(a.x - b.x, a.y - b.y, a.z - b.z);
+    }
+    template<FloatingNumber F>
+    inline constexpr vec3a<F> operator-(const vec3a<F>& a, F scalar) noexcept
+    {
+        return a + (-scalar);
+    }
+
+
+    template <FloatingNumber F>
+    inline constexpr vec3a<F> vec3a<F>::operator-() const noexcept
+    {
+        if constexpr (simd::hasVec3aKernel<F>)
+        {
+            if (!std::is_constant_evaluated())
+            {
+                vec3a<F> res;
+                simd::vec3aNegate(data, res.data);
+                return res;
+            }
+        }
+
+        return vec3a(-x, -y, -z);
+    }
+
+
+    template<FloatingNumber F>
+    inline constexpr vec3a<F> operator*(const vec3a<F>& a, const vec3a<F>& b) noexcept
+    {
+        if constexpr (simd::hasVec3aKernel<F>)
+        {
+            if (!std::is_constant_evaluated())
+            {
+                vec3a<F> res;
+                simd::vec3aMul(a.data, b.data, res.data);
+                return res;
+            }
+        }
+
+        return vec3a(a.x * b.x, a.y * b.y, a.z * b.z);
+    }
+    template<FloatingNumber F>
+    inline constexpr vec3a<F> operator*(const vec3a<F>& vec, F scalar) noexcept
+    {
+        if constexpr (simd::hasVec3aKernel<F>)
+        {
+            if (!std::is_constant_evaluated())
+            {
+                vec3a<F> res;
+                simd::vec3aScale(vec.data, scalar, res.data);
+                return res;
+            }
+        }
+
+        return vec3a(vec.x * scalar, vec.y * scalar, vec.z * scalar);
+    }
+    template<FloatingNumber F>
+    inline constexpr vec3a<F> operator*(F scalar, const vec3a<F>& vec) noexcept
+    {
+        return vec * scalar;
+    }
+    template<FloatingNumber F>
+    inline constexpr vec3a<F> operator/(const vec3a<F>& vec, F scalar) noexcept
+    {
+        if (scalar == static_cast<F>(0.0)) return vec;
+
+        return vec * (static_cast<F>(1.0) / scalar);
+    }
+
+    template<FloatingNumber F>
+    inline constexpr bool operator==(const vec3a<F>& a, const vec3a<F>& b) noexcept
+    {
+        return glMath::abs(a.x - b.x) < glMath::epsilon<F>() &&
+               glMath::abs(a.y - b.y) < glMath::epsilon<F>() &&
+               glMath::abs(a.z - b.z) < glMath::epsilon<F>();
+    }
+
+    template<FloatingNumber F>
+    inline constexpr bool operator!=(const vec3a<F>& a, const vec3a<F>& b) noexcept
+    {
+        return !(a == b);
+    }
+
+    #pragma endregion ArithmeticOperators
+
+}
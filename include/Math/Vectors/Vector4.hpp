@@ -22,38 +22,38 @@ namespace glMath
 
     public:
          
-        vec4();
+        inline constexpr vec4() noexcept;
 
-        vec4(F scalar);
+        inline constexpr vec4(F scalar) noexcept;
         
-        vec4(F vx, F vy, F vz, F vw);
+        inline constexpr vec4(F vx, F vy, F vz, F vw) noexcept;
          
-        vec4(const vec4& vec);
+        inline constexpr vec4(const vec4& vec) noexcept;
         
-        vec4(const vec3<F>& xyz, F vw);
-
-
-        inline static vec4<F> directionZero()     { return vec4(0.0, 0.0, 0.0, 0.0); };    
-        inline static vec4<F> directionOne()      { return vec4(1.0, 1.0, 1.0, 0.0); };   
-        inline static vec4<F> directionRight()    { return vec4(1.0, 0.0, 0.0, 0.0); };    
-        inline static vec4<F> directionLeft()     { return vec4(-1.0, 0.0, 0.0, 0.0); };  
-        inline static vec4<F> directionUp()       { return vec4(0.0, 1.0, 0.0, 0.0); };   
-        inline static vec4<F> directionDown()     { return vec4(0.0, -1.0, 0.0, 0.0); };  
-        inline static vec4<F> directionForward()  { return vec4(0.0, 0.0, 1.0, 0.0); };   
-        inline static vec4<F> directionBackward() { return vec4(0.0, 0.0, -1.0, 0.0); }; 
-
-        inline static vec4<F> pointZero()     { return vec4(0.0, 0.0, 0.0, 1.0); };    
-        inline static vec4<F> pointOne()      { return vec4(1.0, 1.0, 1.0, 1.0); };   
-        inline static vec4<F> pointRight()    { return vec4(1.0, 0.0, 0.0, 1.0); };    
-        inline static vec4<F> pointLeft()     { return vec4(-1.0, 0.0, 0.0, 1.0); };  
-        inline static vec4<F> pointUp()       { return vec4(0.0, 1.0, 0.0, 1.0); };   
-        inline static vec4<F> pointDown()     { return vec4(0.0, -1.0, 0.0, 1.0); };  
-        inline static vec4<F> pointForward()  { return vec4(0.0, 0.0, 1.0, 1.0); };   
-        inline static vec4<F> pointBackward() { return vec4(0.0, 0.0, -1.0, 1.0); };   
+        inline constexpr vec4(const vec3<F>& xyz, F vw) noexcept;
+
+
+        inline static constexpr vec4<F> directionZero() noexcept     { return vec4(0.0, 0.0, 0.0, 0.0); };
+        inline static constexpr vec4<F> directionOne() noexcept      { return vec4(1.0, 1.0, 1.0, 0.0); };
+        inline static constexpr vec4<F> directionRight() noexcept    { return vec4(1.0, 0.0, 0.0, 0.0); };
+        inline static constexpr vec4<F> directionLeft() noexcept     { return vec4(-1.0, 0.0, 0.0, 0.0); };
+        inline static constexpr vec4<F> directionUp() noexcept       { return vec4(0.0, 1.0, 0.0, 0.0); };
+        inline static constexpr vec4<F> directionDown() noexcept     { return vec4(0.0, -1.0, 0.0, 0.0); };
+        inline static constexpr vec4<F> directionForward() noexcept  { return vec4(0.0, 0.0, 1.0, 0.0); };
+        inline static constexpr vec4<F> directionBackward() noexcept { return vec4(0.0, 0.0, -1.0, 0.0); };
+
+        inline static constexpr vec4<F> pointZero() noexcept     { return vec4(0.0, 0.0, 0.0, 1.0); };
+        inline static constexpr vec4<F> pointOne() noexcept      { return vec4(1.0, 1.0, 1.0, 1.0); };
+        inline static constexpr vec4<F> pointRight() noexcept    { return vec4(1.0, 0.0, 0.0, 1.0); };
+        inline static constexpr vec4<F> pointLeft() noexcept     { return vec4(-1.0, 0.0, 0.0, 1.0); };
+        inline static constexpr vec4<F> pointUp() noexcept       { return vec4(0.0, 1.0, 0.0, 1.0); };
+        inline static constexpr vec4<F> pointDown() noexcept     { return vec4(0.0, -1.0, 0.0, 1.0); };
+        inline static constexpr vec4<F> pointForward() noexcept  { return vec4(0.0, 0.0, 1.0, 1.0); };
+        inline static constexpr vec4<F> pointBackward() noexcept { return vec4(0.0, 0.0, -1.0, 1.0); };
         
         
     
-        inline vec4 wzyx() const { return vec4(w, z, y, x); }; 
+        inline constexpr vec4 wzyx() const noexcept { return vec4(w, z, y, x); };
 
 
 
@@ -61,7 +61,7 @@ namespace glMath
         vec4<type> as() const;
         
 
-        vec3<F> toVec3() const;
+        inline constexpr vec3<F> toVec3() const noexcept;
         vec3<F> projectToVec3() const;
         static vec3<F> projectToVec3(const vec4& vec);
 
@@ -71,36 +71,36 @@ namespace glMath
 
         F length() const;
         F length3() const;
-        F lengthSquared() const;
-        F lengthSquared3() const;
+        inline constexpr F lengthSquared() const noexcept;
+        inline constexpr F lengthSquared3() const noexcept;
 
-        F dotProduct(const vec4& other) const;
-        F dotProduct3(const vec4& other) const;
+        inline constexpr F dotProduct(const vec4& other) const noexcept;
+        inline constexpr F dotProduct3(const vec4& other) const noexcept;
 
         F distance(const vec4& other) const;
         F distance3(const vec4& other) const;
-        F distanceSquared(const vec4& other) const;
-        F distanceSquared3(const vec4& other) const;
+        inline constexpr F distanceSquared(const vec4& other) const noexcept;
+        inline constexpr F distanceSquared3(const vec4& other) const noexcept;
 
         static F length(const vec4& vec);
         static F length3(const vec4& vec);
-        static F lengthSquared(const vec4& vec);
-        static F lengthSquared3(const vec4& vec);
+        inline static constexpr F lengthSquared(const vec4& vec) noexcept;
+        inline static constexpr F lengthSquared3(const vec4& vec) noexcept;
 
-        static F dotProduct(const vec4& vec1, const vec4& vec2);
-        static F dotProduct3(const vec4& vec1, const vec4& vec2);
+        inline static constexpr F dotProduct(const vec4& vec1, const vec4& vec2) noexcept;
+        inline static constexpr F dotProduct3(const vec4& vec1, const vec4& vec2) noexcept;
 
         static F distance(const vec4& vec1, const vec4& vec2);
         static F distance3(const vec4& vec1, const vec4& vec2);
-        static F distanceSquared(const vec4& vec1, const vec4& vec2);
-        static F distanceSquared3(const vec4& vec1, const vec4& vec2);
+        inline static constexpr F distanceSquared(const vec4& vec1, const vec4& vec2) noexcept;
+        inline static constexpr F distanceSquared3(const vec4& vec1, const vec4& vec2) noexcept;
 
 
-        vec4 min(const vec4& other) const;
-        static vec4 min(const vec4& a, const vec4& b);
+        inline constexpr vec4 min(const vec4& other) const noexcept;
+        inline static constexpr vec4 min(const vec4& a, const vec4& b) noexcept;
 
-        vec4 max(const vec4& other) const;
-        static vec4 max(const vec4& a, const vec4& b);
+        inline constexpr vec4 max(const vec4& other) const noexcept;
+        inline static constexpr vec4 max(const vec4& a, const vec4& b) noexcept;
 
         
         vec4& normalize();
@@ -110,45 +110,50 @@ namespace glMath
         static vec4 normalized(const vec4& vec);
         static vec4 normalized3(const vec4& vec);
 
+        // Like normalize(), with a fast 1 / sqrt (the hardware estimate and one Newton-Raphson step) instead of a square root and a division.
+        // With floats the length is within 5e-7 of 1, doubles are exact
+        vec4& normalizeFast();
+        static vec4 normalizedFast(const vec4& vec);
 
-        static vec4 lerp(const vec4& start, const vec4& end, F t);
-        static vec4 lerpUnclamped(const vec4& start, const vec4& end, F t);
+
+        inline static constexpr vec4 lerp(const vec4& start, const vec4& end, F t) noexcept;
+        inline static constexpr vec4 lerpUnclamped(const vec4& start, const vec4& end, F t) noexcept;
 
         
-        vec4& operator+=(const vec4& other);
-        vec4& operator+=(F scalar);
-        vec4& operator-=(const vec4& other);
-        vec4& operator-=(F scalar);
-        vec4& operator*=(const vec4<F>& other);
-        vec4& operator*=(F scalar);
-        vec4& operator/=(F scalar);
-
-        vec4 operator-() const;
+        inline constexpr vec4& operator+=(const vec4& other) noexcept;
+        inline constexpr vec4& operator+=(F scalar) noexcept;
+        inline constexpr vec4& operator-=(const vec4& other) noexcept;
+        inline constexpr vec4& operator-=(F scalar) noexcept;
+        inline constexpr vec4& operator*=(const vec4<F>& other) noexcept;
+        inline constexpr vec4& operator*=(F scalar) noexcept;
+        inline constexpr vec4& operator/=(F scalar) noexcept;
+
+        inline constexpr vec4 operator-() const noexcept;
     };
 
     template<FloatingNumber F>
-    inline vec4<F> operator+(const vec4<F>& a, const vec4<F>& b);
+    inline constexpr vec4<F> operator+(const vec4<F>& a, const vec4<F>& b) noexcept;
     template<FloatingNumber F>
-    inline vec4<F> operator+(const vec4<F>& a, F scalar);
+    inline constexpr vec4<F> operator+(const vec4<F>& a, F scalar) noexcept;
 
     template<FloatingNumber F>
-    inline vec4<F> operator-(const vec4<F>& a, const vec4<F>& b);
+    inline constexpr vec4<F> operator-(const vec4<F>& a, const vec4<F>& b) noexcept;
     template<FloatingNumber F>
-    inline vec4<F> operator-(const vec4<F>& a, F scalar);
+    inline constexpr vec4<F> operator-(const vec4<F>& a, F scalar) noexcept;
 
     template<FloatingNumber F>
-    inline vec4<F> operator*(const vec4<F>& a, const vec4<F>& b);
+    inline constexpr vec4<F> operator*(const vec4<F>& a, const vec4<F>& b) noexcept;
     template<FloatingNumber F>
-    inline vec4<F> operator*(const vec4<F>& vec, F scalar);
+    inline constexpr vec4<F> operator*(const vec4<F>& vec, F scalar) noexcept;
     template<FloatingNumber F>
-    inline vec4<F> operator*(F scalar, const vec4<F>& vec);
+    inline constexpr vec4<F> operator*(F scalar, const vec4<F>& vec) noexcept;
     template<FloatingNumber F>
-    inline vec4<F> operator/(const vec4<F>& vec, F scalar);
+    inline constexpr vec4<F> operator/(const vec4<F>& vec, F scalar) noexcept;
 
     template<FloatingNumber F>
-    inline bool operator==(const vec4<F>& a, const vec4<F>& b);
+    inline constexpr bool operator==(const vec4<F>& a, const vec4<F>& b) noexcept;
     template<FloatingNumber F>
-    inline bool operator!=(const vec4<F>& a, const vec4<F>& b);
+    inline constexpr bool operator!=(const vec4<F>& a, const vec4<F>& b) noexcept;
 }
 
 #include "Math\Vectors\Vector4.inl"
@@ -2,6 +2,7 @@
 #include <cmath>
 
 #include <algorithm>
+#include <type_traits>
 
 #include "Math\MathInternal.hpp"
 
@@ -12,7 +13,7 @@ namespace glMath
     #pragma region Constructors
 
     template<FloatingNumber F>
-    inline vec4<F>::vec4()
+    inline constexpr vec4<F>::vec4() noexcept
         :
         x(static_cast<F>(0.0)), 
         y(static_cast<F>(0.0)), 
@@ -21,7 +22,7 @@ namespace glMath
     {}
 
     template<FloatingNumber F>
-    inline vec4<F>::vec4(F scalar)
+    inline constexpr vec4<F>::vec4(F scalar) noexcept
         :
         x(scalar), 
         y(scalar), 
@@ -30,7 +31,7 @@ namespace glMath
     {}
 
     template<FloatingNumber F>
-    inline vec4<F>::vec4(F vx, F vy, F vz, F vw)
+    inline constexpr vec4<F>::vec4(F vx, F vy, F vz, F vw) noexcept
         :
         x(vx), 
         y(vy), 
@@ -39,7 +40,7 @@ namespace glMath
     {}
 
     template<FloatingNumber F>
-    inline vec4<F>::vec4(const vec4<F>& vec)
+    inline constexpr vec4<F>::vec4(const vec4<F>& vec) noexcept
         :
         x(vec.x), 
         y(vec.y), 
@@ -48,7 +49,7 @@ namespace glMath
     {}
 
     template <FloatingNumber F>
-    inline vec4<F>::vec4(const vec3<F>& xyz, F vw)
+    inline constexpr vec4<F>::vec4(const vec3<F>& xyz, F vw) noexcept
         :
         x(xyz.x),
         y(xyz.y),
@@ -78,7 +79,7 @@ namespace glMath
 
 
     template<FloatingNumber F>
-    inline vec3<F> vec4<F>::toVec3() const
+    inline constexpr vec3<F> vec4<F>::toVec3() const noexcept
     {
         return vec3<F>(
             x,
@@ -111,7 +112,18 @@ namespace glMath
     {
         F l = this->length();
 
-        if (l > glMath::epsilon<F>()) 
+        if constexpr (LaneNumber<F>)
+        {
+            // The lanes too short to be normalized are multiplied by 1, so left untouched
+            F minLength = static_cast<F>(glMath::epsilon<typename F::valueType>());
+            F invLen = glMath::select(l > minLength, static_cast<F>(1.0) / l, static_cast<F>(1.0));
+
+            x *= invLen;
+            y *= invLen;
+            z *= invLen;
+            w *= invLen;
+        }
+        else if (l > glMath::epsilon<F>()) 
         {
             F invLen = static_cast<F>(1.0) / l;
 
@@ -128,7 +140,16 @@ namespace glMath
     {
         F l = this->length3();
 
-        if (l > glMath::epsilon<F>()) 
+        if constexpr (LaneNumber<F>)
+        {
+            F minLength = static_cast<F>(glMath::epsilon<typename F::valueType>());
+            F invLen = glMath::select(l > minLength, static_cast<F>(1.0) / l, static_cast<F>(1.0));
+
+            x *= invLen;
+            y *= invLen;
+            z *= invLen;
+        }
+        else if (l > glMath::epsilon<F>()) 
         {
             F invLen = static_cast<F>(1.0) / l;
 
@@ -155,6 +176,34 @@ namespace glMath
         return copy.normalize3();
     }
 
+    template<FloatingNumber F>
+    inline vec4<F>& vec4<F>::normalizeFast()
+    {
+        F lengthSq = this->lengthSquared();
+
+        if constexpr (LaneNumber<F>)
+        {
+            F minLengthSq = static_cast<F>(glMath::epsilon<typename F::valueType>() * glMath::epsilon<typename F::valueType>());
+            F invLen = glMath::select(lengthSq > minLengthSq, glMath::rsqrtFast(lengthSq), static_cast<F>(1.0));
+
+            x *= invLen;
+            y *= invLen;
+            z *= invLen;
+            w *= invLen;
+        }
+        else if (lengthSq > glMath::epsilon<F>() * glMath::epsilon<F>()) 
+        {
+            F invLen = glMath::rsqrtFast(lengthSq);
+
+            x *= invLen;
+            y *= invLen;
+            z *= invLen;
+            w *= invLen;
+        }
+
+        return *this;
+    }
+
     #pragma endregion
 
     #pragma region MemberMethods
@@ -169,35 +218,67 @@ namespace glMath
     template<FloatingNumber F>
     inline F vec4<F>::length() const
     {
-        return std::sqrt( (x * x) + (y * y) + (z * z) + (w * w) );
+        return glMath::sqrt(this->lengthSquared());
     }
     template<FloatingNumber F>
     inline F vec4<F>::length3() const
     {
-        return std::sqrt( (x * x) + (y * y) + (z * z) );
+        return glMath::sqrt(this->lengthSquared3());
     }
 
     template<FloatingNumber F>
-    inline F vec4<F>::lengthSquared() const
+    inline constexpr F vec4<F>::lengthSquared() const noexcept
     {
+        if constexpr (simd::hasVec4DotKernel<F>)
+        {
+            if (!std::is_constant_evaluated())
+            {
+                return simd::vec4Dot(data, data);
+            }
+        }
+
         return (x * x) + (y * y) + (z * z) + (w * w);
     }
     template<FloatingNumber F>
-    inline F vec4<F>::lengthSquared3() const
+    inline constexpr F vec4<F>::lengthSquared3() const noexcept
     {
+        if constexpr (simd::hasVec4DotKernel<F>)
+        {
+            if (!std::is_constant_evaluated())
+            {
+                return simd::vec4Dot3(data, data);
+            }
+        }
+
         return (x * x) + (y * y) + (z * z);
     }
 
 
     template<FloatingNumber F>
-    inline F vec4<F>::dotProduct(const vec4<F>& other) const
+    inline constexpr F vec4<F>::dotProduct(const vec4<F>& other) const noexcept
     {
+        if constexpr (simd::hasVec4DotKernel<F>)
+        {
+            if (!std::is_constant_evaluated())
+            {
+                return simd::vec4Dot(data, other.data);
+            }
+        }
+
         return (x * other.x) + (y * other.y) + (z * other.z) + (w * other.w);
     }
 
     template<FloatingNumber F>
-    inline F vec4<F>::dotProduct3(const vec4<F>& other) const
+    inline constexpr F vec4<F>::dotProduct3(const vec4<F>& other) const noexcept
     {
+        if constexpr (simd::hasVec4DotKernel<F>)
+        {
+            if (!std::is_constant_evaluated())
+            {
+                return simd::vec4Dot3(data, other.data);
+            }
+        }
+
         return (x * other.x) + (y * other.y) + (z * other.z);
     }
 
@@ -205,33 +286,49 @@ namespace glMath
     template<FloatingNumber F>
     inline F vec4<F>::distance(const vec4<F>& other) const
     {
-        return std::sqrt( (other.x - x) + (other.y - y) + (other.z - z) + (other.w - w) );
+        return glMath::sqrt(this->distanceSquared(other));
     }
     template<FloatingNumber F>
     inline F vec4<F>::distance3(const vec4<F>& other) const
     {
-        return std::sqrt( (other.x - x) + (other.y - y) + (other.z - z) );
+        return glMath::sqrt(this->distanceSquared3(other));
     }
 
     template<FloatingNumber F>
-    inline F vec4<F>::distanceSquared(const vec4<F>& other) const
+    inline constexpr F vec4<F>::distanceSquared(const vec4<F>& other) const noexcept
     {
-        return (other.x - x) + (other.y - y) + (other.z - z) + (other.w - w);
+        if constexpr (simd::hasVec4DotKernel<F>)
+        {
+            if (!std::is_constant_evaluated())
+            {
+                return simd::vec4DistanceSquared(data, other.data);
+            }
+        }
+
+        return (other.x - x) * (other.x - x) + (other.y - y) * (other.y - y) + (other.z - z) * (other.z - z) + (other.w - w) * (other.w - w);
     }
     template<FloatingNumber F>
-    inline F vec4<F>::distanceSquared3(const vec4<F>& other) const
+    inline constexpr F vec4<F>::distanceSquared3(const vec4<F>& other) const noexcept
     {
-        return (other.x - x) + (other.y - y) + (other.z - z);
+        if constexpr (simd::hasVec4DotKernel<F>)
+        {
+            if (!std::is_constant_evaluated())
+            {
+                return simd::vec4DistanceSquared3(data, other.data);
+            }
+        }
+
+        return (other.x - x) * (other.x - x) + (other.y - y) * (other.y - y) + (other.z - z) * (other.z - z);
     }
 
 
     template<FloatingNumber F>
-    inline vec4<F> vec4<F>::min(const vec4<F>& other) const
+    inline constexpr vec4<F> vec4<F>::min(const vec4<F>& other) const noexcept
     {
         return vec4<F>(glMath::min(x, other.x), glMath::min(y, other.y), glMath::min(z, other.z), glMath::min(w, other.w));
     }
     template<FloatingNumber F>
-    inline vec4<F> vec4<F>::max(const vec4<F>& other) const
+    inline constexpr vec4<F> vec4<F>::max(const vec4<F>& other) const noexcept
     {
         return vec4<F>(glMath::max(x, other.x), glMath::max(y, other.y), glMath::max(z, other.z), glMath::max(w, other.w));
     }
@@ -252,6 +349,14 @@ namespace glMath
         return vec.getNormalizedVec();
     }
 
+    template<FloatingNumber F>
+    inline vec4<F> vec4<F>::normalizedFast(const vec4<F>& vec)
+    {
+        vec4<F> copy = vec;
+
+        return copy.normalizeFast();
+    }
+
     template<FloatingNumber F>
     inline vec4<F> vec4<F>::normalized3(const vec4<F>& vec)
     {
@@ -261,36 +366,36 @@ namespace glMath
     template<FloatingNumber F>
     inline F vec4<F>::length(const vec4<F>& vec) 
     {
-        return std::sqrt( (vec.x * vec.x) + (vec.y * vec.y) + (vec.z * vec.z) + (vec.w * vec.w) );
+        return vec.length();
     }
     template<FloatingNumber F>
     inline F vec4<F>::length3(const vec4<F>& vec) 
     {
-        return std::sqrt( (vec.x * vec.x) + (vec.y * vec.y) + (vec.z * vec.z) );
+        return vec.length3();
     }
 
     template<FloatingNumber F>
-    inline F vec4<F>::lengthSquared(const vec4<F>& vec) 
+    inline constexpr F vec4<F>::lengthSquared(const vec4<F>& vec) noexcept 
     {
-        return (vec.x * vec.x) + (vec.y * vec.y) + (vec.z * vec.z) + (vec.w * vec.w);
+        return vec.lengthSquared();
     }
     template<FloatingNumber F>
-    inline F vec4<F>::lengthSquared3(const vec4<F>& vec) 
+    inline constexpr F vec4<F>::lengthSquared3(const vec4<F>& vec) noexcept 
     {
-        return (vec.x * vec.x) + (vec.y * vec.y) + (vec.z * vec.z);
+        return vec.lengthSquared3();
     }
 
 
     template<FloatingNumber F>
-    inline F vec4<F>::dotProduct(const vec4<F>& vec1, const vec4<F>& vec2) 
+    inline constexpr F vec4<F>::dotProduct(const vec4<F>& vec1, const vec4<F>& vec2) noexcept 
     {
-        return (vec1.x * vec2.x) + (vec1.y * vec2.y) + (vec1.z * vec2.z) + (vec1.w * vec2.w);
+        return vec1.dotProduct(vec2);
     }
 
     template<FloatingNumber F>
-    inline F vec4<F>::dotProduct3(const vec4<F>& vec1, const vec4<F>& vec2) 
+    inline constexpr F vec4<F>::dotProduct3(const vec4<F>& vec1, const vec4<F>& vec2) noexcept 
     {
-        return (vec1.x * vec2.x) + (vec1.y * vec2.y) + (vec1.z * vec2.z);
+        return vec1.dotProduct3(vec2);
     }
 
 
@@ -298,33 +403,33 @@ namespace glMath
     template<FloatingNumber F>
     inline F vec4<F>::distance(const vec4<F>& vec1, const vec4<F>& vec2) 
     {
-        return std::sqrt( (vec2.x - vec1.x) + (vec2.y - vec1.y) + (vec2.z - vec1.z) + (vec2.w - vec1.w) );
+        return vec1.distance(vec2);
     }
     template<FloatingNumber F>
     inline F vec4<F>::distance3(const vec4<F>& vec1, const vec4<F>& vec2) 
     {
-        return std::sqrt( (vec2.x - vec1.x) + (vec2.y - vec1.y) + (vec2.z - vec1.z) );
+        return vec1.distance3(vec2);
     }
 
     template<FloatingNumber F>
-    inline F vec4<F>::distanceSquared(const vec4<F>& vec1, const vec4<F>& vec2) 
+    inline constexpr F vec4<F>::distanceSquared(const vec4<F>& vec1, const vec4<F>& vec2) noexcept 
     {
-        return (vec2.x - vec1.x) + (vec2.y - vec1.y) + (vec2.z - vec1.z) + (vec2.w - vec1.w);
+        return vec1.distanceSquared(vec2);
     }
     template<FloatingNumber F>
-    inline F vec4<F>::distanceSquared3(const vec4<F>& vec1, const vec4<F>& vec2) 
+    inline constexpr F vec4<F>::distanceSquared3(const vec4<F>& vec1, const vec4<F>& vec2) noexcept 
     {
-        return (vec2.x - vec1.x) + (vec2.y - vec1.y) + (vec2.z - vec1.z);
+        return vec1.distanceSquared3(vec2);
     }
 
 
     template<FloatingNumber F>
-    inline vec4<F> vec4<F>::min(const vec4<F>& a, const vec4<F>& b)
+    inline constexpr vec4<F> vec4<F>::min(const vec4<F>& a, const vec4<F>& b) noexcept
     {
         return vec4<F>(glMath::min(a.x, b.x), glMath::min(a.y, b.y), glMath::min(a.z, b.z), glMath::min(a.w, b.w));
     }
     template<FloatingNumber F>
-    inline vec4<F> vec4<F>::max(const vec4<F>& a, const vec4<F>& b)
+    inline constexpr vec4<F> vec4<F>::max(const vec4<F>& a, const vec4<F>& b) noexcept
     {
         return vec4<F>(glMath::max(a.x, b.x), glMath::max(a.y, b.y), glMath::max(a.z, b.z), glMath::max(a.w, b.w));
     }
@@ -332,19 +437,19 @@ namespace glMath
 
 
     template<FloatingNumber F>
-    inline vec4<F> vec4<F>::lerp(const vec4<F>& start, const vec4<F>& end, F t)
+    inline constexpr vec4<F> vec4<F>::lerp(const vec4<F>& start, const vec4<F>& end, F t) noexcept
     {
         t = glMath::clamp01(t);
         return vec4<F>::lerpUnclamped(start, end, t);
     }
     template<FloatingNumber F>
-    inline vec4<F> vec4<F>::lerpUnclamped(const vec4<F>& start, const vec4<F>& end, F t)
+    inline constexpr vec4<F> vec4<F>::lerpUnclamped(const vec4<F>& start, const vec4<F>& end, F t) noexcept
     {
         return vec4<F>(
             start.x + (end.x - start.x) * t, 
             start.y + (end.y - start.y) * t, 
             start.z + (end.z - start.z) * t, 
-            start.w + (end.w - start.x) * t
+            start.w + (end.w - start.w) * t
         );
     }
     
@@ -354,68 +459,84 @@ namespace glMath
     #pragma region ReferenceOperators
 
     template <FloatingNumber F>
-    inline vec4<F>& vec4<F>::operator+=(const vec4<F>& other)
+    inline constexpr vec4<F>& vec4<F>::operator+=(const vec4<F>& other) noexcept
     {
-        *this.x += other.x;
-        *this.y += other.y;
-        *this.z += other.z;
-        *this.w += other.w;
+        this->x += other.x;
+        this->y += other.y;
+        this->z += other.z;
+        this->w += other.w;
+
+        return *this;
     }
     template <FloatingNumber F>
-    inline vec4<F>& vec4<F>::operator+=(F scalar)
+    inline constexpr vec4<F>& vec4<F>::operator+=(F scalar) noexcept
     {
-        *this.x += scalar;
-        *this.y += scalar;
-        *this.z += scalar;
-        *this.w += scalar;
+        this->x += scalar;
+        this->y += scalar;
+        this->z += scalar;
+        this->w += scalar;
+
+        return *this;
     }
 
     template <FloatingNumber F>
-    inline vec4<F>& vec4<F>::operator-=(const vec4<F>& other)
+    inline constexpr vec4<F>& vec4<F>::operator-=(const vec4<F>& other) noexcept
     {
-        *this.x -= other.x;
-        *this.y -= other.y;
-        *this.z -= other.z;
-        *this.w -= other.w;
+        this->x -= other.x;
+        this->y -= other.y;
+        this->z -= other.z;
+        this->w -= other.w;
+
+        return *this;
     }
     template <FloatingNumber F>
-    inline vec4<F>& vec4<F>::operator-=(F scalar)
+    inline constexpr vec4<F>& vec4<F>::operator-=(F scalar) noexcept
     {
-        *this.x -= scalar;
-        *this.y -= scalar;
-        *this.z -= scalar;
-        *this.w -= scalar;
+        this->x -= scalar;
+        this->y -= scalar;
+        this->z -= scalar;
+        this->w -= scalar;
+
+        return *this;
     }
 
 
     template <FloatingNumber F>
-    inline vec4<F>& vec4<F>::operator*=(const vec4<F>& other)
+    inline constexpr vec4<F>& vec4<F>::operator*=(const vec4<F>& other) noexcept
     {
-        *this.x *= other.x;
-        *this.y *= other.y;
-        *this.z *= other.z;
-        *this.w *= other.w;
+        this->x *= other.x;
+        this->y *= other.y;
+        this->z *= other.z;
+        this->w *= other.w;
+
+        return *this;
     }
     template <FloatingNumber F>
-    inline vec4<F>& vec4<F>::operator*=(F scalar)
+    inline constexpr vec4<F>& vec4<F>::operator*=(F scalar) noexcept
     {
-        *this.x *= scalar;
-        *this.y *= scalar;
-        *this.z *= scalar;
-        *this.w *= scalar;
+        this->x *= scalar;
+        this->y *= scalar;
+        this->z *= scalar;
+        this->w *= scalar;
+
+        return *this;
     }
 
     template <FloatingNumber F>
-    inline vec4<F>& vec4<F>::operator/=(F scalar)
+    inline constexpr vec4<F>& vec4<F>::operator/=(F scalar) noexcept
     {
-        if (std::abs(scalar) > glMath::epsilon<F>())
+        if constexpr (LaneNumber<F>)
+        {
+            *this = *this / scalar;
+        }
+        else if (glMath::abs(scalar) > glMath::epsilon<F>())
         {
             F invScalar = static_cast<F>(1.0) / scalar;
 
-            *this.x *= invScalar;
-            *this.y *= invScalar;
-            *this.z *= invScalar;
-            *this.w *= invScalar;
+            this->x *= invScalar;
+            this->y *= invScalar;
+            this->z *= invScalar;
+            this->w *= invScalar;
         }
 
         return *this;
@@ -426,30 +547,30 @@ namespace glMath
     #pragma region Operators
 
     template<FloatingNumber F>
-    inline vec4<F> vec4<F>::operator-() const
+    inline constexpr vec4<F> vec4<F>::operator-() const noexcept
     {
         return vec4<F>(-x, -y, -z, -w);
     }
 
 
     template<FloatingNumber F>
-    inline vec4<F> operator+(const vec4<F>& a, const vec4<F>& b) 
+    inline constexpr vec4<F> operator+(const vec4<F>& a, const vec4<F>& b) noexcept 
     {
         return vec4<F>(a.x + b.x, a.y + b.y, a.z + b.z, a.w + b.w);
     }
     template<FloatingNumber F>
-    inline vec4<F> operator+(const vec4<F>& a, F scalar) 
+    inline constexpr vec4<F> operator+(const vec4<F>& a, F scalar) noexcept 
     {
         return vec4<F>(a.x + scalar, a.y + scalar, a.z + scalar, a.w + scalar);
     }
 
     template<FloatingNumber F>
-    inline vec4<F> operator-(const vec4<F>& a, const vec4<F>& b) 
+    inline constexpr vec4<F> operator-(const vec4<F>& a, const vec4<F>& b) noexcept 
     {
         return vec4<F>(a.x - b.x, a.y - b.y, a.z - b.z, a.w - b.w);
     }
     template<FloatingNumber F>
-    inline vec4<F> operator-(const vec4<F>& a, F scalar) 
+    inline constexpr vec4<F> operator-(const vec4<F>& a, F scalar) noexcept 
     {
         return vec4<F>(a.x - scalar, a.y - scalar, a.z - scalar, a.w - scalar);
     }
@@ -457,44 +578,55 @@ namespace glMath
 
 
     template<FloatingNumber F>
-    inline vec4<F> operator*(const vec4<F>& a, const vec4<F>& b) 
+    inline constexpr vec4<F> operator*(const vec4<F>& a, const vec4<F>& b) noexcept 
     {
         return vec4<F>(a.x * b.x, a.y * b.y, a.z * b.z, a.w * b.w);
     }
     template<FloatingNumber F>
-    inline vec4<F> operator*(const vec4<F>& vec, F scalar) 
+    inline constexpr vec4<F> operator*(const vec4<F>& vec, F scalar) noexcept 
     {
         return vec4<F>(vec.x * scalar, vec.y * scalar, vec.z * scalar, vec.w * scalar);
     }
     template<FloatingNumber F>
-    inline vec4<F> operator*(F scalar, const vec4<F>& vec) 
+    inline constexpr vec4<F> operator*(F scalar, const vec4<F>& vec) noexcept 
     {
         return vec4<F>(vec.x * scalar, vec.y * scalar, vec.z * scalar, vec.w * scalar);
     }
 
     template<FloatingNumber F>
-    inline vec4<F> operator/(const vec4<F>& vec, F scalar) 
+    inline constexpr vec4<F> operator/(const vec4<F>& vec, F scalar) noexcept 
     {
-        if (std::abs(scalar) < glMath::epsilon<F>()) return vec;
+        if constexpr (LaneNumber<F>)
+        {
+            // The lanes divided by (almost) 0 are multiplied by 1 instead
+            F minScalar = static_cast<F>(glMath::epsilon<typename F::valueType>());
+            F invScalar = glMath::select(glMath::abs(scalar) < minScalar, static_cast<F>(1.0), static_cast<F>(1.0) / scalar);
+
+            return vec4<F>(vec.x * invScalar, vec.y * invScalar, vec.z * invScalar, vec.w * invScalar);
+        }
+        else
+        {
+            if (glMath::abs(scalar) < glMath::epsilon<F>()) return vec;
 
 
-        F invScalar = static_cast<F>(1.0) / scalar;
+            F invScalar = static_cast<F>(1.0) / scalar;
 
-        return vec4<F>(vec.x * invScalar, vec.y * invScalar, vec.z * invScalar, vec.w * invScalar);
+            return vec4<F>(vec.x * invScalar, vec.y * invScalar, vec.z * invScalar, vec.w * invScalar);
+        }
     }
 
 
     template<FloatingNumber F>
-    inline bool operator==(const vec4<F>& a, const vec4<F>& b)
+    inline constexpr bool operator==(const vec4<F>& a, const vec4<F>& b) noexcept
     {
-        return static_cast<F>(std::abs(a.x - b.x)) < glMath::epsilon<F>() && 
-               static_cast<F>(std::abs(a.y - b.y)) < glMath::epsilon<F>() &&
-               static_cast<F>(std::abs(a.z - b.z)) < glMath::epsilon<F>() &&
-               static_cast<F>(std::abs(a.w - b.w)) < glMath::epsilon<F>();
+        return glMath::abs(a.x - b.x) < glMath::epsilon<F>() && 
+               glMath::abs(a.y - b.y) < glMath::epsilon<F>() &&
+               glMath::abs(a.z - b.z) < glMath::epsilon<F>() &&
+               glMath::abs(a.w - b.w) < glMath::epsilon<F>();
     }
 
     template<FloatingNumber F>
-    inline bool operator!=(const vec4<F>& a, const vec4<F>& b)
+    inline constexpr bool operator!=(const vec4<F>& a, const vec4<F>& b) noexcept
     {
         return !(a == b);
     }
@@ -2,7 +2,10 @@
 
 #include "Math\Matrices\Matrix2x2.hpp"
 #include "Math\Matrices\Matrix3x3.hpp"
+#include "Math\Matrices\Matrix3x3a.hpp"
 #include "Math\Matrices\Matrix4x4.hpp"
+#include "Math\Matrices\Matrix3x4.hpp"
+#include "Math\Matrices\CachedMatrix4x4.hpp"
 
 // using namespace glMath;
 
@@ -18,7 +21,25 @@ using mat3f = glMath::mat3<float>;
 using mat3d = glMath::mat3<double>;
 
 
+/// @brief shorthand for writing mat3a<float>
+using mat3af = glMath::mat3a<float>;
+/// @brief shorthand for writing mat3a<double>
+using mat3ad = glMath::mat3a<double>;
+
+
 /// @brief shorthand for writing mat4<float>
 using mat4f = glMath::mat4<float>;
 /// @brief shorthand for writing mat4<double>
 using mat4d = glMath::mat4<double>;
+
+
+/// @brief shorthand for writing mat3x4<float>
+using mat3x4f = glMath::mat3x4<float>;
+/// @brief shorthand for writing mat3x4<double>
+using mat3x4d = glMath::mat3x4<double>;
+
+
+/// @brief shorthand for writing cachedMat4<float>
+using cachedMat4f = glMath::cachedMat4<float>;
+/// @brief shorthand for writing cachedMat4<double>
+using cachedMat4d = glMath::cachedMat4<double>;
@@ -2,6 +2,7 @@
 
 #include "Math\Quaternions\Quaternion.hpp"
 #include "Math\Quaternions\DualQuaternion.hpp"
+#include "Math\Quaternions\PackedQuaternion.hpp"
 
 // using namespace glMath;
 
@@ -20,3 +21,10 @@ using dQuatf = glMath::dualQuat<float>;
 /// @brief shorthand for writing dualQuat<double>
 using dQuatd = glMath::dualQuat<double>;
 
+/// @brief shorthand for writing packedQuat<32>
+using packedQuat32 = glMath::packedQuat<32>;
+/// @brief shorthand for writing packedQuat<48>
+using packedQuat48 = glMath::packedQuat<48>;
+/// @brief shorthand for writing packedQuat<64>
+using packedQuat64 = glMath::packedQuat<64>;
+
@@ -0,0 +1,26 @@
+#pragma once
+
+#include "Math\Streams\VectorStream.hpp"
+#include "Math\Streams\QuaternionStream.hpp"
+
+// using namespace glMath;
+
+/// @brief shorthand for writing vec2Stream<float>
+using vec2Streamf = glMath::vec2Stream<float>;
+/// @brief shorthand for writing vec2Stream<double>
+using vec2Streamd = glMath::vec2Stream<double>;
+
+/// @brief shorthand for writing vec3Stream<float>
+using vec3Streamf = glMath::vec3Stream<float>;
+/// @brief shorthand for writing vec3Stream<double>
+using vec3Streamd = glMath::vec3Stream<double>;
+
+/// @brief shorthand for writing vec4Stream<float>
+using vec4Streamf = glMath::vec4Stream<float>;
+/// @brief shorthand for writing vec4Stream<double>
+using vec4Streamd = glMath::vec4Stream<double>;
+
+/// @brief shorthand for writing quatStream<float>
+using quatStreamf = glMath::quatStream<float>;
+/// @brief shorthand for writing quatStream<double>
+using quatStreamd = glMath::quatStream<double>;
@@ -0,0 +1,10 @@
+#pragma once
+
+#include "Math\Transforms\TransformHierarchy.hpp"
+
+// using namespace glMath;
+
+/// @brief shorthand for writing transformHierarchy<float>
+using transformHierarchyf = glMath::transformHierarchy<float>;
+/// @brief shorthand for writing transformHierarchy<double>
+using transformHierarchyd = glMath::transformHierarchy<double>;
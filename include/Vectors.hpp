@@ -3,6 +3,7 @@
 #include "Math\Vectors\Vector2.hpp"
 #include "Math\Vectors\Vector3.hpp"
 #include "Math\Vectors\Vector4.hpp"
+#include "Math\Vectors\Vector3a.hpp"
 
 // using namespace glMath;
 
@@ -20,3 +21,8 @@ using vec3d = glMath::vec3<double>;
 using vec4f = glMath::vec4<float>;
 /// @brief shorthand for writing vec4<double>
 using vec4d = glMath::vec4<double>;
+
+/// @brief shorthand for writing vec3a<float>
+using vec3af = glMath::vec3a<float>;
+/// @brief shorthand for writing vec3a<double>
+using vec3ad = glMath::vec3a<double>;
@@ -0,0 +1,91 @@
+#include <optional>
+
+#include "Vectors.hpp"
+#include "Matrices.hpp"
+#include "Quaternions.hpp"
+#include "Tests.hpp"
+
+// Only static_asserts : this file compiling is the test. Each function below runs in a constant expression, 
+// with the values chosen so that the results are exact
+namespace glMath::tests
+{
+    namespace
+    {
+        template<FloatingNumber F>
+        constexpr bool vectorsAreConstexpr()
+        {
+            constexpr vec3<F> x = vec3<F>::right();
+            constexpr vec3<F> y = vec3<F>::up();
+
+            vec3<F> sum = x + y * static_cast<F>(2.0);
+            sum -= vec3<F>(static_cast<F>(1.0));
+
+            constexpr vec4<F> a(static_cast<F>(1.0), static_cast<F>(2.0), static_cast<F>(3.0), static_cast<F>(4.0));
+            constexpr vec4<F> b(static_cast<F>(4.0), static_cast<F>(3.0), static_cast<F>(2.0), static_cast<F>(1.0));
+
+            return vec3<F>::crossProduct(x, y) == vec3<F>::forward() && 
+                   vec3<F>::dotProduct(x, y) == static_cast<F>(0.0) && 
+                   sum == vec3<F>(static_cast<F>(0.0), static_cast<F>(1.0), static_cast<F>(-1.0)) && 
+                   vec3<F>::distanceSquared(x, y) == static_cast<F>(2.0) && 
+                   vec4<F>::dotProduct(a, b) == static_cast<F>(20.0) && 
+                   vec4<F>::lerpUnclamped(a, b, static_cast<F>(0.5)) == vec4<F>(static_cast<F>(2.5));
+        }
+
+        template<FloatingNumber F>
+        constexpr bool matricesAreConstexpr()
+        {
+            constexpr mat4<F> model = mat4<F>::translate(static_cast<F>(1.0), static_cast<F>(2.0), static_cast<F>(3.0)) * 
+                                      mat4<F>::scale(static_cast<F>(2.0), static_cast<F>(4.0), static_cast<F>(0.5));
+
+            // The SIMD kernels are skipped in constant evaluation, the scalar code runs instead
+            constexpr std::optional<mat4<F>> inv = mat4<F>::inverse(model);
+            constexpr std::optional<mat4<F>> invAffine = model.getInversedAffineMat();
+
+            mat4<F> singular = mat4<F>::identity();
+            singular.at(1, 1) = static_cast<F>(0.0);
+
+            constexpr mat2<F> m2(static_cast<F>(2.0), static_cast<F>(0.0), 
+                                 static_cast<F>(0.0), static_cast<F>(4.0));
+            constexpr std::optional<mat2<F>> invM2 = m2.getInvertedMat();
+
+            constexpr mat3<F> m3 = mat3<F>::identity() * static_cast<F>(2.0);
+
+            vec4<F> point = model * vec4<F>(static_cast<F>(1.0), static_cast<F>(1.0), static_cast<F>(2.0), static_cast<F>(1.0));
+
+            return model.determinant() == static_cast<F>(4.0) && 
+                   inv.has_value() && *inv * model == mat4<F>::identity() && 
+                   invAffine.has_value() && *invAffine == *inv && 
+                   !singular.getInversedMat().has_value() && 
+                   model.getTransposedMat().getTransposedMat() == model && 
+                   point == vec4<F>(static_cast<F>(3.0), static_cast<F>(6.0), static_cast<F>(4.0), static_cast<F>(1.0)) && 
+                   invM2.has_value() && *invM2 * m2 == mat2<F>::identity() && 
+                   m3.determinant() == static_cast<F>(8.0) && 
+                   mat4<F>::fromMat3(m3).toMat3() == m3;
+        }
+
+        template<FloatingNumber F>
+        constexpr bool quaternionsAreConstexpr()
+        {
+            // Half a turn around z, whose components are exact
+            constexpr quat<F> halfTurnZ(static_cast<F>(0.0), static_cast<F>(0.0), static_cast<F>(0.0), static_cast<F>(1.0));
+            constexpr vec3<F> rotated = halfTurnZ.rotatePoint(vec3<F>::right(), assumeNormalized);
+
+            constexpr quat<F> product = halfTurnZ * halfTurnZ;
+
+            constexpr dualQuat<F> rigid(halfTurnZ, vec3<F>(static_cast<F>(1.0), static_cast<F>(2.0), static_cast<F>(3.0)));
+            constexpr mat4<F> rigidMat = rigid.toMat4();
+
+            return rotated == vec3<F>::left() && 
+                   product == quat<F>(static_cast<F>(-1.0), static_cast<F>(0.0), static_cast<F>(0.0), static_cast<F>(0.0)) && 
+                   halfTurnZ.getInvertedQuat() == halfTurnZ.getConjugatedQuat() && 
+                   rigid.getTranslation() == vec3<F>(static_cast<F>(1.0), static_cast<F>(2.0), static_cast<F>(3.0)) && 
+                   rigidMat == mat4<F>::fromDualQuat(rigid) && 
+                   rigidMat == mat4<F>::translate(static_cast<F>(1.0), static_cast<F>(2.0), static_cast<F>(3.0)) * halfTurnZ.toMat4() && 
+                   (rigid * rigid.getInvertedDualQuat()).toMat4() == mat4<F>::identity();
+        }
+    }
+
+    static_assert(vectorsAreConstexpr<float>() && vectorsAreConstexpr<double>());
+    static_assert(matricesAreConstexpr<float>() && matricesAreConstexpr<double>());
+    static_assert(quaternionsAreConstexpr<float>() && quaternionsAreConstexpr<double>());
+}
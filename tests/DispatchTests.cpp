@@ -0,0 +1,310 @@
+#include <cmath>
+#include <cstddef>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "Vectors.hpp"
+#include "Matrices.hpp"
+#include "Quaternions.hpp"
+#include "Streams.hpp"
+#include "Dispatch.hpp"
+#include "Tests.hpp"
+
+namespace glMath::tests
+{
+    namespace
+    {
+        // The counts cover one item, partial blocks of 16 and whole blocks followed by a partial one
+        constexpr std::size_t counts[] = { 1, 5, 16, 37 };
+
+        // GLMATH_SIMD_LEVEL set to value, or unset if value is nullptr
+        void setLevelVariable(const char* value)
+        {
+        #if defined(_MSC_VER)
+            _putenv_s("GLMATH_SIMD_LEVEL", value != nullptr ? value : "");
+        #else
+            if (value != nullptr) setenv("GLMATH_SIMD_LEVEL", value, 1);
+            else                  unsetenv("GLMATH_SIMD_LEVEL");
+        #endif
+        }
+
+        template<FloatingNumber F>
+        mat4<F> randomMat4(std::mt19937& rng)
+        {
+            std::uniform_real_distribution<F> values(static_cast<F>(-2.0), static_cast<F>(2.0));
+
+            mat4<F> mat;
+            for (int col = 0; col < 4; col++)
+                for (int row = 0; row < 4; row++) mat.columns[col][row] = values(rng);
+
+            return mat;
+        }
+
+        // dispatch::multiply against mat4::multiplyScalar, every element within 4 ULP of the sum of the absolute products
+        // of its dot product, into other matrices and in place
+        template<FloatingNumber F>
+        bool multiplyMatches(std::mt19937& rng)
+        {
+            bool matches = true;
+
+            for (std::size_t count : counts)
+            {
+                std::vector<mat4<F>> a(count), b(count), results(count);
+                for (std::size_t i = 0; i < count; i++)
+                {
+                    a[i] = randomMat4<F>(rng);
+                    b[i] = randomMat4<F>(rng);
+                }
+
+                std::vector<mat4<F>> inPlace = a;
+                dispatch::multiply<F>(a, b, results);
+                dispatch::multiply<F>(inPlace, b, inPlace);
+
+                for (std::size_t i = 0; i < count; i++)
+                {
+                    mat4<F> expected = mat4<F>::multiplyScalar(a[i], b[i]);
+
+                    for (int col = 0; col < 4; col++)
+                    {
+                        for (int row = 0; row < 4; row++)
+                        {
+                            F absSum = static_cast<F>(0.0);
+                            for (int k = 0; k < 4; k++) absSum += std::abs(a[i].columns[k][row] * b[i].columns[col][k]);
+
+                            matches &= std::abs(results[i].columns[col][row] - expected.columns[col][row]) <= 4 * ulp(absSum);
+                            matches &= inPlace[i].columns[col][row] == results[i].columns[col][row];
+                        }
+                    }
+                }
+            }
+
+            return matches;
+        }
+
+        // dispatch::transformPoints, and mat4::transformPoints with and without the perspective divide, against the product
+        // computed in double, within 8 ULP of the sum of the absolute products (and of the divided one)
+        template<FloatingNumber F>
+        bool transformMatches(std::mt19937& rng)
+        {
+            std::uniform_real_distribution<F> values(static_cast<F>(-2.0), static_cast<F>(2.0));
+
+            // w = 1.5 + 0.1 * (x + y + z), far from 0
+            mat4<F> mat = randomMat4<F>(rng);
+            mat.columns[0][3] = mat.columns[1][3] = mat.columns[2][3] = static_cast<F>(0.1);
+            mat.columns[3][3] = static_cast<F>(1.5);
+
+            bool matches = true;
+
+            for (std::size_t count : counts)
+            {
+                std::vector<vec3<F>> points(count), dispatched(count), transformed(count), divided(count);
+                for (auto& point : points) point = vec3<F>(values(rng), values(rng), values(rng));
+
+                dispatch::transformPoints<F>(mat, points, dispatched);
+                mat.transformPoints(points, transformed);
+                mat.transformPoints(points, divided, true);
+
+                // In place
+                std::vector<vec3<F>> inPlace = points;
+                mat.transformPoints(inPlace, inPlace);
+
+                for (std::size_t i = 0; i < count; i++)
+                {
+                    const double p[4] = { points[i].x, points[i].y, points[i].z, 1.0 };
+
+                    double w = 0.0;
+                    for (int k = 0; k < 4; k++) w += mat.columns[k][3] * p[k];
+
+                    for (int row = 0; row < 3; row++)
+                    {
+                        double expected = 0.0, absSum = 0.0;
+                        for (int k = 0; k < 4; k++)
+                        {
+                            expected += mat.columns[k][row] * p[k];
+                            absSum += std::abs(mat.columns[k][row] * p[k]);
+                        }
+
+                        double tolerance = 8.0 * ulp(static_cast<F>(absSum));
+
+                        matches &= std::abs(dispatched[i].data[row] - expected) <= tolerance;
+                        matches &= std::abs(transformed[i].data[row] - expected) <= tolerance;
+                        matches &= std::abs(divided[i].data[row] - expected / w) <= 2.0 * tolerance / std::abs(w);
+                        matches &= inPlace[i].data[row] == transformed[i].data[row];
+                    }
+                }
+            }
+
+            return matches;
+        }
+
+        // dispatch::normalize and vecStream::normalize against the normalization in double, within 4 ULP of 1.
+        // A zero vector is left untouched
+        template<FloatingNumber F, std::size_t N>
+        bool normalizeMatches(std::mt19937& rng)
+        {
+            std::uniform_real_distribution<F> values(static_cast<F>(-100.0), static_cast<F>(100.0));
+            const F tolerance = 4 * ulp(static_cast<F>(1.0));
+
+            bool matches = true;
+
+            for (std::size_t count : counts)
+            {
+                vecStream<F, N> stream(count);
+                for (std::size_t c = 0; c < N; c++)
+                {
+                    for (F& value : stream.component(c)) value = values(rng);
+                    stream.component(c)[count / 2] = static_cast<F>(0.0);
+                }
+
+                vecStream<F, N> original = stream;
+                stream.normalize();
+
+                std::vector<vec3<F>> vectors(count);
+                if constexpr (N == 3)
+                {
+                    original.store(vectors);
+                    dispatch::normalize<F>(vectors);
+                }
+
+                for (std::size_t i = 0; i < count; i++)
+                {
+                    double lengthSq = 0.0;
+                    for (std::size_t c = 0; c < N; c++) lengthSq += static_cast<double>(original.component(c)[i]) * original.component(c)[i];
+
+                    double inverseLength = lengthSq > 0.0 ? 1.0 / std::sqrt(lengthSq) : 1.0;
+
+                    for (std::size_t c = 0; c < N; c++)
+                    {
+                        double expected = original.component(c)[i] * inverseLength;
+
+                        matches &= std::abs(stream.component(c)[i] - expected) <= tolerance;
+                        if constexpr (N == 3) matches &= std::abs(vectors[i].data[c] - expected) <= tolerance;
+                    }
+                }
+            }
+
+            return matches;
+        }
+
+        template<FloatingNumber F>
+        quat<F> randomUnitQuat(std::mt19937& rng)
+        {
+            std::normal_distribution<F> values;
+            return quat<F>(values(rng), values(rng), values(rng), values(rng)).normalize();
+        }
+
+        // dispatch::slerp and quatStream::slerp<polynomialMath> against quat::slerpUnclamped<polynomialMath>,
+        // within 16 ULP of 1 (the kernels compute cos(h) with an inverse square root). Every other end is flipped,
+        // so half the pairs go through the shortest path the other way
+        template<FloatingNumber F>
+        bool slerpMatches(std::mt19937& rng)
+        {
+            std::uniform_real_distribution<F> factors(static_cast<F>(0.0), static_cast<F>(1.0));
+            const F tolerance = 16 * ulp(static_cast<F>(1.0));
+            const F t = static_cast<F>(0.3);
+
+            bool matches = true;
+
+            for (std::size_t count : counts)
+            {
+                std::vector<quat<F>> starts(count), ends(count), dispatched(count);
+                std::vector<F> ts(count);
+                for (std::size_t i = 0; i < count; i++)
+                {
+                    starts[i] = randomUnitQuat<F>(rng);
+                    ends[i] = randomUnitQuat<F>(rng) * static_cast<F>(i % 2 == 0 ? 1.0 : -1.0);
+                    ts[i] = factors(rng);
+                }
+
+                dispatch::slerp<F>(starts, ends, t, dispatched);
+
+                quatStream<F> startStream{ std::span<const quat<F>>(starts) }, endStream{ std::span<const quat<F>>(ends) }, results;
+                quatStream<F>::template slerp<polynomialMath>(startStream, endStream, ts, results);
+
+                for (std::size_t i = 0; i < count; i++)
+                {
+                    quat<F> expected = quat<F>::template slerpUnclamped<polynomialMath>(starts[i], ends[i], t);
+                    quat<F> expectedStream = quat<F>::template slerpUnclamped<polynomialMath>(starts[i], ends[i], ts[i]);
+                    quat<F> streamed = results.get(i);
+
+                    for (int c = 0; c < 4; c++)
+                    {
+                        matches &= std::abs(dispatched[i].data[c] - expected.data[c]) <= tolerance;
+                        matches &= std::abs(streamed.data[c] - expectedStream.data[c]) <= tolerance;
+                    }
+                }
+            }
+
+            return matches;
+        }
+
+        // Every kernel of level against the scalar references, for floats and doubles
+        void levelTests(simdLevel level)
+        {
+            dispatch::forceLevel(level);
+
+            std::string name = dispatch::levelName(level);
+            check(dispatch::activeLevel() == level, ("dispatch::forceLevel binds " + name).c_str());
+
+            // The library's batched functions run the level's kernels, unless it's the build's
+            bool runtime = dispatch::runtimeKernels<float>() != nullptr;
+        #if defined(GLMATH_DISPATCH_TARGETS) && !defined(GLMATH_FORCE_SCALAR)
+            check(runtime == (level != dispatch::compiledLevel()), ("dispatch::runtimeKernels is bound unless " + name + " is the build's level").c_str());
+        #else
+            check(!runtime, "dispatch::runtimeKernels is never bound without per level instruction sets");
+        #endif
+
+            std::mt19937 rng(20 + static_cast<int>(level));
+
+            check(multiplyMatches<float>(rng) && multiplyMatches<double>(rng), (name + " : dispatch::multiply within 4 ULP of mat4::multiplyScalar").c_str());
+            check(transformMatches<float>(rng) && transformMatches<double>(rng), (name + " : dispatch::transformPoints and mat4::transformPoints within 8 ULP").c_str());
+            check(normalizeMatches<float, 2>(rng) && normalizeMatches<float, 3>(rng) && normalizeMatches<float, 4>(rng)
+               && normalizeMatches<double, 2>(rng) && normalizeMatches<double, 3>(rng) && normalizeMatches<double, 4>(rng),
+                  (name + " : dispatch::normalize and vecStream::normalize within 4 ULP").c_str());
+            check(slerpMatches<float>(rng) && slerpMatches<double>(rng), (name + " : dispatch::slerp and quatStream::slerp<polynomialMath> within 16 ULP").c_str());
+        }
+
+        // forceLevel() clamps to the CPU's level, resetLevel() reads GLMATH_SIMD_LEVEL again, and ignores the names it doesn't know
+        void bindingTests()
+        {
+            const char* variable = std::getenv("GLMATH_SIMD_LEVEL");
+            std::string previous = variable != nullptr ? variable : "";
+
+            dispatch::forceLevel(simdLevel::avx512);
+            check(dispatch::activeLevel() == dispatch::detectedLevel(), "dispatch::forceLevel clamps to dispatch::detectedLevel");
+
+            setLevelVariable("sse2");
+            dispatch::resetLevel();
+            check(dispatch::activeLevel() == simdLevel::sse2, "dispatch::resetLevel binds GLMATH_SIMD_LEVEL");
+
+            setLevelVariable("avx512");
+            dispatch::resetLevel();
+            check(dispatch::activeLevel() == dispatch::detectedLevel(), "dispatch::resetLevel clamps GLMATH_SIMD_LEVEL to dispatch::detectedLevel");
+
+            setLevelVariable("sse5");
+            dispatch::resetLevel();
+            check(dispatch::activeLevel() == dispatch::detectedLevel(), "dispatch::resetLevel ignores an unknown GLMATH_SIMD_LEVEL");
+
+            setLevelVariable(nullptr);
+            dispatch::resetLevel();
+            check(dispatch::activeLevel() == dispatch::detectedLevel(), "dispatch::resetLevel binds dispatch::detectedLevel without GLMATH_SIMD_LEVEL");
+
+            setLevelVariable(variable != nullptr ? previous.c_str() : nullptr);
+        }
+    }
+
+    void dispatchTests()
+    {
+        bindingTests();
+
+        for (int level = static_cast<int>(simdLevel::sse2); level <= static_cast<int>(dispatch::detectedLevel()); level++)
+        {
+            levelTests(static_cast<simdLevel>(level));
+        }
+
+        // The other tests check the kernels compiled for the build
+        dispatch::forceLevel(dispatch::compiledLevel());
+    }
+}
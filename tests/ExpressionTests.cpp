@@ -0,0 +1,53 @@
+#include <type_traits>
+
+#include "Vectors.hpp"
+#include "Matrices.hpp"
+#include "Expressions.hpp"
+#include "Tests.hpp"
+
+namespace glMath::tests
+{
+    namespace
+    {
+        template<FloatingNumber F>
+        void lazyExpressionTests()
+        {
+            using namespace glMath::expr;
+
+            const vec3<F> a(static_cast<F>(1.0), static_cast<F>(2.0), static_cast<F>(3.0));
+            const vec3<F> b(static_cast<F>(-4.0), static_cast<F>(0.5), static_cast<F>(8.0));
+            const vec3<F> c(static_cast<F>(0.25), static_cast<F>(-1.0), static_cast<F>(2.0));
+
+            // lazy() only takes lvalues, a temporary would die before the expression is evaluated
+            static_assert(requires (vec3<F>& v) { lazy(v); } && !requires { lazy(vec3<F>()); }, "lazy(vec3) must not take a temporary");
+            static_assert(requires (vec4<F>& v) { lazy(v); } && !requires { lazy(vec4<F>()); }, "lazy(vec4) must not take a temporary");
+            static_assert(requires (mat4<F>& m) { lazy(m); } && !requires { lazy(mat4<F>()); }, "lazy(mat4) must not take a temporary");
+            static_assert(!requires (const vec3<F>& x, const vec3<F>& y) { lazy(x + y); }, "lazy() must not take the result of an eager operator");
+
+            // Lazy end to end : no operand of the tree is an already evaluated vector
+            auto fused = lazy(a) + lazy(b) * static_cast<F>(2.0) - c;
+            static_assert(isVecExpr<decltype(fused)>, "lazy(a) + lazy(b) * s - c must stay an expression");
+            static_assert(std::is_same_v<decltype(fused.node.left.left), vecLeaf<vec3<F>>>, 
+                          "a must be a leaf of the expression, not a temporary");
+            static_assert(std::is_same_v<decltype(fused.node.left.right.right), scalarLeaf<F, vec3<F>>>, 
+                          "lazy(b) * s must be a node of the expression, not a temporary");
+
+            vec3<F> lazyResult = fused;
+            check(lazyResult == a + b * static_cast<F>(2.0) - c, "lazy(a) + lazy(b) * s - c equals the eager expression");
+
+            const mat4<F> proj = mat4<F>::perspective(static_cast<F>(1.0), static_cast<F>(1.5), static_cast<F>(0.1), static_cast<F>(100.0));
+            const mat4<F> view = mat4<F>::lookAt(vec3<F>(static_cast<F>(0.0), static_cast<F>(1.0), static_cast<F>(5.0)), 
+                                                 vec3<F>(static_cast<F>(0.0)), vec3<F>::up());
+            const mat4<F> model = mat4<F>::translate(a) * mat4<F>::scale(static_cast<F>(2.0), static_cast<F>(2.0), static_cast<F>(2.0));
+            const vec4<F> point(b, static_cast<F>(1.0));
+
+            check(lazy(proj) * view * model * point == proj * view * model * point, "lazy(proj) * view * model * point equals the eager chain");
+        }
+    }
+
+    void expressionTests()
+    {
+        lazyExpressionTests<float>();
+        lazyExpressionTests<double>();
+    }
+}
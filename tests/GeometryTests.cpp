@@ -0,0 +1,85 @@
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include "Vectors.hpp"
+#include "Matrices.hpp"
+#include "Geometry.hpp"
+#include "Tests.hpp"
+
+namespace glMath::tests
+{
+    namespace
+    {
+        bool maskBit(const std::vector<std::uint64_t>& mask, std::size_t i)
+        {
+            return ((mask[i >> 6] >> (i & 63)) & 1) != 0;
+        }
+
+        // The batch tests against the single ones, on a count that leaves a tail after the 8 and 4 wide steps, 
+        // with a few NaN, which both paths must keep
+        template<FloatingNumber F>
+        void frustumBatchTests()
+        {
+            constexpr std::size_t count = 1003;
+            const F nan = std::numeric_limits<F>::quiet_NaN();
+
+            mat4<F> viewProj = mat4<F>::perspective(static_cast<F>(1.0), static_cast<F>(16.0 / 9.0), static_cast<F>(0.1), static_cast<F>(100.0)) * 
+                               mat4<F>::lookAt(vec3<F>(static_cast<F>(0.0), static_cast<F>(2.0), static_cast<F>(10.0)), 
+                                               vec3<F>(static_cast<F>(0.0), static_cast<F>(0.0), static_cast<F>(0.0)), 
+                                               vec3<F>(static_cast<F>(0.0), static_cast<F>(1.0), static_cast<F>(0.0)));
+            frustum<F> view(viewProj);
+
+            std::mt19937 rng(6);
+            std::uniform_real_distribution<F> position(static_cast<F>(-60.0), static_cast<F>(60.0));
+            std::uniform_real_distribution<F> size(static_cast<F>(0.0), static_cast<F>(5.0));
+
+            std::vector<F> x(count), y(count), z(count), radius(count), ex(count), ey(count), ez(count);
+            for (std::size_t i = 0; i < count; i++)
+            {
+                x[i] = position(rng); y[i] = position(rng); z[i] = position(rng);
+                radius[i] = size(rng);
+                ex[i] = size(rng); ey[i] = size(rng); ez[i] = size(rng);
+            }
+
+            for (std::size_t i = 5; i < count; i += 97)
+            {
+                x[i] = nan;
+                radius[i + 1] = nan;
+                ez[i + 2] = nan;
+            }
+
+            std::vector<std::uint64_t> sphereMask((count + 63) / 64), boxMask((count + 63) / 64);
+            view.testSpheres(x, y, z, radius, sphereMask);
+            view.testAABBs(x, y, z, ex, ey, ez, boxMask);
+
+            bool spheres = true;
+            bool boxes = true;
+            std::size_t visible = 0;
+
+            for (std::size_t i = 0; i < count; i++)
+            {
+                bool sphere = view.intersectsSphere(vec3<F>(x[i], y[i], z[i]), radius[i]);
+
+                spheres &= maskBit(sphereMask, i) == sphere;
+                boxes &= maskBit(boxMask, i) == view.intersectsAABB(vec3<F>(x[i], y[i], z[i]), vec3<F>(ex[i], ey[i], ez[i]));
+                visible += sphere ? 1 : 0;
+            }
+
+            std::vector<std::uint32_t> indices(count);
+            std::size_t culled = view.cullSpheres(x, y, z, radius, indices);
+
+            check(spheres, "frustum::testSpheres agrees with frustum::intersectsSphere, NaN included");
+            check(boxes, "frustum::testAABBs agrees with frustum::intersectsAABB, NaN included");
+            check(visible > 0 && visible < count, "frustum tests keep some spheres and cull others");
+            check(culled == visible, "frustum::cullSpheres writes one index per visible sphere");
+        }
+    }
+
+    void geometryTests()
+    {
+        frustumBatchTests<float>();
+        frustumBatchTests<double>();
+    }
+}
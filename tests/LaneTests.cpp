@@ -0,0 +1,212 @@
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <random>
+
+#include "Vectors.hpp"
+#include "Quaternions.hpp"
+#include "Lanes.hpp"
+#include "Tests.hpp"
+
+namespace glMath::tests
+{
+    namespace
+    {
+        // Each lane of a vec4 or quat of lanes against the same function on the scalar type, 
+        // one lane being zero to go through the untouched path
+        template<typename L>
+        void laneTests()
+        {
+            using T = typename L::valueType;
+            constexpr std::size_t width = L::width;
+
+            std::mt19937 rng(14);
+            std::uniform_real_distribution<T> values(static_cast<T>(-4.0), static_cast<T>(4.0));
+
+            std::array<vec4<T>, width> vecs;
+            std::array<quat<T>, width> quats;
+            std::array<T, width> scalars;
+
+            for (std::size_t i = 0; i < width; i++)
+            {
+                vecs[i] = vec4<T>(values(rng), values(rng), values(rng), values(rng));
+                quats[i] = quat<T>(values(rng), values(rng), values(rng), values(rng));
+                scalars[i] = values(rng);
+            }
+            vecs[1] = vec4<T>(static_cast<T>(0.0));
+            quats[1] = quat<T>(static_cast<T>(0.0), static_cast<T>(0.0), static_cast<T>(0.0), static_cast<T>(0.0));
+            scalars[1] = static_cast<T>(0.0);
+
+            vec4<L> packedVecs = gather<L>(std::span<const vec4<T>>(vecs));
+            L packedScalars = L::load(scalars.data());
+
+            quat<L> packedQuats = gather<L>(std::span<const quat<T>>(quats));
+
+            std::array<vec4<T>, width> normalized, normalized3, normalizedFast, divided;
+            vec4<L> packedFast = packedVecs;
+            scatter<L>(packedFast.normalizeFast(), std::span<vec4<T>>(normalizedFast));
+            scatter<L>(packedVecs.getNormalizedVec(), std::span<vec4<T>>(normalized));
+            scatter<L>(packedVecs.getNormalizedVec3(), std::span<vec4<T>>(normalized3));
+            scatter<L>(packedVecs / packedScalars, std::span<vec4<T>>(divided));
+
+            std::array<quat<T>, width> inverses, quotients;
+            scatter<L>(packedQuats.getInvertedQuat(), std::span<quat<T>>(inverses));
+            scatter<L>(packedQuats / packedScalars, std::span<quat<T>>(quotients));
+
+            bool vecLanes = true;
+            bool quatLanes = true;
+
+            for (std::size_t i = 0; i < width; i++)
+            {
+                vecLanes &= normalized[i] == vecs[i].getNormalizedVec();
+                vecLanes &= normalized3[i] == vecs[i].getNormalizedVec3();
+                vecLanes &= normalizedFast[i] == vec4<T>(vecs[i]).normalizeFast();
+                vecLanes &= divided[i] == vecs[i] / scalars[i];
+
+                quatLanes &= inverses[i] == quats[i].getInvertedQuat();
+                quatLanes &= quotients[i] == quats[i] / scalars[i];
+            }
+
+            check(vecLanes, "vec4 of lanes : normalize, normalize3, normalizeFast and operator/ match vec4 lane by lane");
+            check(quatLanes, "quat of lanes : inverse and operator/ match quat lane by lane");
+        }
+
+        // Every component of a within maxUlp ULP of the largest component of b
+        template<FloatingNumber T>
+        bool withinUlp(const vec3<T>& a, const vec3<T>& b, T maxUlp)
+        {
+            T bound = maxUlp * ulp(std::max({ std::abs(b.x), std::abs(b.y), std::abs(b.z) }));
+
+            return std::abs(a.x - b.x) <= bound && std::abs(a.y - b.y) <= bound && std::abs(a.z - b.z) <= bound;
+        }
+        template<FloatingNumber T>
+        bool withinUlp(const quat<T>& a, const quat<T>& b, T maxUlp)
+        {
+            T bound = maxUlp * ulp(static_cast<T>(1.0));
+
+            for (int c = 0; c < 4; c++)
+            {
+                if (std::abs(a.data[c] - b.data[c]) > bound) return false;
+            }
+
+            return true;
+        }
+
+        // crossProduct, quat::rotatePoint and slerp lane by lane against vec3 and quat. The lanes can round differently 
+        // (the compiler contracts the scalar code into FMAs, and the slerp of lanes normalizes every lane), hence the ULP
+        template<typename L>
+        void laneGeometryTests()
+        {
+            using T = typename L::valueType;
+            constexpr std::size_t width = L::width;
+            constexpr T maxUlp = static_cast<T>(16.0);
+
+            std::mt19937 rng(41);
+            std::uniform_real_distribution<T> values(static_cast<T>(-4.0), static_cast<T>(4.0));
+
+            std::array<vec3<T>, width> as, bs;
+            std::array<quat<T>, width> starts, ends;
+            std::array<T, width> ts;
+
+            for (std::size_t i = 0; i < width; i++)
+            {
+                as[i] = vec3<T>(values(rng), values(rng), values(rng));
+                bs[i] = vec3<T>(values(rng), values(rng), values(rng));
+                starts[i] = quat<T>(values(rng), values(rng), values(rng), values(rng)).normalize();
+                ends[i] = quat<T>(values(rng), values(rng), values(rng), values(rng)).normalize();
+                ts[i] = (values(rng) + static_cast<T>(4.0)) / static_cast<T>(8.0);
+            }
+            // A nearly parallel pair, which the scalar slerp lerps
+            ends[0] = starts[0];
+
+            vec3<L> packedAs = gather<L>(std::span<const vec3<T>>(as));
+            vec3<L> packedBs = gather<L>(std::span<const vec3<T>>(bs));
+            quat<L> packedStarts = gather<L>(std::span<const quat<T>>(starts));
+            quat<L> packedEnds = gather<L>(std::span<const quat<T>>(ends));
+            L packedTs = L::load(ts.data());
+
+            std::array<vec3<T>, width> crosses, rotated;
+            scatter<L>(vec3<L>::crossProduct(packedAs, packedBs), std::span<vec3<T>>(crosses));
+            scatter<L>(packedStarts.rotatePoint(packedAs), std::span<vec3<T>>(rotated));
+
+            std::array<quat<T>, width> slerped;
+            scatter<L>(quat<L>::slerp(packedStarts, packedEnds, packedTs), std::span<quat<T>>(slerped));
+
+            bool crossLanes = true;
+            bool rotateLanes = true;
+            bool slerpLanes = true;
+
+            for (std::size_t i = 0; i < width; i++)
+            {
+                crossLanes &= withinUlp(crosses[i], vec3<T>::crossProduct(as[i], bs[i]), maxUlp);
+                rotateLanes &= withinUlp(rotated[i], starts[i].rotatePoint(as[i]), maxUlp);
+                slerpLanes &= withinUlp(slerped[i], quat<T>::slerp(starts[i], ends[i], ts[i]), maxUlp);
+            }
+
+            check(crossLanes, "vec3 of lanes : crossProduct matches vec3 lane by lane");
+            check(rotateLanes, "quat of lanes : rotatePoint matches quat lane by lane");
+            check(slerpLanes, "quat of lanes : slerp matches quat lane by lane");
+        }
+
+        // Arrays of vec3 gathered and scattered back W by W. The count isn't a multiple of W, so the last packet
+        // is partial : its missing lanes must be 0, and scattering it must write its vectors only
+        template<typename L>
+        void gatherScatterTests()
+        {
+            using T = typename L::valueType;
+            constexpr std::size_t width = L::width;
+            constexpr std::size_t count = 2 * width + 1;
+
+            std::mt19937 rng(42);
+            std::uniform_real_distribution<T> values(static_cast<T>(-4.0), static_cast<T>(4.0));
+
+            std::array<vec3<T>, count> vectors;
+            for (auto& vector : vectors) vector = vec3<T>(values(rng), values(rng), values(rng));
+
+            const vec3<T> untouched(static_cast<T>(7.0));
+            std::array<vec3<T>, count + 1> results;
+            results.fill(untouched);
+
+            bool zeroLanes = true;
+
+            for (std::size_t i = 0; i < count; i += width)
+            {
+                std::size_t packetSize = std::min(width, count - i);
+
+                vec3<L> packet = gather<L>(std::span<const vec3<T>>(vectors).subspan(i, packetSize));
+                scatter<L>(packet, std::span<vec3<T>>(results).subspan(i, packetSize));
+
+                for (std::size_t lane = packetSize; lane < width; lane++)
+                {
+                    zeroLanes &= packet.x.values[lane] == static_cast<T>(0.0) && packet.y.values[lane] == static_cast<T>(0.0) 
+                              && packet.z.values[lane] == static_cast<T>(0.0);
+                }
+            }
+
+            bool roundTrip = true;
+            for (std::size_t i = 0; i < count; i++) roundTrip &= results[i] == vectors[i];
+
+            check(roundTrip, "gather then scatter gives back an array of vec3 whose size isn't a multiple of the width");
+            check(zeroLanes, "gather fills the lanes past the end of the array with 0");
+            check(results[count] == untouched, "scatter writes only the size of its span");
+        }
+    }
+
+    void laneTests()
+    {
+        laneTests<lanes<float, 4>>();
+        laneTests<lanes<float, 8>>();
+        laneTests<lanes<double, 2>>();
+        laneTests<lanes<double, 4>>();
+
+        laneGeometryTests<float4>();
+        laneGeometryTests<float8>();
+        laneGeometryTests<double2>();
+        laneGeometryTests<double4>();
+
+        gatherScatterTests<float4>();
+        gatherScatterTests<float8>();
+        gatherScatterTests<double2>();
+        gatherScatterTests<double4>();
+    }
+}
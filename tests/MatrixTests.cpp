@@ -0,0 +1,667 @@
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <optional>
+#include <random>
+#include <span>
+#include <vector>
+
+#include "Vectors.hpp"
+#include "Matrices.hpp"
+#include "Tests.hpp"
+
+namespace glMath::tests
+{
+    namespace
+    {
+        template<FloatingNumber F>
+        mat4<F> randomMat4(std::mt19937& rng)
+        {
+            std::uniform_real_distribution<F> values(static_cast<F>(-10.0), static_cast<F>(10.0));
+
+            mat4<F> mat;
+            for (int col = 0; col < 4; col++)
+                for (int row = 0; row < 4; row++) mat.columns[col][row] = values(rng);
+
+            return mat;
+        }
+
+        // Every element of result within maxUlp ULP of the sum of the absolute products of its dot product,
+        // the bound of mat4::multiplyScalar (the kernels can round once with FMA where the scalar code rounds twice)
+        template<FloatingNumber F>
+        bool withinProductBound(const mat4<F>& result, const mat4<F>& expected, const mat4<F>& a, const mat4<F>& b, F maxUlp)
+        {
+            for (int col = 0; col < 4; col++)
+            {
+                for (int row = 0; row < 4; row++)
+                {
+                    F absSum = static_cast<F>(0.0);
+                    for (int k = 0; k < 4; k++) absSum += std::abs(a.columns[k][row] * b.columns[col][k]);
+
+                    if (std::abs(result.columns[col][row] - expected.columns[col][row]) > maxUlp * ulp(absSum)) return false;
+                }
+            }
+
+            return true;
+        }
+
+        template<FloatingNumber F>
+        void mat4MultiplyTests()
+        {
+            constexpr F maxUlp = static_cast<F>(4.0);
+            std::mt19937 rng(1);
+
+            bool product = true;
+            bool inPlace = true;
+            bool aliased = true;
+
+            for (int i = 0; i < 10000; i++)
+            {
+                mat4<F> a = randomMat4<F>(rng);
+                mat4<F> b = randomMat4<F>(rng);
+
+                mat4<F> expected = mat4<F>::multiplyScalar(a, b);
+                product &= withinProductBound(a * b, expected, a, b, maxUlp);
+
+                mat4<F> c = a;
+                c *= b;
+                inPlace &= withinProductBound(c, expected, a, b, maxUlp);
+
+                // The kernels write into their left operand, which is also the right one here
+                mat4<F> d = a;
+                d *= d;
+                aliased &= withinProductBound(d, mat4<F>::multiplyScalar(a, a), a, a, maxUlp);
+            }
+
+            check(product, "mat4 * mat4 within 4 ULP of mat4::multiplyScalar");
+            check(inPlace, "mat4 *= mat4 within 4 ULP of mat4::multiplyScalar");
+            check(aliased, "mat4 *= itself within 4 ULP of mat4::multiplyScalar");
+        }
+
+        template<FloatingNumber F>
+        void inverseTests()
+        {
+            // A singular matrix is reported, and left untouched
+            mat2<F> singular2(static_cast<F>(1.0), static_cast<F>(2.0), 
+                              static_cast<F>(2.0), static_cast<F>(4.0));
+            mat2<F> copy2 = singular2;
+
+            check(!copy2.inverse() && copy2 == singular2, "mat2::inverse() returns false on a singular matrix and leaves it untouched");
+            check(!singular2.getInvertedMat().has_value(), "mat2::getInvertedMat() returns std::nullopt on a singular matrix");
+
+            mat4<F> singular4 = mat4<F>::identity();
+            singular4.columns[2][2] = static_cast<F>(0.0);
+            mat4<F> copy4 = singular4;
+
+            check(!copy4.inverse() && copy4 == singular4, "mat4::inverse() returns false on a singular matrix and leaves it untouched");
+            check(!singular4.getInversedMat().has_value(), "mat4::getInversedMat() returns std::nullopt on a singular matrix");
+
+            // And a regular one is inversed
+            mat2<F> rot = mat2<F>::rotateZ(static_cast<F>(30.0));
+            std::optional<mat2<F>> invRot = rot.getInvertedMat();
+
+            check(invRot.has_value() && *invRot * rot == mat2<F>::identity(), "mat2::getInvertedMat() * mat == identity");
+
+            // mat3 has the same contract, and mat4::getNormalMat() only transposes a singular top-left 3x3 matrix
+            mat3<F> singular3(static_cast<F>(1.0), static_cast<F>(2.0), static_cast<F>(3.0),
+                              static_cast<F>(2.0), static_cast<F>(4.0), static_cast<F>(6.0),
+                              static_cast<F>(0.0), static_cast<F>(1.0), static_cast<F>(5.0));
+            mat3<F> copy3 = singular3;
+
+            check(!copy3.inverse() && copy3 == singular3, "mat3::inverse() returns false on a singular matrix and leaves it untouched");
+            check(!singular3.getInvertedMat().has_value() && !mat3<F>::inverted(singular3).has_value(), 
+                  "mat3::getInvertedMat() returns std::nullopt on a singular matrix");
+            check(singular4.getNormalMat() == singular4.toMat3().getTransposedMat(), "mat4::getNormalMat() transposes a singular matrix");
+
+            mat3<F> scale3 = mat3<F>::diagonal(static_cast<F>(4.0));
+            std::optional<mat3<F>> invScale3 = scale3.getInvertedMat();
+
+            check(invScale3.has_value() && *invScale3 * scale3 == mat3<F>::identity(), "mat3::getInvertedMat() * mat == identity");
+        }
+
+        // inverse * mat within tolerance of the identity, for random matrices made regular (and well conditioned)
+        // by a dominant diagonal. mat4::inverse() runs the SSE or AVX kernel in the SIMD builds, and the scalar code otherwise
+        template<FloatingNumber F>
+        void randomInverseTests(F tolerance)
+        {
+            std::mt19937 rng(7);
+
+            bool inversed = true;
+            bool identity = true;
+            bool inPlace = true;
+
+            for (int i = 0; i < 200; i++)
+            {
+                mat4<F> mat = randomMat4<F>(rng);
+                for (int d = 0; d < 4; d++) mat.columns[d][d] += std::copysign(static_cast<F>(45.0), mat.columns[d][d]);
+
+                std::optional<mat4<F>> inv = mat.getInversedMat();
+                mat4<F> copy = mat;
+
+                inversed &= inv.has_value() && copy.inverse();
+                if (!inv.has_value()) continue;
+
+                mat4<F> product = *inv * mat;
+                // gcc can contract the kernel's products into FMAs differently wherever it is inlined, so the two aren't compared bit to bit
+                mat4<F> inPlaceProduct = copy * mat;
+
+                for (int col = 0; col < 4; col++)
+                {
+                    for (int row = 0; row < 4; row++)
+                    {
+                        F expected = col == row ? static_cast<F>(1.0) : static_cast<F>(0.0);
+
+                        identity &= std::abs(product.columns[col][row] - expected) <= tolerance;
+                        inPlace &= std::abs(inPlaceProduct.columns[col][row] - expected) <= tolerance;
+                    }
+                }
+            }
+
+            check(inversed, "mat4::inverse() inverses random regular matrices");
+            check(identity, "mat4::getInversedMat() * mat within tolerance of the identity for random regular matrices");
+            check(inPlace, "mat4::inverse() in place * mat within tolerance of the identity for random regular matrices");
+        }
+
+        // Every element of a within tolerance of b, relative to the largest element of b
+        template<FloatingNumber F>
+        bool closeTo(const mat4<F>& a, const mat4<F>& b, F tolerance)
+        {
+            F largest = static_cast<F>(1.0);
+            for (int i = 0; i < 16; i++) largest = std::max(largest, std::abs(b.indices[i]));
+
+            for (int i = 0; i < 16; i++)
+            {
+                if (std::abs(a.indices[i] - b.indices[i]) > tolerance * largest) return false;
+            }
+
+            return true;
+        }
+
+        // The depth of a view space point at distance in front of the camera, after the perspective divide
+        template<FloatingNumber F>
+        F projectedDepth(const mat4<F>& projection, F distance)
+        {
+            vec4<F> clip = projection * vec4<F>(static_cast<F>(0.0), static_cast<F>(0.0), -distance, static_cast<F>(1.0));
+
+            return clip.z / clip.w;
+        }
+
+        template<FloatingNumber F>
+        void lookAtTests(F tolerance)
+        {
+            const vec3<F> eye(static_cast<F>(3.0), static_cast<F>(-2.0), static_cast<F>(5.0));
+            const vec3<F> target(static_cast<F>(-1.0), static_cast<F>(4.0), static_cast<F>(0.5));
+            const vec3<F> up(static_cast<F>(0.0), static_cast<F>(1.0), static_cast<F>(0.0));
+
+            mat4<F> view = mat4<F>::lookAt(eye, target, up);
+
+            // The eye goes to the origin, and the target down the -z axis
+            vec4<F> viewEye = view * vec4<F>(eye, static_cast<F>(1.0));
+            vec4<F> viewTarget = view * vec4<F>(target, static_cast<F>(1.0));
+            F distance = (target - eye).length();
+
+            check(std::abs(viewEye.x) <= tolerance && std::abs(viewEye.y) <= tolerance && std::abs(viewEye.z) <= tolerance,
+                  "mat4::lookAt() moves the eye to the origin");
+            check(std::abs(viewTarget.x) <= tolerance * distance && std::abs(viewTarget.y) <= tolerance * distance 
+                  && std::abs(viewTarget.z + distance) <= tolerance * distance, "mat4::lookAt() moves the target down the -z axis");
+
+            std::optional<mat4<F>> inverse = view.getInversedMat();
+            check(inverse.has_value() && closeTo(mat4<F>::lookAtInverse(eye, target, up), *inverse, tolerance), 
+                  "mat4::lookAtInverse() matches the inverse of lookAt()");
+
+            // A worldUp parallel to the view direction is replaced, the matrix stays a rotation and a translation
+            mat4<F> straightDown = mat4<F>::lookAt(eye, eye - up, up);
+            std::optional<mat4<F>> straightDownInverse = straightDown.getInversedMat();
+
+            check(std::abs(straightDown.determinant() - static_cast<F>(1.0)) <= tolerance, "mat4::lookAt() along worldUp is a rotation");
+            check(straightDownInverse.has_value() && closeTo(mat4<F>::lookAtInverse(eye, eye - up, up), *straightDownInverse, tolerance),
+                  "mat4::lookAtInverse() along worldUp matches the inverse of lookAt()");
+        }
+
+        template<FloatingNumber F>
+        void projectionTests(F tolerance)
+        {
+            const F fov = static_cast<F>(1.2);
+            const F aspect = static_cast<F>(16.0 / 9.0);
+            const F near = static_cast<F>(0.1);
+            const F far = static_cast<F>(100.0);
+
+            mat4<F> perspective = mat4<F>::perspective(fov, aspect, near, far);
+            mat4<F> reversedZ = mat4<F>::perspectiveReversedZ(fov, aspect, near, far);
+            mat4<F> infinite = mat4<F>::perspectiveInfinite(fov, aspect, near);
+            mat4<F> infiniteReversedZ = mat4<F>::perspectiveInfiniteReversedZ(fov, aspect, near);
+            mat4<F> orthographic = mat4<F>::orthographic(static_cast<F>(-4.0), static_cast<F>(6.0), static_cast<F>(-2.0), 
+                                                         static_cast<F>(3.0), near, far);
+
+            // The depth ranges : [-1, 1] for the usual ones, near at 1 and far (or the infinity) at 0 for the reversed-Z ones
+            check(std::abs(projectedDepth(perspective, near) + static_cast<F>(1.0)) <= tolerance
+                  && std::abs(projectedDepth(perspective, far) - static_cast<F>(1.0)) <= tolerance, 
+                  "mat4::perspective() maps near to -1 and far to 1");
+            check(std::abs(projectedDepth(reversedZ, near) - static_cast<F>(1.0)) <= tolerance
+                  && std::abs(projectedDepth(reversedZ, far)) <= tolerance, 
+                  "mat4::perspectiveReversedZ() maps near to 1 and far to 0");
+            check(std::abs(projectedDepth(infinite, near) + static_cast<F>(1.0)) <= tolerance
+                  && projectedDepth(infinite, static_cast<F>(1e6)) < static_cast<F>(1.0), 
+                  "mat4::perspectiveInfinite() maps near to -1 and the far points below 1");
+            check(std::abs(projectedDepth(infiniteReversedZ, near) - static_cast<F>(1.0)) <= tolerance
+                  && projectedDepth(infiniteReversedZ, static_cast<F>(1e6)) > static_cast<F>(0.0)
+                  && projectedDepth(infiniteReversedZ, static_cast<F>(1e6)) <= static_cast<F>(1e-6),
+                  "mat4::perspectiveInfiniteReversedZ() maps near to 1 and the far points toward 0");
+            check(std::abs(projectedDepth(orthographic, near) + static_cast<F>(1.0)) <= tolerance
+                  && std::abs(projectedDepth(orthographic, far) - static_cast<F>(1.0)) <= tolerance, 
+                  "mat4::orthographic() maps near to -1 and far to 1");
+
+            // The closed forms against the general inverse
+            auto matchesInverse = [tolerance](const mat4<F>& closedForm, const mat4<F>& mat)
+            {
+                std::optional<mat4<F>> inverse = mat.getInversedMat();
+                return inverse.has_value() && closeTo(closedForm, *inverse, tolerance);
+            };
+
+            check(matchesInverse(mat4<F>::perspectiveInverse(fov, aspect, near, far), perspective), 
+                  "mat4::perspectiveInverse() matches the inverse of perspective()");
+            check(matchesInverse(mat4<F>::perspectiveReversedZInverse(fov, aspect, near, far), reversedZ), 
+                  "mat4::perspectiveReversedZInverse() matches the inverse of perspectiveReversedZ()");
+            check(matchesInverse(mat4<F>::perspectiveInfiniteInverse(fov, aspect, near), infinite), 
+                  "mat4::perspectiveInfiniteInverse() matches the inverse of perspectiveInfinite()");
+            check(matchesInverse(mat4<F>::perspectiveInfiniteReversedZInverse(fov, aspect, near), infiniteReversedZ), 
+                  "mat4::perspectiveInfiniteReversedZInverse() matches the inverse of perspectiveInfiniteReversedZ()");
+            check(matchesInverse(mat4<F>::orthographicInverse(static_cast<F>(-4.0), static_cast<F>(6.0), static_cast<F>(-2.0), 
+                                                              static_cast<F>(3.0), near, far), orthographic), 
+                  "mat4::orthographicInverse() matches the inverse of orthographic()");
+        }
+
+        template<FloatingNumber F>
+        mat3x4<F> randomMat3x4(std::mt19937& rng)
+        {
+            std::uniform_real_distribution<F> values(static_cast<F>(-10.0), static_cast<F>(10.0));
+
+            mat3x4<F> mat;
+            for (int i = 0; i < 12; i++) mat.indices[i] = values(rng);
+
+            return mat;
+        }
+
+        // Like withinProductBound(), with the translation of a that the implicit [0 0 0 1] row of b adds to the last column
+        template<FloatingNumber F>
+        bool withinProductBound(const mat3x4<F>& result, const mat3x4<F>& expected, const mat3x4<F>& a, const mat3x4<F>& b, F maxUlp)
+        {
+            for (int row = 0; row < 3; row++)
+            {
+                for (int col = 0; col < 4; col++)
+                {
+                    F absSum = col == 3 ? std::abs(a.rows[row][3]) : static_cast<F>(0.0);
+                    for (int k = 0; k < 3; k++) absSum += std::abs(a.rows[row][k] * b.rows[k][col]);
+
+                    if (std::abs(result.rows[row][col] - expected.rows[row][col]) > maxUlp * ulp(absSum)) return false;
+                }
+            }
+
+            return true;
+        }
+
+        template<FloatingNumber F>
+        void mat3x4Tests(F tolerance)
+        {
+            constexpr F maxUlp = static_cast<F>(4.0);
+            std::mt19937 rng(8);
+
+            // The products against mat3x4::multiplyScalar, and against mat4 for the implicit bottom row
+            bool product = true;
+            bool inPlace = true;
+            bool aliased = true;
+            bool asMat4 = true;
+
+            for (int i = 0; i < 100; i++)
+            {
+                mat3x4<F> a = randomMat3x4<F>(rng);
+                mat3x4<F> b = randomMat3x4<F>(rng);
+
+                mat3x4<F> expected = mat3x4<F>::multiplyScalar(a, b);
+                product &= withinProductBound(a * b, expected, a, b, maxUlp);
+
+                mat3x4<F> c = a;
+                c *= b;
+                inPlace &= withinProductBound(c, expected, a, b, maxUlp);
+
+                mat3x4<F> d = a;
+                d *= d;
+                aliased &= withinProductBound(d, mat3x4<F>::multiplyScalar(a, a), a, a, maxUlp);
+
+                mat4<F> expected4 = mat4<F>::multiplyScalar(a.toMat4(), b.toMat4());
+                asMat4 &= withinProductBound(a * b, mat3x4<F>::fromMat4(expected4), a, b, maxUlp);
+            }
+
+            check(product, "mat3x4 * mat3x4 within 4 ULP of mat3x4::multiplyScalar");
+            check(inPlace, "mat3x4 *= mat3x4 within 4 ULP of mat3x4::multiplyScalar");
+            check(aliased, "mat3x4 *= itself within 4 ULP of mat3x4::multiplyScalar");
+            check(asMat4, "mat3x4 * mat3x4 within 4 ULP of the mat4 product");
+
+            // pack() and unpack() against fromMat4() and toMat4(), which only move values, for counts that aren't all even
+            bool packed = true;
+            bool unpacked = true;
+
+            for (std::size_t count : { 1, 2, 3, 5, 8, 13 })
+            {
+                std::vector<mat4<F>> mats(count);
+                for (auto& mat : mats) mat = randomMat3x4<F>(rng).toMat4();
+
+                std::vector<mat3x4<F>> packs(count + 1, mat3x4<F>::identity());
+                mat3x4<F>::pack(mats, std::span<mat3x4<F>>(packs).first(count));
+
+                std::vector<mat4<F>> unpacks(count + 1, mat4<F>::identity());
+                mat3x4<F>::unpack(std::span<const mat3x4<F>>(packs).first(count), std::span<mat4<F>>(unpacks).first(count));
+
+                for (std::size_t i = 0; i < count; i++)
+                {
+                    packed &= packs[i] == mat3x4<F>::fromMat4(mats[i]);
+                    unpacked &= unpacks[i] == mats[i];
+                }
+
+                packed &= packs[count] == mat3x4<F>::identity();
+                unpacked &= unpacks[count] == mat4<F>::identity();
+            }
+
+            check(packed, "mat3x4::pack() matches mat3x4::fromMat4() and writes only its span");
+            check(unpacked, "mat3x4::unpack() gives back the packed mat4 and writes only its span");
+
+            // The transforms against the mat4, within 4 ULP of the sum of the absolute products
+            std::uniform_real_distribution<F> values(static_cast<F>(-10.0), static_cast<F>(10.0));
+
+            bool points = true;
+            for (int i = 0; i < 50; i++)
+            {
+                mat3x4<F> mat = randomMat3x4<F>(rng);
+                vec3<F> point(values(rng), values(rng), values(rng));
+
+                vec4<F> expected = mat.toMat4() * vec4<F>(point, static_cast<F>(1.0));
+                vec3<F> transformed = mat.transformPoint(point);
+
+                for (int row = 0; row < 3; row++)
+                {
+                    F absSum = std::abs(mat.rows[row][0] * point.x) + std::abs(mat.rows[row][1] * point.y) 
+                             + std::abs(mat.rows[row][2] * point.z) + std::abs(mat.rows[row][3]);
+
+                    points &= std::abs(transformed.data[row] - expected.data[row]) <= maxUlp * ulp(absSum);
+                }
+            }
+
+            check(points, "mat3x4::transformPoint() matches the mat4");
+
+            // inverse * mat against the identity for regular matrices, and the singular ones reported
+            bool identity = true;
+            for (int i = 0; i < 100; i++)
+            {
+                mat3x4<F> mat = randomMat3x4<F>(rng);
+                for (int d = 0; d < 3; d++) mat.rows[d][d] += std::copysign(static_cast<F>(35.0), mat.rows[d][d]);
+
+                std::optional<mat3x4<F>> inv = mat.getInversedMat();
+                if (!inv.has_value()) { identity = false; continue; }
+
+                mat3x4<F> product = *inv * mat;
+                for (int row = 0; row < 3; row++)
+                {
+                    for (int col = 0; col < 4; col++)
+                    {
+                        F expected = row == col ? static_cast<F>(1.0) : static_cast<F>(0.0);
+                        // The translation is of the order of the values, 10
+                        F bound = col == 3 ? tolerance * static_cast<F>(10.0) : tolerance;
+
+                        identity &= std::abs(product.rows[row][col] - expected) <= bound;
+                    }
+                }
+            }
+
+            mat3x4<F> singular = mat3x4<F>::identity();
+            singular.rows[1][1] = static_cast<F>(0.0);
+            mat3x4<F> copy = singular;
+
+            check(identity, "mat3x4::getInversedMat() * mat within tolerance of the identity for random regular matrices");
+            check(!copy.inverse() && copy == singular && !singular.getInversedMat().has_value(), 
+                  "mat3x4::inverse() reports a singular matrix and leaves it untouched");
+        }
+
+        template<FloatingNumber F>
+        mat3a<F> randomMat3a(std::mt19937& rng)
+        {
+            std::uniform_real_distribution<F> values(static_cast<F>(-10.0), static_cast<F>(10.0));
+
+            mat3a<F> mat;
+            for (int col = 0; col < 3; col++)
+                for (int row = 0; row < 3; row++) mat.columns[col][row] = values(rng);
+
+            return mat;
+        }
+
+        template<FloatingNumber F>
+        bool withinProductBound(const mat3a<F>& result, const mat3a<F>& expected, const mat3a<F>& a, const mat3a<F>& b, F maxUlp)
+        {
+            for (int col = 0; col < 3; col++)
+            {
+                for (int row = 0; row < 3; row++)
+                {
+                    F absSum = static_cast<F>(0.0);
+                    for (int k = 0; k < 3; k++) absSum += std::abs(a.columns[k][row] * b.columns[col][k]);
+
+                    if (std::abs(result.columns[col][row] - expected.columns[col][row]) > maxUlp * ulp(absSum)) return false;
+                }
+            }
+
+            return true;
+        }
+
+        // The 4th value of every column, which the kernels must keep at 0
+        template<FloatingNumber F>
+        bool paddingIsZero(const mat3a<F>& mat)
+        {
+            return mat.columns[0][3] == static_cast<F>(0.0) && mat.columns[1][3] == static_cast<F>(0.0) && mat.columns[2][3] == static_cast<F>(0.0);
+        }
+
+        // Every element of a within tolerance of b, relative to the largest element of b
+        template<FloatingNumber F>
+        bool closeTo(const mat3a<F>& a, const mat3<F>& b, F tolerance)
+        {
+            F largest = static_cast<F>(1.0);
+            for (int col = 0; col < 3; col++)
+                for (int row = 0; row < 3; row++) largest = std::max(largest, std::abs(b.columns[col][row]));
+
+            for (int col = 0; col < 3; col++)
+            {
+                for (int row = 0; row < 3; row++)
+                {
+                    if (std::abs(a.columns[col][row] - b.columns[col][row]) > tolerance * largest) return false;
+                }
+            }
+
+            return true;
+        }
+
+        template<FloatingNumber F>
+        void mat3aTests(F tolerance)
+        {
+            constexpr F maxUlp = static_cast<F>(4.0);
+            std::mt19937 rng(11);
+            std::uniform_real_distribution<F> values(static_cast<F>(-10.0), static_cast<F>(10.0));
+
+            // The products against mat3a::multiplyScalar
+            bool product = true;
+            bool inPlace = true;
+            bool aliased = true;
+            bool padding = true;
+
+            for (int i = 0; i < 100; i++)
+            {
+                mat3a<F> a = randomMat3a<F>(rng);
+                mat3a<F> b = randomMat3a<F>(rng);
+
+                mat3a<F> expected = mat3a<F>::multiplyScalar(a, b);
+                mat3a<F> res = a * b;
+                product &= withinProductBound(res, expected, a, b, maxUlp);
+
+                mat3a<F> c = a;
+                c *= b;
+                inPlace &= withinProductBound(c, expected, a, b, maxUlp);
+
+                mat3a<F> d = a;
+                d *= d;
+                aliased &= withinProductBound(d, mat3a<F>::multiplyScalar(a, a), a, a, maxUlp);
+
+                padding &= paddingIsZero(res) && paddingIsZero(c) && paddingIsZero(d) && paddingIsZero(a.getTransposedMat());
+            }
+
+            check(product, "mat3a * mat3a within 4 ULP of mat3a::multiplyScalar");
+            check(inPlace, "mat3a *= mat3a within 4 ULP of mat3a::multiplyScalar");
+            check(aliased, "mat3a *= itself within 4 ULP of mat3a::multiplyScalar");
+            check(padding, "mat3a products and transposes keep the padding at 0");
+
+            mat3a<F> converted = randomMat3a<F>(rng);
+            check(mat3a<F>::fromMat3(converted.toMat3()) == converted, "mat3a::toMat3() and fromMat3() are lossless");
+
+            // inverse against mat3, whose inverse is scalar, and inverse * mat against the identity
+            bool inverses = true;
+            bool identity = true;
+
+            for (int i = 0; i < 100; i++)
+            {
+                mat3a<F> mat = randomMat3a<F>(rng);
+                for (int d = 0; d < 3; d++) mat.columns[d][d] += std::copysign(static_cast<F>(35.0), mat.columns[d][d]);
+
+                std::optional<mat3a<F>> inv = mat.getInversedMat();
+                std::optional<mat3<F>> expected = mat.toMat3().getInvertedMat();
+
+                if (!inv.has_value() || !expected.has_value()) { inverses = false; continue; }
+
+                inverses &= closeTo(*inv, *expected, tolerance) && paddingIsZero(*inv);
+                identity &= closeTo(*inv * mat, mat3<F>::identity(), tolerance);
+            }
+
+            mat3a<F> singular = mat3a<F>::identity();
+            singular.columns[2][2] = static_cast<F>(0.0);
+            mat3a<F> copy = singular;
+
+            check(inverses, "mat3a::getInversedMat() matches mat3::getInvertedMat()");
+            check(identity, "mat3a::getInversedMat() * mat within tolerance of the identity for random regular matrices");
+            check(!copy.inverse() && copy == singular && !singular.getInversedMat().has_value(), 
+                  "mat3a::inverse() reports a singular matrix and leaves it untouched");
+
+            // normalMats() against mat4::getNormalMat(), one matrix in five being singular (it is only transposed)
+            bool normals = true;
+            bool normalsSpan = true;
+
+            for (std::size_t count : { 1, 2, 3, 5, 8, 13 })
+            {
+                std::vector<mat4<F>> mats(count);
+                for (std::size_t i = 0; i < count; i++)
+                {
+                    mats[i] = randomMat4<F>(rng);
+                    for (int d = 0; d < 3; d++) mats[i].columns[d][d] += std::copysign(static_cast<F>(35.0), mats[i].columns[d][d]);
+
+                    if (i % 5 == 4) mats[i].columns[1][0] = mats[i].columns[1][1] = mats[i].columns[1][2] = static_cast<F>(0.0);
+                }
+
+                std::vector<mat3a<F>> results(count + 1, mat3a<F>::identity());
+                mat3a<F>::normalMats(mats, std::span<mat3a<F>>(results).first(count));
+
+                for (std::size_t i = 0; i < count; i++)
+                {
+                    normals &= closeTo(results[i], mats[i].getNormalMat(), tolerance) && paddingIsZero(results[i]);
+                }
+
+                normalsSpan &= results[count] == mat3a<F>::identity();
+            }
+
+            check(normals, "mat3a::normalMats() matches mat4::getNormalMat(), singular matrices included");
+            check(normalsSpan, "mat3a::normalMats() writes only its span");
+
+            // transformVectors() against operator*, for counts that end in a partial step of the kernel, and in place
+            bool transformed = true;
+            bool transformedInPlace = true;
+
+            for (std::size_t count : { 1, 3, 4, 5, 7, 8, 9, 17 })
+            {
+                mat3a<F> mat = randomMat3a<F>(rng);
+
+                std::vector<vec3<F>> vectors(count);
+                for (auto& vector : vectors) vector = vec3<F>(values(rng), values(rng), values(rng));
+
+                std::vector<vec3<F>> results(count);
+                mat.transformVectors(vectors, results);
+
+                std::vector<vec3<F>> inPlaceResults = vectors;
+                mat.transformVectors(inPlaceResults, inPlaceResults);
+
+                for (std::size_t i = 0; i < count; i++)
+                {
+                    vec3<F> expected = mat * vectors[i];
+
+                    for (int row = 0; row < 3; row++)
+                    {
+                        F absSum = std::abs(mat.columns[0][row] * vectors[i].x) + std::abs(mat.columns[1][row] * vectors[i].y) 
+                                 + std::abs(mat.columns[2][row] * vectors[i].z);
+
+                        transformed &= std::abs(results[i].data[row] - expected.data[row]) <= maxUlp * ulp(absSum);
+                        transformedInPlace &= std::abs(inPlaceResults[i].data[row] - expected.data[row]) <= maxUlp * ulp(absSum);
+                    }
+                }
+            }
+
+            check(transformed, "mat3a::transformVectors() within 4 ULP of mat3a * vec3");
+            check(transformedInPlace, "mat3a::transformVectors() in place within 4 ULP of mat3a * vec3");
+        }
+
+        template<FloatingNumber F>
+        void cachedMat4Tests()
+        {
+            cachedMat4<F> cached(mat4<F>::scale(static_cast<F>(2.0), static_cast<F>(4.0), static_cast<F>(8.0)));
+
+            check(cached.determinant() == static_cast<F>(64.0), "cachedMat4::determinant()");
+            check(cached.getInversedMat().has_value(), "cachedMat4::getInversedMat() on a regular matrix");
+
+            // Reading doesn't invalidate, writing does, even after the derived values were computed
+            cached.getNormalMat();
+            F value = cached.at(0, 0);
+            check(value == static_cast<F>(2.0) && cached.isFullyCached(), "cachedMat4::at() reads without invalidating the cache");
+
+            std::uint32_t version = cached.getVersion();
+            cached.set(0, 0, static_cast<F>(5.0));
+
+            check(cached.getVersion() != version && !cached.isFullyCached(), "cachedMat4::set(row, col, value) invalidates the cache");
+            check(cached.determinant() == static_cast<F>(160.0), "cachedMat4::determinant() after set(row, col, value)");
+            check(*cached.getInversedMat() == *cached.get().getInversedMat(), "cachedMat4::getInversedMat() after set(row, col, value)");
+            check(cached.getNormalMat() == cached.get().getNormalMat(), "cachedMat4::getNormalMat() after set(row, col, value)");
+
+            cached *= mat4<F>::translate(static_cast<F>(1.0), static_cast<F>(2.0), static_cast<F>(3.0));
+            check(*cached.getInversedMat() == *cached.get().getInversedMat(), "cachedMat4::getInversedMat() after operator*=");
+
+            cached.transpose();
+            check(*cached.getInversedMat() == *cached.get().getInversedMat(), "cachedMat4::getInversedMat() after transpose()");
+        }
+    }
+
+    void matrixTests()
+    {
+        mat4MultiplyTests<float>();
+        mat4MultiplyTests<double>();
+
+        inverseTests<float>();
+        inverseTests<double>();
+
+        randomInverseTests<float>(1e-5f);
+        randomInverseTests<double>(1e-13);
+
+        lookAtTests<float>(1e-5f);
+        lookAtTests<double>(1e-12);
+
+        projectionTests<float>(1e-5f);
+        projectionTests<double>(1e-12);
+
+        mat3x4Tests<float>(1e-5f);
+        mat3x4Tests<double>(1e-13);
+
+        mat3aTests<float>(1e-5f);
+        mat3aTests<double>(1e-13);
+
+        cachedMat4Tests<float>();
+        cachedMat4Tests<double>();
+    }
+}
@@ -0,0 +1,154 @@
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "Vectors.hpp"
+#include "Quaternions.hpp"
+#include "Tests.hpp"
+
+namespace glMath::tests
+{
+    namespace
+    {
+        constexpr double radToDeg = 57.29577951308232;
+
+        // The angle of the rotation from a to b, conj(a) * b, in degrees, computed in double
+        template<FloatingNumber F>
+        double angleBetween(const quat<float>& a, const quat<F>& b)
+        {
+            double aw = a.w, ax = a.x, ay = a.y, az = a.z;
+            double bw = b.w, bx = b.x, by = b.y, bz = b.z;
+
+            double w = aw * bw + ax * bx + ay * by + az * bz;
+            double x = aw * bx - ax * bw - ay * bz + az * by;
+            double y = aw * by - ay * bw - az * bx + ax * bz;
+            double z = aw * bz - az * bw - ax * by + ay * bx;
+
+            return 2.0 * std::atan2(std::sqrt(x * x + y * y + z * z), std::abs(w)) * radToDeg;
+        }
+
+        template<FloatingNumber F>
+        double lengthError(const quat<F>& rot)
+        {
+            double w = rot.w, x = rot.x, y = rot.y, z = rot.z;
+            return std::abs(std::sqrt(w * w + x * x + y * y + z * z) - 1.0);
+        }
+
+        // Random unit quaternions, with the identity, -z, a 90 degrees turn and one with 4 components of the same magnitude first.
+        // 1000003 isn't a multiple of 4, so pack() and unpack() have a tail
+        std::vector<quat<float>> unitQuats()
+        {
+            std::mt19937 rng(24);
+            std::normal_distribution<float> values;
+
+            std::vector<quat<float>> rots(1000003);
+            for (auto& rot : rots) rot = quat<float>(values(rng), values(rng), values(rng), values(rng)).normalize();
+
+            rots[0] = quat<float>(1.0f, 0.0f, 0.0f, 0.0f);
+            rots[1] = quat<float>(0.0f, 0.0f, 0.0f, -1.0f);
+            rots[2] = quat<float>(0.70710678f, 0.70710678f, 0.0f, 0.0f);
+            rots[3] = quat<float>(-0.5f, 0.5f, -0.5f, 0.5f);
+
+            return rots;
+        }
+
+        // The largest angle between rots and their packed and unpacked versions, in [minAngle, maxAngle] degrees (the lower bound
+        // checks the quantization is as coarse as the Bits say), their lengths within 6e-8 of 1, and the batched pack() and unpack()
+        // against the scalar constructor and to(), bit for bit (within one rounding when FMA can contract the scalar code differently)
+        template<std::size_t Bits>
+        void packedQuatTests(const std::vector<quat<float>>& rots, double minAngle, double maxAngle, double maxAngleDouble)
+        {
+            const std::size_t count = rots.size();
+
+            std::vector<packedQuat<Bits>> packed(count);
+            std::vector<quat<float>> unpacked(count);
+            packedQuat<Bits>::pack(std::span<const quat<float>>(rots), std::span<packedQuat<Bits>>(packed));
+            packedQuat<Bits>::unpack(std::span<const packedQuat<Bits>>(packed), std::span<quat<float>>(unpacked));
+
+            double largestAngle = 0.0, largestAngleDouble = 0.0, largestLengthError = 0.0;
+            bool packMatches = true, unpackMatches = true;
+
+        #if defined(__FMA__)
+            const float unpackTolerance = 2.0f * ulp(1.0f);
+        #else
+            const float unpackTolerance = 0.0f;
+        #endif
+
+            for (std::size_t i = 0; i < count; i++)
+            {
+                packMatches &= packed[i] == packedQuat<Bits>(rots[i]);
+
+                quat<float> scalar = packed[i].template to<float>();
+                for (int c = 0; c < 4; c++)
+                {
+                    unpackMatches &= std::abs(unpacked[i].data[c] - scalar.data[c]) <= unpackTolerance;
+                }
+
+                largestAngle = std::max(largestAngle, angleBetween(rots[i], unpacked[i]));
+                largestLengthError = std::max(largestLengthError, lengthError(unpacked[i]));
+
+                if (i % 7 == 0)
+                {
+                    quat<double> unpackedDouble = packed[i].template to<double>();
+                    largestAngleDouble = std::max(largestAngleDouble, angleBetween(rots[i], unpackedDouble));
+                    largestLengthError = std::max(largestLengthError, lengthError(unpackedDouble));
+                }
+            }
+
+            check(packMatches, "packedQuat::pack matches the packedQuat constructor bit for bit");
+            check(unpackMatches, "packedQuat::unpack matches packedQuat::to");
+            check(largestAngle >= minAngle && largestAngle <= maxAngle, "packedQuat : the largest angular error, unpacked to quat<float>, is in its bounds");
+            check(largestAngleDouble <= maxAngleDouble, "packedQuat : the largest angular error, unpacked to quat<double>, is in its bounds");
+            check(largestLengthError <= 6e-8, "packedQuat : the unpacked quaternions are normalized within 6e-8");
+        }
+
+        // The 48 bits kernel loads 8 bytes per quaternion, so it leaves the last quaternion (and the rest of its block) to the caller,
+        // never reading past the end of packed. The others handle every whole block of 4
+        template<std::size_t Bits>
+        void unpackTailTests(const std::vector<quat<float>>& rots)
+        {
+            bool handled = true, matches = true;
+
+            for (std::size_t count : { 1, 3, 4, 5, 7, 8, 9, 12, 13 })
+            {
+                std::vector<packedQuat<Bits>> packed(count);
+                std::vector<quat<float>> unpacked(count);
+                packedQuat<Bits>::pack(std::span<const quat<float>>(rots).first(count), std::span<packedQuat<Bits>>(packed));
+
+                if constexpr (simd::hasPackedQuatKernel<float>)
+                {
+                    std::size_t expected = Bits == 48 ? (count - 1) / 4 * 4 : count / 4 * 4;
+                    handled &= simd::quatUnpackSmallestThree<Bits>(reinterpret_cast<const std::uint16_t*>(packed.data()), reinterpret_cast<float*>(unpacked.data()), count) == expected;
+                }
+
+                packedQuat<Bits>::unpack(std::span<const packedQuat<Bits>>(packed), std::span<quat<float>>(unpacked));
+                for (std::size_t i = 0; i < count; i++)
+                {
+                    matches &= angleBetween(packed[i].template to<float>(), unpacked[i]) < 1e-4;
+                }
+            }
+
+            check(handled, "packedQuat : the unpack kernel handles whole blocks of 4, and the 48 bits one stops one quaternion early");
+            check(matches, "packedQuat::unpack with 1 to 13 quaternions matches packedQuat::to");
+        }
+    }
+
+    void packedQuaternionTests()
+    {
+        std::vector<quat<float>> rots = unitQuats();
+
+        check(packedQuat<32>().to<float>() == quat<float>::identity(), "packedQuat : the default packed quaternion is the identity");
+
+        // The bounds of the documentation : about 0.25, 0.0080 and 0.00025 degrees (0.00024 degrees into quat<double>, float rounding aside)
+        packedQuatTests<32>(rots, 0.24, 0.26, 0.26);
+        packedQuatTests<48>(rots, 0.0070, 0.0081, 0.0080);
+        packedQuatTests<64>(rots, 0.00020, 0.00026, 0.00024);
+
+        unpackTailTests<32>(rots);
+        unpackTailTests<48>(rots);
+        unpackTailTests<64>(rots);
+    }
+}
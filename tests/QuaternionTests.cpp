@@ -0,0 +1,196 @@
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <span>
+#include <vector>
+
+#include "Vectors.hpp"
+#include "Quaternions.hpp"
+#include "FastMath.hpp"
+#include "Tests.hpp"
+
+namespace glMath::tests
+{
+    namespace
+    {
+        // fromEuler(span) against the scalar fromEuler, rotation by rotation. The counts cover one rotation, a partial block,
+        // whole blocks of 64 and a partial last block, whose sines and cosines must be computed for its rotations only
+        template<FloatingNumber F, MathPolicy P>
+        void fromEulerBatchTests(F tolerance)
+        {
+            std::mt19937 rng(19);
+            std::uniform_real_distribution<F> degrees(static_cast<F>(-360.0), static_cast<F>(360.0));
+
+            bool matches = true;
+
+            for (std::size_t count : { 1, 3, 64, 67, 200 })
+            {
+                std::vector<vec3<F>> rotations(count);
+                for (auto& rotation : rotations) rotation = vec3<F>(degrees(rng), degrees(rng), degrees(rng));
+
+                std::vector<quat<F>> batched(count);
+                quat<F>::template fromEuler<P>(rotations, batched);
+
+                for (std::size_t i = 0; i < count; i++)
+                {
+                    quat<F> scalar = quat<F>::template fromEuler<P>(rotations[i]);
+
+                    for (int c = 0; c < 4; c++)
+                    {
+                        matches &= std::abs(batched[i].data[c] - scalar.data[c]) <= tolerance;
+                    }
+                }
+            }
+
+            check(matches, "quat::fromEuler(span) matches the scalar fromEuler for 1, 3, 64, 67 and 200 rotations");
+        }
+
+        // sclerp between the identity and a turn of 1e-4 radians, small enough for the series weights :
+        // the interpolated rotation must turn by t times the angle
+        template<FloatingNumber F, MathPolicy P>
+        void sclerpSmallAngleTests(double tolerance)
+        {
+            const double angle = 1e-4;
+            const vec3<F> axis = vec3<F>(static_cast<F>(1.0), static_cast<F>(2.0), static_cast<F>(3.0)).normalize();
+
+            dualQuat<F> start = dualQuat<F>::identity();
+            dualQuat<F> end(quat<F>::fromAxisAngle(axis, sinCos<F>{ static_cast<F>(std::sin(angle / 2.0)), static_cast<F>(std::cos(angle / 2.0)) }));
+
+            bool matches = true;
+
+            for (double t : { 0.1, 0.3, 0.5, 0.9 })
+            {
+                quat<F> real = dualQuat<F>::template sclerp<P>(start, end, static_cast<F>(t)).real;
+
+                double sinHalf = std::sqrt(static_cast<double>(real.x) * real.x + static_cast<double>(real.y) * real.y + static_cast<double>(real.z) * real.z);
+                double turned = 2.0 * std::atan2(sinHalf, static_cast<double>(real.w));
+
+                matches &= std::abs(turned - t * angle) <= tolerance * t * angle;
+            }
+
+            check(matches, "dualQuat::sclerp turns by t times the angle for the small angles");
+        }
+
+        // q * (0, point) * conjugate(q) / |q|², the rotation as a product of quaternions, in double
+        template<FloatingNumber F>
+        vec3<double> referenceRotation(const quat<F>& q, const vec3<F>& point)
+        {
+            double w = q.w, x = q.x, y = q.y, z = q.z;
+            double px = point.x, py = point.y, pz = point.z;
+
+            // q * (0, point)
+            double rw = -x * px - y * py - z * pz;
+            double rx =  w * px + y * pz - z * py;
+            double ry =  w * py + z * px - x * pz;
+            double rz =  w * pz + x * py - y * px;
+
+            // * conjugate(q)
+            double lengthSq = w * w + x * x + y * y + z * z;
+
+            return vec3<double>((-rw * x + rx * w - ry * z + rz * y) / lengthSq,
+                                (-rw * y + ry * w - rz * x + rx * z) / lengthSq,
+                                (-rw * z + rz * w - rx * y + ry * x) / lengthSq);
+        }
+
+        template<FloatingNumber F>
+        bool closeTo(const vec3<F>& value, const vec3<double>& expected, double tolerance)
+        {
+            double bound = tolerance * std::max({ 1.0, std::abs(expected.x), std::abs(expected.y), std::abs(expected.z) });
+
+            return std::abs(value.x - expected.x) <= bound && std::abs(value.y - expected.y) <= bound && std::abs(value.z - expected.z) <= bound;
+        }
+
+        // Every rotatePoint overload, and rotatePoints(span) whose kernel rotates several points per step, 
+        // against the product of quaternions. The quaternions aren't unit ones, except for the assumeNormalized overloads
+        template<FloatingNumber F>
+        void rotatePointTests(double tolerance)
+        {
+            std::mt19937 rng(21);
+            std::uniform_real_distribution<F> values(static_cast<F>(-4.0), static_cast<F>(4.0));
+
+            bool overloads = true;
+            bool normalizedOverloads = true;
+
+            for (int i = 0; i < 100; i++)
+            {
+                quat<F> rot(values(rng), values(rng), values(rng), values(rng));
+                quat<F> unitRot = rot.getNormalizedQuat();
+                vec3<F> point(values(rng), values(rng), values(rng));
+
+                vec3<double> expected = referenceRotation(rot, point);
+
+                overloads &= closeTo(rot.rotatePoint(point), expected, tolerance);
+                overloads &= closeTo(quat<F>::rotatePoint(point, rot), expected, tolerance);
+                overloads &= closeTo(static_cast<vec3<F>>(rot.rotatePoint(vec3a<F>(point))), expected, tolerance);
+                overloads &= closeTo(static_cast<vec3<F>>(quat<F>::rotatePoint(vec3a<F>(point), rot)), expected, tolerance);
+
+                normalizedOverloads &= closeTo(unitRot.rotatePoint(point, assumeNormalized), expected, tolerance);
+                normalizedOverloads &= closeTo(quat<F>::rotatePoint(point, unitRot, assumeNormalized), expected, tolerance);
+                normalizedOverloads &= closeTo(static_cast<vec3<F>>(unitRot.rotatePoint(vec3a<F>(point), assumeNormalized)), expected, tolerance);
+                normalizedOverloads &= closeTo(static_cast<vec3<F>>(quat<F>::rotatePoint(vec3a<F>(point), unitRot, assumeNormalized)), 
+                                               expected, tolerance);
+            }
+
+            check(overloads, "quat::rotatePoint() on vec3 and vec3a matches the product of quaternions");
+            check(normalizedOverloads, "quat::rotatePoint(assumeNormalized) on vec3 and vec3a matches the product of quaternions");
+
+            // The counts end in partial steps of the kernel, the element past the span must be left untouched
+            bool batched = true;
+            bool batchedInPlace = true;
+            bool batchedNormalized = true;
+            bool batchedSpan = true;
+
+            const vec3<F> untouched(static_cast<F>(7.0));
+
+            for (std::size_t count : { 1, 3, 4, 5, 7, 8, 9, 17 })
+            {
+                quat<F> rot(values(rng), values(rng), values(rng), values(rng));
+                quat<F> unitRot = rot.getNormalizedQuat();
+
+                std::vector<vec3<F>> points(count);
+                for (auto& point : points) point = vec3<F>(values(rng), values(rng), values(rng));
+
+                std::vector<vec3<F>> results(count + 1, untouched);
+                rot.rotatePoints(points, std::span<vec3<F>>(results).first(count));
+
+                std::vector<vec3<F>> inPlace = points;
+                rot.rotatePoints(inPlace, inPlace);
+
+                std::vector<vec3<F>> normalizedResults(count);
+                unitRot.rotatePoints(points, normalizedResults, assumeNormalized);
+
+                for (std::size_t i = 0; i < count; i++)
+                {
+                    vec3<double> expected = referenceRotation(rot, points[i]);
+
+                    batched &= closeTo(results[i], expected, tolerance);
+                    batchedInPlace &= closeTo(inPlace[i], expected, tolerance);
+                    batchedNormalized &= closeTo(normalizedResults[i], expected, tolerance);
+                }
+
+                batchedSpan &= results[count] == untouched;
+            }
+
+            check(batched, "quat::rotatePoints() matches the product of quaternions");
+            check(batchedInPlace, "quat::rotatePoints() in place matches the product of quaternions");
+            check(batchedNormalized, "quat::rotatePoints(assumeNormalized) matches the product of quaternions");
+            check(batchedSpan, "quat::rotatePoints() writes only its span");
+        }
+    }
+
+    void quaternionTests()
+    {
+        // exactMath computes the same sines and cosines one by one, glMath::fast's kernels may round differently from its scalar version
+        fromEulerBatchTests<float, exactMath>(0.0f);
+        fromEulerBatchTests<double, exactMath>(0.0);
+        fromEulerBatchTests<float, fastMath>(1e-6f);
+        fromEulerBatchTests<double, fastMath>(1e-12);
+
+        sclerpSmallAngleTests<float, exactMath>(1e-6);
+        sclerpSmallAngleTests<double, exactMath>(1e-13);
+        sclerpSmallAngleTests<double, fastMath>(1e-13);
+
+        rotatePointTests<float>(1e-5);
+        rotatePointTests<double>(1e-13);
+    }
+}
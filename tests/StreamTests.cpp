@@ -0,0 +1,344 @@
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <span>
+#include <vector>
+
+#include "Vectors.hpp"
+#include "Quaternions.hpp"
+#include "Matrices.hpp"
+#include "Streams.hpp"
+#include "Transforms.hpp"
+#include "Tests.hpp"
+
+namespace glMath::tests
+{
+    namespace
+    {
+        // The counts of the stream tests : whole steps of the kernels (4 or 8 vectors), and partial last steps
+        constexpr std::size_t streamCounts[] = { 1, 3, 4, 7, 8, 9, 15, 17, 33 };
+
+        // value within tolerance of expected, relative to the magnitude of the values it was computed from
+        template<FloatingNumber F>
+        bool closeTo(F value, F expected, F magnitude, F tolerance)
+        {
+            return std::abs(value - expected) <= tolerance * std::max(static_cast<F>(1.0), magnitude);
+        }
+
+        template<FloatingNumber F, std::size_t N>
+        bool closeTo(const typename vecStream<F, N>::vecType& value, const typename vecStream<F, N>::vecType& expected, F magnitude, F tolerance)
+        {
+            for (std::size_t c = 0; c < N; c++)
+            {
+                if (!closeTo(value.data[c], expected.data[c], magnitude, tolerance)) return false;
+            }
+
+            return true;
+        }
+
+        // The largest absolute component of a vector
+        template<FloatingNumber F, std::size_t N>
+        F magnitudeOf(const typename vecStream<F, N>::vecType& vec)
+        {
+            F magnitude = static_cast<F>(0.0);
+            for (std::size_t c = 0; c < N; c++) magnitude = std::max(magnitude, std::abs(vec.data[c]));
+
+            return magnitude;
+        }
+
+        template<FloatingNumber F, std::size_t N>
+        std::vector<typename vecStream<F, N>::vecType> randomVectors(std::mt19937& rng, std::size_t count)
+        {
+            std::uniform_real_distribution<F> values(static_cast<F>(-4.0), static_cast<F>(4.0));
+
+            std::vector<typename vecStream<F, N>::vecType> vectors(count);
+            for (auto& vector : vectors)
+                for (std::size_t c = 0; c < N; c++) vector.data[c] = values(rng);
+
+            return vectors;
+        }
+
+        // Every function of vecStream against the same function on its vector type, vector by vector,
+        // for results written to another stream and to one of the operands
+        template<FloatingNumber F, std::size_t N>
+        void vecStreamTests(F tolerance)
+        {
+            using stream = vecStream<F, N>;
+            using vecType = typename stream::vecType;
+
+            std::mt19937 rng(13);
+            std::uniform_real_distribution<F> values(static_cast<F>(-4.0), static_cast<F>(4.0));
+
+            bool roundTrip = true;
+            bool dots = true;
+            bool lengths = true;
+            bool normalized = true;
+            bool normalizedFast = true;
+            bool lerps = true;
+            bool lerpsAliased = true;
+            bool minMax = true;
+
+            for (std::size_t count : streamCounts)
+            {
+                std::vector<vecType> as = randomVectors<F, N>(rng, count);
+                std::vector<vecType> bs = randomVectors<F, N>(rng, count);
+                // A zero vector, that normalize() leaves untouched
+                as[count / 2] = vecType();
+
+                stream a(as);
+                stream b(bs);
+
+                std::vector<vecType> stored(count);
+                a.store(stored);
+                for (std::size_t i = 0; i < count; i++) roundTrip &= stored[i] == as[i] && a.get(i) == as[i];
+
+                std::vector<F> dotResults(count);
+                stream::dotProduct(a, b, dotResults);
+
+                std::vector<F> lengthResults(count);
+                a.lengths(lengthResults);
+
+                stream normalizedStream = a;
+                normalizedStream.normalize();
+                stream normalizedFastStream = a;
+                normalizedFastStream.normalizeFast();
+
+                F t = (values(rng) + static_cast<F>(4.0)) / static_cast<F>(8.0);
+                stream lerpResults;
+                stream::lerp(a, b, t, lerpResults);
+                stream lerpAliased = a;
+                stream::lerpUnclamped(lerpAliased, b, t, lerpAliased);
+
+                stream minResults, maxResults;
+                stream::min(a, b, minResults);
+                stream::max(a, b, maxResults);
+
+                for (std::size_t i = 0; i < count; i++)
+                {
+                    F magnitude = magnitudeOf<F, N>(as[i]) * magnitudeOf<F, N>(bs[i]) * static_cast<F>(N);
+
+                    dots &= closeTo(dotResults[i], vecType::dotProduct(as[i], bs[i]), magnitude, tolerance);
+                    lengths &= closeTo(lengthResults[i], as[i].length(), magnitudeOf<F, N>(as[i]), tolerance);
+
+                    vecType expected = as[i] == vecType() ? as[i] : as[i].getNormalizedVec();
+                    normalized &= closeTo<F, N>(normalizedStream.get(i), expected, static_cast<F>(1.0), tolerance);
+
+                    // The fast normalize is only within 5e-7 of a unit length with floats
+                    F fastTolerance = std::max(tolerance, static_cast<F>(1e-6));
+                    normalizedFast &= closeTo<F, N>(normalizedFastStream.get(i), expected, static_cast<F>(1.0), fastTolerance);
+
+                    F lerpMagnitude = std::max(magnitudeOf<F, N>(as[i]), magnitudeOf<F, N>(bs[i]));
+                    lerps &= closeTo<F, N>(lerpResults.get(i), vecType::lerp(as[i], bs[i], t), lerpMagnitude, tolerance);
+                    lerpsAliased &= closeTo<F, N>(lerpAliased.get(i), vecType::lerpUnclamped(as[i], bs[i], t), lerpMagnitude, tolerance);
+
+                    minMax &= minResults.get(i) == vecType::min(as[i], bs[i]) && maxResults.get(i) == vecType::max(as[i], bs[i]);
+                }
+            }
+
+            check(roundTrip, "vecStream : load, store and get give back the vectors");
+            check(dots, "vecStream::dotProduct() matches the vectors");
+            check(lengths, "vecStream::lengths() matches the vectors");
+            check(normalized, "vecStream::normalize() matches the vectors, and leaves the zero vectors untouched");
+            check(normalizedFast, "vecStream::normalizeFast() matches the vectors, and leaves the zero vectors untouched");
+            check(lerps, "vecStream::lerp() matches the vectors");
+            check(lerpsAliased, "vecStream::lerpUnclamped() into its start matches the vectors");
+            check(minMax, "vecStream::min() and max() match the vectors");
+        }
+
+        // crossProduct() and the transforms of vec3Stream, and transform() of vec4Stream, against vec3, vec4 and mat4
+        template<FloatingNumber F>
+        void vecStreamTransformTests(F tolerance)
+        {
+            std::mt19937 rng(31);
+            std::uniform_real_distribution<F> values(static_cast<F>(-4.0), static_cast<F>(4.0));
+
+            mat4<F> mat = mat4<F>::identity();
+            for (int col = 0; col < 4; col++)
+                for (int row = 0; row < 3; row++) mat.columns[col][row] = values(rng);
+
+            // The projected points are in front of the camera, so their w is between 1 and 10
+            mat4<F> projection = mat4<F>::perspective(static_cast<F>(1.2), static_cast<F>(1.5), static_cast<F>(0.1), static_cast<F>(100.0));
+
+            bool crosses = true;
+            bool crossesAliased = true;
+            bool points = true;
+            bool pointsInPlace = true;
+            bool projected = true;
+            bool directions = true;
+            bool transformed = true;
+
+            for (std::size_t count : streamCounts)
+            {
+                std::vector<vec3<F>> as = randomVectors<F, 3>(rng, count);
+                std::vector<vec3<F>> bs = randomVectors<F, 3>(rng, count);
+                std::vector<vec4<F>> vec4s = randomVectors<F, 4>(rng, count);
+
+                std::vector<vec3<F>> depths = as;
+                for (auto& point : depths) point.z = static_cast<F>(-5.5) + point.z * static_cast<F>(1.125);
+
+                vec3Stream<F> a(as);
+                vec3Stream<F> b(bs);
+
+                vec3Stream<F> crossResults;
+                vec3Stream<F>::crossProduct(a, b, crossResults);
+                vec3Stream<F> crossAliased = b;
+                vec3Stream<F>::crossProduct(a, crossAliased, crossAliased);
+
+                vec3Stream<F> pointResults;
+                a.transformPoints(mat, pointResults);
+                vec3Stream<F> pointsAliased = a;
+                pointsAliased.transformPoints(mat, pointsAliased);
+
+                vec3Stream<F> projectedResults;
+                vec3Stream<F>(depths).transformPoints(projection, projectedResults, true);
+
+                vec3Stream<F> directionResults;
+                a.transformDirections(mat, directionResults);
+
+                vec4Stream<F> vec4Results;
+                vec4Stream<F>(vec4s).transform(mat, vec4Results);
+
+                for (std::size_t i = 0; i < count; i++)
+                {
+                    F magnitude = static_cast<F>(32.0);
+
+                    vec3<F> cross = vec3<F>::crossProduct(as[i], bs[i]);
+                    crosses &= closeTo<F, 3>(crossResults.get(i), cross, magnitude, tolerance);
+                    crossesAliased &= closeTo<F, 3>(crossAliased.get(i), cross, magnitude, tolerance);
+
+                    vec3<F> point = (mat * vec4<F>(as[i], static_cast<F>(1.0))).toVec3();
+                    points &= closeTo<F, 3>(pointResults.get(i), point, magnitude * static_cast<F>(2.0), tolerance);
+                    pointsInPlace &= closeTo<F, 3>(pointsAliased.get(i), point, magnitude * static_cast<F>(2.0), tolerance);
+
+                    vec4<F> clip = projection * vec4<F>(depths[i], static_cast<F>(1.0));
+                    projected &= closeTo<F, 3>(projectedResults.get(i), clip.toVec3() / clip.w, magnitude, tolerance);
+
+                    vec3<F> direction = (mat * vec4<F>(as[i], static_cast<F>(0.0))).toVec3();
+                    directions &= closeTo<F, 3>(directionResults.get(i), direction, magnitude * static_cast<F>(2.0), tolerance);
+
+                    transformed &= closeTo<F, 4>(vec4Results.get(i), mat * vec4s[i], magnitude * static_cast<F>(2.0), tolerance);
+                }
+            }
+
+            check(crosses, "vec3Stream::crossProduct() matches vec3::crossProduct()");
+            check(crossesAliased, "vec3Stream::crossProduct() into its right operand matches vec3::crossProduct()");
+            check(points, "vec3Stream::transformPoints() matches mat4 * vec4");
+            check(pointsInPlace, "vec3Stream::transformPoints() in place matches mat4 * vec4");
+            check(projected, "vec3Stream::transformPoints() with the perspective divide matches mat4 * vec4");
+            check(directions, "vec3Stream::transformDirections() matches mat4 * vec4");
+            check(transformed, "vec4Stream::transform() matches mat4 * vec4");
+        }
+
+        // Every element of a within tolerance of b, relative to the largest element of b. F* are the values of the matrices
+        template<FloatingNumber F>
+        bool closeTo(const F* a, const F* b, std::size_t valueCount, F tolerance)
+        {
+            F largest = static_cast<F>(1.0);
+            for (std::size_t i = 0; i < valueCount; i++) largest = std::max(largest, std::abs(b[i]));
+
+            for (std::size_t i = 0; i < valueCount; i++)
+            {
+                if (std::abs(a[i] - b[i]) > tolerance * largest) return false;
+            }
+
+            return true;
+        }
+
+        // The conversions of quatStream to matrices against quat::toMat4(), quat::toMat3() and transformHierarchy::composeTRS(),
+        // whose translation and scale are 0 and 1 when the stream isn't given them
+        template<FloatingNumber F>
+        void quatStreamMatrixTests(F tolerance)
+        {
+            std::mt19937 rng(22);
+            std::uniform_real_distribution<F> values(static_cast<F>(-4.0), static_cast<F>(4.0));
+            std::uniform_real_distribution<F> scaleValues(static_cast<F>(0.5), static_cast<F>(2.0));
+
+            const vec3<F> zero(static_cast<F>(0.0));
+            const vec3<F> one(static_cast<F>(1.0));
+
+            bool mat4s = true;
+            bool mat3x4s = true;
+            bool mat3s = true;
+            bool spans = true;
+
+            for (std::size_t count : streamCounts)
+            {
+                std::vector<quat<F>> rotations(count);
+                std::vector<vec3<F>> translations(count);
+                std::vector<vec3<F>> scales(count);
+
+                for (std::size_t i = 0; i < count; i++)
+                {
+                    rotations[i] = quat<F>(values(rng), values(rng), values(rng), values(rng)).normalize();
+                    translations[i] = vec3<F>(values(rng), values(rng), values(rng));
+                    scales[i] = vec3<F>(scaleValues(rng), scaleValues(rng), scaleValues(rng));
+                }
+
+                quatStream<F> stream(rotations);
+                vec3Stream<F> translationStream(translations);
+                vec3Stream<F> scaleStream(scales);
+
+                // One more matrix than the stream, which must be left untouched
+                std::vector<mat4<F>> rotationMats(count + 1, mat4<F>::identity()), translatedMats(count), transformMats(count);
+                stream.toMat4(std::span<mat4<F>>(rotationMats).first(count));
+                stream.toMat4(translationStream, translatedMats);
+                stream.toMat4(translationStream, scaleStream, transformMats);
+
+                std::vector<mat3x4<F>> rotation3x4s(count + 1, mat3x4<F>::identity()), translated3x4s(count), transform3x4s(count);
+                stream.toMat3x4(std::span<mat3x4<F>>(rotation3x4s).first(count));
+                stream.toMat3x4(translationStream, translated3x4s);
+                stream.toMat3x4(translationStream, scaleStream, transform3x4s);
+
+                std::vector<mat3<F>> rotationMat3s(count + 1, mat3<F>::identity()), scaledMat3s(count);
+                stream.toMat3(std::span<mat3<F>>(rotationMat3s).first(count));
+                stream.toMat3(scaleStream, scaledMat3s);
+
+                for (std::size_t i = 0; i < count; i++)
+                {
+                    mat4<F> rotation = rotations[i].toMat4();
+                    mat4<F> translated = transformHierarchy<F>::composeTRS(translations[i], rotations[i], one);
+                    mat4<F> transform = transformHierarchy<F>::composeTRS(translations[i], rotations[i], scales[i]);
+                    mat4<F> scaled = transformHierarchy<F>::composeTRS(zero, rotations[i], scales[i]);
+
+                    mat4s &= closeTo(rotationMats[i].indices, rotation.indices, 16, tolerance);
+                    mat4s &= closeTo(translatedMats[i].indices, translated.indices, 16, tolerance);
+                    mat4s &= closeTo(transformMats[i].indices, transform.indices, 16, tolerance);
+
+                    mat3x4s &= closeTo(rotation3x4s[i].indices, mat3x4<F>::fromMat4(rotation).indices, 12, tolerance);
+                    mat3x4s &= closeTo(translated3x4s[i].indices, mat3x4<F>::fromMat4(translated).indices, 12, tolerance);
+                    mat3x4s &= closeTo(transform3x4s[i].indices, mat3x4<F>::fromMat4(transform).indices, 12, tolerance);
+
+                    mat3<F> rotation3 = rotations[i].toMat3();
+                    mat3<F> scaled3 = scaled.toMat3();
+
+                    mat3s &= closeTo(&rotationMat3s[i].columns[0][0], &rotation3.columns[0][0], 9, tolerance);
+                    mat3s &= closeTo(&scaledMat3s[i].columns[0][0], &scaled3.columns[0][0], 9, tolerance);
+                }
+
+                spans &= rotationMats[count] == mat4<F>::identity() && rotation3x4s[count] == mat3x4<F>::identity() 
+                      && rotationMat3s[count] == mat3<F>::identity();
+            }
+
+            check(mat4s, "quatStream::toMat4() matches quat::toMat4() and composeTRS()");
+            check(mat3x4s, "quatStream::toMat3x4() matches quat::toMat4() and composeTRS()");
+            check(mat3s, "quatStream::toMat3() matches quat::toMat3() and composeTRS()");
+            check(spans, "quatStream::toMat4(), toMat3x4() and toMat3() write only their span");
+        }
+    }
+
+    void streamTests()
+    {
+        vecStreamTests<float, 2>(1e-5f);
+        vecStreamTests<float, 3>(1e-5f);
+        vecStreamTests<float, 4>(1e-5f);
+        vecStreamTests<double, 2>(1e-13);
+        vecStreamTests<double, 3>(1e-13);
+        vecStreamTests<double, 4>(1e-13);
+
+        vecStreamTransformTests<float>(1e-5f);
+        vecStreamTransformTests<double>(1e-13);
+
+        quatStreamMatrixTests<float>(1e-6f);
+        quatStreamMatrixTests<double>(1e-14);
+    }
+}
@@ -0,0 +1,36 @@
+#include <cstdio>
+
+#include "Dispatch.hpp"
+#include "Tests.hpp"
+
+int main()
+{
+    using namespace glMath;
+
+    // A build for an instruction set the CPU doesn't have : ctest reports the test as skipped
+#if defined(__AVX2__) && !defined(GLMATH_FORCE_SCALAR)
+    if (dispatch::detectedLevel() < simdLevel::avx2)
+    {
+        std::printf("glMath tests (%s) : skipped, the CPU doesn't support AVX2\n", tests::buildName());
+        return 77;
+    }
+#endif
+
+    std::printf("glMath tests (%s)\n", tests::buildName());
+
+    // The batched functions run the kernels compiled for the build, not the CPU's : dispatchTests() checks the other levels
+    dispatch::forceLevel(dispatch::compiledLevel());
+
+    tests::matrixTests();
+    tests::geometryTests();
+    tests::expressionTests();
+    tests::laneTests();
+    tests::quaternionTests();
+    tests::packedQuaternionTests();
+    tests::transformTests();
+    tests::streamTests();
+    tests::dispatchTests();
+
+    std::printf("%d failure(s)\n", tests::failureCount);
+    return tests::failureCount == 0 ? 0 : 1;
+}
@@ -0,0 +1,60 @@
+#pragma once
+
+#include <cmath>
+#include <concepts>
+#include <cstdio>
+#include <limits>
+#include <source_location>
+
+// The tests are compiled once per instruction set (see tests/CMakeLists.txt) : 
+// each SIMD kernel is compared to the scalar fallback it replaces, which the library keeps callable
+namespace glMath::tests
+{
+    inline int failureCount = 0;
+
+    /// @brief Counts and reports a failure when condition is false
+    /// @param what What is checked, printed with the file and the line of the call
+    inline bool check(bool condition, const char* what, const std::source_location location = std::source_location::current())
+    {
+        if (!condition)
+        {
+            failureCount++;
+            std::printf("  FAILED %s:%u : %s\n", location.file_name(), static_cast<unsigned>(location.line()), what);
+        }
+
+        return condition;
+    }
+
+    /// @brief The distance between |x| and the next representable value above it
+    template<std::floating_point F>
+    inline F ulp(F x)
+    {
+        x = std::abs(x);
+        return std::nextafter(x, std::numeric_limits<F>::infinity()) - x;
+    }
+
+    /// @brief The name of the instruction set the tests were compiled for
+    inline const char* buildName()
+    {
+    #if defined(GLMATH_FORCE_SCALAR)
+        return "scalar";
+    #elif defined(__AVX2__)
+        return "avx2";
+    #elif defined(__AVX__)
+        return "avx";
+    #else
+        return "sse2";
+    #endif
+    }
+
+    // One function per test file, called by TestMain.cpp
+    void matrixTests();
+    void geometryTests();
+    void expressionTests();
+    void laneTests();
+    void quaternionTests();
+    void packedQuaternionTests();
+    void transformTests();
+    void streamTests();
+    void dispatchTests();
+}
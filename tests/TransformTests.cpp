@@ -0,0 +1,135 @@
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include "Vectors.hpp"
+#include "Quaternions.hpp"
+#include "Matrices.hpp"
+#include "Transforms.hpp"
+#include "Tests.hpp"
+
+namespace glMath::tests
+{
+    namespace
+    {
+        // The world matrices recomputed from scratch : composeTRS for every node, times the world matrix of its parent
+        template<FloatingNumber F>
+        std::vector<mat4<F>> fullRecompute(const transformHierarchy<F>& hierarchy)
+        {
+            std::vector<mat4<F>> worldMats(hierarchy.size());
+
+            for (std::size_t i = 0; i < hierarchy.size(); i++)
+            {
+                mat4<F> local = transformHierarchy<F>::composeTRS(hierarchy.getLocalPosition(i), hierarchy.getLocalRotation(i), 
+                                                                  hierarchy.getLocalScale(i));
+                std::size_t parent = hierarchy.getParent(i);
+
+                worldMats[i] = parent == transformHierarchy<F>::noParent ? local : worldMats[parent] * local;
+            }
+
+            return worldMats;
+        }
+
+        // Every world matrix within tolerance of the full recompute, relative to its largest element.
+        // The kernels of operator* can be contracted into FMAs differently in the two, so they aren't compared bit to bit
+        template<FloatingNumber F>
+        bool matchesFullRecompute(const transformHierarchy<F>& hierarchy, F tolerance)
+        {
+            std::vector<mat4<F>> expected = fullRecompute(hierarchy);
+
+            for (std::size_t node = 0; node < hierarchy.size(); node++)
+            {
+                const mat4<F>& world = hierarchy.getWorldMat(node);
+
+                F largest = static_cast<F>(1.0);
+                for (int i = 0; i < 16; i++) largest = std::max(largest, std::abs(expected[node].indices[i]));
+
+                for (int i = 0; i < 16; i++)
+                {
+                    if (std::abs(world.indices[i] - expected[node].indices[i]) > tolerance * largest) return false;
+                }
+            }
+
+            return true;
+        }
+
+        template<FloatingNumber F>
+        void transformHierarchyTests(F tolerance)
+        {
+            using hierarchy = transformHierarchy<F>;
+
+            std::mt19937 rng(5);
+            std::uniform_real_distribution<F> values(static_cast<F>(-2.0), static_cast<F>(2.0));
+            std::uniform_real_distribution<F> scales(static_cast<F>(0.5), static_cast<F>(2.0));
+
+            auto randomPosition = [&]() { return vec3<F>(values(rng), values(rng), values(rng)); };
+            auto randomRotation = [&]() { return quat<F>(values(rng), values(rng), values(rng), values(rng)).normalize(); };
+            auto randomScale = [&]() { return vec3<F>(scales(rng), scales(rng), scales(rng)); };
+
+            // Two trees whose children aren't right after their parents :
+            //
+            // 0 ─┬─ 1 ─┬─ 3 ── 6 ── 8        4 ── 7
+            //    │     └─ 9
+            //    └─ 2 ── 5
+            const std::size_t parents[] = { hierarchy::noParent, 0, 0, 1, hierarchy::noParent, 2, 3, 4, 6, 1 };
+
+            hierarchy nodes;
+            for (std::size_t parent : parents) nodes.addNode(parent, randomPosition(), randomRotation(), randomScale());
+
+            nodes.updateWorldMats();
+            check(matchesFullRecompute(nodes, tolerance), "transformHierarchy : the first update matches a full recompute");
+
+            bool clean = true;
+            for (std::size_t i = 0; i < nodes.size(); i++) clean &= !nodes.isDirty(i);
+            check(clean, "transformHierarchy : no node is dirty after an update");
+
+            // A dirty node with clean descendants : 1 moves, so 3, 6, 8 and 9 move with it, and the other tree is left untouched
+            mat4<F> otherTree = nodes.getWorldMat(7);
+            mat4<F> sibling = nodes.getWorldMat(5);
+
+            nodes.setLocalPosition(1, randomPosition());
+            nodes.updateWorldMats();
+
+            check(matchesFullRecompute(nodes, tolerance), "transformHierarchy : a dirty node with clean descendants matches a full recompute");
+            check(nodes.getWorldMat(7) == otherTree && nodes.getWorldMat(5) == sibling, 
+                  "transformHierarchy : the nodes outside the dirty subtree are left untouched");
+
+            // Several dirty nodes in different subtrees, one of them a leaf
+            nodes.setLocalRotation(8, randomRotation());
+            nodes.setLocalScale(2, randomScale());
+            nodes.setLocalTransform(4, randomPosition(), randomRotation(), randomScale());
+            nodes.updateWorldMats();
+
+            check(matchesFullRecompute(nodes, tolerance), "transformHierarchy : several dirty subtrees match a full recompute");
+
+            // Reparenting : a leaf under the other tree, a subtree under another branch, and a node made a root
+            nodes.setParent(5, 4);
+            nodes.setParent(3, 2);
+            nodes.setParent(9, hierarchy::noParent);
+
+            check(nodes.getParent(5) == 4 && nodes.getParent(3) == 2 && nodes.getParent(9) == hierarchy::noParent,
+                  "transformHierarchy::setParent() changes the parents");
+            check(nodes.isDirty(3) && !nodes.isDirty(6), "transformHierarchy::setParent() marks only the node dirty");
+
+            nodes.updateWorldMats();
+            check(matchesFullRecompute(nodes, tolerance), "transformHierarchy : reparented nodes and their subtrees match a full recompute");
+
+            // A node marked dirty without any change
+            nodes.markDirty(6);
+            nodes.updateWorldMats();
+            check(matchesFullRecompute(nodes, tolerance), "transformHierarchy : markDirty() matches a full recompute");
+
+            // A node added under a clean one
+            nodes.addNode(8, randomPosition(), randomRotation(), randomScale());
+            nodes.updateWorldMats();
+            check(matchesFullRecompute(nodes, tolerance), "transformHierarchy : a node added under a clean one matches a full recompute");
+        }
+    }
+
+    void transformTests()
+    {
+        transformHierarchyTests<float>(1e-5f);
+        transformHierarchyTests<double>(1e-13);
+    }
+}